@@ -11,6 +11,8 @@
 
 #include "core/bridge.hpp"
 #include "core/algorithm_manager.hpp"
+#include "core/trace.hpp"
+#include "core/log.hpp"
 #include "sim/local_simulator.hpp"
 #include "world_tick.pb.h"
 #include "plan_update.pb.h"
@@ -26,6 +28,9 @@ struct CommandLineArgs {
   std::string ws_url;
   std::string room_id;
   std::string config_file;
+  std::string trace_file;        // 非空时记录 Chrome trace
+  std::string log_level;         // 非空时覆盖运行期日志级别
+  std::string record_file;       // 非空时记录 WorldTick 日志（覆盖配置文件中的 record_file）
 
   bool is_valid() const {
     if (use_local_sim) {
@@ -57,6 +62,9 @@ void print_usage(const char* prog) {
   std::cerr << "Usage: " << std::endl;
   std::cerr << "  WebSocket mode: " << prog << " <ws_url> <room_id> [--config=<path>]" << std::endl;
   std::cerr << "  Local sim mode: " << prog << " --local-sim --scenario=<scene_file> [--config=<path>]" << std::endl;
+  std::cerr << "  Options:        --trace=<file>  Record a Chrome/Perfetto trace (chrome://tracing)" << std::endl;
+  std::cerr << "                  --log-level=<debug|info|warn|error|off>  Runtime log level (default: info)" << std::endl;
+  std::cerr << "                  --record=<file>  Record WorldTick/PlanUpdate stream for navsim_replay" << std::endl;
   std::cerr << std::endl;
   std::cerr << "Examples:" << std::endl;
   std::cerr << "  # WebSocket online mode (scene from frontend)" << std::endl;
@@ -100,6 +108,33 @@ bool load_config_from_file(const std::string& config_path, navsim::AlgorithmMana
       if (algo.contains("goal_hold_distance_")) {
         config.goal_hold_distance = algo["goal_hold_distance_"].get<double>();
       }
+      if (algo.contains("loop_rate_hz")) {
+        config.loop_rate_hz = algo["loop_rate_hz"].get<double>();
+      }
+      if (algo.contains("loop_catch_up_policy")) {
+        config.loop_catch_up_policy = algo["loop_catch_up_policy"].get<std::string>();
+      }
+      if (algo.contains("loop_max_burst_ticks")) {
+        config.loop_max_burst_ticks = algo["loop_max_burst_ticks"].get<int>();
+      }
+      if (algo.contains("metrics_output_file")) {
+        config.metrics_output_file = algo["metrics_output_file"].get<std::string>();
+      }
+      if (algo.contains("metrics_dump_interval_s")) {
+        config.metrics_dump_interval_s = algo["metrics_dump_interval_s"].get<double>();
+      }
+      if (algo.contains("record_file")) {
+        config.record_file = algo["record_file"].get<std::string>();
+      }
+      if (algo.contains("record_flush_interval")) {
+        config.record_flush_interval = algo["record_flush_interval"].get<int>();
+      }
+      if (algo.contains("worker_threads")) {
+        config.worker_threads = algo["worker_threads"].get<int>();
+      }
+      if (algo.contains("worker_cpu_affinity")) {
+        config.worker_cpu_affinity = algo["worker_cpu_affinity"].get<std::vector<int>>();
+      }
     }
 
     // 🔧 读取栅格地图配置
@@ -157,6 +192,12 @@ bool parse_command_line(int argc, char* argv[], CommandLineArgs& args) {
         args.scenario_file = arg.substr(11);
       } else if (arg.find("--config=") == 0) {
         args.config_file = arg.substr(9);
+      } else if (arg.find("--trace=") == 0) {
+        args.trace_file = arg.substr(8);
+      } else if (arg.find("--log-level=") == 0) {
+        args.log_level = arg.substr(12);
+      } else if (arg.find("--record=") == 0) {
+        args.record_file = arg.substr(9);
       } else if (arg == "--local-sim") {
         // Already handled
         continue;
@@ -179,6 +220,12 @@ bool parse_command_line(int argc, char* argv[], CommandLineArgs& args) {
       std::string arg = argv[i];
       if (arg.find("--config=") == 0) {
         args.config_file = arg.substr(9);
+      } else if (arg.find("--trace=") == 0) {
+        args.trace_file = arg.substr(8);
+      } else if (arg.find("--log-level=") == 0) {
+        args.log_level = arg.substr(12);
+      } else if (arg.find("--record=") == 0) {
+        args.record_file = arg.substr(9);
       }
     }
   }
@@ -228,6 +275,9 @@ int run_local_simulation(const CommandLineArgs& args) {
     algo_config.config_file = args.config_file;
     navsim::load_config_from_file(args.config_file, algo_config);
   }
+  if (!args.record_file.empty()) {
+    algo_config.record_file = args.record_file;
+  }
 
   navsim::AlgorithmManager algorithm_manager;
   if (!algorithm_manager.initialize_with_simulator(algo_config)) {
@@ -290,6 +340,9 @@ int run_websocket_mode(const CommandLineArgs& args) {
     algo_config.config_file = args.config_file;
     navsim::load_config_from_file(args.config_file, algo_config);
   }
+  if (!args.record_file.empty()) {
+    algo_config.record_file = args.record_file;
+  }
 
   navsim::AlgorithmManager algorithm_manager;
   if (!algorithm_manager.initialize_with_simulator(algo_config)) {
@@ -447,10 +500,26 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  // 根据模式分发
-  if (args.use_local_sim) {
-    return navsim::run_local_simulation(args);
-  } else {
-    return navsim::run_websocket_mode(args);
+  if (!args.log_level.empty()) {
+    navsim::log::Level level;
+    if (!navsim::log::parseLevel(args.log_level, level)) {
+      std::cerr << "Unknown log level: " << args.log_level << std::endl;
+      return 1;
+    }
+    navsim::log::Logger::setLevel(level);
   }
+
+  auto& tracer = navsim::trace::Tracer::instance();
+  if (!args.trace_file.empty()) {
+    if (!tracer.start(args.trace_file)) {
+      return 1;
+    }
+    tracer.setThreadName("main");
+  }
+
+  // 根据模式分发
+  int result = args.use_local_sim ? navsim::run_local_simulation(args)
+                                  : navsim::run_websocket_mode(args);
+  tracer.stop();
+  return result;
 }
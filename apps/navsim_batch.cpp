@@ -0,0 +1,454 @@
+/**
+ * @file navsim_batch.cpp
+ * @brief 无界面批量仿真工具 - 以快于实时的速度并行回归大量场景
+ *
+ * 功能：
+ * - 通过 LocalSimulator::load_scenario 加载场景（文件或目录下的 *.json）
+ * - 以固定仿真步长锁步推进，不休眠、不打开窗口（NullVisualizer）
+ * - 多个工作线程并行执行，每个线程独立持有仿真器和插件实例（插件状态均为实例级）
+ * - 输出每个场景的成功与否、到达终点用时、碰撞次数和规划耗时分位数
+ *
+ * 使用示例：
+ * ```bash
+ * ./navsim_batch scenarios/ --config=config/default.json --workers=8 --output=report.json
+ * ./navsim_batch scenarios/a.json scenarios/b.json --timeout=30 --dt=0.05
+ * ./navsim_batch scenarios/ --record-dir=logs/   # 供 navsim_replay 离线回放
+ * ```
+ */
+
+#include "core/algorithm_manager.hpp"
+#include "sim/local_simulator.hpp"
+#include "core/trace.hpp"
+#include "core/log.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace navsim;
+
+namespace {
+
+// ========== 命令行参数 ==========
+
+struct CommandLineArgs {
+  std::vector<std::string> scenario_files;
+  std::string config_file;
+  std::string output_file;
+  std::string trace_file;       // 非空时记录 Chrome trace
+  std::string record_dir;       // 非空时每个场景记录一份 WorldTick 日志
+  int workers = 0;              // 0 = 硬件线程数
+  double dt = 1.0 / 30.0;       // 每步仿真时间 (s)
+  double timeout = 60.0;        // 单个场景最长仿真时间 (s)
+  bool verbose = false;         // 保留各模块的 stdout 日志
+};
+
+void print_usage(const char* program_name) {
+  std::cout << "Usage: " << program_name << " <scenario.json|dir>... [options]\n"
+            << "\n"
+            << "Options:\n"
+            << "  --config=<file>    Plugin configuration file (default: built-in defaults)\n"
+            << "  --workers=<n>      Number of worker threads (default: hardware concurrency)\n"
+            << "  --dt=<seconds>     Simulated time per step (default: 0.0333)\n"
+            << "  --timeout=<sec>    Max simulated time per scenario (default: 60)\n"
+            << "  --output=<file>    Write JSON report to file\n"
+            << "  --trace=<file>     Record a Chrome/Perfetto trace of all workers\n"
+            << "  --record-dir=<dir> Record <dir>/<scenario>.ticklog per scenario for navsim_replay\n"
+            << "  --verbose          Keep per-module logs on stdout\n"
+            << "  --log-level=<lvl>  Runtime log level: debug|info|warn|error|off (default: info)\n"
+            << "  --help             Show this help" << std::endl;
+}
+
+bool collect_scenarios(const std::string& path, std::vector<std::string>& files) {
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  if (fs::is_directory(path, ec)) {
+    std::vector<std::string> found;
+    for (const auto& entry : fs::directory_iterator(path, ec)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".json") {
+        found.push_back(entry.path().string());
+      }
+    }
+    std::sort(found.begin(), found.end());
+    files.insert(files.end(), found.begin(), found.end());
+    return true;
+  }
+  if (fs::is_regular_file(path, ec)) {
+    files.push_back(path);
+    return true;
+  }
+  std::cerr << "Scenario path not found: " << path << std::endl;
+  return false;
+}
+
+bool parse_arguments(int argc, char** argv, CommandLineArgs& args) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      return false;
+    } else if (arg.find("--config=") == 0) {
+      args.config_file = arg.substr(9);
+    } else if (arg.find("--output=") == 0) {
+      args.output_file = arg.substr(9);
+    } else if (arg.find("--trace=") == 0) {
+      args.trace_file = arg.substr(8);
+    } else if (arg.find("--record-dir=") == 0) {
+      args.record_dir = arg.substr(13);
+    } else if (arg.find("--workers=") == 0) {
+      args.workers = std::stoi(arg.substr(10));
+    } else if (arg.find("--dt=") == 0) {
+      args.dt = std::stod(arg.substr(5));
+    } else if (arg.find("--timeout=") == 0) {
+      args.timeout = std::stod(arg.substr(10));
+    } else if (arg == "--verbose") {
+      args.verbose = true;
+    } else if (arg.find("--log-level=") == 0) {
+      navsim::log::Level level;
+      if (!navsim::log::parseLevel(arg.substr(12), level)) {
+        std::cerr << "Unknown log level: " << arg.substr(12) << std::endl;
+        return false;
+      }
+      navsim::log::Logger::setLevel(level);
+    } else if (arg.find("--") == 0) {
+      std::cerr << "Unknown argument: " << arg << std::endl;
+      return false;
+    } else if (!collect_scenarios(arg, args.scenario_files)) {
+      return false;
+    }
+  }
+
+  if (args.scenario_files.empty()) {
+    std::cerr << "No scenarios given" << std::endl;
+    return false;
+  }
+  if (args.dt <= 0.0 || args.timeout <= 0.0) {
+    std::cerr << "--dt and --timeout must be positive" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// ========== 场景结果 ==========
+
+struct ScenarioResult {
+  std::string scenario;
+  bool success = false;           // 到达终点
+  bool timed_out = false;
+  std::string error;              // 加载或步进失败原因
+  double time_to_goal_s = 0.0;    // 到达终点时的仿真时间
+  double sim_time_s = 0.0;        // 结束时的仿真时间
+  int steps = 0;
+  int collisions = 0;             // 进入碰撞状态的次数
+  int planning_failures = 0;
+  double wall_time_ms = 0.0;
+  std::vector<double> planning_latencies_ms;
+};
+
+/**
+ * @brief 最近秩分位数（输入需已排序）
+ */
+double percentile(const std::vector<double>& sorted, double quantile) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  size_t rank = static_cast<size_t>(std::ceil(quantile * sorted.size()));
+  rank = std::clamp<size_t>(rank, 1, sorted.size());
+  return sorted[rank - 1];
+}
+
+nlohmann::json latency_summary(std::vector<double> latencies) {
+  std::sort(latencies.begin(), latencies.end());
+  nlohmann::json summary;
+  summary["samples"] = latencies.size();
+  summary["p50_ms"] = percentile(latencies, 0.50);
+  summary["p90_ms"] = percentile(latencies, 0.90);
+  summary["p99_ms"] = percentile(latencies, 0.99);
+  summary["max_ms"] = latencies.empty() ? 0.0 : latencies.back();
+  return summary;
+}
+
+nlohmann::json to_json(const ScenarioResult& result) {
+  nlohmann::json j;
+  j["scenario"] = result.scenario;
+  j["success"] = result.success;
+  j["timed_out"] = result.timed_out;
+  if (!result.error.empty()) {
+    j["error"] = result.error;
+  }
+  j["time_to_goal_s"] = result.success ? nlohmann::json(result.time_to_goal_s) : nlohmann::json(nullptr);
+  j["sim_time_s"] = result.sim_time_s;
+  j["steps"] = result.steps;
+  j["collisions"] = result.collisions;
+  j["planning_failures"] = result.planning_failures;
+  j["wall_time_ms"] = result.wall_time_ms;
+  j["planning_latency"] = latency_summary(result.planning_latencies_ms);
+  return j;
+}
+
+// ========== 工作线程 ==========
+
+class BatchWorker {
+public:
+  BatchWorker(const CommandLineArgs& args, const AlgorithmManager::Config& config)
+      : args_(args), config_(config) {}
+
+  bool initialize() {
+    return manager_.initialize_with_simulator(config_);
+  }
+
+  ScenarioResult run(const std::string& scenario_file) {
+    ScenarioResult result;
+    result.scenario = scenario_file;
+    auto wall_start = std::chrono::steady_clock::now();
+
+    sim::SimulatorConfig sim_config;
+    sim_config.time_step = 0.01;
+    sim_config.time_scale = 1.0;
+    sim_config.enable_adaptive_stepping = false;
+
+    auto simulator = std::make_shared<sim::LocalSimulator>();
+    if (!simulator->initialize(sim_config) || !simulator->load_scenario(scenario_file)) {
+      result.error = "Failed to load scenario";
+      return result;
+    }
+
+    manager_.set_local_simulator(simulator);
+    manager_.set_current_scenario(scenario_file);
+    if (!args_.record_dir.empty()) {
+      manager_.setRecordFile(
+          (std::filesystem::path(args_.record_dir) /
+           (std::filesystem::path(scenario_file).stem().string() + ".ticklog")).string());
+    }
+    manager_.reset();
+    manager_.startSimulation();
+
+    // 仿真时间可能因回放结束而推进较慢，步数上限防止死循环
+    const int max_steps = static_cast<int>(std::ceil(args_.timeout / args_.dt)) * 4 + 1;
+    bool in_collision = false;
+
+    while (simulator->get_simulation_time() < args_.timeout && result.steps < max_steps) {
+      int processed_before = manager_.getStatistics().successful_processed;
+
+      if (!manager_.process_simulation_step(args_.dt)) {
+        result.error = "Simulation step failed";
+        break;
+      }
+      result.steps++;
+
+      auto stats = manager_.getStatistics();
+      if (stats.successful_processed > processed_before) {
+        result.planning_latencies_ms.push_back(stats.last_planning_time_ms);
+      }
+
+      bool colliding = simulator->check_collision();
+      if (colliding && !in_collision) {
+        result.collisions++;
+      }
+      in_collision = colliding;
+
+      if (manager_.isGoalReached(simulator->get_world_state())) {
+        result.success = true;
+        result.time_to_goal_s = simulator->get_simulation_time();
+        break;
+      }
+
+      // 轨迹回放结束但未到达终点时，仿真会自动暂停；继续仿真以触发重新规划
+      if (manager_.isSimulationPaused()) {
+        manager_.startSimulation();
+      }
+    }
+
+    if (!result.success && result.error.empty()) {
+      result.timed_out = true;
+    }
+
+    result.planning_failures = manager_.getStatistics().planning_failures;
+    result.sim_time_s = simulator->get_simulation_time();
+    result.wall_time_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - wall_start).count();
+    return result;
+  }
+
+private:
+  const CommandLineArgs& args_;
+  AlgorithmManager::Config config_;
+  AlgorithmManager manager_;
+};
+
+AlgorithmManager::Config make_algorithm_config(const CommandLineArgs& args) {
+  AlgorithmManager::Config config;
+  config.enable_visualization = false;
+  config.verbose_logging = false;
+  config.config_file = args.config_file;
+
+  if (!args.config_file.empty()) {
+    std::ifstream file(args.config_file);
+    if (file.is_open()) {
+      try {
+        nlohmann::json j;
+        file >> j;
+        if (j.contains("algorithm")) {
+          const auto& algo = j["algorithm"];
+          config.max_computation_time_ms = algo.value("max_computation_time_ms", config.max_computation_time_ms);
+          config.goal_hold_distance = algo.value("goal_hold_distance_", config.goal_hold_distance);
+          config.worker_threads = algo.value("worker_threads", config.worker_threads);
+          config.worker_cpu_affinity = algo.value("worker_cpu_affinity", config.worker_cpu_affinity);
+        }
+      } catch (const std::exception& e) {
+        std::cerr << "Failed to parse config file: " << e.what() << std::endl;
+      }
+    }
+  }
+  return config;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  CommandLineArgs args;
+  if (!parse_arguments(argc, argv, args)) {
+    print_usage(argv[0]);
+    return 2;
+  }
+
+  int worker_count = args.workers > 0
+      ? args.workers
+      : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  worker_count = std::min<int>(worker_count, static_cast<int>(args.scenario_files.size()));
+
+  std::cerr << "[navsim_batch] " << args.scenario_files.size() << " scenarios, "
+            << worker_count << " workers, dt=" << args.dt << "s, timeout=" << args.timeout << "s"
+            << std::endl;
+
+  if (!args.trace_file.empty() && !navsim::trace::Tracer::instance().start(args.trace_file)) {
+    return 2;
+  }
+
+  if (!args.record_dir.empty()) {
+    std::error_code ec;
+    std::filesystem::create_directories(args.record_dir, ec);
+    if (ec) {
+      std::cerr << "Failed to create record directory " << args.record_dir << ": " << ec.message() << std::endl;
+      return 2;
+    }
+  }
+
+  // 默认屏蔽各模块的 stdout 日志，报告在恢复后输出
+  std::ofstream null_stream;
+  std::streambuf* original_cout = std::cout.rdbuf();
+  if (!args.verbose) {
+    // 日志写出线程改写到空流，避免与下面替换 std::cout 缓冲区产生竞争
+    navsim::log::Logger::instance().setOutput(null_stream, std::cerr);
+    std::cout.rdbuf(null_stream.rdbuf());
+  }
+
+  const auto algo_config = make_algorithm_config(args);
+  std::vector<ScenarioResult> results(args.scenario_files.size());
+  std::atomic<size_t> next_index{0};
+  std::atomic<size_t> completed{0};
+  auto batch_start = std::chrono::steady_clock::now();
+
+  auto worker_main = [&](int worker_id) {
+    if (navsim::trace::Tracer::enabled()) {
+      navsim::trace::Tracer::instance().setThreadName("worker_" + std::to_string(worker_id));
+    }
+    BatchWorker worker(args, algo_config);
+    if (!worker.initialize()) {
+      std::cerr << "[navsim_batch] Failed to initialize worker" << std::endl;
+      return;
+    }
+
+    for (size_t index = next_index.fetch_add(1); index < results.size();
+         index = next_index.fetch_add(1)) {
+      results[index] = worker.run(args.scenario_files[index]);
+      size_t done = completed.fetch_add(1) + 1;
+      std::cerr << "[navsim_batch] (" << done << "/" << results.size() << ") "
+                << (results[index].success ? "OK     " : "FAILED ") << results[index].scenario
+                << std::endl;
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (int i = 0; i < worker_count; ++i) {
+    workers.emplace_back(worker_main, i);
+  }
+  for (auto& thread : workers) {
+    thread.join();
+  }
+
+  std::cout.rdbuf(original_cout);
+  navsim::log::Logger::instance().setOutput(std::cout, std::cerr);
+  navsim::trace::Tracer::instance().stop();
+
+  double batch_wall_ms = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - batch_start).count();
+
+  // ========== 汇总 ==========
+  nlohmann::json report;
+  report["scenarios"] = nlohmann::json::array();
+  std::vector<double> all_latencies;
+  size_t success_count = 0;
+  int total_collisions = 0;
+  double total_time_to_goal = 0.0;
+  double total_sim_time = 0.0;
+
+  for (auto& result : results) {
+    if (result.scenario.empty()) {
+      result.error = "Not executed";
+    }
+    report["scenarios"].push_back(to_json(result));
+    if (result.success) {
+      success_count++;
+      total_time_to_goal += result.time_to_goal_s;
+    }
+    total_collisions += result.collisions;
+    total_sim_time += result.sim_time_s;
+    all_latencies.insert(all_latencies.end(),
+                         result.planning_latencies_ms.begin(), result.planning_latencies_ms.end());
+  }
+
+  nlohmann::json summary;
+  summary["total_scenarios"] = results.size();
+  summary["success_count"] = success_count;
+  summary["success_rate"] = results.empty() ? 0.0 : static_cast<double>(success_count) / results.size();
+  summary["avg_time_to_goal_s"] = success_count > 0 ? total_time_to_goal / success_count : 0.0;
+  summary["total_collisions"] = total_collisions;
+  summary["workers"] = worker_count;
+  summary["wall_time_ms"] = batch_wall_ms;
+  summary["real_time_factor"] = batch_wall_ms > 0.0 ? total_sim_time * 1000.0 / batch_wall_ms : 0.0;
+  summary["planning_latency"] = latency_summary(all_latencies);
+  report["summary"] = summary;
+
+  std::cout << "=== NavSim Batch Summary ===" << std::endl;
+  std::cout << "Scenarios:      " << success_count << "/" << results.size() << " reached goal" << std::endl;
+  std::cout << "Collisions:     " << total_collisions << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "Avg time-to-goal: " << summary["avg_time_to_goal_s"].get<double>() << " s" << std::endl;
+  std::cout << "Planning p50/p90/p99: " << summary["planning_latency"]["p50_ms"].get<double>() << " / "
+            << summary["planning_latency"]["p90_ms"].get<double>() << " / "
+            << summary["planning_latency"]["p99_ms"].get<double>() << " ms" << std::endl;
+  std::cout << "Wall time:      " << batch_wall_ms / 1000.0 << " s ("
+            << summary["real_time_factor"].get<double>() << "x real time)" << std::endl;
+
+  if (!args.output_file.empty()) {
+    std::ofstream out(args.output_file);
+    if (!out.is_open()) {
+      std::cerr << "Failed to write report: " << args.output_file << std::endl;
+      return 1;
+    }
+    out << report.dump(2) << std::endl;
+    std::cout << "Report written to " << args.output_file << std::endl;
+  }
+
+  return success_count == results.size() ? 0 : 1;
+}
@@ -0,0 +1,314 @@
+/**
+ * @file navsim_replay.cpp
+ * @brief 离线回放工具 - 用记录日志中的 WorldTick 流直接驱动 AlgorithmManager::process
+ *
+ * 功能：
+ * - 读取 navsim_algo --record / navsim_batch --record-dir 生成的 .ticklog
+ * - 不连接 WebSocket、不运行仿真器、不打开窗口（NullVisualizer）
+ * - 尽快回放（fast）或按记录时的节奏回放（recorded，可用 --speed 加速）
+ * - 对比回放与记录的规划结果，并输出两者的阶段耗时分位数
+ *
+ * 使用示例：
+ * ```bash
+ * ./navsim_batch scenarios/map1.json --record-dir=logs/
+ * ./navsim_replay logs/map1.ticklog --config=config/default.json
+ * ./navsim_replay logs/map1.ticklog --pacing=recorded --speed=2 --trace=replay.json
+ * ```
+ */
+
+#include "core/algorithm_manager.hpp"
+#include "core/latency_metrics.hpp"
+#include "core/tick_log.hpp"
+#include "core/trace.hpp"
+#include "core/log.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+using namespace navsim;
+
+namespace {
+
+// ========== 命令行参数 ==========
+
+struct CommandLineArgs {
+  std::string log_file;
+  std::string config_file;
+  std::string metrics_output_file;  // 回放阶段耗时导出（格式同 metrics_output_file）
+  std::string trace_file;           // 非空时记录 Chrome trace
+  bool recorded_pacing = false;     // false = 尽快回放
+  double speed = 1.0;               // recorded 节奏下的倍速
+  double tolerance = 1e-6;          // 轨迹点比较容差 (m / rad)
+  bool verbose = false;             // 保留各模块的 stdout 日志
+};
+
+void print_usage(const char* program_name) {
+  std::cout << "Usage: " << program_name << " <record.ticklog> [options]\n"
+            << "\n"
+            << "Options:\n"
+            << "  --config=<file>          Plugin configuration file (default: built-in defaults)\n"
+            << "  --pacing=<fast|recorded> Replay as fast as possible or at recorded timing (default: fast)\n"
+            << "  --speed=<x>              Speed factor for recorded pacing (default: 1.0)\n"
+            << "  --tolerance=<v>          Max pose difference counted as identical plan (default: 1e-6)\n"
+            << "  --metrics-output=<file>  Dump replay latency metrics (.prom or JSON)\n"
+            << "  --trace=<file>           Record a Chrome/Perfetto trace of the replay\n"
+            << "  --verbose                Keep per-module logs on stdout\n"
+            << "  --log-level=<lvl>        Runtime log level: debug|info|warn|error|off (default: info)\n"
+            << "  --help                   Show this help" << std::endl;
+}
+
+bool parse_arguments(int argc, char** argv, CommandLineArgs& args) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      return false;
+    } else if (arg.find("--config=") == 0) {
+      args.config_file = arg.substr(9);
+    } else if (arg.find("--pacing=") == 0) {
+      std::string pacing = arg.substr(9);
+      if (pacing != "fast" && pacing != "recorded") {
+        std::cerr << "Unknown pacing: " << pacing << std::endl;
+        return false;
+      }
+      args.recorded_pacing = pacing == "recorded";
+    } else if (arg.find("--speed=") == 0) {
+      args.speed = std::stod(arg.substr(8));
+    } else if (arg.find("--tolerance=") == 0) {
+      args.tolerance = std::stod(arg.substr(12));
+    } else if (arg.find("--metrics-output=") == 0) {
+      args.metrics_output_file = arg.substr(17);
+    } else if (arg.find("--trace=") == 0) {
+      args.trace_file = arg.substr(8);
+    } else if (arg == "--verbose") {
+      args.verbose = true;
+    } else if (arg.find("--log-level=") == 0) {
+      navsim::log::Level level;
+      if (!navsim::log::parseLevel(arg.substr(12), level)) {
+        std::cerr << "Unknown log level: " << arg.substr(12) << std::endl;
+        return false;
+      }
+      navsim::log::Logger::setLevel(level);
+    } else if (arg.find("--") == 0) {
+      std::cerr << "Unknown argument: " << arg << std::endl;
+      return false;
+    } else if (args.log_file.empty()) {
+      args.log_file = arg;
+    } else {
+      std::cerr << "Only one record file can be replayed at a time" << std::endl;
+      return false;
+    }
+  }
+
+  if (args.log_file.empty()) {
+    std::cerr << "No record file given" << std::endl;
+    return false;
+  }
+  if (args.speed <= 0.0) {
+    std::cerr << "--speed must be positive" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+AlgorithmManager::Config make_algorithm_config(const CommandLineArgs& args) {
+  AlgorithmManager::Config config;
+  config.enable_visualization = false;
+  config.verbose_logging = false;
+  config.config_file = args.config_file;
+  config.metrics_output_file = args.metrics_output_file;
+
+  if (!args.config_file.empty()) {
+    std::ifstream file(args.config_file);
+    if (file.is_open()) {
+      try {
+        nlohmann::json j;
+        file >> j;
+        if (j.contains("algorithm")) {
+          const auto& algo = j["algorithm"];
+          config.max_computation_time_ms = algo.value("max_computation_time_ms", config.max_computation_time_ms);
+          config.goal_hold_distance = algo.value("goal_hold_distance_", config.goal_hold_distance);
+          config.worker_threads = algo.value("worker_threads", config.worker_threads);
+          config.worker_cpu_affinity = algo.value("worker_cpu_affinity", config.worker_cpu_affinity);
+        }
+      } catch (const std::exception& e) {
+        std::cerr << "Failed to parse config file: " << e.what() << std::endl;
+      }
+    }
+  }
+  return config;
+}
+
+// ========== 结果对比 ==========
+
+/**
+ * @brief 两条轨迹的最大位姿差；点数不同时返回无穷大
+ */
+double max_trajectory_difference(const proto::PlanUpdate& a, const proto::PlanUpdate& b) {
+  if (a.trajectory_size() != b.trajectory_size()) {
+    return std::numeric_limits<double>::infinity();
+  }
+  double max_diff = 0.0;
+  for (int i = 0; i < a.trajectory_size(); ++i) {
+    const auto& p = a.trajectory(i);
+    const auto& q = b.trajectory(i);
+    max_diff = std::max({max_diff,
+                         std::abs(p.x() - q.x()),
+                         std::abs(p.y() - q.y()),
+                         std::abs(p.yaw() - q.yaw()),
+                         std::abs(p.t() - q.t())});
+  }
+  return max_diff;
+}
+
+void print_latency_comparison(const metrics::LatencyMetrics& recorded,
+                              const metrics::LatencyMetrics& replayed) {
+  const nlohmann::json recorded_json = recorded.toJson()["stages"];
+  const nlohmann::json replayed_json = replayed.toJson()["stages"];
+
+  std::cout << std::left << std::setw(16) << "stage"
+            << std::right << std::setw(14) << "rec p50 ms" << std::setw(14) << "rec p99 ms"
+            << std::setw(14) << "replay p50 ms" << std::setw(14) << "replay p99 ms" << "\n";
+  for (const char* stage : {"preprocessing", "perception", "planning", "total"}) {
+    auto value = [](const nlohmann::json& stages, const char* name, const char* key) {
+      return stages.contains(name) ? stages[name].value(key, 0.0) : 0.0;
+    };
+    std::cout << std::left << std::setw(16) << stage << std::right << std::fixed << std::setprecision(3)
+              << std::setw(14) << value(recorded_json, stage, "p50_ms")
+              << std::setw(14) << value(recorded_json, stage, "p99_ms")
+              << std::setw(14) << value(replayed_json, stage, "p50_ms")
+              << std::setw(14) << value(replayed_json, stage, "p99_ms") << "\n";
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  CommandLineArgs args;
+  if (!parse_arguments(argc, argv, args)) {
+    print_usage(argv[0]);
+    return 2;
+  }
+
+  record::TickLogReader reader;
+  if (!reader.open(args.log_file)) {
+    return 2;
+  }
+  std::cerr << "[navsim_replay] " << reader.size() << " ticks from " << args.log_file
+            << ", pacing=" << (args.recorded_pacing ? "recorded" : "fast");
+  if (args.recorded_pacing) {
+    std::cerr << " x" << args.speed;
+  }
+  std::cerr << std::endl;
+
+  auto& tracer = navsim::trace::Tracer::instance();
+  if (!args.trace_file.empty()) {
+    if (!tracer.start(args.trace_file)) {
+      return 2;
+    }
+    tracer.setThreadName("replay");
+  }
+
+  // 默认屏蔽各模块的 stdout 日志，报告在恢复后输出
+  std::ofstream null_stream;
+  std::streambuf* original_cout = std::cout.rdbuf();
+  if (!args.verbose) {
+    navsim::log::Logger::instance().setOutput(null_stream, std::cerr);
+    std::cout.rdbuf(null_stream.rdbuf());
+  }
+
+  int processed = 0;
+  int succeeded = 0;
+  int outcome_mismatches = 0;     // 成功/失败与记录不一致
+  int trajectory_mismatches = 0;  // 均成功但轨迹不一致
+  double max_difference = 0.0;
+  metrics::LatencyMetrics recorded_metrics;
+  double replay_wall_ms = 0.0;
+
+  {
+    AlgorithmManager manager(make_algorithm_config(args));
+    if (!manager.initialize()) {
+      std::cout.rdbuf(original_cout);
+      std::cerr << "[navsim_replay] Failed to initialize AlgorithmManager" << std::endl;
+      return 1;
+    }
+    manager.setSimulationStarted(true);
+
+    proto::TickRecord tick_record;
+    proto::PlanUpdate plan_update;
+    proto::EgoCmd ego_cmd;
+    double first_recv_time = 0.0;
+    const auto replay_start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < reader.size(); ++i) {
+      if (!reader.read(i, tick_record)) {
+        std::cerr << "[navsim_replay] Failed to parse record " << i << ", stopping" << std::endl;
+        break;
+      }
+
+      if (args.recorded_pacing) {
+        if (i == 0) {
+          first_recv_time = tick_record.recv_time();
+        }
+        auto offset = std::chrono::duration<double>((tick_record.recv_time() - first_recv_time) / args.speed);
+        std::this_thread::sleep_until(
+            replay_start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+      }
+
+      for (const auto& timing : tick_record.timings()) {
+        recorded_metrics.stage(timing.stage()).record(timing.latency_ms(), 0.0);
+      }
+
+      plan_update.Clear();
+      ego_cmd.Clear();
+      auto deadline = std::chrono::milliseconds(static_cast<int64_t>(tick_record.deadline_ms()));
+      bool success = manager.process(tick_record.world_tick(), deadline, plan_update, ego_cmd);
+
+      processed++;
+      if (success) {
+        succeeded++;
+      }
+      if (success != tick_record.success()) {
+        outcome_mismatches++;
+      } else if (success) {
+        double difference = max_trajectory_difference(plan_update, tick_record.plan_update());
+        max_difference = std::max(max_difference, difference);
+        if (difference > args.tolerance) {
+          trajectory_mismatches++;
+        }
+      }
+    }
+
+    replay_wall_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - replay_start).count();
+
+    navsim::log::Logger::instance().flush();
+    std::cout.rdbuf(original_cout);
+    navsim::log::Logger::instance().setOutput(std::cout, std::cerr);
+
+    std::cout << "\n========== Replay Summary ==========\n"
+              << "Ticks replayed:        " << processed << " / " << reader.size() << "\n"
+              << "Planning succeeded:    " << succeeded << "\n"
+              << "Outcome mismatches:    " << outcome_mismatches << "\n"
+              << "Trajectory mismatches: " << trajectory_mismatches
+              << " (max diff " << max_difference << ", tolerance " << args.tolerance << ")\n"
+              << "Wall time:             " << std::fixed << std::setprecision(1) << replay_wall_ms << " ms";
+    if (processed > 0) {
+      std::cout << " (" << std::setprecision(3) << replay_wall_ms / processed << " ms/tick)";
+    }
+    std::cout << "\n\n";
+    print_latency_comparison(recorded_metrics, manager.getLatencyMetrics());
+    std::cout << std::endl;
+  }  // manager 析构时导出 --metrics-output
+
+  tracer.stop();
+  return (outcome_mismatches + trajectory_mismatches) > 0 ? 1 : 0;
+}
@@ -0,0 +1,223 @@
+#include "bench_common.hpp"
+#include "esdf_builder_plugin.hpp"
+#include "plugin/preprocessing/preprocessing.hpp"
+#include "sim/local_simulator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+
+#ifndef NAVSIM_SOURCE_DIR
+#define NAVSIM_SOURCE_DIR "."
+#endif
+
+namespace navsim {
+namespace bench {
+
+namespace {
+
+constexpr double kClearance = 2.0;   // 起点、终点、自车周围的净空 (m)
+
+bool nearAny(double x, double y, double radius, const std::vector<planning::Pose2d>& keep_clear) {
+  for (const auto& pose : keep_clear) {
+    if (std::hypot(x - pose.x, y - pose.y) < radius + kClearance) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void fillSyntheticTick(const SyntheticSceneSpec& spec, const std::vector<planning::Pose2d>& keep_clear,
+                       const planning::Pose2d& goal, proto::WorldTick& tick) {
+  std::mt19937 rng(spec.seed);
+  const double half = 0.45 * spec.area_m;
+  std::uniform_real_distribution<double> position(-half, half);
+  std::uniform_real_distribution<double> radius(0.3, 1.0);
+  std::uniform_real_distribution<double> side(0.5, 2.0);
+  std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+
+  tick.set_tick_id(1);
+  tick.set_stamp(0.0);
+  tick.mutable_ego()->mutable_pose()->set_yaw(M_PI / 4.0);
+
+  auto* task_goal = tick.mutable_goal();
+  task_goal->mutable_pose()->set_x(goal.x);
+  task_goal->mutable_pose()->set_y(goal.y);
+  task_goal->mutable_pose()->set_yaw(goal.yaw);
+  task_goal->mutable_tol()->set_pos(0.5);
+  task_goal->mutable_tol()->set_yaw(0.2);
+
+  auto* chassis = tick.mutable_chassis();
+  chassis->set_model("differential");
+  chassis->set_track_width(0.5);
+  chassis->mutable_limits()->set_v_max(1.5);
+  chassis->mutable_limits()->set_a_max(1.0);
+  chassis->mutable_limits()->set_omega_max(1.0);
+  chassis->mutable_geometry()->set_body_length(0.6);
+  chassis->mutable_geometry()->set_body_width(0.5);
+
+  auto* static_map = tick.mutable_static_map();
+  static_map->set_resolution(0.1);
+
+  // 3/4 圆形，1/4 旋转矩形；落在净空区的候选直接丢弃重采样
+  int placed = 0;
+  while (placed < spec.obstacle_count) {
+    const double x = position(rng);
+    const double y = position(rng);
+    if (placed % 4 != 3) {
+      const double r = radius(rng);
+      if (nearAny(x, y, r, keep_clear)) {
+        continue;
+      }
+      auto* circle = static_map->add_circles();
+      circle->set_x(x);
+      circle->set_y(y);
+      circle->set_r(r);
+    } else {
+      const double w = side(rng);
+      const double h = side(rng);
+      const double yaw = angle(rng);
+      if (nearAny(x, y, 0.5 * std::hypot(w, h), keep_clear)) {
+        continue;
+      }
+      auto* polygon = static_map->add_polygons();
+      const double c = std::cos(yaw);
+      const double s = std::sin(yaw);
+      const double corners[4][2] = {{0.5 * w, 0.5 * h}, {-0.5 * w, 0.5 * h},
+                                    {-0.5 * w, -0.5 * h}, {0.5 * w, -0.5 * h}};
+      for (const auto& corner : corners) {
+        auto* point = polygon->add_points();
+        point->set_x(x + c * corner[0] - s * corner[1]);
+        point->set_y(y + s * corner[0] + c * corner[1]);
+      }
+    }
+    ++placed;
+  }
+
+  // 少量动态障碍物，覆盖预测与动态栅格化路径
+  const int dynamic_count = std::max(1, spec.obstacle_count / 8);
+  for (int i = 0; i < dynamic_count;) {
+    const double x = position(rng);
+    const double y = position(rng);
+    if (nearAny(x, y, 0.4, keep_clear)) {
+      continue;
+    }
+    auto* obstacle = tick.add_dynamic_obstacles();
+    obstacle->set_id("dyn_" + std::to_string(i));
+    obstacle->set_model("cv");
+    obstacle->mutable_shape()->mutable_circle()->set_r(0.4);
+    obstacle->mutable_pose()->set_x(x);
+    obstacle->mutable_pose()->set_y(y);
+    obstacle->mutable_twist()->set_vx(0.5 * std::cos(angle(rng)));
+    obstacle->mutable_twist()->set_vy(0.5 * std::sin(angle(rng)));
+    ++i;
+  }
+}
+
+void preprocess(BenchScene& scene) {
+  perception::PreprocessingPipeline pipeline;
+  scene.input = pipeline.process(scene.world_tick);
+  scene.input.raw_world_tick = &scene.world_tick;
+}
+
+} // namespace
+
+void makeSyntheticScene(const SyntheticSceneSpec& spec, BenchScene& scene) {
+  const double corner = 0.4 * spec.area_m;
+  scene.name = "synthetic";
+  scene.area_m = spec.area_m;
+  scene.start = planning::Pose2d(-corner, -corner, M_PI / 4.0);
+  scene.goal = planning::Pose2d(corner, corner, M_PI / 4.0);
+
+  scene.world_tick.Clear();
+  fillSyntheticTick(spec, {scene.start, scene.goal, planning::Pose2d()}, scene.goal, scene.world_tick);
+  preprocess(scene);
+}
+
+const BenchScene& syntheticScene(double area_m, int obstacle_count) {
+  static std::map<std::pair<double, int>, std::unique_ptr<BenchScene>> cache;
+  auto& scene = cache[{area_m, obstacle_count}];
+  if (!scene) {
+    scene = std::make_unique<BenchScene>();
+    SyntheticSceneSpec spec;
+    spec.area_m = area_m;
+    spec.obstacle_count = obstacle_count;
+    makeSyntheticScene(spec, *scene);
+  }
+  return *scene;
+}
+
+std::shared_ptr<perception::ESDFMap> sceneESDFMap(const BenchScene& scene) {
+  static std::map<const BenchScene*, std::shared_ptr<perception::ESDFMap>> cache;
+  auto& map = cache[&scene];
+  if (!map) {
+    plugins::perception::ESDFBuilderPlugin builder;
+    builder.initialize({{"resolution", 0.1},
+                        {"map_width", scene.area_m},
+                        {"map_height", scene.area_m},
+                        {"max_distance", 5.0},
+                        {"include_dynamic", true}});
+    planning::PlanningContext context;
+    builder.process(scene.input, context);
+    map = builder.getESDFMap();
+  }
+  return map;
+}
+
+bool loadScenarioScene(const std::string& scenario_file, BenchScene& scene) {
+  sim::LocalSimulator simulator;
+  if (!simulator.initialize(sim::SimulatorConfig{}) || !simulator.load_scenario(scenario_file)) {
+    std::cerr << "[navsim_bench] Failed to load scenario " << scenario_file << std::endl;
+    return false;
+  }
+
+  scene.name = std::filesystem::path(scenario_file).stem().string();
+  scene.world_tick = simulator.to_world_tick();
+  preprocess(scene);
+
+  scene.start = scene.input.ego.pose;
+  scene.goal = scene.input.task.goal_pose;
+  const double distance = std::hypot(scene.goal.x - scene.start.x, scene.goal.y - scene.start.y);
+  scene.area_m = std::max(30.0, std::ceil(2.0 * distance + 10.0));
+  return true;
+}
+
+std::vector<std::string> listMapScenarios(const std::string& scenario_dir) {
+  std::vector<std::string> files;
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator(scenario_dir, ec)) {
+    const auto& path = entry.path();
+    if (path.extension() == ".json" && path.stem().string().rfind("map", 0) == 0) {
+      files.push_back(path.string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+nlohmann::json loadPlannerConfig(const std::string& config_file, const std::string& planner_name) {
+  std::ifstream file(config_file);
+  if (!file.is_open()) {
+    std::cerr << "[navsim_bench] Failed to open " << config_file << ", using built-in defaults" << std::endl;
+    return nlohmann::json::object();
+  }
+  try {
+    const auto config = nlohmann::json::parse(file);
+    return config.at("planning").at("planners").at(planner_name);
+  } catch (const std::exception& e) {
+    std::cerr << "[navsim_bench] No config for " << planner_name << " in " << config_file
+              << ": " << e.what() << std::endl;
+    return nlohmann::json::object();
+  }
+}
+
+std::string sourceDir() {
+  return NAVSIM_SOURCE_DIR;
+}
+
+} // namespace bench
+} // namespace navsim
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "esdf_map.hpp"
+#include "plugin/data/perception_input.hpp"
+#include "world_tick.pb.h"
+#include <nlohmann/json.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace navsim {
+namespace bench {
+
+/**
+ * @brief 合成场景参数
+ *
+ * 自车位于原点，障碍物在 [-area/2, area/2]² 内按固定种子随机分布，
+ * 规划起点 / 终点位于对角附近并保留净空，保证 JPS 可达。
+ */
+struct SyntheticSceneSpec {
+  double area_m = 40.0;     // 场景边长 (m)，感知栅格与 ESDF 窗口同尺寸
+  int obstacle_count = 64;  // 静态障碍物数量（约 3/4 圆形、1/4 矩形多边形）
+  uint32_t seed = 42;
+};
+
+/**
+ * @brief 基准输入：WorldTick 及其经前置处理得到的 PerceptionInput
+ */
+struct BenchScene {
+  std::string name;
+  proto::WorldTick world_tick;
+  plugin::PerceptionInput input;   // raw_world_tick 指向本对象的 world_tick
+  double area_m = 40.0;            // 感知窗口边长 (m)
+  planning::Pose2d start;          // 规划起点
+  planning::Pose2d goal;           // 规划终点
+
+  BenchScene() = default;
+  BenchScene(const BenchScene&) = delete;
+  BenchScene& operator=(const BenchScene&) = delete;
+};
+
+/**
+ * @brief 生成合成场景（同一参数总是生成同一场景）
+ */
+void makeSyntheticScene(const SyntheticSceneSpec& spec, BenchScene& scene);
+
+/**
+ * @brief 取缓存的合成场景（Google Benchmark 会多次调用同一基准函数，场景只生成一次）
+ */
+const BenchScene& syntheticScene(double area_m, int obstacle_count);
+
+/**
+ * @brief 以 ESDFBuilder 插件构建场景的 ESDF 地图（窗口以自车为中心，边长 scene.area_m）
+ *
+ * 结果按场景缓存，感知与规划基准共用。
+ */
+std::shared_ptr<perception::ESDFMap> sceneESDFMap(const BenchScene& scene);
+
+/**
+ * @brief 用 LocalSimulator 加载场景文件并取第一帧 WorldTick
+ *
+ * 感知窗口以自车为中心，边长覆盖到终点的距离。
+ * @return 加载失败时返回 false
+ */
+bool loadScenarioScene(const std::string& scenario_file, BenchScene& scene);
+
+/**
+ * @brief 列出 scenarios/ 下的 map*.json（按文件名排序）
+ */
+std::vector<std::string> listMapScenarios(const std::string& scenario_dir);
+
+/**
+ * @brief 读取 config/default.json 中指定规划器的参数段，缺失时返回空对象
+ */
+nlohmann::json loadPlannerConfig(const std::string& config_file, const std::string& planner_name);
+
+/**
+ * @brief 为场景文件注册感知 / 规划基准（名称以 "/scenario:<文件名>" 结尾）
+ */
+void registerPerceptionScenarioBenchmarks(const BenchScene& scene);
+void registerPlanningScenarioBenchmarks(const BenchScene& scene);
+
+/**
+ * @brief 仓库根目录（由 CMake 注入）
+ */
+std::string sourceDir();
+
+} // namespace bench
+} // namespace navsim
@@ -0,0 +1,113 @@
+/**
+ * @file bench_guidance_environment.cpp
+ * @brief T-MPC 引导规划器碰撞 / 可见性查询基准：逐个障碍物检查 vs 时空索引
+ *
+ * 查询模式与 PRM 相同：随机 (x, y, t) 采样点的碰撞检查，以及采样点之间的可见性射线检查。
+ * 障碍物在 40 m × 40 m 内匀速运动，按数量扫描查询代价随障碍物数的增长。
+ */
+
+#include <guidance_planner/environment.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace navsim {
+namespace bench {
+
+namespace {
+
+using GuidancePlanner::Config;
+using GuidancePlanner::Environment;
+using GuidancePlanner::Obstacle;
+using GuidancePlanner::SpaceTimePoint;
+
+constexpr int kHorizon = 30;
+constexpr int kQueries = 256;
+
+struct GuidanceScene {
+  std::vector<Obstacle> obstacles;
+  std::vector<SpaceTimePoint> points;
+};
+
+GuidanceScene makeGuidanceScene(int obstacle_count) {
+  Config::N = kHorizon;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> xy(-20.0, 20.0);
+  std::uniform_real_distribution<double> velocity(-1.0, 1.0);
+  std::uniform_real_distribution<double> time(0.0, kHorizon);
+
+  GuidanceScene scene;
+  for (int i = 0; i < obstacle_count; ++i) {
+    scene.obstacles.emplace_back(i, Eigen::Vector2d(xy(rng), xy(rng)), Eigen::Vector2d(velocity(rng), velocity(rng)),
+                                 0.2, kHorizon, 0.5);
+  }
+  for (int q = 0; q < kQueries; ++q) {
+    scene.points.emplace_back(xy(rng), xy(rng), time(rng));
+  }
+  return scene;
+}
+
+void obstacleArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"obstacles", "index"});
+  for (int obstacles : {10, 50, 200}) {
+    for (int index : {0, 1}) {
+      b->Args({obstacles, index});
+    }
+  }
+}
+
+// ========== 查询 ==========
+
+void BM_GuidanceInCollision(benchmark::State& state) {
+  GuidanceScene scene = makeGuidanceScene(static_cast<int>(state.range(0)));
+  Environment environment;
+  environment.SetUseObstacleIndex(state.range(1) != 0);
+  environment.LoadObstacles(scene.obstacles, {});
+
+  for (auto _ : state) {
+    int collisions = 0;
+    for (const auto& point : scene.points) {
+      collisions += environment.InCollision(point);
+    }
+    benchmark::DoNotOptimize(collisions);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries);
+}
+BENCHMARK(BM_GuidanceInCollision)->Apply(obstacleArgs)->Unit(benchmark::kMicrosecond);
+
+void BM_GuidanceIsVisible(benchmark::State& state) {
+  GuidanceScene scene = makeGuidanceScene(static_cast<int>(state.range(0)));
+  Environment environment;
+  environment.SetUseObstacleIndex(state.range(1) != 0);
+  environment.LoadObstacles(scene.obstacles, {});
+
+  for (auto _ : state) {
+    int visible = 0;
+    for (int q = 0; q + 1 < kQueries; q += 2) {
+      visible += environment.IsVisible(scene.points[q], scene.points[q + 1]);
+    }
+    benchmark::DoNotOptimize(visible);
+  }
+  state.SetItemsProcessed(state.iterations() * kQueries / 2);
+}
+BENCHMARK(BM_GuidanceIsVisible)->Apply(obstacleArgs)->Unit(benchmark::kMicrosecond);
+
+// 每帧 LoadObstacles 时重建索引的开销
+void BM_GuidanceLoadObstacles(benchmark::State& state) {
+  GuidanceScene scene = makeGuidanceScene(static_cast<int>(state.range(0)));
+  Environment environment;
+  environment.SetUseObstacleIndex(state.range(1) != 0);
+
+  for (auto _ : state) {
+    environment.LoadObstacles(scene.obstacles, {});
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_GuidanceLoadObstacles)->Apply(obstacleArgs)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+
+} // namespace bench
+} // namespace navsim
@@ -0,0 +1,89 @@
+/**
+ * @file bench_main.cpp
+ * @brief navsim_bench 入口：感知 / 规划内核性能回归基准
+ *
+ * 用法:
+ *   ./navsim_bench                                   # 合成场景 + scenarios/map*.json
+ *   ./navsim_bench --benchmark_filter=ESDF           # 只跑部分基准
+ *   ./navsim_bench --benchmark_out=bench.json --benchmark_out_format=json
+ *   python3 tools/navsim_bench_compare.py base.json bench.json
+ *
+ * 额外参数:
+ *   --scenario_dir=<dir>   场景目录（默认 <源码根目录>/scenarios），为空时只跑合成场景
+ *   --verbose              保留被测代码自身的 stdout 输出（默认丢弃，避免淹没结果表）
+ */
+
+#include "bench_common.hpp"
+#include "core/log.hpp"
+
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace {
+
+class NullBuffer : public std::streambuf {
+protected:
+  int overflow(int c) override { return c; }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string scenario_dir = navsim::bench::sourceDir() + "/scenarios";
+  bool verbose = false;
+
+  // 先取出本程序自己的参数，其余交给 Google Benchmark
+  std::vector<char*> args;
+  for (int i = 0; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg.rfind("--scenario_dir=", 0) == 0) {
+      scenario_dir = arg.substr(15);
+    } else if (arg == "--verbose") {
+      verbose = true;
+    } else {
+      args.push_back(argv[i]);
+    }
+  }
+  int bench_argc = static_cast<int>(args.size());
+  benchmark::Initialize(&bench_argc, args.data());
+  if (benchmark::ReportUnrecognizedArguments(bench_argc, args.data())) {
+    return 1;
+  }
+
+  // 结果表写到原始 stdout；被测代码的 std::cout 输出默认丢弃
+  std::ostream report_stream(std::cout.rdbuf());
+  NullBuffer null_buffer;
+  std::streambuf* original_cout = nullptr;
+  if (!verbose) {
+    navsim::log::Logger::setLevel(navsim::log::Level::WARN);
+    original_cout = std::cout.rdbuf(&null_buffer);
+  }
+
+  std::vector<std::unique_ptr<navsim::bench::BenchScene>> scenes;
+  if (!scenario_dir.empty()) {
+    for (const auto& file : navsim::bench::listMapScenarios(scenario_dir)) {
+      auto scene = std::make_unique<navsim::bench::BenchScene>();
+      if (navsim::bench::loadScenarioScene(file, *scene)) {
+        navsim::bench::registerPerceptionScenarioBenchmarks(*scene);
+        navsim::bench::registerPlanningScenarioBenchmarks(*scene);
+        scenes.push_back(std::move(scene));
+      }
+    }
+  }
+
+  benchmark::ConsoleReporter console_reporter(benchmark::ConsoleReporter::OO_None);
+  console_reporter.SetOutputStream(&report_stream);
+  console_reporter.SetErrorStream(&std::cerr);
+  benchmark::RunSpecifiedBenchmarks(&console_reporter);
+  benchmark::Shutdown();
+
+  if (original_cout) {
+    navsim::log::Logger::instance().flush();
+    std::cout.rdbuf(original_cout);
+  }
+  return 0;
+}
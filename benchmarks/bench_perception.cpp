@@ -0,0 +1,138 @@
+/**
+ * @file bench_perception.cpp
+ * @brief 前置处理与感知插件内核基准：BEV 提取、前置处理管道、栅格化 / 膨胀、ESDF
+ */
+
+#include "bench_common.hpp"
+#include "grid_map_builder_plugin.hpp"
+#include "plugin/preprocessing/preprocessing.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace navsim {
+namespace bench {
+
+namespace {
+
+// 合成场景参数网格：边长 (m) × 静态障碍物数量
+void syntheticArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"area_m", "obstacles"});
+  for (int area : {20, 40, 80}) {
+    for (int obstacles : {16, 64, 256}) {
+      b->Args({area, obstacles});
+    }
+  }
+}
+
+// 膨胀半径 0 时只剩栅格化，与非零半径对比即可得到 inflateObstacles 的开销
+void gridMapArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"area_m", "obstacles", "inflation_cm"});
+  for (int area : {20, 40, 80}) {
+    for (int obstacles : {16, 64, 256}) {
+      for (int inflation_cm : {0, 50}) {
+        b->Args({area, obstacles, inflation_cm});
+      }
+    }
+  }
+}
+
+const BenchScene& sceneFromArgs(const benchmark::State& state) {
+  return syntheticScene(static_cast<double>(state.range(0)), static_cast<int>(state.range(1)));
+}
+
+// ========== 内核 ==========
+
+void runBEVExtract(benchmark::State& state, const BenchScene& scene) {
+  perception::BEVExtractor extractor;
+  size_t obstacles = 0;
+  for (auto _ : state) {
+    auto bev = extractor.extract(scene.world_tick);
+    obstacles = bev->circles.size() + bev->rectangles.size() + bev->polygons.size();
+    benchmark::DoNotOptimize(bev);
+  }
+  state.counters["bev_obstacles"] = static_cast<double>(obstacles);
+}
+
+void runPreprocessing(benchmark::State& state, const BenchScene& scene) {
+  perception::PreprocessingPipeline pipeline;
+  for (auto _ : state) {
+    auto input = pipeline.process(scene.world_tick);
+    benchmark::DoNotOptimize(input);
+  }
+}
+
+void runGridMapBuilder(benchmark::State& state, const BenchScene& scene, double inflation_radius) {
+  plugins::perception::GridMapBuilderPlugin::Config config;
+  config.resolution = 0.1;
+  config.map_width = scene.area_m;
+  config.map_height = scene.area_m;
+  config.inflation_radius = inflation_radius;
+  plugins::perception::GridMapBuilderPlugin builder(config);
+
+  planning::PlanningContext context;
+  for (auto _ : state) {
+    builder.process(scene.input, context);
+    benchmark::DoNotOptimize(context.occupancy_grid);
+  }
+
+  const double cells = static_cast<double>(context.occupancy_grid->data.size());
+  state.counters["cells"] = cells;
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(cells));
+}
+
+void runComputeESDF(benchmark::State& state, const BenchScene& scene) {
+  auto map = sceneESDFMap(scene);
+  for (auto _ : state) {
+    map->computeESDF();
+    benchmark::ClobberMemory();
+  }
+  state.counters["cells"] = static_cast<double>(map->GLXY_SIZE_);
+  state.SetItemsProcessed(state.iterations() * map->GLXY_SIZE_);
+}
+
+// ========== 合成场景 ==========
+
+void BM_BEVExtractor_Extract(benchmark::State& state) {
+  runBEVExtract(state, sceneFromArgs(state));
+}
+BENCHMARK(BM_BEVExtractor_Extract)->Apply(syntheticArgs)->Unit(benchmark::kMicrosecond);
+
+void BM_PreprocessingPipeline_Process(benchmark::State& state) {
+  runPreprocessing(state, sceneFromArgs(state));
+}
+BENCHMARK(BM_PreprocessingPipeline_Process)->Apply(syntheticArgs)->Unit(benchmark::kMicrosecond);
+
+void BM_GridMapBuilder_Process(benchmark::State& state) {
+  runGridMapBuilder(state, sceneFromArgs(state), state.range(2) / 100.0);
+}
+BENCHMARK(BM_GridMapBuilder_Process)->Apply(gridMapArgs)->Unit(benchmark::kMillisecond);
+
+void BM_ESDFMap_ComputeESDF(benchmark::State& state) {
+  runComputeESDF(state, sceneFromArgs(state));
+}
+BENCHMARK(BM_ESDFMap_ComputeESDF)->Apply(syntheticArgs)->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+// ========== 场景文件 ==========
+
+void registerPerceptionScenarioBenchmarks(const BenchScene& scene) {
+  const std::string suffix = "/scenario:" + scene.name;
+  const BenchScene* s = &scene;
+
+  benchmark::RegisterBenchmark(("BM_BEVExtractor_Extract" + suffix).c_str(),
+                               [s](benchmark::State& state) { runBEVExtract(state, *s); })
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark(("BM_PreprocessingPipeline_Process" + suffix).c_str(),
+                               [s](benchmark::State& state) { runPreprocessing(state, *s); })
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark(("BM_GridMapBuilder_Process" + suffix).c_str(),
+                               [s](benchmark::State& state) { runGridMapBuilder(state, *s, 0.5); })
+      ->Unit(benchmark::kMillisecond);
+  benchmark::RegisterBenchmark(("BM_ESDFMap_ComputeESDF" + suffix).c_str(),
+                               [s](benchmark::State& state) { runComputeESDF(state, *s); })
+      ->Unit(benchmark::kMillisecond);
+}
+
+} // namespace bench
+} // namespace navsim
@@ -0,0 +1,127 @@
+/**
+ * @file bench_planning.cpp
+ * @brief JPS 规划内核基准：栅格图搜索与 MINCO 轨迹优化
+ */
+
+#include "bench_common.hpp"
+#include "adapter/jps_planner_plugin.hpp"
+#include "algorithm/graph_search.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace navsim {
+namespace bench {
+
+namespace {
+
+// 与感知基准相同的参数网格，但去掉过密组合（20m 场景放 256 个障碍物时起终点不连通）
+void syntheticArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"area_m", "obstacles"});
+  for (int area : {20, 40, 80}) {
+    for (int obstacles : {16, 64, 256}) {
+      if (obstacles <= area * area / 2) {
+        b->Args({area, obstacles});
+      }
+    }
+  }
+}
+
+const BenchScene& sceneFromArgs(const benchmark::State& state) {
+  return syntheticScene(static_cast<double>(state.range(0)), static_cast<int>(state.range(1)));
+}
+
+/**
+ * @brief 规划器配置：config/default.json 中的 JpsPlanner 参数 + 场景底盘约束
+ *
+ * 经插件自身的 initialize() / updateOptimizerConfigFromChassis() 得到，与在线规划一致。
+ */
+JPS::JPSConfig plannerConfig(const BenchScene& scene) {
+  static jps_planner::adapter::JpsPlannerPlugin plugin;
+  static const bool initialized = plugin.initialize(
+      loadPlannerConfig(sourceDir() + "/config/default.json", "JpsPlanner"));
+  (void)initialized;
+
+  JPS::JPSConfig config = plugin.getConfig();
+  plugin.updateOptimizerConfigFromChassis(scene.input.ego, config.optimizer);
+  return config;
+}
+
+// ========== 内核 ==========
+
+void runGraphSearch(benchmark::State& state, const BenchScene& scene, bool use_jps) {
+  auto map = sceneESDFMap(scene);
+  JPS::GraphSearch search(map, plannerConfig(scene).safe_dis);
+
+  const Eigen::Vector2i start = map->coord2gridIndex(Eigen::Vector2d(scene.start.x, scene.start.y));
+  const Eigen::Vector2i goal = map->coord2gridIndex(Eigen::Vector2d(scene.goal.x, scene.goal.y));
+
+  size_t path_nodes = 0;
+  for (auto _ : state) {
+    if (!search.plan(start.x(), start.y(), goal.x(), goal.y(), use_jps)) {
+      state.SkipWithError("no path between start and goal");
+      break;
+    }
+    path_nodes = search.getPath().size();
+  }
+  state.counters["path_nodes"] = static_cast<double>(path_nodes);
+}
+
+void runMincoPlan(benchmark::State& state, const BenchScene& scene) {
+  auto map = sceneESDFMap(scene);
+  const JPS::JPSConfig config = plannerConfig(scene);
+
+  // 前端只运行一次，计时部分只包含后端优化
+  JPS::JPSPlanner front_end(map);
+  front_end.setConfig(config);
+  front_end.setCurrentVelocityState(Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero());
+  const Eigen::Vector3d start(scene.start.x, scene.start.y, scene.start.yaw);
+  const Eigen::Vector3d goal(scene.goal.x, scene.goal.y, scene.goal.yaw);
+  if (!front_end.plan(start, goal)) {
+    state.SkipWithError("JPS front end failed");
+    return;
+  }
+
+  JPS::MSPlanner optimizer(config.optimizer, map);
+  int64_t succeeded = 0;
+  for (auto _ : state) {
+    succeeded += optimizer.minco_plan(front_end.flat_traj_) ? 1 : 0;
+  }
+  state.counters["success_rate"] = benchmark::Counter(
+      static_cast<double>(succeeded), benchmark::Counter::kAvgIterations);
+}
+
+// ========== 合成场景 ==========
+
+void BM_GraphSearch_Jps(benchmark::State& state) {
+  runGraphSearch(state, sceneFromArgs(state), true);
+}
+BENCHMARK(BM_GraphSearch_Jps)->Apply(syntheticArgs)->Unit(benchmark::kMicrosecond);
+
+void BM_GraphSearch_AStar(benchmark::State& state) {
+  runGraphSearch(state, sceneFromArgs(state), false);
+}
+BENCHMARK(BM_GraphSearch_AStar)->Apply(syntheticArgs)->Unit(benchmark::kMicrosecond);
+
+void BM_MSPlanner_MincoPlan(benchmark::State& state) {
+  runMincoPlan(state, sceneFromArgs(state));
+}
+BENCHMARK(BM_MSPlanner_MincoPlan)->Apply(syntheticArgs)->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+// ========== 场景文件 ==========
+
+void registerPlanningScenarioBenchmarks(const BenchScene& scene) {
+  const std::string suffix = "/scenario:" + scene.name;
+  const BenchScene* s = &scene;
+
+  benchmark::RegisterBenchmark(("BM_GraphSearch_Jps" + suffix).c_str(),
+                               [s](benchmark::State& state) { runGraphSearch(state, *s, true); })
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark(("BM_MSPlanner_MincoPlan" + suffix).c_str(),
+                               [s](benchmark::State& state) { runMincoPlan(state, *s); })
+      ->Unit(benchmark::kMillisecond);
+}
+
+} // namespace bench
+} // namespace navsim
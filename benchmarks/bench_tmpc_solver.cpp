@@ -0,0 +1,162 @@
+/**
+ * @file bench_tmpc_solver.cpp
+ * @brief T-MPC 求解器参数装载基准：YAML 名称查找 vs 生成的编译期索引表
+ *
+ * 每次求解前各模块要为 N 个阶段写入全部障碍物参数（椭球障碍物 7 个参数 × 障碍物数）。
+ * 三种写法写入同一批参数：
+ * - YamlLookup：旧的 Solver::setParameter 路径，_parameter_map[name].as<int>()
+ * - NameTable：当前按名称的路径，solverParameterIndex() 在生成的有序表上二分查找
+ * - GeneratedSetters：模块实际使用的 setSolverParameter*()，直接按下标写入
+ *
+ * 模型变量同理：旧 getEgoPrediction(k, "x") 的 _model_map 查找 vs ModelIndex 常量。
+ */
+
+#include "bench_common.hpp"
+
+#include <mpc_planner_solver/mpc_planner_parameters.h>
+#include <mpc_planner_solver/solver_interface.h>
+
+#include <benchmark/benchmark.h>
+#include <yaml-cpp/yaml.h>
+
+#include <string>
+#include <vector>
+
+namespace navsim {
+namespace bench {
+
+namespace {
+
+constexpr int kObstacleFields = 7;
+const char* const kFieldNames[kObstacleFields] = {"x", "y", "psi", "major", "minor", "chi", "r"};
+
+std::string solverConfigPath(const std::string& name) {
+  return sourceDir() + "/plugins/planning/t_mpc/algorithm/mpc_planner_solver/config/" + name + ".yaml";
+}
+
+/**
+ * @brief 参数名在循环外构造，只比较查找本身的开销
+ */
+std::vector<std::string> obstacleParameterNames(int obstacles) {
+  std::vector<std::string> names;
+  for (int i = 0; i < obstacles; ++i) {
+    for (const char* field : kFieldNames) {
+      names.push_back("ellipsoid_obst_" + std::to_string(i) + "_" + field);
+    }
+  }
+  return names;
+}
+
+void obstacleArgs(benchmark::internal::Benchmark* b) {
+  b->ArgName("obstacles");
+  for (int obstacles : {10, 100}) {
+    b->Arg(obstacles);
+  }
+}
+
+void setCounters(benchmark::State& state, int obstacles) {
+  const int64_t writes = static_cast<int64_t>(SOLVER_N) * obstacles * kObstacleFields;
+  state.counters["params"] = static_cast<double>(writes);
+  state.SetItemsProcessed(state.iterations() * writes);
+}
+
+// ========== 参数装载 ==========
+
+void BM_TMPCParameters_YamlLookup(benchmark::State& state) {
+  const int obstacles = static_cast<int>(state.range(0));
+  YAML::Node parameter_map = YAML::LoadFile(solverConfigPath("parameter_map"));
+  const auto names = obstacleParameterNames(obstacles);
+  auto params = std::make_unique<MPCPlanner::AcadosParameters>();
+
+  for (auto _ : state) {
+    for (int k = 0; k < SOLVER_N; ++k) {
+      for (const auto& name : names) {
+        params->all_parameters[k * SOLVER_NP + parameter_map[name].as<int>()] = 1.0;
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, obstacles);
+}
+BENCHMARK(BM_TMPCParameters_YamlLookup)->Apply(obstacleArgs)->Unit(benchmark::kMicrosecond);
+
+void BM_TMPCParameters_NameTable(benchmark::State& state) {
+  const int obstacles = static_cast<int>(state.range(0));
+  const auto names = obstacleParameterNames(obstacles);
+  auto params = std::make_unique<MPCPlanner::AcadosParameters>();
+
+  for (auto _ : state) {
+    for (int k = 0; k < SOLVER_N; ++k) {
+      for (const auto& name : names) {
+        params->all_parameters[k * SOLVER_NP + MPCPlanner::solverParameterIndex(name)] = 1.0;
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, obstacles);
+}
+BENCHMARK(BM_TMPCParameters_NameTable)->Apply(obstacleArgs)->Unit(benchmark::kMicrosecond);
+
+void BM_TMPCParameters_GeneratedSetters(benchmark::State& state) {
+  using namespace MPCPlanner;
+  const int obstacles = static_cast<int>(state.range(0));
+  auto params = std::make_unique<AcadosParameters>();
+
+  for (auto _ : state) {
+    for (int k = 0; k < SOLVER_N; ++k) {
+      for (int i = 0; i < obstacles; ++i) {
+        setSolverParameterEllipsoidObstX(k, *params, 1.0, i);
+        setSolverParameterEllipsoidObstY(k, *params, 1.0, i);
+        setSolverParameterEllipsoidObstPsi(k, *params, 1.0, i);
+        setSolverParameterEllipsoidObstMajor(k, *params, 1.0, i);
+        setSolverParameterEllipsoidObstMinor(k, *params, 1.0, i);
+        setSolverParameterEllipsoidObstChi(k, *params, 1.0, i);
+        setSolverParameterEllipsoidObstR(k, *params, 1.0, i);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, obstacles);
+}
+BENCHMARK(BM_TMPCParameters_GeneratedSetters)->Apply(obstacleArgs)->Unit(benchmark::kMicrosecond);
+
+// ========== 模型变量访问（暖启动 / 输出读取） ==========
+
+void BM_TMPCModelAccess_YamlLookup(benchmark::State& state) {
+  YAML::Node model_map = YAML::LoadFile(solverConfigPath("model_map"));
+  auto params = std::make_unique<MPCPlanner::AcadosParameters>();
+  const std::string x = "x";
+  const std::string y = "y";
+
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (int k = 0; k < SOLVER_N; ++k) {
+      sum += params->x0[k * MPCPlanner::MODEL_NVAR + model_map[x][1].as<int>()];
+      sum += params->x0[k * MPCPlanner::MODEL_NVAR + model_map[y][1].as<int>()];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * SOLVER_N * 2);
+}
+BENCHMARK(BM_TMPCModelAccess_YamlLookup)->Unit(benchmark::kMicrosecond);
+
+void BM_TMPCModelAccess_ModelIndex(benchmark::State& state) {
+  using namespace MPCPlanner;
+  auto params = std::make_unique<AcadosParameters>();
+
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (int k = 0; k < SOLVER_N; ++k) {
+      sum += params->x0[k * MODEL_NVAR + ModelIndex::X];
+      sum += params->x0[k * MODEL_NVAR + ModelIndex::Y];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * SOLVER_N * 2);
+}
+BENCHMARK(BM_TMPCModelAccess_ModelIndex)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+
+} // namespace bench
+} // namespace navsim
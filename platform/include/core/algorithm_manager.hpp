@@ -2,6 +2,8 @@
 
 #include "viz/visualizer_interface.hpp"
 #include "control/trajectory_tracker.hpp"
+#include "core/tick_scheduler.hpp"
+#include "core/latency_metrics.hpp"
 #include "world_tick.pb.h"
 #include "plan_update.pb.h"
 #include "ego_cmd.pb.h"
@@ -9,6 +11,7 @@
 #include <chrono>
 #include <string>
 #include <optional>
+#include <vector>
 
 // 前向声明
 namespace navsim {
@@ -27,6 +30,9 @@ namespace planning {
   struct Pose2d;
   struct EgoVehicle;
 }
+namespace record {
+  class TickLogWriter;
+}
 }
 
 namespace navsim {
@@ -48,10 +54,13 @@ public:
     std::string primary_planner = "JpsPlanner";  // 默认使用 JPS 规划器
     std::string fallback_planner = "StraightLine";  // 降级使用直线规划器
     bool enable_planner_fallback = true;
+    std::string planner_execution_mode = "sequential";  // "sequential" / "race"（主/降级并行竞速）/ "portfolio"
+    std::vector<std::string> planner_portfolio;         // portfolio 模式下并发执行的规划器
 
     // 性能配置
     double max_computation_time_ms = 25.0;  // 最大计算时间
     bool verbose_logging = false;           // 详细日志
+    bool enable_visualization = true;       // false 时直接使用 NullVisualizer（无界面批量运行）
 
     double goal_hold_distance = 2.0;        // 判定保持终点的距离阈值
 
@@ -63,6 +72,23 @@ public:
 
     // 播放配置
     double playback_time_step = 0.03;          // 轨迹回放每步时间 (s)
+
+    // 仿真主循环调度
+    double loop_rate_hz = 30.0;                // 主循环频率 (Hz)
+    std::string loop_catch_up_policy = "skip"; // 超时追赶策略："skip" / "burst"
+    int loop_max_burst_ticks = 3;              // burst 模式下最多补执行的节拍数
+
+    // 延迟指标导出
+    std::string metrics_output_file = "";      // 为空则不导出；.prom 为 Prometheus 文本，其余为 JSON
+    double metrics_dump_interval_s = 5.0;      // 导出周期 (s)
+
+    // 记录日志（供 navsim_replay 离线回放）
+    std::string record_file = "";              // 为空则不记录；每帧的 WorldTick、PlanUpdate 与阶段耗时
+    int record_flush_interval = 1;             // 每写入多少条记录刷新一次文件，0 表示只在关闭时刷新
+
+    // 共享工作线程池（T-MPC 并行求解等），进程内在首次使用前生效
+    int worker_threads = 0;                    // <= 0 使用 hardware_concurrency
+    std::vector<int> worker_cpu_affinity;      // 工作线程绑定的 CPU 列表，为空则不绑定
   };
 
   AlgorithmManager();
@@ -106,6 +132,22 @@ public:
                proto::PlanUpdate& plan_update,
                proto::EgoCmd& ego_cmd);
 
+  /**
+   * @brief 最近一次 process() 的各阶段耗时 (ms)，未执行到的阶段为负数
+   */
+  struct TickTimings {
+    double preprocessing_ms = -1.0;
+    double perception_ms = -1.0;
+    double planning_ms = -1.0;
+    double total_ms = -1.0;
+  };
+  const TickTimings& getLastTickTimings() const { return last_tick_timings_; }
+
+  /**
+   * @brief 切换记录日志文件（关闭当前文件，下一帧写入新文件；空路径停止记录）
+   */
+  void setRecordFile(const std::string& path);
+
   /**
    * @brief 运行本地仿真循环（新的主循环）
    * 集成本地仿真器，在同一进程内运行仿真和算法
@@ -137,14 +179,39 @@ public:
     double avg_computation_time_ms = 0.0;
     double avg_perception_time_ms = 0.0;
     double avg_planning_time_ms = 0.0;
+
+    // 最近一次成功处理的耗时
+    double last_computation_time_ms = 0.0;
+    double last_perception_time_ms = 0.0;
+    double last_planning_time_ms = 0.0;
+
+    // 仿真主循环节拍统计（抖动 / 超时直方图）
+    TickScheduler::Statistics loop;
   };
 
-  Statistics getStatistics() const { return stats_; }
+  Statistics getStatistics() const {
+    Statistics stats = stats_;
+    stats.loop = loop_scheduler_.getStatistics();
+    return stats;
+  }
+
+  /**
+   * @brief 各阶段延迟直方图与截止时间超时计数
+   *
+   * 阶段："total"、"preprocessing"、"perception"、"perception/<插件名>"、
+   * "planning"、"tracking"。"total" 以 process() 的 deadline 为截止时间，
+   * "planning" 以剩余时间预算为截止时间。
+   */
+  const metrics::LatencyMetrics& getLatencyMetrics() const { return latency_metrics_; }
 
   /**
    * @brief 重置统计信息
    */
-  void resetStatistics() { stats_ = Statistics{}; }
+  void resetStatistics() {
+    stats_ = Statistics{};
+    loop_scheduler_.resetStatistics();
+    latency_metrics_.reset();
+  }
 
   /**
    * @brief 重置所有插件
@@ -203,6 +270,18 @@ public:
    */
   void pauseSimulation();
 
+  /**
+   * @brief 检查是否已到达终点（到达后仿真自动暂停）
+   */
+  bool hasReachedGoal() const {
+    return goal_reached_;
+  }
+
+  /**
+   * @brief 按场景的终点容差判断自车是否位于终点
+   */
+  bool isGoalReached(const sim::WorldState& world_state) const;
+
   /**
    * @brief 检查仿真是否暂停
    */
@@ -230,9 +309,43 @@ private:
    * - 清空可视化器缓存
    */
   void performFullReset();
+
+  /**
+   * @brief process() 的实际处理流程（process() 负责计时汇总与记录日志）
+   */
+  bool processTick(const proto::WorldTick& world_tick,
+                   std::chrono::milliseconds deadline,
+                   proto::PlanUpdate& plan_update,
+                   proto::EgoCmd& ego_cmd);
+
+  /**
+   * @brief 将一帧写入记录日志（首次调用时按 config_.record_file 创建文件）
+   */
+  void recordTick(const proto::WorldTick& world_tick,
+                  std::chrono::milliseconds deadline,
+                  const proto::PlanUpdate& plan_update,
+                  bool success);
+
   Config config_;
   Statistics stats_;
 
+  // 延迟指标（阶段指针在构造时缓存，热路径上不加锁）
+  metrics::LatencyMetrics latency_metrics_;
+  struct LatencyStages {
+    metrics::LatencyMetrics::Stage* total = nullptr;
+    metrics::LatencyMetrics::Stage* preprocessing = nullptr;
+    metrics::LatencyMetrics::Stage* perception = nullptr;
+    metrics::LatencyMetrics::Stage* planning = nullptr;
+    metrics::LatencyMetrics::Stage* tracking = nullptr;
+  } latency_stages_;
+  std::chrono::steady_clock::time_point last_metrics_dump_{};
+  TickTimings last_tick_timings_;
+
+  // 记录日志
+  std::unique_ptr<record::TickLogWriter> tick_log_writer_;
+  std::chrono::steady_clock::time_point record_start_{};
+  bool record_open_failed_ = false;
+
   // 插件系统模块
   std::unique_ptr<plugin::PerceptionPluginManager> perception_plugin_manager_;
   std::unique_ptr<plugin::PlannerPluginManager> planner_plugin_manager_;
@@ -246,6 +359,7 @@ private:
 
   // Bridge引用（用于感知调试数据发送）
   Bridge* bridge_ = nullptr;
+  int perception_debug_counter_ = 0;  // 感知调试数据降频计数
 
   // 可视化器
   std::unique_ptr<viz::IVisualizer> visualizer_;
@@ -270,6 +384,7 @@ private:
   std::vector<plugin::TrajectoryPoint> hold_trajectory_;
   std::string hold_planner_name_;
   int hold_last_velocity_sign_ = 0;
+  bool first_trajectory_printed_ = false;  // 首条轨迹的调试打印只输出一次
 
   // 仿真状态
   std::atomic<bool> simulation_started_{false};
@@ -277,10 +392,23 @@ private:
   std::atomic<bool> simulation_paused_{true};  // 默认启动时暂停
   std::string current_scenario_file_;  // 当前加载的场景文件路径
 
+  // 仿真主循环调度器
+  TickScheduler loop_scheduler_;
+
+  // 暂停状态下的感知结果缓存（场景未变化时复用，见 renderPausedFrame）
+  struct PausedViewCache;
+  std::unique_ptr<PausedViewCache> paused_view_cache_;
+
+  // 每帧复用的前置处理管线 / PerceptionInput / PlanningContext（见 processTick）
+  struct TickWorkspace;
+  std::unique_ptr<TickWorkspace> tick_workspace_;
+
   // 内部函数
   void setupPluginSystem();
+  void renderPausedFrame();
   void updateStatistics(double total_time, double perception_time, double planning_time, bool success);
-  bool isGoalReached(const sim::WorldState& world_state) const;
+  void setupLatencyStages();
+  void dumpLatencyMetricsIfDue(bool force = false);
   bool isNearGoal(const proto::WorldTick& world_tick) const;
   std::vector<plugin::TrajectoryPoint> trimTrajectoryForCurrentPose(
     const std::vector<plugin::TrajectoryPoint>& trajectory,
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <nlohmann/json.hpp>
+
+namespace navsim {
+namespace metrics {
+
+/**
+ * @brief HDR 风格的无锁延迟直方图（微秒）
+ *
+ * 桶按 2 的幂分段，每段再线性细分为 kSubBuckets 个子桶：
+ * - [0, kSubBuckets) us 每 1us 一个桶（精确）
+ * - 之后每段 [2^m, 2^(m+1)) 分为 kSubBuckets 个等宽桶，相对误差不超过 1/kSubBuckets
+ *
+ * record() 只做 relaxed 原子加法（最大值用 CAS），可被任意线程并发调用。
+ */
+class LatencyHistogram {
+public:
+  static constexpr int kSubBucketBits = 4;
+  static constexpr uint64_t kSubBuckets = 1ull << kSubBucketBits;   // 16 → 误差 ≤ 6.25%
+  static constexpr int kMaxMagnitude = 36;                           // 上限 2^36 us（约 19 小时）
+  static constexpr size_t kBucketCount = (kMaxMagnitude - kSubBucketBits + 1) * kSubBuckets;
+
+  /**
+   * @brief 某一时刻的只读副本，用于计算分位数
+   */
+  struct Snapshot {
+    std::array<uint64_t, kBucketCount> buckets{};
+    uint64_t count = 0;
+    uint64_t sum_us = 0;
+    uint64_t max_us = 0;
+
+    /**
+     * @brief 估算分位数（返回所在桶的上界，不超过最大值）
+     * @param quantile [0, 1]
+     */
+    double percentile(double quantile) const;
+
+    double mean() const { return count > 0 ? static_cast<double>(sum_us) / count : 0.0; }
+  };
+
+  LatencyHistogram() = default;
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  void record(double value_us);
+
+  Snapshot snapshot() const;
+
+  /**
+   * @brief 清空（与并发 record() 之间不保证原子性）
+   */
+  void reset();
+
+  static size_t bucketIndex(uint64_t value_us);
+
+  /**
+   * @brief 桶的上界（不含，微秒）
+   */
+  static uint64_t bucketUpperBound(size_t index);
+
+private:
+  std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+  std::atomic<uint64_t> sum_us_{0};
+  std::atomic<uint64_t> max_us_{0};
+};
+
+/**
+ * @brief 按阶段命名的延迟指标集合
+ *
+ * 阶段在首次 stage() 时创建（加锁），返回的引用在对象生命周期内有效，
+ * 调用方应在初始化时缓存，热路径上只调用 Stage::record()。
+ */
+class LatencyMetrics {
+public:
+  struct Stage {
+    explicit Stage(std::string stage_name) : name(std::move(stage_name)) {}
+
+    /**
+     * @brief 记录一次耗时
+     * @param latency_ms 耗时 (ms)
+     * @param deadline_ms 截止时间 (ms)，<= 0 表示不检查
+     */
+    void record(double latency_ms, double deadline_ms = 0.0) {
+      histogram.record(latency_ms * 1000.0);
+      if (deadline_ms > 0.0 && latency_ms > deadline_ms) {
+        deadline_misses.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    const std::string name;
+    LatencyHistogram histogram;
+    std::atomic<uint64_t> deadline_misses{0};
+  };
+
+  LatencyMetrics() = default;
+  LatencyMetrics(const LatencyMetrics&) = delete;
+  LatencyMetrics& operator=(const LatencyMetrics&) = delete;
+
+  /**
+   * @brief 获取（必要时创建）阶段
+   */
+  Stage& stage(const std::string& name);
+
+  /**
+   * @brief 导出为 JSON：{"stages": {name: {count, mean_ms, p50_ms, p90_ms, p99_ms, max_ms, deadline_misses}}}
+   */
+  nlohmann::json toJson() const;
+
+  /**
+   * @brief 导出为 Prometheus 文本格式（summary 类型，单位秒）
+   */
+  std::string toPrometheus() const;
+
+  /**
+   * @brief 写入文件（扩展名为 .prom 时使用 Prometheus 格式，否则 JSON）
+   *
+   * 先写临时文件再重命名，读取方（如 node_exporter textfile collector）不会看到半个文件。
+   */
+  bool dump(const std::string& path) const;
+
+  void reset();
+
+private:
+  mutable std::mutex mutex_;
+  std::deque<std::unique_ptr<Stage>> stages_;
+};
+
+} // namespace metrics
+} // namespace navsim
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief 编译期最低日志级别：0=DEBUG 1=INFO 2=WARN 3=ERROR 4=OFF
+ *
+ * 低于该级别的日志语句是常量假分支，由编译器整体删除（参数表达式也不会求值）。
+ */
+#ifndef NAVSIM_LOG_MIN_LEVEL
+#define NAVSIM_LOG_MIN_LEVEL 0
+#endif
+
+namespace navsim {
+namespace log {
+
+enum class Level : int {
+  DEBUG = 0,
+  INFO = 1,
+  WARN = 2,
+  ERROR = 3,
+  OFF = 4
+};
+
+/**
+ * @brief 从名称解析日志级别（"debug" / "info" / "warn" / "error" / "off"）
+ */
+bool parseLevel(const std::string& name, Level& level);
+
+/**
+ * @brief 异步日志器
+ *
+ * - 调用线程只格式化消息并写入有界多生产者队列（无锁），不做终端 I/O；
+ *   队列满时丢弃消息并计数，不阻塞调用线程
+ * - 后台线程批量写出：INFO 及以下写 stdout，WARN 及以上写 stderr，
+ *   每批只 flush 一次；WARN/ERROR 会立即唤醒写出线程
+ * - 运行期级别默认 INFO，可由环境变量 NAVSIM_LOG_LEVEL 或 setLevel() 修改
+ *
+ * 位于 navsim_plugin_framework 共享库中，平台与所有插件共用同一个实例。
+ */
+class Logger {
+public:
+  static constexpr size_t kQueueCapacity = 1 << 12;  // 必须是 2 的幂
+
+  static Logger& instance();
+
+  static bool enabled(Level level) {
+    return static_cast<int>(level) >= level_.load(std::memory_order_relaxed);
+  }
+
+  static void setLevel(Level level) {
+    level_.store(static_cast<int>(level), std::memory_order_relaxed);
+  }
+
+  static Level level() { return static_cast<Level>(level_.load(std::memory_order_relaxed)); }
+
+  /**
+   * @brief 提交一条已格式化的消息（不含换行）
+   * @return 队列已满被丢弃时返回 false
+   */
+  bool submit(Level level, std::string message);
+
+  /**
+   * @brief 在调用线程中同步写出队列中的所有消息
+   */
+  void flush();
+
+  /**
+   * @brief 停止写出线程并写出剩余消息；之后的消息在调用线程中同步写出
+   */
+  void shutdown();
+
+  /**
+   * @brief 替换输出流（测试或需要重定向时使用，调用方保证流的生命周期）
+   */
+  void setOutput(std::ostream& out, std::ostream& err);
+
+  uint64_t droppedMessages() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  struct Slot;
+
+  Logger();
+  Logger(const Logger&) = delete;
+  Logger& operator=(const Logger&) = delete;
+
+  void writerLoop();
+  void drainLocked();
+
+  static std::atomic<int> level_;
+
+  // 有界 MPSC 队列（每个槽位带序号，生产者通过 CAS 领取位置）
+  std::unique_ptr<Slot[]> slots_;
+  alignas(64) std::atomic<uint64_t> enqueue_pos_{0};
+  alignas(64) uint64_t dequeue_pos_ = 0;   // 仅在持有 write_mutex_ 时访问
+  std::atomic<uint64_t> dropped_{0};
+  uint64_t reported_dropped_ = 0;
+
+  // 写出（消费端）
+  std::mutex write_mutex_;
+  std::ostream* out_;
+  std::ostream* err_;
+
+  // 后台写出线程
+  std::thread writer_;
+  std::mutex wake_mutex_;
+  std::condition_variable wake_cv_;
+  bool stop_writer_ = false;
+  std::atomic<bool> running_{false};
+};
+
+/**
+ * @brief 单条日志的格式化缓冲，析构时提交
+ */
+class LogLine {
+public:
+  LogLine(Level level, const char* tag) : level_(level) {
+    stream_ << '[' << tag << "] ";
+  }
+
+  ~LogLine() { Logger::instance().submit(level_, stream_.str()); }
+
+  LogLine(const LogLine&) = delete;
+  LogLine& operator=(const LogLine&) = delete;
+
+  std::ostream& stream() { return stream_; }
+
+private:
+  Level level_;
+  std::ostringstream stream_;
+};
+
+/**
+ * @brief 将流表达式转换为 void，使日志宏可以用在条件表达式中
+ */
+struct Voidify {
+  void operator&(std::ostream&) {}
+};
+
+// ========== 单个调用点的限频 ==========
+
+inline bool everyN(std::atomic<uint64_t>& counter, uint64_t n) {
+  return n <= 1 || counter.fetch_add(1, std::memory_order_relaxed) % n == 0;
+}
+
+inline bool throttle(std::atomic<int64_t>& last_ns, double period_s) {
+  const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  int64_t last = last_ns.load(std::memory_order_relaxed);
+  if (last != std::numeric_limits<int64_t>::min() &&
+      now - last < static_cast<int64_t>(period_s * 1e9)) {
+    return false;
+  }
+  return last_ns.compare_exchange_strong(last, now, std::memory_order_relaxed);
+}
+
+} // namespace log
+} // namespace navsim
+
+#define NAVSIM_LOG_COMPILED(level) \
+  (static_cast<int>(::navsim::log::Level::level) >= NAVSIM_LOG_MIN_LEVEL)
+
+#define NAVSIM_LOG_IF(level, tag, condition)                                        \
+  !(NAVSIM_LOG_COMPILED(level) && ::navsim::log::Logger::enabled(::navsim::log::Level::level) && \
+    (condition))                                                                    \
+    ? (void)0                                                                       \
+    : ::navsim::log::Voidify() & ::navsim::log::LogLine(::navsim::log::Level::level, tag).stream()
+
+/**
+ * @brief 流式日志，例如 NAVSIM_LOG(INFO, "Bridge") << "Sent plan with " << n << " points";
+ */
+#define NAVSIM_LOG(level, tag) NAVSIM_LOG_IF(level, tag, true)
+
+/**
+ * @brief 每个调用点每 n 次输出一次
+ */
+#define NAVSIM_LOG_EVERY_N(level, tag, n)                                     \
+  NAVSIM_LOG_IF(level, tag, ::navsim::log::everyN(                            \
+      []() -> std::atomic<uint64_t>& {                                        \
+        static std::atomic<uint64_t> site_counter{0};                         \
+        return site_counter;                                                  \
+      }(), (n)))
+
+/**
+ * @brief 每个调用点每 period_s 秒最多输出一次
+ */
+#define NAVSIM_LOG_THROTTLE(level, tag, period_s)                             \
+  NAVSIM_LOG_IF(level, tag, ::navsim::log::throttle(                          \
+      []() -> std::atomic<int64_t>& {                                         \
+        static std::atomic<int64_t> site_last_ns{std::numeric_limits<int64_t>::min()}; \
+        return site_last_ns;                                                  \
+      }(), (period_s)))
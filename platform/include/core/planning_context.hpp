@@ -326,12 +326,91 @@ struct PlanningContext {
   }
 
   bool hasCustomData(const std::string& key) const {
-    return custom_data.find(key) != custom_data.end();
+    auto it = custom_data.find(key);
+    return it != custom_data.end() && it->second != nullptr;
   }
 
   void clearCustomData() {
     custom_data.clear();
   }
+
+  /**
+   * @brief 以本帧输入开始新的一帧，复用上一帧的存储
+   *
+   * 供每帧复用同一个上下文的调用方使用（如 AlgorithmManager）：
+   * - ego / task / dynamic_obstacles / bev_obstacles 按值覆写，沿用已有容量；
+   *   本帧没有 BEV 障碍物时 bev_obstacles 置空，与新建上下文一致
+   * - custom_data 保留键、清空值（hasCustomData() 对空值返回 false）
+   * - occupancy_grid / esdf_map / lane_lines 置空：本帧没有感知插件产出时，
+   *   规划器看到的是“无地图”而不是上一帧的旧地图；上一帧的对象移入备用池，
+   *   产出它们的感知插件通过 acquireOccupancyGrid() 等取回并原地覆写
+   */
+  void resetForTick(const EgoVehicle& tick_ego,
+                    const PlanningTask& tick_task,
+                    const BEVObstacles& tick_bev_obstacles,
+                    const std::vector<DynamicObstacle>& tick_dynamic_obstacles);
+
+  /**
+   * @brief 取得本帧的栅格地图，供感知插件覆写
+   *
+   * 本帧已产出时返回现有对象；否则优先复用 resetForTick() 移入备用池的上一帧对象，
+   * 其内容为上一帧数据，调用方需完整覆写。
+   */
+  OccupancyGrid& acquireOccupancyGrid() { return acquire(occupancy_grid, spare_occupancy_grid_); }
+
+  /**
+   * @brief 取得本帧的 ESDF 地图，规则同 acquireOccupancyGrid()
+   */
+  ESDFMap& acquireESDFMap() { return acquire(esdf_map, spare_esdf_map_); }
+
+  /**
+   * @brief 取得本帧的车道线，规则同 acquireOccupancyGrid()
+   */
+  LaneLines& acquireLaneLines() { return acquire(lane_lines, spare_lane_lines_); }
+
+  /**
+   * @brief 深拷贝上下文
+   *
+   * 地图类数据（occupancy_grid / esdf_map / bev_obstacles / lane_lines）逐项复制，
+   * 供并发执行的规划器各自持有一份；custom_data 为类型擦除的 shared_ptr，
+   * 只复制指针，规划器应将其视为只读。
+   */
+  PlanningContext clone() const {
+    PlanningContext copy;
+    copy.ego = ego;
+    copy.task = task;
+    copy.planning_horizon = planning_horizon;
+    copy.timestamp = timestamp;
+    if (occupancy_grid) {
+      copy.occupancy_grid = std::make_unique<OccupancyGrid>(*occupancy_grid);
+    }
+    if (esdf_map) {
+      copy.esdf_map = std::make_unique<ESDFMap>(*esdf_map);
+    }
+    if (bev_obstacles) {
+      copy.bev_obstacles = std::make_unique<BEVObstacles>(*bev_obstacles);
+    }
+    if (lane_lines) {
+      copy.lane_lines = std::make_unique<LaneLines>(*lane_lines);
+    }
+    copy.dynamic_obstacles = dynamic_obstacles;
+    copy.custom_data = custom_data;
+    return copy;
+  }
+
+private:
+  template<typename T>
+  static T& acquire(std::unique_ptr<T>& current, std::unique_ptr<T>& spare) {
+    if (!current) {
+      current = spare ? std::move(spare) : std::make_unique<T>();
+    }
+    return *current;
+  }
+
+  // resetForTick() 移出的上一帧地图，仅用于复用存储，规划器不可见
+  std::unique_ptr<OccupancyGrid> spare_occupancy_grid_;
+  std::unique_ptr<ESDFMap> spare_esdf_map_;
+  std::unique_ptr<LaneLines> spare_lane_lines_;
 };
 
 } // namespace planning
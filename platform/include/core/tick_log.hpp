@@ -0,0 +1,113 @@
+#pragma once
+
+#include "tick_log.pb.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace navsim {
+namespace record {
+
+/**
+ * @brief WorldTick 记录日志格式
+ *
+ * 文件 = 8 字节魔数 "NAVTICK1" + 若干条记录；
+ * 每条记录 = 4 字节小端长度 + 序列化后的 proto::TickRecord。
+ *
+ * 只追加写入。进程崩溃时丢失最近一次刷新之后的记录（刷新间隔见
+ * TickLogWriter::setFlushInterval()），尾部的不完整记录在读取时被忽略。
+ */
+constexpr char kTickLogMagic[] = "NAVTICK1";
+constexpr size_t kTickLogMagicSize = 8;
+
+/**
+ * @brief 记录日志写入器
+ *
+ * 写入带缓冲，每 flushInterval() 条记录刷新一次（默认每条），close() 或析构时落盘。
+ * 非线程安全，由调用方串行调用。
+ */
+class TickLogWriter {
+public:
+  TickLogWriter() = default;
+  ~TickLogWriter();
+
+  TickLogWriter(const TickLogWriter&) = delete;
+  TickLogWriter& operator=(const TickLogWriter&) = delete;
+
+  /**
+   * @brief 创建（截断）日志文件并写入魔数
+   */
+  bool open(const std::string& path);
+
+  /**
+   * @brief 追加一条记录
+   */
+  bool append(const proto::TickRecord& record);
+
+  /**
+   * @brief 设置刷新间隔：每写入 records 条记录刷新一次缓冲，0 表示只在 flush() / close() 时刷新
+   */
+  void setFlushInterval(uint32_t records) { flush_interval_ = records; }
+  uint32_t flushInterval() const { return flush_interval_; }
+
+  void flush();
+  void close();
+
+  bool isOpen() const { return file_.is_open(); }
+  uint64_t recordCount() const { return record_count_; }
+  const std::string& path() const { return path_; }
+
+private:
+  std::ofstream file_;
+  std::string path_;
+  std::string buffer_;  // 复用的序列化缓冲区
+  uint64_t record_count_ = 0;
+  uint32_t flush_interval_ = 1;
+};
+
+/**
+ * @brief 记录日志读取器
+ *
+ * 以只读 mmap 映射整个文件，open() 时扫描一遍建立记录偏移索引，
+ * 之后 read() 可随机访问任意记录，解析直接在映射内存上进行。
+ */
+class TickLogReader {
+public:
+  TickLogReader() = default;
+  ~TickLogReader();
+
+  TickLogReader(const TickLogReader&) = delete;
+  TickLogReader& operator=(const TickLogReader&) = delete;
+
+  bool open(const std::string& path);
+  void close();
+
+  size_t size() const { return index_.size(); }
+
+  /**
+   * @brief 解析第 i 条记录
+   */
+  bool read(size_t i, proto::TickRecord& record) const;
+
+  /**
+   * @brief 文件尾部是否存在被忽略的不完整记录
+   */
+  bool truncated() const { return truncated_; }
+
+private:
+  struct Entry {
+    size_t offset;  // 负载起始偏移
+    uint32_t length;
+  };
+
+  const uint8_t* data_ = nullptr;
+  size_t file_size_ = 0;
+  std::vector<Entry> index_;
+  bool truncated_ = false;
+};
+
+}  // namespace record
+}  // namespace navsim
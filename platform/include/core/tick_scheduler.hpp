@@ -0,0 +1,126 @@
+#pragma once
+
+#include "core/latency_metrics.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace navsim {
+
+/**
+ * @brief 实时节拍调度器
+ *
+ * 以绝对截止时间驱动固定频率循环：每个节拍的截止时间为
+ * start + k * period，通过 sleep_until() 等待，避免相对休眠累积漂移，
+ * 也避免 1ms 轮询带来的空转唤醒。
+ *
+ * 当上一个节拍的工作超过其时间片（超时）时：
+ * - SKIP: 丢弃错过的节拍，立即执行一次，dt 覆盖丢弃的时长
+ * - BURST: 依次补执行错过的节拍（每次 dt = period），最多 max_burst_ticks 个，
+ *   超出部分丢弃
+ *
+ * 使用示例：
+ * ```cpp
+ * TickScheduler scheduler(config);
+ * scheduler.start();
+ * while (running) {
+ *   auto tick = scheduler.waitForNextTick();
+ *   step(tick.dt);
+ * }
+ * ```
+ */
+class TickScheduler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief 超时追赶策略
+   */
+  enum class CatchUpPolicy {
+    SKIP,   // 丢弃错过的节拍
+    BURST   // 补执行错过的节拍
+  };
+
+  struct Config {
+    double rate_hz = 30.0;                          // 循环频率 (Hz)
+    CatchUpPolicy catch_up = CatchUpPolicy::SKIP;   // 超时追赶策略
+    int max_burst_ticks = 3;                        // BURST 模式下最多补执行的节拍数
+  };
+
+  /**
+   * @brief 节拍统计
+   */
+  struct Statistics {
+    uint64_t ticks = 0;            // 已执行的节拍数
+    uint64_t overruns = 0;         // 进入节拍时已超过截止时间的次数
+    uint64_t skipped_ticks = 0;    // 因超时被丢弃的节拍数
+    uint64_t burst_ticks = 0;      // BURST 模式下补执行的节拍数（不含超出上限被丢弃的）
+    metrics::LatencyHistogram::Snapshot jitter_us;   // 按时节拍的唤醒延迟（实际唤醒 - 截止时间）
+    metrics::LatencyHistogram::Snapshot overrun_us;  // 超时节拍的超出时长（进入时间 - 截止时间）
+  };
+
+  /**
+   * @brief 单个节拍的信息
+   */
+  struct TickInfo {
+    uint64_t index = 0;           // 节拍序号
+    double dt = 0.0;              // 与上一节拍截止时间的间隔 (s)
+    bool overrun = false;         // 是否为超时节拍
+    uint64_t skipped_ticks = 0;   // 本节拍之前丢弃的节拍数
+    Clock::time_point deadline;   // 本节拍的截止时间
+  };
+
+  TickScheduler() = default;
+  explicit TickScheduler(const Config& config);
+
+  /**
+   * @brief 从字符串解析追赶策略（"skip" / "burst"）
+   */
+  static bool parseCatchUpPolicy(const std::string& name, CatchUpPolicy& policy);
+
+  /**
+   * @brief 以当前时间为基准重新开始调度（不清空统计）
+   *
+   * 第一个节拍的截止时间为 now + period。
+   */
+  void start();
+
+  /**
+   * @brief 等待下一个节拍
+   *
+   * 未到截止时间时休眠到截止时间；已超时时按追赶策略立即返回。
+   */
+  TickInfo waitForNextTick();
+
+  /**
+   * @brief 节拍周期
+   */
+  Clock::duration period() const { return period_; }
+
+  const Config& getConfig() const { return config_; }
+
+  /**
+   * @brief 节拍统计（直方图为调用时刻的快照）
+   */
+  Statistics getStatistics() const;
+
+  void resetStatistics();
+
+private:
+  Config config_;
+  Clock::duration period_ = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(1.0 / 30.0));
+  Clock::time_point next_deadline_;
+  Clock::time_point last_deadline_;
+  bool started_ = false;
+  uint64_t pending_burst_ = 0;  // 已计入 burst_ticks、尚未补执行的节拍数
+  Statistics stats_;  // 计数部分；直方图单独记录，getStatistics() 时取快照
+
+  // LatencyHistogram 不可移动，放在堆上以保持调度器可赋值
+  std::unique_ptr<metrics::LatencyHistogram> jitter_us_ = std::make_unique<metrics::LatencyHistogram>();
+  std::unique_ptr<metrics::LatencyHistogram> overrun_us_ = std::make_unique<metrics::LatencyHistogram>();
+};
+
+} // namespace navsim
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace navsim {
+namespace trace {
+
+/**
+ * @brief 一条完整的耗时事件（Chrome trace 中的 "X" 事件）
+ */
+struct TraceEvent {
+  int64_t start_ns = 0;          // steady_clock 时间戳
+  int64_t duration_ns = 0;
+  const char* category = "";     // 必须是字符串字面量
+  char name[48] = {};            // 超长名称被截断
+};
+
+/**
+ * @brief 进程级追踪器
+ *
+ * - 每个线程首次记录时注册一个单生产者/单消费者环形缓冲区，记录路径上没有锁；
+ *   缓冲区满时丢弃事件并计数，不阻塞调用线程
+ * - 后台线程周期性地取出所有缓冲区中的事件，以 Chrome/Perfetto JSON 格式写入文件
+ * - 未开启时每个追踪点只有一次 relaxed 原子读
+ *
+ * 位于 navsim_plugin_framework 共享库中，平台与所有插件共用同一个实例。
+ */
+class Tracer {
+public:
+  static constexpr size_t kBufferCapacity = 1 << 13;  // 每线程事件数，必须是 2 的幂
+
+  static Tracer& instance();
+
+  /**
+   * @brief 是否正在记录
+   */
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief 当前 steady_clock 时间 (ns)
+   */
+  static int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /**
+   * @brief 开始记录到文件（已在记录时先结束上一次会话）
+   * @param output_file 输出的 JSON 文件路径
+   * @param flush_interval 后台写出周期
+   * @return 文件无法打开时返回 false
+   */
+  bool start(const std::string& output_file,
+             std::chrono::milliseconds flush_interval = std::chrono::milliseconds(50));
+
+  /**
+   * @brief 停止记录，写出剩余事件并关闭文件
+   */
+  void stop();
+
+  /**
+   * @brief 记录一条事件（未开启时直接返回）
+   */
+  void record(const char* category, const char* name, int64_t start_ns, int64_t end_ns);
+
+  /**
+   * @brief 设置当前线程在 trace 中显示的名称
+   */
+  void setThreadName(const std::string& name);
+
+  uint64_t writtenEvents() const { return written_events_.load(std::memory_order_relaxed); }
+  uint64_t droppedEvents() const;
+
+private:
+  struct ThreadBuffer;
+  struct ThreadHandle;
+
+  Tracer() = default;
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+
+  ThreadBuffer& localBuffer();
+  void flushLoop();
+  void drain();
+  void writeEvent(const TraceEvent& event, uint32_t tid);
+
+  static std::atomic<bool> enabled_;
+
+  // 线程缓冲区注册表（仅在线程首次记录和后台写出时加锁）
+  mutable std::mutex registry_mutex_;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+  std::vector<std::pair<uint32_t, std::string>> thread_names_;
+  uint32_t next_tid_ = 1;
+  uint64_t retired_dropped_ = 0;
+
+  // 会话
+  std::mutex session_mutex_;
+  std::ofstream output_;
+  std::string pending_;
+  int64_t origin_ns_ = 0;
+  std::atomic<uint64_t> written_events_{0};
+
+  // 后台写出线程
+  std::thread flusher_;
+  std::mutex flush_mutex_;
+  std::condition_variable flush_cv_;
+  bool stop_flusher_ = false;
+  std::chrono::milliseconds flush_interval_{50};
+};
+
+/**
+ * @brief RAII 追踪区间，析构或调用 end() 时记录
+ */
+class TraceScope {
+public:
+  TraceScope(const char* category, const char* name) {
+    if (Tracer::enabled()) {
+      begin(category, name);
+    }
+  }
+
+  TraceScope(const char* category, const std::string& name) {
+    if (Tracer::enabled()) {
+      begin(category, name.c_str());
+    }
+  }
+
+  ~TraceScope() { end(); }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+  /**
+   * @brief 提前结束区间（用于不便加作用域的顺序代码）
+   */
+  void end() {
+    if (active_) {
+      active_ = false;
+      Tracer::instance().record(category_, name_, start_ns_, Tracer::now());
+    }
+  }
+
+private:
+  void begin(const char* category, const char* name);
+
+  bool active_ = false;
+  const char* category_ = "";
+  char name_[sizeof(TraceEvent::name)];
+  int64_t start_ns_ = 0;
+};
+
+} // namespace trace
+} // namespace navsim
+
+#define NAVSIM_TRACE_CONCAT_IMPL(a, b) a##b
+#define NAVSIM_TRACE_CONCAT(a, b) NAVSIM_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief 追踪当前作用域，例如 NAVSIM_TRACE_SCOPE("planning", "JpsPlanner::search")
+ */
+#define NAVSIM_TRACE_SCOPE(category, name) \
+  ::navsim::trace::TraceScope NAVSIM_TRACE_CONCAT(navsim_trace_scope_, __LINE__)(category, name)
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace navsim {
+namespace worker {
+
+/**
+ * @brief 进程级常驻工作线程池
+ *
+ * - 线程在首次使用时创建并一直保留，每次并行调用不再有线程组创建/销毁开销
+ * - 每个工作线程有自己的任务队列：parallelFor 的第 i 项固定交给第 i % size() 个线程，
+ *   配合 CPU 亲和性，同一个求解器每帧都在同一个核上运行（缓存与求解器内存保持局部）
+ * - 在工作线程内部再次调用 parallelFor 时直接在当前线程串行执行，避免嵌套并行超额占用核心
+ *
+ * 位于 navsim_plugin_framework 共享库中，平台与所有插件共用同一个实例。
+ */
+class WorkerPool {
+public:
+  struct Config {
+    int threads = 0;                // <= 0 表示使用 hardware_concurrency
+    std::vector<int> cpu_affinity;  // 第 k 个线程绑定到 cpu_affinity[k % size]；为空则不绑定
+  };
+
+  /**
+   * @brief 设置共享线程池的配置，必须在首次调用 shared() 之前
+   * @return 线程池已启动且配置不同时返回 false（配置不生效）
+   */
+  static bool configure(const Config& config);
+
+  /**
+   * @brief 共享线程池（首次调用时按 configure() 的配置启动）
+   */
+  static WorkerPool& shared();
+
+  explicit WorkerPool(const Config& config);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  size_t size() const { return workers_.size(); }
+
+  /**
+   * @brief 并行执行 body(0) ... body(n - 1)，全部完成后返回
+   *
+   * 第 i 项在第 i % size() 个工作线程上执行。任一项抛出异常时，
+   * 等待其余项完成后在调用线程重新抛出第一个异常。
+   */
+  void parallelFor(size_t n, const std::function<void(size_t)>& body);
+
+  /**
+   * @brief 当前线程是否为本线程池的工作线程
+   */
+  bool isWorkerThread() const;
+
+private:
+  struct Worker {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> queue;
+    bool stop = false;
+  };
+
+  void enqueue(size_t worker_index, std::function<void()> task);
+  void workerLoop(size_t worker_index, int cpu);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+} // namespace worker
+} // namespace navsim
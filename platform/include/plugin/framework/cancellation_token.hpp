@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace navsim {
+namespace plugin {
+
+/**
+ * @brief 协作式取消令牌
+ *
+ * 由 PlannerPluginManager 在每次规划前重置并绑定到规划器。
+ * 以下两种情况视为已取消：
+ * - 管理器显式调用 cancel()（例如竞速模式下主规划器已按时完成）
+ * - 超过 reset() 时设置的截止时间
+ *
+ * 令牌不会中断线程，规划器需要在阶段边界（如搜索与优化之间）
+ * 轮询 PlannerPluginInterface::isCancelled()，发现取消后尽快返回 false。
+ */
+class CancellationToken {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief 重置令牌
+   *
+   * @param deadline 截止时间，默认永不超时
+   */
+  void reset(Clock::time_point deadline = Clock::time_point::max()) {
+    deadline_ticks_.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+    cancelled_.store(false, std::memory_order_release);
+  }
+
+  /**
+   * @brief 请求取消
+   */
+  void cancel() {
+    cancelled_.store(true, std::memory_order_release);
+  }
+
+  /**
+   * @brief 检查是否已取消（显式取消或已超过截止时间）
+   */
+  bool isCancelled() const {
+    if (cancelled_.load(std::memory_order_acquire)) {
+      return true;
+    }
+    return Clock::now().time_since_epoch().count() >=
+           deadline_ticks_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<bool> cancelled_{false};
+  std::atomic<Clock::rep> deadline_ticks_{std::numeric_limits<Clock::rep>::max()};
+};
+
+} // namespace plugin
+} // namespace navsim
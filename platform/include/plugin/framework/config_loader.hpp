@@ -37,6 +37,11 @@ namespace plugin {
  *     "primary_planner": "AStarPlannerPlugin",
  *     "fallback_planner": "StraightLinePlannerPlugin",
  *     "enable_fallback": true,
+ *     "execution_mode": "sequential",
+ *     "portfolio": {
+ *       "planners": ["AStarPlannerPlugin", "JpsPlanner"],
+ *       "scoring": {"clearance_weight": 1.0}
+ *     },
  *     "planners": {
  *       "AStarPlannerPlugin": {
  *         "time_step": 0.1,
@@ -109,6 +114,27 @@ public:
     return enable_fallback_;
   }
   
+  /**
+   * @brief 获取规划器执行模式（"sequential" 或 "race"）
+   */
+  const std::string& getPlannerExecutionMode() const {
+    return planner_execution_mode_;
+  }
+  
+  /**
+   * @brief 获取组合模式的规划器列表
+   */
+  const std::vector<std::string>& getPortfolioPlannerNames() const {
+    return portfolio_planner_names_;
+  }
+  
+  /**
+   * @brief 获取组合模式的评分参数
+   */
+  const nlohmann::json& getPortfolioScoringConfig() const {
+    return portfolio_scoring_config_;
+  }
+  
   /**
    * @brief 获取规划器配置
    */
@@ -160,6 +186,9 @@ private:
   std::string primary_planner_name_;
   std::string fallback_planner_name_;
   bool enable_fallback_ = false;
+  std::string planner_execution_mode_ = "sequential";
+  std::vector<std::string> portfolio_planner_names_;
+  nlohmann::json portfolio_scoring_config_ = nlohmann::json::object();
   nlohmann::json planner_configs_;
 };
 
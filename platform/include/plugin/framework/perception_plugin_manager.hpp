@@ -2,6 +2,7 @@
 
 #include "plugin/framework/perception_plugin_interface.hpp"
 #include "plugin/framework/plugin_registry.hpp"
+#include "core/latency_metrics.hpp"
 #include <nlohmann/json.hpp>
 #include <vector>
 #include <string>
@@ -124,6 +125,12 @@ public:
    */
   nlohmann::json getStatistics() const;
 
+  /**
+   * @brief 设置延迟指标，每个插件的耗时记录到 "perception/<插件名>" 阶段
+   * @param metrics 为空时不记录；须在插件加载之后调用，且生命周期长于本对象
+   */
+  void setLatencyMetrics(metrics::LatencyMetrics* metrics);
+
 private:
   /**
    * @brief 按优先级排序插件
@@ -138,6 +145,9 @@ private:
   
   // 是否已初始化
   bool initialized_ = false;
+
+  // 每个插件对应的延迟阶段（与 plugins_ 一一对应，未设置指标时为空）
+  std::vector<metrics::LatencyMetrics::Stage*> plugin_stages_;
 };
 
 } // namespace plugin
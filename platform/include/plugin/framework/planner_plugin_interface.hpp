@@ -1,6 +1,7 @@
 #pragma once
 
 #include "plugin/data/planning_result.hpp"
+#include "plugin/framework/cancellation_token.hpp"
 #include "plugin/framework/plugin_metadata.hpp"
 #include "core/planning_context.hpp"
 #include <nlohmann/json.hpp>
@@ -195,6 +196,30 @@ public:
   bool canBeFallback() const {
     return getMetadata().can_be_fallback;
   }
+
+  // ========== 协作式取消 ==========
+
+  /**
+   * @brief 绑定取消令牌（由 PlannerPluginManager 调用）
+   *
+   * @param token 取消令牌，传入 nullptr 表示解除绑定
+   */
+  void setCancellationToken(std::shared_ptr<const CancellationToken> token) {
+    cancellation_token_ = std::move(token);
+  }
+
+  /**
+   * @brief 检查当前规划是否已被取消
+   *
+   * 耗时较长的规划器应在阶段边界调用此方法，
+   * 返回 true 时应放弃后续计算并返回失败。
+   */
+  bool isCancelled() const {
+    return cancellation_token_ && cancellation_token_->isCancelled();
+  }
+
+private:
+  std::shared_ptr<const CancellationToken> cancellation_token_;
 };
 
 /**
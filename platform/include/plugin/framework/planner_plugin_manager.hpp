@@ -1,11 +1,17 @@
 #pragma once
 
+#include "plugin/framework/cancellation_token.hpp"
 #include "plugin/framework/planner_plugin_interface.hpp"
 #include "plugin/framework/plugin_registry.hpp"
 #include <nlohmann/json.hpp>
 #include <string>
 #include <memory>
 #include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
 
 namespace navsim {
 namespace plugin {
@@ -21,18 +27,69 @@ namespace plugin {
  * 2. initialize() - 初始化所有规划器
  * 3. plan() - 执行规划（主规划器失败时使用降级规划器）
  * 4. reset() - 重置所有规划器
+ *
+ * 执行模式：
+ * - SEQUENTIAL: 先执行主规划器，失败后再执行降级规划器
+ * - RACE: 主规划器在常驻后台线程上执行，降级规划器在调用线程上同时执行；
+ *   主规划器在截止时间内成功则采用其结果，否则在截止时间返回降级规划器结果，
+ *   主规划器留在后台执行完毕（或响应取消后返回），仍在执行时下一帧只运行降级规划器
+ * - PORTFOLIO: 组合中的所有规划器各持一份上下文副本，在共享工作线程池上并发执行，
+ *   截止时间内成功的结果由评分函数择优；全部失败时再尝试降级规划器
+ *   （降级规划器本身是组合成员时结果已知，不再重复执行）
  */
 class PlannerPluginManager {
 public:
+  /**
+   * @brief 规划执行模式
+   */
+  enum class ExecutionMode {
+    SEQUENTIAL,  // 串行：主规划器失败后才尝试降级规划器
+    RACE,        // 竞速：主规划器与降级规划器并发执行
+    PORTFOLIO    // 组合：多个规划器并发执行，按评分择优
+  };
+
+  /**
+   * @brief 组合模式评分函数，分数越低越好
+   *
+   * 只对成功的规划结果调用。
+   */
+  using ScoringFunction = std::function<double(const PlanningResult&)>;
+
+  /**
+   * @brief 创建默认评分函数
+   *
+   * score = total_cost
+   *       + (constraints_satisfied ? 0 : infeasible_penalty)
+   *       - clearance_weight * min(metadata["min_clearance"], clearance_cap)
+   *
+   * @param scoring_config 评分参数，缺省项使用默认值：
+   *   {"infeasible_penalty": 1e6, "clearance_weight": 1.0, "clearance_cap": 2.0}
+   */
+  static ScoringFunction makeDefaultScoringFunction(const nlohmann::json& scoring_config = {});
+
+  /**
+   * @brief 从字符串解析执行模式（"sequential" / "race" / "portfolio"）
+   *
+   * @param name 模式名称
+   * @param mode 解析结果（输出）
+   * @return 名称是否有效
+   */
+  static bool parseExecutionMode(const std::string& name, ExecutionMode& mode);
+
+  /**
+   * @brief 执行模式名称
+   */
+  static std::string executionModeName(ExecutionMode mode);
+
   /**
    * @brief 构造函数
    */
-  PlannerPluginManager() = default;
+  PlannerPluginManager();
   
   /**
-   * @brief 析构函数
+   * @brief 析构函数（等待后台执行的主规划器返回）
    */
-  ~PlannerPluginManager() = default;
+  ~PlannerPluginManager();
   
   /**
    * @brief 从配置加载规划器
@@ -60,6 +117,33 @@ public:
       const std::string& fallback_planner_name,
       bool enable_fallback,
       const nlohmann::json& planner_configs);
+
+  /**
+   * @brief 加载组合模式的规划器列表
+   *
+   * 需要在 loadPlanners() 之后、initialize() 之前调用。
+   * 与主/降级规划器同名的条目复用已加载的实例，其余条目各自创建实例，
+   * 参数从 loadPlanners() 传入的 planner_configs 中读取。
+   *
+   * @param planner_names 组合中的规划器名称
+   * @param scoring_config 默认评分函数参数（见 makeDefaultScoringFunction）
+   * @return 加载是否成功
+   */
+  bool loadPortfolio(
+      const std::vector<std::string>& planner_names,
+      const nlohmann::json& scoring_config = {});
+
+  /**
+   * @brief 替换组合模式的评分函数
+   */
+  void setScoringFunction(ScoringFunction scoring_function) {
+    scoring_function_ = std::move(scoring_function);
+  }
+
+  /**
+   * @brief 获取组合模式的规划器名称
+   */
+  std::vector<std::string> getPortfolioPlannerNames() const;
   
   /**
    * @brief 初始化所有规划器
@@ -109,6 +193,23 @@ public:
   bool isFallbackEnabled() const {
     return enable_fallback_;
   }
+
+  /**
+   * @brief 设置执行模式
+   *
+   * RACE 模式需要启用降级规划器，PORTFOLIO 模式需要先调用 loadPortfolio()，
+   * 条件不满足时按 SEQUENTIAL 执行。
+   */
+  void setExecutionMode(ExecutionMode mode) {
+    execution_mode_ = mode;
+  }
+
+  /**
+   * @brief 获取执行模式
+   */
+  ExecutionMode getExecutionMode() const {
+    return execution_mode_;
+  }
   
   /**
    * @brief 获取统计信息
@@ -116,14 +217,65 @@ public:
   nlohmann::json getStatistics() const;
 
 private:
+  /**
+   * @brief 串行执行：主规划器失败后尝试降级规划器
+   */
+  bool planSequential(
+      const planning::PlanningContext& context,
+      std::chrono::milliseconds deadline,
+      PlanningResult& result);
+
+  /**
+   * @brief 竞速执行：主规划器在后台线程上与降级规划器并发执行，最迟在截止时间返回
+   */
+  bool planRace(
+      const planning::PlanningContext& context,
+      std::chrono::milliseconds deadline,
+      PlanningResult& result);
+
+  /**
+   * @brief 组合执行：所有组合规划器并发执行，按评分择优
+   */
+  bool planPortfolio(
+      const planning::PlanningContext& context,
+      std::chrono::milliseconds deadline,
+      PlanningResult& result);
+
+  /**
+   * @brief 统计已在后台结束、尚未计入的竞速主规划器结果
+   */
+  void collectRacePrimary();
+
+  /**
+   * @brief 取消并等待后台执行的竞速主规划器（之后才能在其他模式下使用主规划器）
+   */
+  void waitForRacePrimary();
+
+  /**
+   * @brief 重置降级规划器的取消令牌并开启新的一代
+   *
+   * @return 本次重置对应的代数，供 cancelFallback() 使用
+   */
+  uint64_t resetFallbackToken(CancellationToken::Clock::time_point deadline = CancellationToken::Clock::time_point::max());
+
+  /**
+   * @brief 仅当令牌仍属于 generation 这一代时取消降级规划器
+   *
+   * 超时返回的竞速主规划器可能在下一帧已重置令牌后才调用，此时不能取消新一帧的降级规划器。
+   */
+  void cancelFallback(uint64_t generation);
+
   /**
    * @brief 尝试使用指定规划器进行规划
    * 
+   * 可能在工作线程上调用，因此不修改统计信息。
+   * 
    * @param planner 规划器
    * @param planner_name 规划器名称
    * @param context 规划上下文
    * @param deadline 截止时间
    * @param result 规划结果（输出）
+   * @param elapsed_ms 规划耗时（输出）
    * @return 规划是否成功
    */
   bool tryPlan(
@@ -131,7 +283,8 @@ private:
       const std::string& planner_name,
       const planning::PlanningContext& context,
       std::chrono::milliseconds deadline,
-      PlanningResult& result);
+      PlanningResult& result,
+      double& elapsed_ms);
   
   // 主规划器
   PlannerPluginPtr primary_planner_;
@@ -144,6 +297,40 @@ private:
   // 是否启用降级机制
   bool enable_fallback_ = false;
 
+  // 执行模式
+  ExecutionMode execution_mode_ = ExecutionMode::SEQUENTIAL;
+
+  // 竞速模式主规划器的常驻后台线程
+  class RaceWorker;
+  std::unique_ptr<RaceWorker> race_worker_;
+
+  // 竞速模式主规划器的本次执行（在后台线程上写入，线程结束后才读取）
+  struct RacePrimaryRun {
+    planning::PlanningContext context;  // 上下文副本：主规划器可能比 plan() 调用存活得更久
+    PlanningResult result;
+    bool success = false;
+    double elapsed_ms = 0.0;
+    bool pending = false;               // 已超过截止时间，结束后计入统计
+    double fallback_ms = 0.0;           // 该帧降级规划器耗时
+    double tick_ms = 0.0;               // 该帧 plan() 耗时
+  } race_primary_;
+
+  // 协作式取消令牌（每个规划器一个）
+  std::shared_ptr<CancellationToken> primary_cancel_token_ = std::make_shared<CancellationToken>();
+  std::shared_ptr<CancellationToken> fallback_cancel_token_ = std::make_shared<CancellationToken>();
+  std::mutex fallback_token_mutex_;     // 保护降级令牌的重置与按代取消
+  uint64_t fallback_token_generation_ = 0;
+
+  // 组合模式规划器
+  struct PortfolioEntry {
+    std::string name;
+    PlannerPluginPtr planner;
+    std::shared_ptr<CancellationToken> cancel_token;
+    bool owned = true;  // false 表示复用主/降级规划器实例（由其负责初始化和重置）
+  };
+  std::vector<PortfolioEntry> portfolio_;
+  ScoringFunction scoring_function_ = makeDefaultScoringFunction();
+
   // 是否已初始化
   bool initialized_ = false;
 
@@ -158,6 +345,22 @@ private:
     size_t fallback_success = 0;
     size_t fallback_failure = 0;
     double total_time_ms = 0.0;
+
+    // 竞速模式统计
+    size_t race_calls = 0;
+    size_t race_primary_wins = 0;       // 主规划器按时成功
+    size_t race_primary_late = 0;       // 主规划器成功但超过截止时间
+    size_t race_primary_busy = 0;       // 上一帧的主规划器仍在执行，本帧只运行降级规划器
+    size_t race_fallback_wins = 0;      // 采用降级规划器结果
+    size_t race_no_winner = 0;          // 两者均失败
+    double race_latency_saved_ms = 0.0;      // 相比串行执行节省的累计延迟
+    double race_max_latency_saved_ms = 0.0;  // 单次最大节省延迟
+
+    // 组合模式统计
+    size_t portfolio_calls = 0;
+    size_t portfolio_no_winner = 0;                   // 截止时间内无成功结果
+    std::map<std::string, size_t> portfolio_wins;     // 各规划器被选中次数
+    std::map<std::string, size_t> portfolio_late;     // 各规划器成功但超时次数
   } stats_;
 };
 
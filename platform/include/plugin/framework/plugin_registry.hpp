@@ -7,6 +7,7 @@
 #include <string>
 #include <functional>
 #include <iostream>
+#include <mutex>
 
 namespace navsim {
 namespace plugin {
@@ -38,6 +39,7 @@ public:
    * @return 注册是否成功
    */
   bool registerPlugin(const std::string& name, PerceptionPluginFactory factory) {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (factories_.find(name) != factories_.end()) {
       std::cerr << "[PerceptionPluginRegistry] Plugin '" << name 
                 << "' already registered!" << std::endl;
@@ -56,14 +58,20 @@ public:
    * @return 插件实例，如果插件未注册则返回 nullptr
    */
   PerceptionPluginPtr createPlugin(const std::string& name) const {
-    auto it = factories_.find(name);
-    if (it == factories_.end()) {
-      std::cerr << "[PerceptionPluginRegistry] Plugin '" << name 
-                << "' not found!" << std::endl;
-      return nullptr;
+    PerceptionPluginFactory factory;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = factories_.find(name);
+      if (it == factories_.end()) {
+        std::cerr << "[PerceptionPluginRegistry] Plugin '" << name 
+                  << "' not found!" << std::endl;
+        return nullptr;
+      }
+      factory = it->second;
     }
     
-    return it->second();
+    // 工厂在锁外调用：每次返回新的实例，插件状态不在实例之间共享
+    return factory();
   }
   
   /**
@@ -73,6 +81,7 @@ public:
    * @return 是否已注册
    */
   bool hasPlugin(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
     return factories_.find(name) != factories_.end();
   }
   
@@ -82,6 +91,7 @@ public:
    * @return 插件名称列表
    */
   std::vector<std::string> getPluginNames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
     std::vector<std::string> names;
     for (const auto& pair : factories_) {
       names.push_back(pair.first);
@@ -93,6 +103,7 @@ public:
    * @brief 获取已注册插件数量
    */
   size_t getPluginCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
     return factories_.size();
   }
 
@@ -104,7 +115,8 @@ private:
   PerceptionPluginRegistry(const PerceptionPluginRegistry&) = delete;
   PerceptionPluginRegistry& operator=(const PerceptionPluginRegistry&) = delete;
   
-  // 插件工厂函数映射表
+  // 插件工厂函数映射表（多个 AlgorithmManager 可在不同线程并发注册/创建）
+  mutable std::mutex mutex_;
   std::map<std::string, PerceptionPluginFactory> factories_;
 };
 
@@ -131,6 +143,7 @@ public:
    * @return 注册是否成功
    */
   bool registerPlugin(const std::string& name, PlannerPluginFactory factory) {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (factories_.find(name) != factories_.end()) {
       std::cerr << "[PlannerPluginRegistry] Plugin '" << name 
                 << "' already registered!" << std::endl;
@@ -149,14 +162,20 @@ public:
    * @return 插件实例，如果插件未注册则返回 nullptr
    */
   PlannerPluginPtr createPlugin(const std::string& name) const {
-    auto it = factories_.find(name);
-    if (it == factories_.end()) {
-      std::cerr << "[PlannerPluginRegistry] Plugin '" << name 
-                << "' not found!" << std::endl;
-      return nullptr;
+    PlannerPluginFactory factory;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = factories_.find(name);
+      if (it == factories_.end()) {
+        std::cerr << "[PlannerPluginRegistry] Plugin '" << name 
+                  << "' not found!" << std::endl;
+        return nullptr;
+      }
+      factory = it->second;
     }
     
-    return it->second();
+    // 工厂在锁外调用：每次返回新的实例，插件状态不在实例之间共享
+    return factory();
   }
   
   /**
@@ -166,6 +185,7 @@ public:
    * @return 是否已注册
    */
   bool hasPlugin(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
     return factories_.find(name) != factories_.end();
   }
   
@@ -175,6 +195,7 @@ public:
    * @return 插件名称列表
    */
   std::vector<std::string> getPluginNames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
     std::vector<std::string> names;
     for (const auto& pair : factories_) {
       names.push_back(pair.first);
@@ -186,6 +207,7 @@ public:
    * @brief 获取已注册插件数量
    */
   size_t getPluginCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
     return factories_.size();
   }
 
@@ -197,7 +219,8 @@ private:
   PlannerPluginRegistry(const PlannerPluginRegistry&) = delete;
   PlannerPluginRegistry& operator=(const PlannerPluginRegistry&) = delete;
   
-  // 插件工厂函数映射表
+  // 插件工厂函数映射表（多个 AlgorithmManager 可在不同线程并发注册/创建）
+  mutable std::mutex mutex_;
   std::map<std::string, PlannerPluginFactory> factories_;
 };
 
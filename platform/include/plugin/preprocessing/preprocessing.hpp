@@ -9,6 +9,20 @@
 namespace navsim {
 namespace perception {
 
+/**
+ * @brief 取出 items 中下一个可复写的元素
+ *
+ * 已构造的元素直接复用（其内部 vector / string 保留容量），不足时才追加。
+ * 填充完成后用 items.resize(count) 去掉多余元素。
+ */
+template <typename T>
+T& reuseSlot(std::vector<T>& items, size_t& count) {
+  if (count == items.size()) {
+    items.emplace_back();
+  }
+  return items[count++];
+}
+
 /**
  * @brief BEV 障碍物提取器
  *
@@ -38,6 +52,11 @@ public:
    */
   std::unique_ptr<planning::BEVObstacles> extract(const proto::WorldTick& world_tick);
 
+  /**
+   * @brief 提取到已有对象中，复用其容器容量（稳态下不再分配内存）
+   */
+  void extract(const proto::WorldTick& world_tick, planning::BEVObstacles& obstacles);
+
   /**
    * @brief 重置提取器状态
    */
@@ -89,6 +108,12 @@ public:
    */
   std::vector<planning::DynamicObstacle> predict(const proto::WorldTick& world_tick);
 
+  /**
+   * @brief 预测到已有列表中，复用各障碍物的字符串与轨迹容量
+   */
+  void predict(const proto::WorldTick& world_tick,
+               std::vector<planning::DynamicObstacle>& obstacles);
+
   /**
    * @brief 设置预测参数
    */
@@ -162,6 +187,13 @@ public:
    */
   plugin::PerceptionInput process(const proto::WorldTick& world_tick);
 
+  /**
+   * @brief 处理 WorldTick，原地更新 PerceptionInput
+   *
+   * 每帧复用同一个 input 时，障碍物容器沿用上一帧的容量，稳态下不分配内存。
+   */
+  void process(const proto::WorldTick& world_tick, plugin::PerceptionInput& input);
+
   /**
    * @brief 设置配置
    */
@@ -193,6 +225,9 @@ private:
 
   // 统计信息
   Statistics stats_;
+
+  // 上次打印自车状态的 tick（BasicDataConverter 为无状态静态函数，日志节流放在管道实例上）
+  uint64_t last_ego_log_tick_ = 0;
 };
 
 } // namespace perception
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "sim/dynamic_obstacle_store.hpp"
+#include "sim/local_simulator.hpp"
+
+namespace navsim {
+namespace sim {
+
+// ========== 几何图元 ==========
+
+/**
+ * @brief 轴对齐包围盒
+ */
+struct Aabb {
+  double min_x = 0.0;
+  double min_y = 0.0;
+  double max_x = 0.0;
+  double max_y = 0.0;
+
+  bool overlaps(const Aabb& other) const {
+    return min_x <= other.max_x && other.min_x <= max_x &&
+           min_y <= other.max_y && other.min_y <= max_y;
+  }
+};
+
+/**
+ * @brief 有向包围盒（自车轮廓、矩形动态障碍物）
+ */
+struct OrientedBox {
+  double cx = 0.0;           // 中心
+  double cy = 0.0;
+  double yaw = 0.0;          // 长边方向
+  double half_length = 0.0;  // 沿 yaw 方向的半长
+  double half_width = 0.0;   // 垂直 yaw 方向的半宽
+
+  Aabb bounds() const;
+};
+
+// ========== 窄相测试 ==========
+
+bool boxIntersectsCircle(const OrientedBox& box, double cx, double cy, double radius);
+bool boxIntersectsBox(const OrientedBox& a, const OrientedBox& b);
+
+/**
+ * @brief 有向包围盒与任意简单多边形（可非凸）相交测试
+ *
+ * 相交当且仅当：任一边与盒相交，或盒中心在多边形内（盒完全被包含）。
+ */
+bool boxIntersectsPolygon(const OrientedBox& box, const std::vector<planning::Point2d>& polygon);
+
+// ========== 碰撞世界 ==========
+
+/**
+ * @brief 仿真碰撞检测子系统
+ *
+ * 粗相：
+ * - 静态障碍物：加载场景时构建一次的均匀网格（CSR 布局），
+ *   跨多个格子的障碍物只在查询框与其包围盒交集的最小角所在格子中测试，无需去重
+ * - 动态障碍物：按中心点分格的哈希网格，每步只重新挂接跨格的障碍物；
+ *   查询框按最大障碍物外接半径扩展
+ *
+ * 窄相：自车有向包围盒分别与圆、多边形、有向包围盒做精确测试。
+ *
+ * 动态障碍物按 (Block, 行号) 引用 DynamicObstacleStore，存储增删后需要 rebuildDynamic()。
+ * 拷贝开销只与动态障碍物数量相关：静态网格在副本之间共享。
+ */
+class CollisionWorld {
+public:
+  struct Config {
+    double static_cell_size = 0.0;   // 静态网格边长 (m)，<= 0 时按障碍物尺寸自动选择
+    double dynamic_cell_size = 0.0;  // 动态网格边长 (m)，<= 0 时按最大障碍物尺寸自动选择
+    size_t max_static_cells = 1 << 20;
+  };
+
+  /**
+   * @brief 碰撞结果
+   */
+  struct Hit {
+    enum class Kind { STATIC, DYNAMIC } kind = Kind::STATIC;
+    uint32_t index = 0;                   // 静态障碍物下标 / 动态障碍物在所属 Block 中的行号
+    MotionModel model = MotionModel::CV;  // 动态障碍物所属 Block
+  };
+
+  CollisionWorld() = default;
+  explicit CollisionWorld(const Config& config) : config_(config) {}
+
+  // ========== 构建 ==========
+
+  void buildStatic(const std::vector<StaticObstacle>& obstacles);
+
+  void rebuildDynamic(const DynamicObstacleStore& store);
+
+  /**
+   * @brief 障碍物移动后增量更新动态网格（仅跨格的障碍物重新挂接）
+   *
+   * 障碍物数量变化时自动退化为 rebuildDynamic()。
+   */
+  void updateDynamic(const DynamicObstacleStore& store);
+
+  // ========== 查询 ==========
+
+  /**
+   * @brief 是否与任一障碍物相交
+   */
+  bool collides(const OrientedBox& box, const DynamicObstacleStore& store) const;
+
+  /**
+   * @brief 收集所有相交的障碍物（追加到 hits）
+   */
+  void collect(const OrientedBox& box, const DynamicObstacleStore& store,
+               std::vector<Hit>& hits) const;
+
+  size_t staticCount() const { return static_grid_ ? static_grid_->shapes.size() : 0; }
+  size_t dynamicCount() const { return dynamic_refs_.size(); }
+
+private:
+  struct StaticShape {
+    uint32_t source = 0;  // 在 buildStatic() 输入中的下标
+    Aabb bounds;
+    StaticObstacle::Type type = StaticObstacle::Type::CIRCLE;
+    double cx = 0.0, cy = 0.0, radius = 0.0;
+    std::vector<planning::Point2d> points;
+  };
+
+  struct StaticGrid {
+    std::vector<StaticShape> shapes;
+    Aabb bounds;                       // 所有静态障碍物的包围盒
+    double cell = 1.0;
+    int cols = 0;
+    int rows = 0;
+    std::vector<uint32_t> cell_start;  // 大小 cols * rows + 1
+    std::vector<uint32_t> items;
+  };
+
+  struct DynamicRef {
+    MotionModel model = MotionModel::CV;
+    uint32_t row = 0;
+    int64_t cell = 0;   // 当前所在格子
+    uint32_t slot = 0;  // 在格子列表中的位置，用于 O(1) 移除
+  };
+
+  // 遍历查询框覆盖的候选障碍物，visitor 返回 false 时提前结束
+  template <typename Visitor>
+  bool visitStatic(const OrientedBox& box, Visitor&& visitor) const;
+  template <typename Visitor>
+  bool visitDynamic(const OrientedBox& box, const DynamicObstacleStore& store,
+                    Visitor&& visitor) const;
+
+  bool testStatic(const OrientedBox& box, const StaticShape& shape) const;
+  bool testDynamic(const OrientedBox& box, const DynamicObstacleStore& store,
+                   const DynamicRef& ref) const;
+
+  int64_t dynamicCellKey(double x, double y) const;
+  void insertDynamic(uint32_t index, int64_t cell);
+  void eraseDynamic(uint32_t index);
+
+  Config config_;
+
+  // 静态网格：构建后只读，拷贝 CollisionWorld 时共享
+  std::shared_ptr<const StaticGrid> static_grid_;
+
+  // 动态网格
+  std::vector<DynamicRef> dynamic_refs_;
+  std::unordered_map<int64_t, std::vector<uint32_t>> dynamic_cells_;
+  double dynamic_cell_ = 1.0;
+  double dynamic_max_extent_ = 0.0;  // 障碍物中心到轮廓的最大距离
+};
+
+} // namespace sim
+} // namespace navsim
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/planning_context.hpp"
+#include "world_tick.pb.h"
+
+namespace navsim {
+namespace sim {
+
+// ========== 运动模型 ==========
+
+/**
+ * @brief 动态障碍物运动模型
+ */
+enum class MotionModel : uint8_t {
+  CV = 0,    // 恒速：世界系速度 (vx, vy) 与角速度 omega 保持不变
+  CA,        // 恒加速：世界系加速度 (ax, ay) 保持不变
+  CTRV,      // 恒转率恒速：沿 yaw 方向以 |v| 行驶，yaw 以 omega 匀速转动
+  CUSTOM     // 外部控制，仿真器不积分
+};
+
+constexpr size_t kMotionModelCount = 4;
+
+/**
+ * @brief 运动模型名称（"cv" / "ca" / "ctrv" / "custom"），与 WorldTick.model 一致
+ */
+const char* motionModelName(MotionModel model);
+
+/**
+ * @brief 从名称解析运动模型
+ */
+bool parseMotionModel(const std::string& name, MotionModel& model);
+
+// ========== 动态障碍物 ==========
+
+/**
+ * @brief 单个动态障碍物（用于场景编辑接口和按下标读取）
+ *
+ * 仿真器内部以 DynamicObstacleStore 的列式布局存储，该结构只是单条记录的视图。
+ */
+struct DynamicObstacle {
+  std::string id;
+  planning::Pose2d pose;
+  planning::Twist2d twist;
+  double accel_x = 0.0;       // 世界系加速度 (m/s²)，仅 CA 模型使用
+  double accel_y = 0.0;
+
+  // 形状信息 (简化版本，后续可扩展)
+  enum class Shape : uint8_t { CIRCLE, RECTANGLE } shape = Shape::CIRCLE;
+  double radius = 0.3;        // 圆形半径 (m)
+  double width = 1.0;         // 矩形宽度 (m)
+  double height = 1.0;        // 矩形高度 (m)
+
+  MotionModel model = MotionModel::CV;
+
+  DynamicObstacle() = default;
+  DynamicObstacle(const std::string& id_) : id(id_) {}
+};
+
+// ========== ID 驻留表 ==========
+
+/**
+ * @brief 障碍物 ID 驻留表
+ *
+ * 字符串 ID 只在添加时哈希一次，之后存储和比较都使用 32 位下标。
+ * 同时缓存 ID 的整数形式，供 PlanningContext（使用 int ID）直接读取。
+ */
+class ObstacleIdTable {
+public:
+  /**
+   * @brief 驻留 ID，已存在时返回原下标
+   */
+  uint32_t intern(const std::string& id);
+
+  /**
+   * @brief 查找 ID，不存在时返回 false
+   */
+  bool find(const std::string& id, uint32_t& index) const;
+
+  const std::string& name(uint32_t index) const { return names_[index]; }
+
+  /**
+   * @brief ID 的整数形式：纯数字 ID 取其数值，否则取 -(下标 + 1)，避免与数字 ID 冲突
+   */
+  int numericId(uint32_t index) const { return numeric_ids_[index]; }
+
+  size_t size() const { return names_.size(); }
+
+  void clear();
+
+private:
+  std::vector<std::string> names_;
+  std::vector<int> numeric_ids_;
+  std::unordered_map<std::string, uint32_t> lookup_;
+};
+
+// ========== 动态障碍物存储 ==========
+
+/**
+ * @brief 列式（SoA）动态障碍物存储
+ *
+ * 每种运动模型一个 Block，Block 内每个字段一列连续数组，
+ * 积分时按模型对整列执行无分支的循环（便于编译器向量化），
+ * 不再逐个障碍物比较模型字符串。
+ *
+ * 遍历顺序：按 MotionModel 枚举顺序依次遍历各 Block，Block 内保持插入顺序。
+ */
+class DynamicObstacleStore {
+public:
+  struct Block {
+    std::vector<uint32_t> id;                   // ObstacleIdTable 下标
+    std::vector<double> x, y, yaw;
+    std::vector<double> vx, vy, omega;
+    std::vector<double> ax, ay;
+    std::vector<DynamicObstacle::Shape> shape;
+    std::vector<double> radius, width, height;
+
+    size_t size() const { return id.size(); }
+    bool empty() const { return id.empty(); }
+  };
+
+  // ========== 容量与编辑 ==========
+
+  size_t size() const;
+  bool empty() const { return size() == 0; }
+
+  void reserve(size_t count);
+
+  void add(const DynamicObstacle& obstacle);
+
+  /**
+   * @brief 移除所有指定 ID 的障碍物
+   * @return 是否移除了至少一个
+   */
+  bool remove(const std::string& id);
+
+  /**
+   * @brief 清空障碍物和 ID 表
+   */
+  void clear();
+
+  // ========== 访问 ==========
+
+  /**
+   * @brief 按遍历顺序读取第 i 个障碍物（组装为 DynamicObstacle）
+   */
+  DynamicObstacle operator[](size_t index) const;
+
+  const Block& block(MotionModel model) const { return blocks_[static_cast<size_t>(model)]; }
+
+  const ObstacleIdTable& ids() const { return ids_; }
+
+  // ========== 积分 ==========
+
+  /**
+   * @brief 按各自的运动模型积分所有障碍物（CUSTOM 不积分）
+   */
+  void integrate(double dt);
+
+  static void integrateConstantVelocity(Block& block, double dt);
+  static void integrateConstantAcceleration(Block& block, double dt);
+  static void integrateCtrv(Block& block, double dt);
+
+  // ========== 批量转换 ==========
+
+  /**
+   * @brief 追加到 WorldTick.dynamic_obstacles（预分配后逐列写入）
+   */
+  void appendTo(proto::WorldTick& world_tick) const;
+
+  /**
+   * @brief 追加到 PlanningContext 格式的障碍物列表
+   */
+  void appendTo(std::vector<planning::DynamicObstacle>& obstacles) const;
+
+private:
+  std::array<Block, kMotionModelCount> blocks_;
+  ObstacleIdTable ids_;
+};
+
+} // namespace sim
+} // namespace navsim
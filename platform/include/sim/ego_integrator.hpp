@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+
+#include "core/planning_context.hpp"
+#include "world_tick.pb.h"
+
+namespace navsim {
+namespace sim {
+
+/**
+ * @brief 数值积分方法
+ */
+enum class IntegrationMethod {
+  EULER,     // 一阶显式欧拉
+  MIDPOINT,  // 二阶中点法
+  RK4        // 四阶龙格-库塔
+};
+
+/**
+ * @brief 从名称解析积分方法（"euler" / "midpoint" / "rk4"）
+ */
+bool parseIntegrationMethod(const std::string& name, IntegrationMethod& method);
+
+/**
+ * @brief 自车运动学模型
+ *
+ * - DIFFERENTIAL: 差速/履带底盘，车体系速度 (vx, vy) 与角速度 omega 直接作用
+ * - ACKERMANN: 后轴中心为参考点的自行车模型，omega 换算为前轮转角并按
+ *   max_steer 限幅，忽略横向速度 vy，低速时不能原地转向
+ */
+struct EgoKinematics {
+  enum class Type { DIFFERENTIAL, ACKERMANN } type = Type::DIFFERENTIAL;
+  double wheelbase = 0.0;   // 轴距 (m)
+  double max_steer = 0.0;   // 最大前轮转角 (rad)，<= 0 表示不限幅
+
+  /**
+   * @brief 由底盘配置构造（"ackermann" / "four_wheel" 且轴距 > 0 时使用自行车模型）
+   */
+  static EgoKinematics fromChassis(const proto::ChassisConfig& chassis);
+};
+
+/**
+ * @brief 以恒定控制输入积分一个步长
+ *
+ * @param pose 当前位姿
+ * @param twist 车体系控制输入，步长内保持不变
+ * @param kinematics 运动学模型
+ * @param method 积分方法
+ * @param dt 步长 (s)
+ * @return 积分后的位姿（yaw 标准化到 [-π, π]）
+ */
+planning::Pose2d integrateEgoPose(const planning::Pose2d& pose,
+                                  const planning::Twist2d& twist,
+                                  const EgoKinematics& kinematics,
+                                  IntegrationMethod method,
+                                  double dt);
+
+} // namespace sim
+} // namespace navsim
@@ -7,6 +7,7 @@
 #include <functional>
 
 #include "core/planning_context.hpp"
+#include "sim/dynamic_obstacle_store.hpp"
 #include "world_tick.pb.h"
 
 namespace navsim {
@@ -15,14 +16,15 @@ namespace sim {
 // ========== 仿真配置 ==========
 
 struct PhysicsConfig {
-  std::string integration_method = "rk4";  // "euler", "rk4"
+  std::string integration_method = "rk4";  // "euler", "midpoint", "rk4"
   bool collision_detection = true;
   double friction_coefficient = 0.8;
+  int max_substeps = 100;                  // 单次 step() 最多执行的物理子步数，超出的时间丢弃
 };
 
 struct SimulatorConfig {
-  double time_step = 0.01;                 // 默认仿真步长 (s)
-  double max_time_step = 0.1;              // 最大仿真步长 (s)
+  double time_step = 0.01;                 // 固定物理子步长 (s)，与 step() 的调用频率无关
+  double max_time_step = 0.1;              // 单次 step() 接受的最大帧时长 (s)，在时间缩放前截断
   double time_scale = 1.0;                 // 时间缩放 (1.0=实时)
   bool enable_adaptive_stepping = true;    // 自适应步长
   PhysicsConfig physics;
@@ -34,25 +36,6 @@ struct VisualizationConfig {
   bool compress_data = false;              // 数据压缩
 };
 
-// ========== 动态障碍物 ==========
-
-struct DynamicObstacle {
-  std::string id;
-  planning::Pose2d pose;
-  planning::Twist2d twist;
-
-  // 形状信息 (简化版本，后续可扩展)
-  enum class Shape { CIRCLE, RECTANGLE } shape = Shape::CIRCLE;
-  double radius = 0.3;        // 圆形半径 (m)
-  double width = 1.0;         // 矩形宽度 (m)
-  double height = 1.0;        // 矩形高度 (m)
-
-  std::string model = "cv";   // "cv"=恒速, "ca"=恒加速, "custom"=自定义
-
-  DynamicObstacle() = default;
-  DynamicObstacle(const std::string& id_) : id(id_) {}
-};
-
 // ========== 静态障碍物 ==========
 
 struct StaticObstacle {
@@ -97,7 +80,7 @@ struct WorldState {
 
   // 环境信息
   std::vector<StaticObstacle> static_obstacles;
-  std::vector<DynamicObstacle> dynamic_obstacles;
+  DynamicObstacleStore dynamic_obstacles;  // 列式存储，按运动模型分块
 
   // 地图版本 (用于检测地图变更)
   uint32_t map_version = 1;
@@ -121,6 +104,33 @@ struct WorldState {
   }
 };
 
+// ========== 仿真快照 ==========
+
+/**
+ * @brief 仿真状态快照
+ *
+ * 不可变，拷贝只复制一个共享指针，可以在线程之间自由传递。
+ * 快照内的静态碰撞网格和初始状态与源仿真器共享，不随快照复制。
+ */
+class SimulationSnapshot {
+public:
+  SimulationSnapshot() = default;
+
+  bool valid() const { return data_ != nullptr; }
+
+  /**
+   * @brief 快照时刻的世界状态（快照无效时抛出 std::logic_error）
+   */
+  const WorldState& world_state() const;
+
+private:
+  friend class LocalSimulator;
+  struct Data;
+  explicit SimulationSnapshot(std::shared_ptr<const Data> data) : data_(std::move(data)) {}
+
+  std::shared_ptr<const Data> data_;
+};
+
 // ========== 仿真事件回调 ==========
 
 using SimulationStateCallback = std::function<void(bool is_running)>;
@@ -186,7 +196,12 @@ public:
 
   /**
    * @brief 执行单步仿真
-   * @param dt 时间步长 (s)，如果为0则使用配置的默认步长
+   *
+   * dt 经时间缩放后计入累加器，物理状态以固定的 time_step 推进整数个子步，
+   * 不足一个子步的余量留到下一次调用。因此只要累计时间相同，
+   * 无论调用方的 dt 如何抖动，积分结果都逐位一致。
+   *
+   * @param dt 帧时长 (s)，如果为0则使用配置的默认步长
    * @return 是否成功
    */
   bool step(double dt = 0.0);
@@ -196,6 +211,34 @@ public:
    */
   bool is_running() const;
 
+  // ========== 快照与分叉 ==========
+
+  /**
+   * @brief 保存当前仿真状态（世界状态、积分累加器、运行状态、碰撞网格）
+   *
+   * 回调函数不属于仿真状态，不会被保存。
+   */
+  SimulationSnapshot snapshot() const;
+
+  /**
+   * @brief 恢复到快照状态，保留当前回调
+   * @return 快照无效时返回 false
+   */
+  bool restore(const SimulationSnapshot& snapshot);
+
+  /**
+   * @brief 从快照创建独立的仿真器（不带回调）
+   *
+   * 只读取快照，多个线程可以同时从同一个快照分叉，各自推进互不影响，
+   * 用于从同一状态并行评估多条候选轨迹。
+   */
+  static std::unique_ptr<LocalSimulator> from_snapshot(const SimulationSnapshot& snapshot);
+
+  /**
+   * @brief 以当前状态分叉出独立的仿真器，等价于 from_snapshot(snapshot())
+   */
+  std::unique_ptr<LocalSimulator> fork() const;
+
   // ========== 状态访问 ==========
 
   /**
@@ -213,6 +256,27 @@ public:
    */
   uint64_t get_frame_id() const;
 
+  /**
+   * @brief 获取场景修订号
+   *
+   * 加载场景、重置、运行中的步进以及所有场景编辑操作都会递增修订号，
+   * 调用方可据此判断世界状态是否变化（例如暂停时跳过重复的感知处理）。
+   */
+  uint64_t get_scene_revision() const;
+
+  /**
+   * @brief 渲染插值系数：累加器余量 / time_step，范围 [0, 1)
+   */
+  double get_interpolation_alpha() const;
+
+  /**
+   * @brief 渲染用自车位姿：在最后一个物理子步的前后状态之间按插值系数插值
+   *
+   * 渲染频率高于物理频率或与之不整除时，用它代替 get_world_state().ego_pose
+   * 可以避免画面抖动；规划与碰撞检测仍应使用物理状态。
+   */
+  planning::Pose2d get_interpolated_ego_pose() const;
+
   // ========== 场景编辑 ==========
 
   /**
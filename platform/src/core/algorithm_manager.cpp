@@ -1,6 +1,9 @@
 #include "core/algorithm_manager.hpp"
 #include "plugin/framework/perception_plugin_manager.hpp"
 #include "core/bridge.hpp"
+#include "core/trace.hpp"
+#include "core/tick_log.hpp"
+#include "core/worker_pool.hpp"
 #include "plugin/framework/planner_plugin_manager.hpp"
 #include "plugin/data/perception_input.hpp"
 #include "plugin/data/planning_result.hpp"
@@ -22,6 +25,7 @@
 #include <atomic>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
 
 namespace {
 constexpr double kPi = 3.14159265358979323846;
@@ -60,17 +64,55 @@ int inferTrajectoryVelocitySign(const std::vector<navsim::plugin::TrajectoryPoin
 
 namespace navsim {
 
-AlgorithmManager::AlgorithmManager() : config_(Config{}) {}
+/**
+ * @brief 暂停状态下的感知结果缓存
+ *
+ * 暂停时世界状态通常不变，按场景修订号缓存前置处理与感知结果，
+ * 每帧只重新提交绘制。
+ */
+struct AlgorithmManager::PausedViewCache {
+  uint64_t scene_revision = 0;
+  bool valid = false;
+  plugin::PerceptionInput perception_input;
+  planning::PlanningContext context;
+  bool context_valid = false;
+};
+
+/**
+ * @brief 每帧复用的工作区
+ *
+ * 前置处理管线、PerceptionInput 与 PlanningContext 跨帧保留，
+ * 每帧原地覆写，稳态下各容器沿用已有容量而不再重新分配。
+ */
+struct AlgorithmManager::TickWorkspace {
+  perception::PreprocessingPipeline pipeline;
+  plugin::PerceptionInput perception_input;
+  planning::PlanningContext context;
+};
+
+AlgorithmManager::AlgorithmManager() : config_(Config{}) {
+  setupLatencyStages();
+}
 
 AlgorithmManager::AlgorithmManager(const Config& config)
-    : config_(config) {}
+    : config_(config) {
+  setupLatencyStages();
+}
 
-AlgorithmManager::~AlgorithmManager() = default;
+AlgorithmManager::~AlgorithmManager() {
+  dumpLatencyMetricsIfDue(true);
+}
 
 bool AlgorithmManager::initialize() {
   try {
     goal_hold_distance_ = config_.goal_hold_distance;
 
+    // 插件初始化时可能已开始使用共享线程池，须在此之前配置
+    worker::WorkerPool::Config pool_config;
+    pool_config.threads = config_.worker_threads;
+    pool_config.cpu_affinity = config_.worker_cpu_affinity;
+    worker::WorkerPool::configure(pool_config);
+
     std::cout << "[AlgorithmManager] Initializing with plugin system..." << std::endl;
     setupPluginSystem();
 
@@ -91,10 +133,10 @@ bool AlgorithmManager::initialize() {
     bool visualization_ready = false;
 
     std::cout << "[AlgorithmManager] Initializing visualizer..." << std::endl;
-    visualizer_ = viz::createVisualizer(true);
+    visualizer_ = viz::createVisualizer(config_.enable_visualization);
     if (visualizer_ && visualizer_->initialize()) {
       std::cout << "[AlgorithmManager] Visualizer initialized successfully" << std::endl;
-      visualization_ready = true;
+      visualization_ready = config_.enable_visualization;
 
       // 🎮 设置仿真控制回调
       auto* imgui_viz = dynamic_cast<viz::ImGuiVisualizer*>(visualizer_.get());
@@ -198,6 +240,72 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
                               std::chrono::milliseconds deadline,
                               proto::PlanUpdate& plan_update,
                               proto::EgoCmd& ego_cmd) {
+  last_tick_timings_ = TickTimings{};
+  const bool started = simulation_started_.load();
+  bool success = processTick(world_tick, deadline, plan_update, ego_cmd);
+
+  // 仿真未开始时不执行算法，也不记录
+  if (started && !config_.record_file.empty()) {
+    recordTick(world_tick, deadline, plan_update, success);
+  }
+  return success;
+}
+
+void AlgorithmManager::setRecordFile(const std::string& path) {
+  tick_log_writer_.reset();
+  record_open_failed_ = false;
+  config_.record_file = path;
+}
+
+void AlgorithmManager::recordTick(const proto::WorldTick& world_tick,
+                                  std::chrono::milliseconds deadline,
+                                  const proto::PlanUpdate& plan_update,
+                                  bool success) {
+  if (!tick_log_writer_) {
+    if (record_open_failed_) {
+      return;
+    }
+    tick_log_writer_ = std::make_unique<record::TickLogWriter>();
+    tick_log_writer_->setFlushInterval(static_cast<uint32_t>(std::max(0, config_.record_flush_interval)));
+    if (!tick_log_writer_->open(config_.record_file)) {
+      tick_log_writer_.reset();
+      record_open_failed_ = true;  // 只报一次错，之后不再尝试
+      return;
+    }
+    record_start_ = std::chrono::steady_clock::now();
+    std::cout << "[AlgorithmManager] Recording ticks to " << config_.record_file << std::endl;
+  }
+
+  proto::TickRecord record;
+  record.set_sequence(tick_log_writer_->recordCount());
+  record.set_recv_time(std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - record_start_).count());
+  record.set_deadline_ms(static_cast<double>(deadline.count()));
+  *record.mutable_world_tick() = world_tick;
+  *record.mutable_plan_update() = plan_update;
+  record.set_success(success);
+
+  auto add_timing = [&record](const char* stage, double latency_ms) {
+    if (latency_ms < 0.0) {
+      return;
+    }
+    auto* timing = record.add_timings();
+    timing->set_stage(stage);
+    timing->set_latency_ms(latency_ms);
+  };
+  add_timing("preprocessing", last_tick_timings_.preprocessing_ms);
+  add_timing("perception", last_tick_timings_.perception_ms);
+  add_timing("planning", last_tick_timings_.planning_ms);
+  add_timing("total", last_tick_timings_.total_ms);
+
+  tick_log_writer_->append(record);
+}
+
+bool AlgorithmManager::processTick(const proto::WorldTick& world_tick,
+                                   std::chrono::milliseconds deadline,
+                                   proto::PlanUpdate& plan_update,
+                                   proto::EgoCmd& ego_cmd) {
+  NAVSIM_TRACE_SCOPE("pipeline", "AlgorithmManager::process");
   stats_.total_processed++;
 
   // 🔧 检查仿真是否已开始
@@ -254,14 +362,31 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
 
   // Step 1: 前置处理（生成标准化的 PerceptionInput）
   auto preprocessing_start = std::chrono::steady_clock::now();
+  trace::TraceScope preprocessing_trace("pipeline", "preprocessing");
 
-  // 创建前置处理管线并处理
-  perception::PreprocessingPipeline preprocessing_pipeline;
-  plugin::PerceptionInput perception_input = preprocessing_pipeline.process(world_tick);
+  // 复用工作区中的前置处理管线与输出
+  if (!tick_workspace_) {
+    tick_workspace_ = std::make_unique<TickWorkspace>();
+  }
+  plugin::PerceptionInput& perception_input = tick_workspace_->perception_input;
+  tick_workspace_->pipeline.process(world_tick, perception_input);
+
+  preprocessing_trace.end();
 
   auto preprocessing_end = std::chrono::steady_clock::now();
   double preprocessing_time = std::chrono::duration<double, std::milli>(
       preprocessing_end - preprocessing_start).count();
+  latency_stages_.preprocessing->record(preprocessing_time);
+  last_tick_timings_.preprocessing_ms = preprocessing_time;
+
+  // 失败提前返回时同样计入总耗时
+  auto record_total_latency = [&]() {
+    double elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - total_start).count();
+    latency_stages_.total->record(elapsed_ms, static_cast<double>(deadline.count()));
+    last_tick_timings_.total_ms = elapsed_ms;
+    return elapsed_ms;
+  };
 
   // 🔍 调试日志：检查 perception_input 中的障碍物数据
   // std::cout << "[AlgorithmManager] ========== Perception Input Check ==========" << std::endl;
@@ -272,6 +397,7 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
 
   // 🎨 可视化感知输入数据
   if (visualizer_) {
+    NAVSIM_TRACE_SCOPE("viz", "draw perception input");
     // std::cout << "[AlgorithmManager] Calling visualizer->drawBEVObstacles()..." << std::endl;
     visualizer_->drawEgo(perception_input.ego);
     visualizer_->drawGoal(perception_input.task.goal_pose);
@@ -292,32 +418,25 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
 
   // Step 2: 感知插件处理
   auto perception_start = std::chrono::steady_clock::now();
+  trace::TraceScope perception_trace("pipeline", "perception");
 
-  planning::PlanningContext context;
-  // 复制基础数据到 context
-  context.ego = perception_input.ego;
-  context.task = perception_input.task;
-  context.dynamic_obstacles = perception_input.dynamic_obstacles;
-
-  // 🔧 复制 BEV 障碍物（静态障碍物）到 context
-  if (!perception_input.bev_obstacles.circles.empty() ||
-      !perception_input.bev_obstacles.rectangles.empty() ||
-      !perception_input.bev_obstacles.polygons.empty()) {
-    context.bev_obstacles = std::make_unique<planning::BEVObstacles>(perception_input.bev_obstacles);
-  }
+  // 复制基础数据与 BEV 障碍物（静态障碍物）到 context，沿用上一帧的存储
+  planning::PlanningContext& context = tick_workspace_->context;
+  context.resetForTick(perception_input.ego, perception_input.task,
+                       perception_input.bev_obstacles, perception_input.dynamic_obstacles);
 
   bool perception_success = perception_plugin_manager_->process(perception_input, context);
+  perception_trace.end();
 
   auto perception_end = std::chrono::steady_clock::now();
   double perception_time = std::chrono::duration<double, std::milli>(
       perception_end - perception_start).count();
-
-  if (visualizer_) {
-    visualizer_->updatePlanningContext(context);
-  }
+  latency_stages_.perception->record(perception_time);
+  last_tick_timings_.perception_ms = perception_time;
 
   if (!perception_success) {
     stats_.perception_failures++;
+    record_total_latency();
     if (config_.verbose_logging) {
       std::cerr << "[AlgorithmManager] Perception plugin processing failed" << std::endl;
     }
@@ -333,13 +452,17 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
     return false;
   }
 
-  // 🎨 可视化感知处理结果（如栅格地图）
+  // 🎨 可视化感知处理结果（如栅格地图），感知失败的帧不更新，避免显示不完整的地图
+  if (visualizer_) {
+    visualizer_->updatePlanningContext(context);
+  }
   if (visualizer_ && context.occupancy_grid) {
     visualizer_->drawOccupancyGrid(*context.occupancy_grid);
   }
 
   // Step 3: 规划器插件处理
   auto planning_start = std::chrono::steady_clock::now();
+  trace::TraceScope planning_trace("pipeline", "planning");
   auto remaining_time = deadline - std::chrono::duration_cast<std::chrono::milliseconds>(
       planning_start - total_start);
 
@@ -428,12 +551,16 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
     }
   }
 
+  planning_trace.end();
   auto planning_end = std::chrono::steady_clock::now();
   double planning_time = std::chrono::duration<double, std::milli>(
       planning_end - planning_start).count();
+  latency_stages_.planning->record(planning_time, static_cast<double>(remaining_time.count()));
+  last_tick_timings_.planning_ms = planning_time;
 
   if (!planning_success) {
     stats_.planning_failures++;
+    record_total_latency();
     if (config_.verbose_logging) {
       std::cerr << "[AlgorithmManager] Planning failed" << std::endl;
     }
@@ -455,6 +582,7 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
 
   // 🎨 可视化规划结果
   if (visualizer_) {
+    NAVSIM_TRACE_SCOPE("viz", "draw planning result");
     visualizer_->updatePlanningResult(planning_result);
     visualizer_->drawTrajectory(planning_result.trajectory, planning_result.planner_name);
 
@@ -604,11 +732,10 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
     ego_cmd.set_steering(0.0);  // 简化：假设转向角为0
   }
 
-  auto total_end = std::chrono::steady_clock::now();
-  double total_time = std::chrono::duration<double, std::milli>(
-      total_end - total_start).count();
+  double total_time = record_total_latency();
 
   updateStatistics(total_time, perception_time, planning_time, true);
+  dumpLatencyMetricsIfDue();
 
   // 🎨 显示性能调试信息
   if (visualizer_) {
@@ -638,11 +765,10 @@ bool AlgorithmManager::process(const proto::WorldTick& world_tick,
 
   // 🔧 发送感知调试数据到前端（如果 Bridge 已连接且启用）
   // 为了避免数据量过大导致卡顿，降低发送频率（每 10 帧发送一次）
-  static int perception_debug_counter = 0;
   if (bridge_ && bridge_->is_connected() && bridge_->is_perception_debug_enabled()) {
-    if (++perception_debug_counter >= 10) {
+    if (++perception_debug_counter_ >= 10) {
       bridge_->send_perception_debug(context);
-      perception_debug_counter = 0;
+      perception_debug_counter_ = 0;
     }
   }
 
@@ -684,6 +810,9 @@ void AlgorithmManager::reset() {
     trajectory_tracker_->reset();
   }
 
+  // 丢弃每帧工作区（含前置处理的静态地图缓存）
+  tick_workspace_.reset();
+
   // 重置播放状态
   playback_active_ = false;
   playback_elapsed_time_ = 0.0;
@@ -916,6 +1045,32 @@ void AlgorithmManager::updateStatistics(double total_time, double perception_tim
 
   stats_.avg_planning_time_ms =
     stats_.avg_planning_time_ms * (1.0 - alpha) + planning_time * alpha;
+
+  stats_.last_computation_time_ms = total_time;
+  stats_.last_perception_time_ms = perception_time;
+  stats_.last_planning_time_ms = planning_time;
+}
+
+void AlgorithmManager::setupLatencyStages() {
+  latency_stages_.total = &latency_metrics_.stage("total");
+  latency_stages_.preprocessing = &latency_metrics_.stage("preprocessing");
+  latency_stages_.perception = &latency_metrics_.stage("perception");
+  latency_stages_.planning = &latency_metrics_.stage("planning");
+  latency_stages_.tracking = &latency_metrics_.stage("tracking");
+}
+
+void AlgorithmManager::dumpLatencyMetricsIfDue(bool force) {
+  if (config_.metrics_output_file.empty()) {
+    return;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  auto interval = std::chrono::duration<double>(std::max(0.0, config_.metrics_dump_interval_s));
+  if (!force && now - last_metrics_dump_ < interval) {
+    return;
+  }
+  last_metrics_dump_ = now;
+  latency_metrics_.dump(config_.metrics_output_file);
 }
 
 bool AlgorithmManager::isGoalReached(const sim::WorldState& world_state) const {
@@ -1110,6 +1265,7 @@ void AlgorithmManager::setupPluginSystem() {
   // 加载插件
   perception_plugin_manager_->loadPlugins(perception_configs);
   perception_plugin_manager_->initialize();
+  perception_plugin_manager_->setLatencyMetrics(&latency_metrics_);
 
   std::cout << "[AlgorithmManager] Perception plugin manager initialized with "
             << perception_configs.size() << " plugins" << std::endl;
@@ -1119,6 +1275,7 @@ void AlgorithmManager::setupPluginSystem() {
 
   // 创建规划器配置
   nlohmann::json planner_configs;
+  nlohmann::json portfolio_scoring_config = nlohmann::json::object();
 
   // 从配置加载器获取规划器配置
   if (plugin_loader.getConfigLoader()) {
@@ -1135,6 +1292,17 @@ void AlgorithmManager::setupPluginSystem() {
       config_.fallback_planner = fallback_planner;
     }
 
+    std::string execution_mode = plugin_loader.getConfigLoader()->getPlannerExecutionMode();
+    if (!execution_mode.empty()) {
+      config_.planner_execution_mode = execution_mode;
+    }
+
+    const auto& portfolio = plugin_loader.getConfigLoader()->getPortfolioPlannerNames();
+    if (!portfolio.empty()) {
+      config_.planner_portfolio = portfolio;
+    }
+    portfolio_scoring_config = plugin_loader.getConfigLoader()->getPortfolioScoringConfig();
+
     std::cout << "[AlgorithmManager] Loaded planner configs from file" << std::endl;
     std::cout << "[AlgorithmManager] Primary planner from config: " << config_.primary_planner << std::endl;
     std::cout << "[AlgorithmManager] Fallback planner from config: " << config_.fallback_planner << std::endl;
@@ -1170,16 +1338,34 @@ void AlgorithmManager::setupPluginSystem() {
   }
 
   // 加载规划器（使用配置中的规划器名称）
-  planner_plugin_manager_->loadPlanners(
-      config_.primary_planner,   // 主规划器（从配置读取）
-      config_.fallback_planner,  // 降级规划器（从配置读取）
-      config_.enable_planner_fallback,  // 启用降级
-      planner_configs);
-  planner_plugin_manager_->initialize();
+  if (!planner_plugin_manager_->loadPlanners(
+          config_.primary_planner,   // 主规划器（从配置读取）
+          config_.fallback_planner,  // 降级规划器（从配置读取）
+          config_.enable_planner_fallback,  // 启用降级
+          planner_configs)) {
+    throw std::runtime_error("Failed to load planner: " + config_.primary_planner);
+  }
+
+  if (!config_.planner_portfolio.empty()) {
+    planner_plugin_manager_->loadPortfolio(config_.planner_portfolio, portfolio_scoring_config);
+  }
+
+  plugin::PlannerPluginManager::ExecutionMode execution_mode;
+  if (plugin::PlannerPluginManager::parseExecutionMode(config_.planner_execution_mode, execution_mode)) {
+    planner_plugin_manager_->setExecutionMode(execution_mode);
+  } else {
+    std::cerr << "[AlgorithmManager] Unknown planner execution mode '"
+              << config_.planner_execution_mode << "', using sequential" << std::endl;
+  }
+  if (!planner_plugin_manager_->initialize()) {
+    throw std::runtime_error("Failed to initialize planner plugin manager");
+  }
 
   std::cout << "[AlgorithmManager] Planner plugin manager initialized" << std::endl;
   std::cout << "  Primary planner: " << planner_plugin_manager_->getPrimaryPlannerName() << std::endl;
   std::cout << "  Fallback planner: " << planner_plugin_manager_->getFallbackPlannerName() << std::endl;
+  std::cout << "  Execution mode: " << plugin::PlannerPluginManager::executionModeName(
+      planner_plugin_manager_->getExecutionMode()) << std::endl;
 }
 
 // ========== 本地仿真集成方法 ==========
@@ -1244,11 +1430,21 @@ bool AlgorithmManager::run_simulation_loop(const std::atomic<bool>* external_int
     local_simulator_->pause();
   }
 
-  // 仿真主循环
-  const double target_frequency = 30.0;  // 30Hz 主循环
-  const auto loop_period = std::chrono::duration<double>(1.0 / target_frequency);
+  // 仿真主循环（按绝对截止时间调度）
+  TickScheduler::Config scheduler_config;
+  scheduler_config.rate_hz = config_.loop_rate_hz;
+  scheduler_config.max_burst_ticks = config_.loop_max_burst_ticks;
+  if (!TickScheduler::parseCatchUpPolicy(config_.loop_catch_up_policy, scheduler_config.catch_up)) {
+    std::cerr << "[AlgorithmManager] Unknown loop catch-up policy '" << config_.loop_catch_up_policy
+              << "', using skip" << std::endl;
+  }
+  loop_scheduler_ = TickScheduler(scheduler_config);
+  loop_scheduler_.start();
 
-  auto last_step_time = std::chrono::steady_clock::now();
+  if (!paused_view_cache_) {
+    paused_view_cache_ = std::make_unique<PausedViewCache>();
+  }
+  paused_view_cache_->valid = false;
 
   // 🎯 性能监控
   auto last_fps_update = std::chrono::steady_clock::now();
@@ -1256,6 +1452,8 @@ bool AlgorithmManager::run_simulation_loop(const std::atomic<bool>* external_int
   double current_fps = 0.0;
 
   while (!simulation_should_stop_.load()) {
+    auto tick = loop_scheduler_.waitForNextTick();
+
     // 🎨 检查可视化窗口是否被关闭
     if (visualizer_ && visualizer_->shouldClose()) {
       std::cout << "[AlgorithmManager] Visualizer window closed, stopping simulation..." << std::endl;
@@ -1285,94 +1483,47 @@ bool AlgorithmManager::run_simulation_loop(const std::atomic<bool>* external_int
       }
     }
 
-    auto current_time = std::chrono::steady_clock::now();
-    auto elapsed = current_time - last_step_time;
-
     // 🎮 检查仿真是否暂停
     if (simulation_paused_.load()) {
-      // 暂停时仍然渲染可视化界面，并显示当前世界状态
-      if (visualizer_) {
-        visualizer_->beginFrame();
-
-        // 🔧 即使暂停，也要显示当前世界状态（特别是加载新场景后）
-        const auto& world_state = local_simulator_->get_world_state();
-
-        // 更新仿真时间
-        double sim_time = local_simulator_->get_simulation_time();
-        std::ostringstream time_stream;
-        time_stream << std::fixed << std::setprecision(3) << sim_time << "s";
-        visualizer_->showDebugInfo("Simulation Time", time_stream.str());
-        visualizer_->showDebugInfo("Frame ID", std::to_string(local_simulator_->get_frame_id()));
-
-        // 转换为protobuf格式并更新可视化
-        auto world_tick = local_simulator_->to_world_tick();
-
-        // 创建前置处理管线并处理
-        perception::PreprocessingPipeline preprocessing_pipeline;
-        plugin::PerceptionInput perception_input = preprocessing_pipeline.process(world_tick);
-
-        // 更新可视化器的世界数据
-        visualizer_->drawEgo(perception_input.ego);
-        visualizer_->drawGoal(perception_input.task.goal_pose);
-        visualizer_->drawBEVObstacles(perception_input.bev_obstacles);
-        visualizer_->drawDynamicObstacles(perception_input.dynamic_obstacles);
-
-        // 如果有感知插件，也处理一下以获取栅格地图
-        planning::PlanningContext context;
-        context.ego = perception_input.ego;
-        context.task = perception_input.task;
-        context.dynamic_obstacles = perception_input.dynamic_obstacles;
-
-        if (perception_plugin_manager_->process(perception_input, context)) {
-          visualizer_->updatePlanningContext(context);
-          if (context.occupancy_grid) {
-            visualizer_->drawOccupancyGrid(*context.occupancy_grid);
-          }
-        }
-
-        visualizer_->showDebugInfo("Simulation Status", "PAUSED");
-        visualizer_->endFrame();
-      }
-
-      // 短暂休眠避免CPU占用过高
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
-      last_step_time = std::chrono::steady_clock::now();
+      // 暂停时仍然按节拍渲染可视化界面，并显示当前世界状态
+      renderPausedFrame();
       continue;  // 跳过本次循环，不执行仿真步进
     }
 
-    // 控制循环频率
-    if (elapsed >= loop_period) {
-      double dt = std::chrono::duration<double>(elapsed).count();
-
-      // 处理单步仿真
-      if (!process_simulation_step(dt)) {
-        std::cerr << "[AlgorithmManager] Simulation step failed" << std::endl;
-        break;
-      }
-
-      last_step_time = current_time;
-      frame_count++;
+    // 处理单步仿真
+    if (!process_simulation_step(tick.dt)) {
+      std::cerr << "[AlgorithmManager] Simulation step failed" << std::endl;
+      break;
+    }
 
-      // 🎯 每秒更新一次FPS
-      auto fps_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-        current_time - last_fps_update).count();
-      if (fps_elapsed >= 1000) {
-        current_fps = frame_count * 1000.0 / fps_elapsed;
+    frame_count++;
 
-        if (visualizer_) {
-          std::ostringstream fps_stream;
-          fps_stream << std::fixed << std::setprecision(1) << current_fps << " Hz";
-          visualizer_->showDebugInfo("Loop Frequency", fps_stream.str());
-          visualizer_->showDebugInfo("Simulation Status", "RUNNING");
-        }
+    // 🎯 每秒更新一次FPS
+    auto current_time = std::chrono::steady_clock::now();
+    auto fps_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      current_time - last_fps_update).count();
+    if (fps_elapsed >= 1000) {
+      current_fps = frame_count * 1000.0 / fps_elapsed;
 
-        frame_count = 0;
-        last_fps_update = current_time;
+      if (visualizer_) {
+        const auto& loop_stats = loop_scheduler_.getStatistics();
+
+        std::ostringstream fps_stream;
+        fps_stream << std::fixed << std::setprecision(1) << current_fps << " Hz";
+        visualizer_->showDebugInfo("Loop Frequency", fps_stream.str());
+
+        std::ostringstream jitter_stream;
+        jitter_stream << std::fixed << std::setprecision(2)
+                      << loop_stats.jitter_us.percentile(0.99) / 1000.0 << " ms";
+        visualizer_->showDebugInfo("Loop Jitter p99", jitter_stream.str());
+        visualizer_->showDebugInfo("Loop Overruns", std::to_string(loop_stats.overruns) +
+                                   " (skipped " + std::to_string(loop_stats.skipped_ticks) + ")");
+        visualizer_->showDebugInfo("Simulation Status", "RUNNING");
       }
-    }
 
-    // 短暂休眠避免CPU占用过高
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      frame_count = 0;
+      last_fps_update = current_time;
+    }
   }
 
   std::cout << "[AlgorithmManager] Simulation loop ended" << std::endl;
@@ -1384,13 +1535,70 @@ void AlgorithmManager::stop_simulation_loop() {
   std::cout << "[AlgorithmManager] Stopping simulation loop..." << std::endl;
 }
 
+void AlgorithmManager::renderPausedFrame() {
+  if (!visualizer_) {
+    return;
+  }
+
+  visualizer_->beginFrame();
+
+  // 🔧 即使暂停，也要显示当前世界状态（特别是加载新场景后）
+  double sim_time = local_simulator_->get_simulation_time();
+  std::ostringstream time_stream;
+  time_stream << std::fixed << std::setprecision(3) << sim_time << "s";
+  visualizer_->showDebugInfo("Simulation Time", time_stream.str());
+  visualizer_->showDebugInfo("Frame ID", std::to_string(local_simulator_->get_frame_id()));
+
+  if (!paused_view_cache_) {
+    paused_view_cache_ = std::make_unique<PausedViewCache>();
+  }
+  auto& cache = *paused_view_cache_;
+
+  // 只有场景变化（加载、重置、编辑）时才重新执行前置处理和感知
+  uint64_t scene_revision = local_simulator_->get_scene_revision();
+  if (!cache.valid || cache.scene_revision != scene_revision) {
+    auto world_tick = local_simulator_->to_world_tick();
+
+    perception::PreprocessingPipeline preprocessing_pipeline;
+    cache.perception_input = preprocessing_pipeline.process(world_tick);
+
+    // 如果有感知插件，也处理一下以获取栅格地图
+    cache.context = planning::PlanningContext{};
+    cache.context.ego = cache.perception_input.ego;
+    cache.context.task = cache.perception_input.task;
+    cache.context.dynamic_obstacles = cache.perception_input.dynamic_obstacles;
+    cache.context_valid = perception_plugin_manager_->process(cache.perception_input, cache.context);
+
+    cache.scene_revision = scene_revision;
+    cache.valid = true;
+  }
+
+  // 更新可视化器的世界数据
+  visualizer_->drawEgo(cache.perception_input.ego);
+  visualizer_->drawGoal(cache.perception_input.task.goal_pose);
+  visualizer_->drawBEVObstacles(cache.perception_input.bev_obstacles);
+  visualizer_->drawDynamicObstacles(cache.perception_input.dynamic_obstacles);
+
+  if (cache.context_valid) {
+    visualizer_->updatePlanningContext(cache.context);
+    if (cache.context.occupancy_grid) {
+      visualizer_->drawOccupancyGrid(*cache.context.occupancy_grid);
+    }
+  }
+
+  visualizer_->showDebugInfo("Simulation Status", "PAUSED");
+  visualizer_->endFrame();
+}
+
 bool AlgorithmManager::process_simulation_step(double dt) {
   if (!local_simulator_) {
     return false;
   }
+  NAVSIM_TRACE_SCOPE("pipeline", "AlgorithmManager::process_simulation_step");
 
   // 🎨 开始新的可视化帧
   if (visualizer_) {
+    NAVSIM_TRACE_SCOPE("viz", "beginFrame");
     visualizer_->beginFrame();
   }
 
@@ -1431,9 +1639,11 @@ bool AlgorithmManager::process_simulation_step(double dt) {
     trajectory_tracker_->getConfig().mode == control::TrajectoryTracker::TrackingMode::PLAYBACK;
 
   if (planning_success && plan_update.trajectory_size() > 0) {
+    trace::TraceScope tracker_trace("control", "tracker");
+    auto tracking_start = std::chrono::steady_clock::now();
+
     // 🔧 调试：打印前几个轨迹点的速度
-    static bool first_print = true;
-    if (first_print && plan_update.trajectory_size() > 0) {
+    if (!first_trajectory_printed_ && plan_update.trajectory_size() > 0) {
       std::cout << "\n[DEBUG] First 10 trajectory points:" << std::endl;
       for (int i = 0; i < std::min(10, plan_update.trajectory_size()); ++i) {
         const auto& pt = plan_update.trajectory(i);
@@ -1441,7 +1651,7 @@ bool AlgorithmManager::process_simulation_step(double dt) {
                   << "s, pos=(" << pt.x() << ", " << pt.y() << ")"
                   << ", vx=" << pt.vx() << ", omega=" << pt.omega() << std::endl;
       }
-      first_print = false;
+      first_trajectory_printed_ = true;
     }
 
     // 🚗 使用改进的轨迹跟踪器
@@ -1550,8 +1760,13 @@ bool AlgorithmManager::process_simulation_step(double dt) {
       control_command_valid = true;
     }
 
+    tracker_trace.end();
+    latency_stages_.tracking->record(std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - tracking_start).count());
+
     // 显示轨迹跟踪质量信息
     if (visualizer_) {
+      NAVSIM_TRACE_SCOPE("viz", "draw tracking");
       const auto& quality = trajectory_tracker_->getQualityMetrics();
       const auto& tracking_state = trajectory_tracker_->getTrackingState();
       const auto& ego_pose_for_viz = playback_apply_state ? playback_target_pose : current_world_state.ego_pose;
@@ -1642,6 +1857,7 @@ bool AlgorithmManager::process_simulation_step(double dt) {
   }
 
   // 5. 执行仿真步进（应用新的状态）
+  trace::TraceScope sim_step_trace("sim", "simulation step");
   bool playback_step_mode = playback_apply_state && tracker_playback_mode;
 
   if (playback_step_mode) {
@@ -1719,6 +1935,8 @@ bool AlgorithmManager::process_simulation_step(double dt) {
     }
   }
 
+  sim_step_trace.end();
+
   if (local_simulator_) {
     const auto& updated_world_state = local_simulator_->get_world_state();
     if (!goal_reached_ && isGoalReached(updated_world_state)) {
@@ -1743,6 +1961,7 @@ bool AlgorithmManager::process_simulation_step(double dt) {
 
   // 🎨 结束可视化帧
   if (visualizer_) {
+    NAVSIM_TRACE_SCOPE("viz", "endFrame");
     visualizer_->endFrame();
   }
 
@@ -1,4 +1,6 @@
 #include "core/bridge.hpp"
+#include "core/latency_metrics.hpp"
+#include "core/log.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -38,9 +40,8 @@ class Bridge::Impl {
   // 仿真状态
   std::atomic<bool> simulation_running_{false};
 
-  // 滑动窗口统计（最近 100 帧）
-  std::deque<double> compute_ms_window_;
-  mutable std::mutex window_mutex_;
+  // compute_ms 直方图（每次 heartbeat 取出后清空，即统计两次 heartbeat 之间的窗口）
+  metrics::LatencyHistogram compute_latency_;
 
   // 获取当前时间戳（秒）
   static double now() {
@@ -49,31 +50,12 @@ class Bridge::Impl {
     return std::chrono::duration<double>(duration).count();
   }
 
-  // 计算 compute_ms 中位数（p50）
-  double compute_ms_p50() const {
-    std::lock_guard<std::mutex> lock(window_mutex_);
-    if (compute_ms_window_.empty()) {
-      return 0.0;
-    }
-    auto sorted = compute_ms_window_;
-    std::sort(sorted.begin(), sorted.end());
-    return sorted[sorted.size() / 2];
-  }
-
-  // 更新 compute_ms 窗口
-  void update_compute_ms(double ms) {
-    std::lock_guard<std::mutex> lock(window_mutex_);
-    compute_ms_window_.push_back(ms);
-    if (compute_ms_window_.size() > 100) {
-      compute_ms_window_.pop_front();
-    }
-  }
 
   // JSON ↔ Protobuf 转换（后续 Phase 3 实现）
   bool json_to_world_tick(const nlohmann::json& j, proto::WorldTick* tick, double* delay_ms);
   nlohmann::json world_tick_to_json(const proto::WorldTick& tick);
   nlohmann::json plan_to_json(const proto::PlanUpdate& plan, double compute_ms);
-  nlohmann::json heartbeat_to_json(double loop_hz, double compute_ms_p50);
+  nlohmann::json heartbeat_to_json(double loop_hz, const metrics::LatencyHistogram::Snapshot& compute);
   nlohmann::json context_to_json(const planning::PlanningContext& context);
 
   // WebSocket 回调
@@ -136,38 +118,27 @@ bool Bridge::is_simulation_running() const {
 void Bridge::publish(const proto::PlanUpdate& plan, double compute_ms) {
   // 断线时直接丢弃，不阻塞
   if (!impl_->connected_) {
-    std::cerr << "[Bridge] WARN: Not connected, dropping plan" << std::endl;
+    NAVSIM_LOG_THROTTLE(WARN, "Bridge", 1.0) << "Not connected, dropping plan";
     return;
   }
 
-  // 更新 compute_ms 窗口
-  impl_->update_compute_ms(compute_ms);
+  // 更新 compute_ms 直方图（无锁）
+  impl_->compute_latency_.record(compute_ms * 1000.0);
 
   // 转换为 JSON（Phase 3 实现）
   nlohmann::json j = impl_->plan_to_json(plan, compute_ms);
 
-  // 【调试输出】打印 topic 和数据格式
-  std::cout << "[DEBUG] Sending plan:" << std::endl;
-  std::cout << "  Topic: " << j["topic"].get<std::string>() << std::endl;
-  std::cout << "  Data keys: ";
-  for (auto it = j["data"].begin(); it != j["data"].end(); ++it) {
-    std::cout << it.key() << " ";
-  }
-  std::cout << std::endl;
-  if (j["data"].contains("trajectory")) {
-    std::cout << "  Trajectory points: " << j["data"]["trajectory"].size() << std::endl;
-  }
-  if (j["data"].contains("points")) {
-    std::cout << "  ⚠️  WARNING: Using 'points' field (should be 'trajectory')" << std::endl;
-  }
+  NAVSIM_LOG(DEBUG, "Bridge") << "Sending plan: topic=" << j["topic"].get<std::string>()
+                              << ", trajectory points=" << plan.trajectory_size();
 
   // 发送
   std::string msg = j.dump();
   impl_->ws_.send(msg);
   impl_->ws_tx_++;
 
-  std::cout << "[Bridge] Sent plan with " << plan.trajectory_size() << " points, compute_ms="
-            << std::fixed << std::setprecision(1) << compute_ms << "ms" << std::endl;
+  NAVSIM_LOG_THROTTLE(INFO, "Bridge", 1.0)
+      << "Sent plan with " << plan.trajectory_size() << " points, compute_ms="
+      << std::fixed << std::setprecision(1) << compute_ms << "ms";
 }
 
 void Bridge::send_world_tick(const proto::WorldTick& world_tick) {
@@ -184,11 +155,7 @@ void Bridge::send_world_tick(const proto::WorldTick& world_tick) {
   impl_->ws_.send(msg);
   impl_->ws_tx_++;
 
-  // 只在verbose模式下打印（避免刷屏）
-  static int send_count = 0;
-  if (++send_count % 30 == 0) {  // 每30帧打印一次
-    std::cout << "[Bridge] Sent world_tick #" << world_tick.tick_id() << std::endl;
-  }
+  NAVSIM_LOG_EVERY_N(INFO, "Bridge", 30) << "Sent world_tick #" << world_tick.tick_id();
 }
 
 void Bridge::send_heartbeat(double loop_hz) {
@@ -198,15 +165,18 @@ void Bridge::send_heartbeat(double loop_hz) {
   }
 
   // 转换为 JSON
-  nlohmann::json j = impl_->heartbeat_to_json(loop_hz, impl_->compute_ms_p50());
+  auto compute = impl_->compute_latency_.snapshot();
+  impl_->compute_latency_.reset();
+  nlohmann::json j = impl_->heartbeat_to_json(loop_hz, compute);
 
   // 发送
   std::string msg = j.dump();
   impl_->ws_.send(msg);
   impl_->ws_tx_++;
 
-  std::cout << "[Bridge] Sent heartbeat: loop_hz=" << std::fixed << std::setprecision(1)
-            << loop_hz << ", compute_ms_p50=" << impl_->compute_ms_p50() << "ms" << std::endl;
+  NAVSIM_LOG(INFO, "Bridge") << "Sent heartbeat: loop_hz=" << std::fixed << std::setprecision(1)
+                             << loop_hz << ", compute_ms_p50=" << compute.percentile(0.5) / 1000.0
+                             << "ms, p99=" << compute.percentile(0.99) / 1000.0 << "ms";
 }
 
 void Bridge::send_perception_debug(const planning::PlanningContext& context) {
@@ -691,7 +661,8 @@ nlohmann::json Bridge::Impl::plan_to_json(const proto::PlanUpdate& plan, double
   return j;
 }
 
-nlohmann::json Bridge::Impl::heartbeat_to_json(double loop_hz, double compute_ms_p50) {
+nlohmann::json Bridge::Impl::heartbeat_to_json(double loop_hz,
+                                               const metrics::LatencyHistogram::Snapshot& compute) {
   nlohmann::json j;
   j["topic"] = "/room/" + room_id_ + "/control/heartbeat";
   j["data"] = {
@@ -701,7 +672,10 @@ nlohmann::json Bridge::Impl::heartbeat_to_json(double loop_hz, double compute_ms
     {"ws_tx", ws_tx_.load()},
     {"dropped_ticks", dropped_ticks_.load()},
     {"loop_hz", loop_hz},
-    {"compute_ms_p50", compute_ms_p50}
+    {"compute_ms_p50", compute.percentile(0.5) / 1000.0},
+    {"compute_ms_p90", compute.percentile(0.9) / 1000.0},
+    {"compute_ms_p99", compute.percentile(0.99) / 1000.0},
+    {"compute_ms_max", compute.max_us / 1000.0}
   };
   return j;
 }
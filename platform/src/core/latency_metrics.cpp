@@ -0,0 +1,213 @@
+#include "core/latency_metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace navsim {
+namespace metrics {
+
+namespace {
+
+constexpr uint64_t kMaxValueUs = (1ull << LatencyHistogram::kMaxMagnitude) - 1;
+constexpr double kQuantiles[] = {0.5, 0.9, 0.99};
+
+int floorLog2(uint64_t value) {
+  int magnitude = 0;
+  while (value >>= 1) {
+    ++magnitude;
+  }
+  return magnitude;
+}
+
+std::string escapeLabel(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      escaped.push_back('\\');
+      escaped.push_back(c);
+    } else if (c == '\n') {
+      escaped += "\\n";
+    } else {
+      escaped.push_back(c);
+    }
+  }
+  return escaped;
+}
+
+bool endsWith(const std::string& text, const std::string& suffix) {
+  return text.size() >= suffix.size() &&
+         text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+// ========== LatencyHistogram ==========
+
+size_t LatencyHistogram::bucketIndex(uint64_t value_us) {
+  value_us = std::min(value_us, kMaxValueUs);
+  if (value_us < kSubBuckets) {
+    return static_cast<size_t>(value_us);
+  }
+  const int shift = floorLog2(value_us) - kSubBucketBits;
+  return static_cast<size_t>(shift) * kSubBuckets + static_cast<size_t>(value_us >> shift);
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+  if (index < kSubBuckets) {
+    return index + 1;
+  }
+  const int shift = static_cast<int>(index / kSubBuckets) - 1;
+  const uint64_t sub_bucket = index % kSubBuckets + kSubBuckets;
+  return (sub_bucket + 1) << shift;
+}
+
+void LatencyHistogram::record(double value_us) {
+  const uint64_t value = value_us <= 0.0
+      ? 0
+      : std::min(kMaxValueUs, static_cast<uint64_t>(std::llround(value_us)));
+
+  buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  sum_us_.fetch_add(value, std::memory_order_relaxed);
+
+  uint64_t current_max = max_us_.load(std::memory_order_relaxed);
+  while (value > current_max &&
+         !max_us_.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {
+  }
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+  Snapshot snapshot;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    snapshot.count += snapshot.buckets[i];   // 以桶计数为准，与并发写入保持一致
+  }
+  snapshot.sum_us = sum_us_.load(std::memory_order_relaxed);
+  snapshot.max_us = max_us_.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+void LatencyHistogram::reset() {
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  sum_us_.store(0, std::memory_order_relaxed);
+  max_us_.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::Snapshot::percentile(double quantile) const {
+  if (count == 0) {
+    return 0.0;
+  }
+
+  uint64_t target = static_cast<uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * count));
+  target = std::max<uint64_t>(target, 1);
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    cumulative += buckets[i];
+    if (cumulative >= target) {
+      // 上界不含，桶内最大整数值为 upper - 1
+      return static_cast<double>(std::min(bucketUpperBound(i) - 1, max_us));
+    }
+  }
+  return static_cast<double>(max_us);
+}
+
+// ========== LatencyMetrics ==========
+
+LatencyMetrics::Stage& LatencyMetrics::stage(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& stage : stages_) {
+    if (stage->name == name) {
+      return *stage;
+    }
+  }
+  stages_.push_back(std::make_unique<Stage>(name));
+  return *stages_.back();
+}
+
+nlohmann::json LatencyMetrics::toJson() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  nlohmann::json stages = nlohmann::json::object();
+  for (const auto& stage : stages_) {
+    const auto snapshot = stage->histogram.snapshot();
+    stages[stage->name] = {
+      {"count", snapshot.count},
+      {"mean_ms", snapshot.mean() / 1000.0},
+      {"p50_ms", snapshot.percentile(0.5) / 1000.0},
+      {"p90_ms", snapshot.percentile(0.9) / 1000.0},
+      {"p99_ms", snapshot.percentile(0.99) / 1000.0},
+      {"max_ms", snapshot.max_us / 1000.0},
+      {"deadline_misses", stage->deadline_misses.load(std::memory_order_relaxed)}
+    };
+  }
+  return {{"stages", stages}};
+}
+
+std::string LatencyMetrics::toPrometheus() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::ostringstream latency;
+  std::ostringstream max_latency;
+  std::ostringstream misses;
+
+  latency << "# HELP navsim_stage_latency_seconds Pipeline stage latency.\n"
+          << "# TYPE navsim_stage_latency_seconds summary\n";
+  max_latency << "# HELP navsim_stage_latency_max_seconds Maximum observed stage latency.\n"
+              << "# TYPE navsim_stage_latency_max_seconds gauge\n";
+  misses << "# HELP navsim_stage_deadline_misses_total Stage executions that exceeded their deadline.\n"
+         << "# TYPE navsim_stage_deadline_misses_total counter\n";
+
+  for (const auto& stage : stages_) {
+    const auto snapshot = stage->histogram.snapshot();
+    const std::string label = "stage=\"" + escapeLabel(stage->name) + "\"";
+    for (double quantile : kQuantiles) {
+      latency << "navsim_stage_latency_seconds{" << label << ",quantile=\"" << quantile << "\"} "
+              << snapshot.percentile(quantile) * 1e-6 << "\n";
+    }
+    latency << "navsim_stage_latency_seconds_sum{" << label << "} " << snapshot.sum_us * 1e-6 << "\n"
+            << "navsim_stage_latency_seconds_count{" << label << "} " << snapshot.count << "\n";
+    max_latency << "navsim_stage_latency_max_seconds{" << label << "} " << snapshot.max_us * 1e-6 << "\n";
+    misses << "navsim_stage_deadline_misses_total{" << label << "} "
+           << stage->deadline_misses.load(std::memory_order_relaxed) << "\n";
+  }
+
+  return latency.str() + max_latency.str() + misses.str();
+}
+
+bool LatencyMetrics::dump(const std::string& path) const {
+  const std::string content = endsWith(path, ".prom") ? toPrometheus() : toJson().dump(2) + "\n";
+  const std::string tmp_path = path + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+      std::cerr << "[LatencyMetrics] Failed to open " << tmp_path << std::endl;
+      return false;
+    }
+    file << content;
+    if (!file.good()) {
+      std::cerr << "[LatencyMetrics] Failed to write " << tmp_path << std::endl;
+      return false;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::cerr << "[LatencyMetrics] Failed to rename " << tmp_path << " to " << path << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void LatencyMetrics::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& stage : stages_) {
+    stage->histogram.reset();
+    stage->deadline_misses.store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace metrics
+} // namespace navsim
@@ -0,0 +1,190 @@
+#include "core/log.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace navsim {
+namespace log {
+
+namespace {
+
+constexpr uint64_t kQueueMask = Logger::kQueueCapacity - 1;
+static_assert((Logger::kQueueCapacity & kQueueMask) == 0, "capacity must be a power of two");
+
+constexpr auto kWriterInterval = std::chrono::milliseconds(20);
+
+int initialLevel() {
+  Level level = Level::INFO;
+  if (const char* env = std::getenv("NAVSIM_LOG_LEVEL")) {
+    if (!parseLevel(env, level)) {
+      std::cerr << "[Logger] Unknown NAVSIM_LOG_LEVEL '" << env << "', using info" << std::endl;
+    }
+  }
+  return static_cast<int>(level);
+}
+
+} // namespace
+
+bool parseLevel(const std::string& name, Level& level) {
+  if (name == "debug") {
+    level = Level::DEBUG;
+  } else if (name == "info") {
+    level = Level::INFO;
+  } else if (name == "warn") {
+    level = Level::WARN;
+  } else if (name == "error") {
+    level = Level::ERROR;
+  } else if (name == "off") {
+    level = Level::OFF;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+struct Logger::Slot {
+  std::atomic<uint64_t> sequence{0};
+  Level level = Level::INFO;
+  std::string message;
+};
+
+std::atomic<int> Logger::level_{initialLevel()};
+
+Logger& Logger::instance() {
+  // 有意不析构：静态对象析构期间仍可能有日志
+  static Logger* logger = new Logger();
+  return *logger;
+}
+
+Logger::Logger()
+    : slots_(new Slot[kQueueCapacity]), out_(&std::cout), err_(&std::cerr) {
+  for (uint64_t i = 0; i < kQueueCapacity; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  running_.store(true, std::memory_order_release);
+  writer_ = std::thread(&Logger::writerLoop, this);
+  std::atexit([]() { Logger::instance().shutdown(); });
+}
+
+// ========== 生产者 ==========
+
+bool Logger::submit(Level level, std::string message) {
+  if (!running_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    drainLocked();
+    std::ostream& stream = level >= Level::WARN ? *err_ : *out_;
+    stream << message << '\n';
+    stream.flush();
+    return true;
+  }
+
+  uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Slot* slot = nullptr;
+  for (;;) {
+    slot = &slots_[pos & kQueueMask];
+    const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->level = level;
+  slot->message = std::move(message);
+  slot->sequence.store(pos + 1, std::memory_order_release);
+
+  if (level >= Level::WARN) {
+    wake_cv_.notify_one();
+  }
+  return true;
+}
+
+// ========== 消费者 ==========
+
+void Logger::drainLocked() {
+  bool wrote_out = false;
+  bool wrote_err = false;
+
+  for (;;) {
+    Slot& slot = slots_[dequeue_pos_ & kQueueMask];
+    if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+      break;
+    }
+
+    if (slot.level >= Level::WARN) {
+      *err_ << slot.message << '\n';
+      wrote_err = true;
+    } else {
+      *out_ << slot.message << '\n';
+      wrote_out = true;
+    }
+    slot.message.clear();
+    slot.sequence.store(dequeue_pos_ + kQueueCapacity, std::memory_order_release);
+    ++dequeue_pos_;
+  }
+
+  const uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+  if (dropped != reported_dropped_) {
+    *err_ << "[Logger] Dropped " << (dropped - reported_dropped_) << " messages (queue full)\n";
+    reported_dropped_ = dropped;
+    wrote_err = true;
+  }
+
+  if (wrote_out) {
+    out_->flush();
+  }
+  if (wrote_err) {
+    err_->flush();
+  }
+}
+
+void Logger::writerLoop() {
+  std::unique_lock<std::mutex> wake_lock(wake_mutex_);
+  while (!stop_writer_) {
+    wake_cv_.wait_for(wake_lock, kWriterInterval);
+    wake_lock.unlock();
+    {
+      std::lock_guard<std::mutex> lock(write_mutex_);
+      drainLocked();
+    }
+    wake_lock.lock();
+  }
+}
+
+void Logger::flush() {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  drainLocked();
+}
+
+void Logger::shutdown() {
+  if (!running_.exchange(false)) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    stop_writer_ = true;
+  }
+  wake_cv_.notify_one();
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+  flush();
+}
+
+void Logger::setOutput(std::ostream& out, std::ostream& err) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  drainLocked();
+  out_ = &out;
+  err_ = &err;
+}
+
+} // namespace log
+} // namespace navsim
@@ -4,6 +4,42 @@
 namespace navsim {
 namespace planning {
 
+// ========== PlanningContext ==========
+
+void PlanningContext::resetForTick(const EgoVehicle& tick_ego,
+                                   const PlanningTask& tick_task,
+                                   const BEVObstacles& tick_bev_obstacles,
+                                   const std::vector<DynamicObstacle>& tick_dynamic_obstacles) {
+  ego = tick_ego;
+  task = tick_task;
+  dynamic_obstacles = tick_dynamic_obstacles;
+
+  if (tick_bev_obstacles.circles.empty() &&
+      tick_bev_obstacles.rectangles.empty() &&
+      tick_bev_obstacles.polygons.empty()) {
+    bev_obstacles.reset();
+  } else if (bev_obstacles) {
+    *bev_obstacles = tick_bev_obstacles;
+  } else {
+    bev_obstacles = std::make_unique<BEVObstacles>(tick_bev_obstacles);
+  }
+
+  // 上一帧的地图移入备用池：本帧由感知插件重新产出，否则保持为空
+  if (occupancy_grid) {
+    spare_occupancy_grid_ = std::move(occupancy_grid);
+  }
+  if (esdf_map) {
+    spare_esdf_map_ = std::move(esdf_map);
+  }
+  if (lane_lines) {
+    spare_lane_lines_ = std::move(lane_lines);
+  }
+
+  for (auto& entry : custom_data) {
+    entry.second.reset();
+  }
+}
+
 // ========== OccupancyGrid 工具函数 ==========
 
 bool OccupancyGrid::isOccupied(int x, int y, uint8_t threshold) const {
@@ -0,0 +1,165 @@
+#include "core/tick_log.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace navsim {
+namespace record {
+
+namespace {
+
+void encodeLength(uint32_t length, char out[4]) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<char>((length >> (8 * i)) & 0xFF);
+  }
+}
+
+uint32_t decodeLength(const uint8_t* in) {
+  return static_cast<uint32_t>(in[0]) |
+         (static_cast<uint32_t>(in[1]) << 8) |
+         (static_cast<uint32_t>(in[2]) << 16) |
+         (static_cast<uint32_t>(in[3]) << 24);
+}
+
+}  // namespace
+
+// ========== TickLogWriter ==========
+
+TickLogWriter::~TickLogWriter() {
+  close();
+}
+
+bool TickLogWriter::open(const std::string& path) {
+  close();
+  file_.open(path, std::ios::binary | std::ios::trunc);
+  if (!file_.is_open()) {
+    std::cerr << "[TickLogWriter] Failed to open " << path << std::endl;
+    return false;
+  }
+  file_.write(kTickLogMagic, kTickLogMagicSize);
+  path_ = path;
+  record_count_ = 0;
+  return static_cast<bool>(file_);
+}
+
+bool TickLogWriter::append(const proto::TickRecord& record) {
+  if (!file_.is_open()) {
+    return false;
+  }
+  buffer_.clear();
+  if (!record.SerializeToString(&buffer_)) {
+    std::cerr << "[TickLogWriter] Failed to serialize record " << record.sequence() << std::endl;
+    return false;
+  }
+
+  char header[4];
+  encodeLength(static_cast<uint32_t>(buffer_.size()), header);
+  file_.write(header, sizeof(header));
+  file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  if (!file_) {
+    std::cerr << "[TickLogWriter] Write failed: " << path_ << std::endl;
+    return false;
+  }
+  ++record_count_;
+  if (flush_interval_ > 0 && record_count_ % flush_interval_ == 0) {
+    file_.flush();
+  }
+  return true;
+}
+
+void TickLogWriter::flush() {
+  if (file_.is_open()) {
+    file_.flush();
+  }
+}
+
+void TickLogWriter::close() {
+  if (file_.is_open()) {
+    file_.close();
+  }
+}
+
+// ========== TickLogReader ==========
+
+TickLogReader::~TickLogReader() {
+  close();
+}
+
+bool TickLogReader::open(const std::string& path) {
+  close();
+
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    std::cerr << "[TickLogReader] Failed to open " << path << ": " << std::strerror(errno) << std::endl;
+    return false;
+  }
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kTickLogMagicSize)) {
+    std::cerr << "[TickLogReader] Not a tick log (too small): " << path << std::endl;
+    ::close(fd);
+    return false;
+  }
+
+  void* mapped = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);  // 映射建立后文件描述符不再需要
+  if (mapped == MAP_FAILED) {
+    std::cerr << "[TickLogReader] mmap failed: " << path << ": " << std::strerror(errno) << std::endl;
+    return false;
+  }
+  data_ = static_cast<const uint8_t*>(mapped);
+  file_size_ = static_cast<size_t>(st.st_size);
+
+  if (std::memcmp(data_, kTickLogMagic, kTickLogMagicSize) != 0) {
+    std::cerr << "[TickLogReader] Bad magic, not a tick log: " << path << std::endl;
+    close();
+    return false;
+  }
+
+  // 回放按顺序访问
+  ::madvise(mapped, file_size_, MADV_SEQUENTIAL);
+
+  size_t offset = kTickLogMagicSize;
+  while (offset + 4 <= file_size_) {
+    uint32_t length = decodeLength(data_ + offset);
+    if (offset + 4 + length > file_size_) {
+      break;
+    }
+    index_.push_back(Entry{offset + 4, length});
+    offset += 4 + static_cast<size_t>(length);
+  }
+
+  truncated_ = offset != file_size_;
+  if (truncated_) {
+    std::cerr << "[TickLogReader] Ignoring incomplete record at tail of " << path
+              << " (" << (file_size_ - offset) << " bytes)" << std::endl;
+  }
+  return true;
+}
+
+void TickLogReader::close() {
+  if (data_) {
+    ::munmap(const_cast<uint8_t*>(data_), file_size_);
+  }
+  data_ = nullptr;
+  file_size_ = 0;
+  index_.clear();
+  truncated_ = false;
+}
+
+bool TickLogReader::read(size_t i, proto::TickRecord& record) const {
+  if (i >= index_.size()) {
+    return false;
+  }
+  const Entry& entry = index_[i];
+  return record.ParseFromArray(data_ + entry.offset, static_cast<int>(entry.length));
+}
+
+}  // namespace record
+}  // namespace navsim
@@ -0,0 +1,111 @@
+#include "core/tick_scheduler.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace navsim {
+
+namespace {
+
+double toMicroseconds(TickScheduler::Clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+// ========== TickScheduler ==========
+
+TickScheduler::TickScheduler(const Config& config) : config_(config) {
+  double rate_hz = config_.rate_hz > 0.0 ? config_.rate_hz : 30.0;
+  period_ = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate_hz));
+  config_.max_burst_ticks = std::max(0, config_.max_burst_ticks);
+}
+
+bool TickScheduler::parseCatchUpPolicy(const std::string& name, CatchUpPolicy& policy) {
+  if (name == "skip") {
+    policy = CatchUpPolicy::SKIP;
+    return true;
+  }
+  if (name == "burst") {
+    policy = CatchUpPolicy::BURST;
+    return true;
+  }
+  return false;
+}
+
+void TickScheduler::start() {
+  last_deadline_ = Clock::now();
+  next_deadline_ = last_deadline_ + period_;
+  pending_burst_ = 0;
+  started_ = true;
+}
+
+TickScheduler::Statistics TickScheduler::getStatistics() const {
+  Statistics stats = stats_;
+  stats.jitter_us = jitter_us_->snapshot();
+  stats.overrun_us = overrun_us_->snapshot();
+  return stats;
+}
+
+void TickScheduler::resetStatistics() {
+  stats_ = Statistics{};
+  jitter_us_->reset();
+  overrun_us_->reset();
+}
+
+TickScheduler::TickInfo TickScheduler::waitForNextTick() {
+  if (!started_) {
+    start();
+  }
+
+  TickInfo info;
+  auto now = Clock::now();
+
+  if (now < next_deadline_) {
+    // 按时：休眠到绝对截止时间，记录唤醒抖动
+    std::this_thread::sleep_until(next_deadline_);
+    jitter_us_->record(toMicroseconds(Clock::now() - next_deadline_));
+    pending_burst_ = 0;
+  } else {
+    // 超时：上一节拍的工作超出了时间片
+    info.overrun = true;
+    stats_.overruns++;
+
+    auto late = now - next_deadline_;
+    overrun_us_->record(toMicroseconds(late));
+
+    // 本次调用若是补执行的节拍，消耗一个已计数的待补节拍
+    if (pending_burst_ > 0) {
+      pending_burst_--;
+    }
+
+    // 完整错过的节拍数
+    uint64_t missed = static_cast<uint64_t>(late / period_);
+    uint64_t burst = 0;
+    if (missed > 0) {
+      uint64_t dropped = missed;
+      if (config_.catch_up == CatchUpPolicy::BURST) {
+        uint64_t max_burst = static_cast<uint64_t>(config_.max_burst_ticks);
+        dropped = missed > max_burst ? missed - max_burst : 0;
+        burst = missed - dropped;
+        // 只计入新增的待补节拍，已在之前超时中计数的不重复计入
+        if (burst > pending_burst_) {
+          stats_.burst_ticks += burst - pending_burst_;
+        }
+      }
+      next_deadline_ += period_ * dropped;
+      stats_.skipped_ticks += dropped;
+      info.skipped_ticks = dropped;
+    }
+    pending_burst_ = burst;
+  }
+
+  info.index = stats_.ticks++;
+  info.deadline = next_deadline_;
+  info.dt = std::chrono::duration<double>(next_deadline_ - last_deadline_).count();
+
+  last_deadline_ = next_deadline_;
+  next_deadline_ += period_;
+  return info;
+}
+
+} // namespace navsim
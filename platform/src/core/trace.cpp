@@ -0,0 +1,268 @@
+#include "core/trace.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace navsim {
+namespace trace {
+
+namespace {
+
+constexpr uint64_t kBufferMask = Tracer::kBufferCapacity - 1;
+static_assert((Tracer::kBufferCapacity & kBufferMask) == 0, "capacity must be a power of two");
+
+void appendEscaped(std::string& out, const char* text) {
+  for (const char* c = text; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out.push_back('\\');
+      out.push_back(*c);
+    } else if (static_cast<unsigned char>(*c) >= 0x20) {
+      out.push_back(*c);
+    }
+  }
+}
+
+} // namespace
+
+// ========== 线程缓冲区 ==========
+
+/**
+ * @brief 单生产者（所属线程）/ 单消费者（后台写出线程）环形缓冲区
+ */
+struct Tracer::ThreadBuffer {
+  std::unique_ptr<TraceEvent[]> events{new TraceEvent[kBufferCapacity]};
+  std::atomic<uint64_t> head{0};      // 仅生产者写
+  std::atomic<uint64_t> tail{0};      // 仅消费者写
+  std::atomic<uint64_t> dropped{0};
+  std::atomic<bool> retired{false};   // 所属线程已退出
+  uint32_t tid = 0;
+};
+
+/**
+ * @brief 线程退出时标记缓冲区，由写出线程取完剩余事件后回收
+ */
+struct Tracer::ThreadHandle {
+  std::shared_ptr<ThreadBuffer> buffer;
+
+  ~ThreadHandle() {
+    if (buffer) {
+      buffer->retired.store(true, std::memory_order_release);
+    }
+  }
+};
+
+std::atomic<bool> Tracer::enabled_{false};
+
+Tracer& Tracer::instance() {
+  // 有意不析构：线程局部缓冲区可能在静态对象析构之后才释放
+  static Tracer* tracer = new Tracer();
+  return *tracer;
+}
+
+Tracer::ThreadBuffer& Tracer::localBuffer() {
+  thread_local ThreadHandle handle;
+  if (!handle.buffer) {
+    auto buffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    buffer->tid = next_tid_++;
+    buffers_.push_back(buffer);
+    handle.buffer = std::move(buffer);
+  }
+  return *handle.buffer;
+}
+
+// ========== 记录 ==========
+
+void TraceScope::begin(const char* category, const char* name) {
+  active_ = true;
+  category_ = category;
+  std::strncpy(name_, name, sizeof(name_) - 1);
+  name_[sizeof(name_) - 1] = '\0';
+  start_ns_ = Tracer::now();
+}
+
+void Tracer::record(const char* category, const char* name, int64_t start_ns, int64_t end_ns) {
+  if (!enabled()) {
+    return;
+  }
+
+  ThreadBuffer& buffer = localBuffer();
+  const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+  if (head - buffer.tail.load(std::memory_order_acquire) >= kBufferCapacity) {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  TraceEvent& event = buffer.events[head & kBufferMask];
+  event.start_ns = start_ns;
+  event.duration_ns = end_ns - start_ns;
+  event.category = category;
+  std::strncpy(event.name, name, sizeof(event.name) - 1);
+  event.name[sizeof(event.name) - 1] = '\0';
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void Tracer::setThreadName(const std::string& name) {
+  ThreadBuffer& buffer = localBuffer();
+  std::lock_guard<std::mutex> lock(registry_mutex_);
+  thread_names_.emplace_back(buffer.tid, name);
+}
+
+uint64_t Tracer::droppedEvents() const {
+  std::lock_guard<std::mutex> lock(registry_mutex_);
+  uint64_t dropped = retired_dropped_;
+  for (const auto& buffer : buffers_) {
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  return dropped;
+}
+
+// ========== 会话 ==========
+
+bool Tracer::start(const std::string& output_file, std::chrono::milliseconds flush_interval) {
+  stop();
+
+  std::lock_guard<std::mutex> session_lock(session_mutex_);
+  output_.open(output_file, std::ios::out | std::ios::trunc);
+  if (!output_.is_open()) {
+    std::cerr << "[Tracer] Failed to open trace file: " << output_file << std::endl;
+    return false;
+  }
+
+  // 丢弃上一次会话停止后残留的事件
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    for (const auto& buffer : buffers_) {
+      buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+      buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+    retired_dropped_ = 0;
+  }
+
+  pending_.clear();
+  written_events_.store(0, std::memory_order_relaxed);
+  origin_ns_ = now();
+  output_ << "{\"traceEvents\":[\n"
+          << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+             "\"args\":{\"name\":\"navsim\"}}";
+
+  stop_flusher_ = false;
+  flush_interval_ = flush_interval;
+  flusher_ = std::thread(&Tracer::flushLoop, this);
+
+  static std::once_flag atexit_once;
+  std::call_once(atexit_once, []() { std::atexit([]() { Tracer::instance().stop(); }); });
+
+  enabled_.store(true, std::memory_order_release);
+  std::cout << "[Tracer] Recording to " << output_file << std::endl;
+  return true;
+}
+
+void Tracer::stop() {
+  std::lock_guard<std::mutex> session_lock(session_mutex_);
+  if (!enabled_.exchange(false)) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(flush_mutex_);
+    stop_flusher_ = true;
+  }
+  flush_cv_.notify_all();
+  if (flusher_.joinable()) {
+    flusher_.join();
+  }
+  drain();
+
+  // 线程名元数据
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    for (const auto& [tid, name] : thread_names_) {
+      pending_ += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+      pending_ += std::to_string(tid);
+      pending_ += ",\"args\":{\"name\":\"";
+      appendEscaped(pending_, name.c_str());
+      pending_ += "\"}}";
+    }
+  }
+
+  const uint64_t dropped = droppedEvents();
+  output_ << pending_ << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":"
+          << dropped << "}}\n";
+  pending_.clear();
+  output_.close();
+
+  std::cout << "[Tracer] Wrote " << writtenEvents() << " events";
+  if (dropped > 0) {
+    std::cout << " (" << dropped << " dropped, buffers full)";
+  }
+  std::cout << std::endl;
+}
+
+// ========== 后台写出 ==========
+
+void Tracer::flushLoop() {
+  std::unique_lock<std::mutex> lock(flush_mutex_);
+  while (!stop_flusher_) {
+    flush_cv_.wait_for(lock, flush_interval_, [this]() { return stop_flusher_; });
+    lock.unlock();
+    drain();
+    output_ << pending_;
+    output_.flush();
+    pending_.clear();
+    lock.lock();
+  }
+}
+
+void Tracer::drain() {
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    buffers = buffers_;
+  }
+
+  for (const auto& buffer : buffers) {
+    const uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+    for (; tail < head; ++tail) {
+      writeEvent(buffer->events[tail & kBufferMask], buffer->tid);
+    }
+    buffer->tail.store(head, std::memory_order_release);
+  }
+
+  // 回收已退出且取空的线程缓冲区
+  std::lock_guard<std::mutex> lock(registry_mutex_);
+  auto retired = std::remove_if(buffers_.begin(), buffers_.end(), [this](const auto& buffer) {
+    if (!buffer->retired.load(std::memory_order_acquire) ||
+        buffer->tail.load(std::memory_order_relaxed) != buffer->head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    retired_dropped_ += buffer->dropped.load(std::memory_order_relaxed);
+    return true;
+  });
+  buffers_.erase(retired, buffers_.end());
+}
+
+void Tracer::writeEvent(const TraceEvent& event, uint32_t tid) {
+  // 会话开始之前进入的区间从会话起点开始显示
+  const int64_t start_ns = std::max(event.start_ns, origin_ns_);
+  const int64_t duration_ns = std::max<int64_t>(0, event.start_ns + event.duration_ns - start_ns);
+
+  // 文件头已写入进程名元数据，之后的每条事件都以逗号开头
+  pending_ += ",\n{\"name\":\"";
+  appendEscaped(pending_, event.name);
+  pending_ += "\",\"cat\":\"";
+  appendEscaped(pending_, event.category);
+
+  char numbers[96];
+  std::snprintf(numbers, sizeof(numbers), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                (start_ns - origin_ns_) / 1000.0, duration_ns / 1000.0, tid);
+  pending_ += numbers;
+  written_events_.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace trace
+} // namespace navsim
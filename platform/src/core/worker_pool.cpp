@@ -0,0 +1,185 @@
+#include "core/worker_pool.hpp"
+
+#include "core/log.hpp"
+#include "core/trace.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace navsim {
+namespace worker {
+
+namespace {
+
+thread_local const WorkerPool* t_current_pool = nullptr;
+
+std::mutex g_shared_mutex;
+WorkerPool::Config g_shared_config;
+bool g_shared_started = false;
+
+bool sameConfig(const WorkerPool::Config& a, const WorkerPool::Config& b) {
+  return a.threads == b.threads && a.cpu_affinity == b.cpu_affinity;
+}
+
+void pinCurrentThread(int cpu) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+    NAVSIM_LOG(WARN, "WorkerPool") << "Failed to pin worker thread to CPU " << cpu;
+  }
+#else
+  (void)cpu;
+#endif
+}
+
+}  // namespace
+
+// ========== 共享实例 ==========
+
+bool WorkerPool::configure(const Config& config) {
+  std::lock_guard<std::mutex> lock(g_shared_mutex);
+  if (g_shared_started) {
+    if (!sameConfig(config, g_shared_config)) {
+      NAVSIM_LOG(WARN, "WorkerPool") << "Shared pool already running with " << shared().size()
+                                     << " threads, ignoring new configuration";
+      return false;
+    }
+    return true;
+  }
+  g_shared_config = config;
+  return true;
+}
+
+WorkerPool& WorkerPool::shared() {
+  static WorkerPool* pool = [] {
+    std::lock_guard<std::mutex> lock(g_shared_mutex);
+    g_shared_started = true;
+    return new WorkerPool(g_shared_config);  // 不析构：进程退出时插件可能仍持有任务
+  }();
+  return *pool;
+}
+
+// ========== 生命周期 ==========
+
+WorkerPool::WorkerPool(const Config& config) {
+  int threads = config.threads;
+  if (threads <= 0) {
+    threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  }
+
+  workers_.reserve(static_cast<size_t>(threads));
+  for (int k = 0; k < threads; ++k) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (size_t k = 0; k < workers_.size(); ++k) {
+    int cpu = config.cpu_affinity.empty() ? -1 : config.cpu_affinity[k % config.cpu_affinity.size()];
+    workers_[k]->thread = std::thread(&WorkerPool::workerLoop, this, k, cpu);
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  for (auto& worker : workers_) {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->stop = true;
+    worker->cv.notify_one();
+  }
+  for (auto& worker : workers_) {
+    if (worker->thread.joinable()) {
+      worker->thread.join();
+    }
+  }
+}
+
+bool WorkerPool::isWorkerThread() const {
+  return t_current_pool == this;
+}
+
+// ========== 执行 ==========
+
+void WorkerPool::parallelFor(size_t n, const std::function<void(size_t)>& body) {
+  if (n == 0) {
+    return;
+  }
+  if (n == 1 || isWorkerThread()) {
+    for (size_t i = 0; i < n; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  struct Batch {
+    std::mutex mutex;
+    std::condition_variable done;
+    size_t remaining = 0;
+    std::exception_ptr error;
+  } batch;
+  batch.remaining = n;
+
+  for (size_t i = 0; i < n; ++i) {
+    enqueue(i % workers_.size(), [&batch, &body, i]() {
+      std::exception_ptr error;
+      try {
+        body(i);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      // 在锁内通知：调用线程被唤醒后 batch 随即析构
+      std::lock_guard<std::mutex> lock(batch.mutex);
+      if (error && !batch.error) {
+        batch.error = error;
+      }
+      if (--batch.remaining == 0) {
+        batch.done.notify_one();
+      }
+    });
+  }
+
+  std::unique_lock<std::mutex> lock(batch.mutex);
+  batch.done.wait(lock, [&batch] { return batch.remaining == 0; });
+  if (batch.error) {
+    std::rethrow_exception(batch.error);
+  }
+}
+
+void WorkerPool::enqueue(size_t worker_index, std::function<void()> task) {
+  Worker& worker = *workers_[worker_index];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queue.push_back(std::move(task));
+  }
+  worker.cv.notify_one();
+}
+
+void WorkerPool::workerLoop(size_t worker_index, int cpu) {
+  t_current_pool = this;
+  if (cpu >= 0) {
+    pinCurrentThread(cpu);
+  }
+  trace::Tracer::instance().setThreadName("pool-" + std::to_string(worker_index));
+
+  Worker& worker = *workers_[worker_index];
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(worker.mutex);
+      worker.cv.wait(lock, [&worker] { return worker.stop || !worker.queue.empty(); });
+      if (worker.queue.empty()) {
+        return;  // stop 且队列已清空
+      }
+      task = std::move(worker.queue.front());
+      worker.queue.pop_front();
+    }
+    task();
+  }
+}
+
+} // namespace worker
+} // namespace navsim
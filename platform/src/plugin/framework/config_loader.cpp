@@ -171,6 +171,22 @@ bool ConfigLoader::parsePlanningConfig(const nlohmann::json& planning_config) {
     enable_fallback_ = planning_config["enable_fallback"];
   }
   
+  // 解析执行模式
+  if (planning_config.contains("execution_mode")) {
+    planner_execution_mode_ = planning_config["execution_mode"];
+  }
+  
+  // 解析组合模式配置
+  if (planning_config.contains("portfolio")) {
+    const auto& portfolio = planning_config["portfolio"];
+    if (portfolio.contains("planners")) {
+      portfolio_planner_names_ = portfolio["planners"].get<std::vector<std::string>>();
+    }
+    if (portfolio.contains("scoring")) {
+      portfolio_scoring_config_ = portfolio["scoring"];
+    }
+  }
+  
   // 解析规划器参数
   if (planning_config.contains("planners")) {
     planner_configs_ = planning_config["planners"];
@@ -180,6 +196,7 @@ bool ConfigLoader::parsePlanningConfig(const nlohmann::json& planning_config) {
   if (enable_fallback_) {
     std::cout << "[ConfigLoader] Fallback planner: " << fallback_planner_name_ << std::endl;
   }
+  std::cout << "[ConfigLoader] Execution mode: " << planner_execution_mode_ << std::endl;
   
   return true;
 }
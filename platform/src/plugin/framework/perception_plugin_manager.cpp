@@ -1,5 +1,7 @@
 #include "plugin/framework/perception_plugin_manager.hpp"
+#include "core/trace.hpp"
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 
 namespace navsim {
@@ -10,6 +12,7 @@ bool PerceptionPluginManager::loadPlugins(
   // 清空现有插件
   plugins_.clear();
   plugin_configs_.clear();
+  plugin_stages_.clear();
   
   // 获取注册表
   auto& registry = PerceptionPluginRegistry::getInstance();
@@ -98,7 +101,14 @@ bool PerceptionPluginManager::process(
     }
     
     // 执行插件
-    if (!plugin->process(input, context)) {
+    NAVSIM_TRACE_SCOPE("perception", config.name);
+    auto plugin_start = std::chrono::steady_clock::now();
+    bool plugin_success = plugin->process(input, context);
+    if (i < plugin_stages_.size()) {
+      plugin_stages_[i]->record(std::chrono::duration<double, std::milli>(
+          std::chrono::steady_clock::now() - plugin_start).count());
+    }
+    if (!plugin_success) {
       std::cerr << "[PerceptionPluginManager] Plugin '" << config.name 
                 << "' failed to process" << std::endl;
       // 继续执行其他插件，不返回失败
@@ -143,6 +153,16 @@ nlohmann::json PerceptionPluginManager::getStatistics() const {
   return stats;
 }
 
+void PerceptionPluginManager::setLatencyMetrics(metrics::LatencyMetrics* metrics) {
+  plugin_stages_.clear();
+  if (!metrics) {
+    return;
+  }
+  for (const auto& config : plugin_configs_) {
+    plugin_stages_.push_back(&metrics->stage("perception/" + config.name));
+  }
+}
+
 void PerceptionPluginManager::sortPluginsByPriority() {
   // 创建索引数组
   std::vector<size_t> indices(plugins_.size());
@@ -1,9 +1,177 @@
 #include "plugin/framework/planner_plugin_manager.hpp"
+#include "core/trace.hpp"
+#include "core/log.hpp"
+#include "core/worker_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
 
 namespace navsim {
 namespace plugin {
 
+namespace {
+
+/**
+ * @brief 轨迹在 ESDF 上的最小净空（最近栅格查询，地图外按 max_distance 计）
+ */
+double computeMinClearance(const planning::ESDFMap& esdf,
+                           const std::vector<TrajectoryPoint>& trajectory) {
+  double min_clearance = esdf.config.max_distance;
+  if (esdf.config.resolution <= 0.0) {
+    return min_clearance;
+  }
+  for (const auto& point : trajectory) {
+    int x = static_cast<int>(std::floor((point.pose.x - esdf.config.origin.x) / esdf.config.resolution));
+    int y = static_cast<int>(std::floor((point.pose.y - esdf.config.origin.y) / esdf.config.resolution));
+    if (x < 0 || x >= esdf.config.width || y < 0 || y >= esdf.config.height) {
+      continue;
+    }
+    size_t index = static_cast<size_t>(y) * esdf.config.width + x;
+    if (index < esdf.data.size()) {
+      min_clearance = std::min(min_clearance, esdf.data[index]);
+    }
+  }
+  return min_clearance;
+}
+
+}  // namespace
+
+/**
+ * @brief 竞速模式主规划器的常驻后台线程
+ *
+ * 一次执行一个任务。调用方最多等到截止时间，超时的任务在后台执行完毕，
+ * 期间 busy() 为 true。
+ */
+class PlannerPluginManager::RaceWorker {
+public:
+  RaceWorker() : thread_(&RaceWorker::loop, this) {}
+
+  ~RaceWorker() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    start_cv_.notify_one();
+    thread_.join();
+  }
+
+  bool busy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+  }
+
+  /**
+   * @brief 启动任务（调用前 busy() 必须为 false）
+   */
+  void start(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_ = std::move(task);
+      running_ = true;
+    }
+    start_cv_.notify_one();
+  }
+
+  /**
+   * @brief 等待任务结束，最迟到 deadline
+   * @return 任务是否已结束
+   */
+  bool waitUntil(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return done_cv_.wait_until(lock, deadline, [this] { return !running_; });
+  }
+
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return !running_; });
+  }
+
+private:
+  void loop() {
+    trace::Tracer::instance().setThreadName("race-primary");
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      start_cv_.wait(lock, [this] { return stop_ || running_; });
+      if (!running_) {
+        return;
+      }
+      std::function<void()> task = std::move(task_);
+      lock.unlock();
+      task();
+      lock.lock();
+      running_ = false;
+      done_cv_.notify_all();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  std::function<void()> task_;
+  bool running_ = false;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+PlannerPluginManager::PlannerPluginManager() = default;
+
+PlannerPluginManager::~PlannerPluginManager() {
+  waitForRacePrimary();
+}
+
+PlannerPluginManager::ScoringFunction PlannerPluginManager::makeDefaultScoringFunction(
+    const nlohmann::json& scoring_config) {
+  // 默认参数 {} 构造的是 null，value() 只接受 object
+  const nlohmann::json params = scoring_config.is_object() ? scoring_config : nlohmann::json::object();
+  double infeasible_penalty = params.value("infeasible_penalty", 1e6);
+  double clearance_weight = params.value("clearance_weight", 1.0);
+  double clearance_cap = params.value("clearance_cap", 2.0);
+
+  return [=](const PlanningResult& result) {
+    double score = result.total_cost;
+    if (!result.constraints_satisfied) {
+      score += infeasible_penalty;
+    }
+    auto it = result.metadata.find("min_clearance");
+    if (it != result.metadata.end()) {
+      score -= clearance_weight * std::min(it->second, clearance_cap);
+    }
+    return score;
+  };
+}
+
+bool PlannerPluginManager::parseExecutionMode(const std::string& name, ExecutionMode& mode) {
+  if (name == "sequential") {
+    mode = ExecutionMode::SEQUENTIAL;
+    return true;
+  }
+  if (name == "race") {
+    mode = ExecutionMode::RACE;
+    return true;
+  }
+  if (name == "portfolio") {
+    mode = ExecutionMode::PORTFOLIO;
+    return true;
+  }
+  return false;
+}
+
+std::string PlannerPluginManager::executionModeName(ExecutionMode mode) {
+  switch (mode) {
+    case ExecutionMode::RACE:
+      return "race";
+    case ExecutionMode::PORTFOLIO:
+      return "portfolio";
+    case ExecutionMode::SEQUENTIAL:
+    default:
+      return "sequential";
+  }
+}
+
 bool PlannerPluginManager::loadPlanners(
     const std::string& primary_planner_name,
     const std::string& fallback_planner_name,
@@ -25,6 +193,7 @@ bool PlannerPluginManager::loadPlanners(
               << primary_planner_name << std::endl;
     return false;
   }
+  primary_planner_->setCancellationToken(primary_cancel_token_);
   std::cout << "[PlannerPluginManager] Loaded primary planner: " 
             << primary_planner_name << std::endl;
   
@@ -36,6 +205,7 @@ bool PlannerPluginManager::loadPlanners(
                 << fallback_planner_name << std::endl;
       return false;
     }
+    fallback_planner_->setCancellationToken(fallback_cancel_token_);
     std::cout << "[PlannerPluginManager] Loaded fallback planner: " 
               << fallback_planner_name << std::endl;
   }
@@ -43,6 +213,60 @@ bool PlannerPluginManager::loadPlanners(
   return true;
 }
 
+bool PlannerPluginManager::loadPortfolio(
+    const std::vector<std::string>& planner_names,
+    const nlohmann::json& scoring_config) {
+  if (initialized_) {
+    std::cerr << "[PlannerPluginManager] loadPortfolio() must be called before initialize()" 
+              << std::endl;
+    return false;
+  }
+
+  portfolio_.clear();
+  auto& registry = PlannerPluginRegistry::getInstance();
+
+  for (const auto& name : planner_names) {
+    PortfolioEntry entry;
+    entry.name = name;
+
+    // 主/降级规划器已加载时直接复用，避免重复初始化
+    if (primary_planner_ && name == primary_planner_name_) {
+      entry.planner = primary_planner_;
+      entry.cancel_token = primary_cancel_token_;
+      entry.owned = false;
+    } else if (fallback_planner_ && name == fallback_planner_name_) {
+      entry.planner = fallback_planner_;
+      entry.cancel_token = fallback_cancel_token_;
+      entry.owned = false;
+    } else {
+      entry.planner = registry.createPlugin(name);
+      if (!entry.planner) {
+        std::cerr << "[PlannerPluginManager] Failed to create portfolio planner: " 
+                  << name << std::endl;
+        portfolio_.clear();
+        return false;
+      }
+      entry.cancel_token = std::make_shared<CancellationToken>();
+      entry.planner->setCancellationToken(entry.cancel_token);
+    }
+
+    portfolio_.push_back(std::move(entry));
+    std::cout << "[PlannerPluginManager] Loaded portfolio planner: " << name << std::endl;
+  }
+
+  scoring_function_ = makeDefaultScoringFunction(scoring_config);
+  return true;
+}
+
+std::vector<std::string> PlannerPluginManager::getPortfolioPlannerNames() const {
+  std::vector<std::string> names;
+  names.reserve(portfolio_.size());
+  for (const auto& entry : portfolio_) {
+    names.push_back(entry.name);
+  }
+  return names;
+}
+
 bool PlannerPluginManager::initialize() {
   if (initialized_) {
     std::cerr << "[PlannerPluginManager] Already initialized!" << std::endl;
@@ -89,6 +313,24 @@ bool PlannerPluginManager::initialize() {
               << "' initialized successfully" << std::endl;
   }
   
+  // 初始化组合模式中独立创建的规划器
+  for (auto& entry : portfolio_) {
+    if (!entry.owned) {
+      continue;
+    }
+
+    nlohmann::json entry_config;
+    if (planner_configs_.contains(entry.name)) {
+      entry_config = planner_configs_[entry.name];
+    }
+
+    if (!entry.planner->initialize(entry_config)) {
+      std::cerr << "[PlannerPluginManager] Failed to initialize portfolio planner: "
+                << entry.name << std::endl;
+      return false;
+    }
+  }
+
   initialized_ = true;
   std::cout << "[PlannerPluginManager] All planners initialized" << std::endl;
   
@@ -105,9 +347,33 @@ bool PlannerPluginManager::plan(
   }
   
   stats_.total_calls++;
-  
+
+  if (execution_mode_ == ExecutionMode::RACE && enable_fallback_ && fallback_planner_) {
+    return planRace(context, deadline, result);
+  }
+
+  // 其他模式会在调用线程上使用主规划器实例
+  waitForRacePrimary();
+
+  if (execution_mode_ == ExecutionMode::PORTFOLIO && !portfolio_.empty()) {
+    return planPortfolio(context, deadline, result);
+  }
+  return planSequential(context, deadline, result);
+}
+
+bool PlannerPluginManager::planSequential(
+    const planning::PlanningContext& context,
+    std::chrono::milliseconds deadline,
+    PlanningResult& result) {
+  // 串行模式不按截止时间取消，保持规划器原有行为
+  primary_cancel_token_->reset();
+  resetFallbackToken();
+
   // 尝试使用主规划器
-  if (tryPlan(primary_planner_, primary_planner_name_, context, deadline, result)) {
+  double elapsed_ms = 0.0;
+  bool success = tryPlan(primary_planner_, primary_planner_name_, context, deadline, result, elapsed_ms);
+  stats_.total_time_ms += elapsed_ms;
+  if (success) {
     stats_.primary_success++;
     return true;
   }
@@ -116,10 +382,11 @@ bool PlannerPluginManager::plan(
   
   // 如果主规划器失败且启用了降级机制，尝试使用降级规划器
   if (enable_fallback_ && fallback_planner_) {
-    std::cout << "[PlannerPluginManager] Primary planner failed, trying fallback planner" 
-              << std::endl;
+    NAVSIM_LOG(INFO, "PlannerPluginManager") << "Primary planner failed, trying fallback planner";
     
-    if (tryPlan(fallback_planner_, fallback_planner_name_, context, deadline, result)) {
+    success = tryPlan(fallback_planner_, fallback_planner_name_, context, deadline, result, elapsed_ms);
+    stats_.total_time_ms += elapsed_ms;
+    if (success) {
       stats_.fallback_success++;
       return true;
     }
@@ -128,17 +395,282 @@ bool PlannerPluginManager::plan(
   }
   
   // 所有规划器都失败
-  std::cerr << "[PlannerPluginManager] All planners failed!" << std::endl;
+  NAVSIM_LOG(WARN, "PlannerPluginManager") << "All planners failed!";
+  return false;
+}
+
+bool PlannerPluginManager::planRace(
+    const planning::PlanningContext& context,
+    std::chrono::milliseconds deadline,
+    PlanningResult& result) {
+  stats_.race_calls++;
+
+  auto start_time = std::chrono::steady_clock::now();
+  auto deadline_time = start_time + deadline;
+
+  if (!race_worker_) {
+    race_worker_ = std::make_unique<RaceWorker>();
+  }
+  collectRacePrimary();
+  uint64_t fallback_generation = resetFallbackToken();
+
+  // 主规划器在后台线程上执行，持有自己的上下文副本；上一帧的主规划器仍未返回时本帧不再启动
+  bool primary_started = false;
+  if (race_worker_->busy()) {
+    stats_.race_primary_busy++;
+  } else {
+    primary_cancel_token_->reset(deadline_time);
+    race_primary_.context = context.clone();
+    race_primary_.result = PlanningResult();
+    race_primary_.success = false;
+    race_primary_.elapsed_ms = 0.0;
+    race_worker_->start([this, deadline, deadline_time, fallback_generation]() {
+      race_primary_.success = tryPlan(primary_planner_, primary_planner_name_, race_primary_.context,
+                                      deadline, race_primary_.result, race_primary_.elapsed_ms);
+      // 按时成功时本帧的降级规划器不再需要；按代取消，避免误取消下一帧的降级规划器
+      if (race_primary_.success && std::chrono::steady_clock::now() <= deadline_time) {
+        cancelFallback(fallback_generation);
+      }
+    });
+    primary_started = true;
+  }
+
+  // 降级规划器在调用线程上执行
+  PlanningResult fallback_result;
+  double fallback_ms = 0.0;
+  bool fallback_success = tryPlan(fallback_planner_, fallback_planner_name_, context, deadline,
+                                  fallback_result, fallback_ms);
+
+  // 最多等到截止时间，不等待超时的主规划器
+  bool primary_done = primary_started && race_worker_->waitUntil(deadline_time);
+  auto tick_ms = [&start_time]() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+  };
+
+  if (primary_done) {
+    if (race_primary_.success) {
+      stats_.primary_success++;
+      stats_.race_primary_wins++;
+      stats_.total_time_ms += tick_ms();
+      result = std::move(race_primary_.result);
+      return true;
+    }
+    stats_.primary_failure++;
+  }
+
+  if (fallback_success) {
+    stats_.fallback_success++;
+    stats_.race_fallback_wins++;
+    stats_.total_time_ms += tick_ms();
+
+    if (primary_done) {
+      // 串行模式下降级结果需要等待 primary_ms + fallback_ms
+      double saved_ms = std::max(0.0, race_primary_.elapsed_ms + fallback_ms - tick_ms());
+      stats_.race_latency_saved_ms += saved_ms;
+      stats_.race_max_latency_saved_ms = std::max(stats_.race_max_latency_saved_ms, saved_ms);
+    } else if (primary_started) {
+      // 主规划器结束后再计入统计（见 collectRacePrimary）
+      race_primary_.pending = true;
+      race_primary_.fallback_ms = fallback_ms;
+      race_primary_.tick_ms = tick_ms();
+    }
+
+    result = std::move(fallback_result);
+    return true;
+  }
+
+  stats_.fallback_failure++;
+
+  // 降级规划器失败时，超时的主规划器结果仍优于无结果，只能等待它返回
+  if (primary_started && !primary_done) {
+    race_worker_->wait();
+    if (race_primary_.success) {
+      NAVSIM_LOG_THROTTLE(WARN, "PlannerPluginManager", 1.0)
+          << "Fallback planner failed, using late primary result";
+      stats_.primary_success++;
+      stats_.race_primary_late++;
+      stats_.total_time_ms += tick_ms();
+      result = std::move(race_primary_.result);
+      return true;
+    }
+    stats_.primary_failure++;
+  }
+
+  stats_.total_time_ms += tick_ms();
+  stats_.race_no_winner++;
+  NAVSIM_LOG(WARN, "PlannerPluginManager") << "All planners failed!";
+  return false;
+}
+
+void PlannerPluginManager::collectRacePrimary() {
+  if (!race_primary_.pending || !race_worker_ || race_worker_->busy()) {
+    return;
+  }
+  race_primary_.pending = false;
+
+  // 超时但成功的主规划器不算失败
+  if (race_primary_.success) {
+    stats_.race_primary_late++;
+  } else {
+    stats_.primary_failure++;
+  }
+
+  double saved_ms = std::max(0.0, race_primary_.elapsed_ms + race_primary_.fallback_ms - race_primary_.tick_ms);
+  stats_.race_latency_saved_ms += saved_ms;
+  stats_.race_max_latency_saved_ms = std::max(stats_.race_max_latency_saved_ms, saved_ms);
+}
+
+void PlannerPluginManager::waitForRacePrimary() {
+  if (!race_worker_ || !race_worker_->busy()) {
+    return;
+  }
+  primary_cancel_token_->cancel();
+  race_worker_->wait();
+  collectRacePrimary();
+}
+
+uint64_t PlannerPluginManager::resetFallbackToken(CancellationToken::Clock::time_point deadline) {
+  std::lock_guard<std::mutex> lock(fallback_token_mutex_);
+  fallback_cancel_token_->reset(deadline);
+  return ++fallback_token_generation_;
+}
+
+void PlannerPluginManager::cancelFallback(uint64_t generation) {
+  std::lock_guard<std::mutex> lock(fallback_token_mutex_);
+  if (generation == fallback_token_generation_) {
+    fallback_cancel_token_->cancel();
+  }
+}
+
+bool PlannerPluginManager::planPortfolio(
+    const planning::PlanningContext& context,
+    std::chrono::milliseconds deadline,
+    PlanningResult& result) {
+  stats_.portfolio_calls++;
+
+  auto start_time = std::chrono::steady_clock::now();
+  auto deadline_time = start_time + deadline;
+  const size_t count = portfolio_.size();
+
+  // 每个规划器持有独立的上下文副本，避免插件在 plan() 中修改共享数据
+  std::vector<planning::PlanningContext> contexts;
+  contexts.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    contexts.push_back(context.clone());
+    if (portfolio_[i].cancel_token == fallback_cancel_token_) {
+      resetFallbackToken(deadline_time);
+    } else {
+      portfolio_[i].cancel_token->reset(deadline_time);
+    }
+  }
+
+  std::vector<PlanningResult> results(count);
+  std::vector<double> elapsed_ms(count, 0.0);
+  std::vector<char> succeeded(count, 0);
+  std::vector<std::chrono::steady_clock::time_point> finish_times(count);
+
+  auto run_entry = [&](size_t i) {
+    succeeded[i] = tryPlan(portfolio_[i].planner, portfolio_[i].name, contexts[i], deadline,
+                           results[i], elapsed_ms[i]) ? 1 : 0;
+    finish_times[i] = std::chrono::steady_clock::now();
+  };
+
+  // 各规划器在共享工作线程池上并行执行（第 i 个固定在第 i % size() 个工作线程上），
+  // 规划器内部的并行循环（如 T-MPC 的并行求解）因此在该工作线程内串行执行
+  worker::WorkerPool::shared().parallelFor(count, run_entry);
+
+  stats_.total_time_ms += std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - start_time).count();
+
+  // 评分择优：优先选择截止时间内完成的结果
+  int best_in_time = -1;
+  int best_late = -1;
+  double best_in_time_score = std::numeric_limits<double>::infinity();
+  double best_late_score = std::numeric_limits<double>::infinity();
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!succeeded[i]) {
+      continue;
+    }
+
+    auto& candidate = results[i];
+    if (context.esdf_map && candidate.metadata.find("min_clearance") == candidate.metadata.end()) {
+      candidate.metadata["min_clearance"] = computeMinClearance(*context.esdf_map, candidate.trajectory);
+    }
+    double score = scoring_function_(candidate);
+    candidate.metadata["portfolio_score"] = score;
+
+    if (finish_times[i] <= deadline_time) {
+      if (best_in_time < 0 || score < best_in_time_score) {
+        best_in_time = static_cast<int>(i);
+        best_in_time_score = score;
+      }
+    } else {
+      stats_.portfolio_late[portfolio_[i].name]++;
+      if (best_late < 0 || score < best_late_score) {
+        best_late = static_cast<int>(i);
+        best_late_score = score;
+      }
+    }
+  }
+
+  if (best_in_time >= 0) {
+    stats_.primary_success++;
+    stats_.portfolio_wins[portfolio_[best_in_time].name]++;
+    result = std::move(results[best_in_time]);
+    return true;
+  }
+
+  stats_.primary_failure++;
+  stats_.portfolio_no_winner++;
+
+  // 组合内无按时结果时，回退到降级规划器；降级规划器本身是组合成员时结果已知，不再重复执行
+  bool fallback_in_portfolio = std::any_of(portfolio_.begin(), portfolio_.end(), [this](const PortfolioEntry& entry) {
+    return entry.planner == fallback_planner_;
+  });
+  if (enable_fallback_ && fallback_planner_ && !fallback_in_portfolio) {
+    NAVSIM_LOG(INFO, "PlannerPluginManager") << "Portfolio produced no result in time, trying fallback planner";
+
+    resetFallbackToken();
+    double fallback_ms = 0.0;
+    bool success = tryPlan(fallback_planner_, fallback_planner_name_, context, deadline,
+                           result, fallback_ms);
+    stats_.total_time_ms += fallback_ms;
+    if (success) {
+      stats_.fallback_success++;
+      return true;
+    }
+
+    stats_.fallback_failure++;
+  }
+
+  // 超时的组合结果仍优于无结果
+  if (best_late >= 0) {
+    NAVSIM_LOG_THROTTLE(WARN, "PlannerPluginManager", 1.0)
+        << "Using late portfolio result from '" << portfolio_[best_late].name << "'";
+    result = std::move(results[best_late]);
+    return true;
+  }
+
+  NAVSIM_LOG(WARN, "PlannerPluginManager") << "All planners failed!";
   return false;
 }
 
 void PlannerPluginManager::reset() {
+  waitForRacePrimary();
+  race_primary_ = RacePrimaryRun();
+
   if (primary_planner_) {
     primary_planner_->reset();
   }
   if (fallback_planner_) {
     fallback_planner_->reset();
   }
+  for (auto& entry : portfolio_) {
+    if (entry.owned) {
+      entry.planner->reset();
+    }
+  }
   
   // 重置统计信息
   stats_ = Statistics();
@@ -154,6 +686,33 @@ nlohmann::json PlannerPluginManager::getStatistics() const {
   stats["fallback_success"] = stats_.fallback_success;
   stats["fallback_failure"] = stats_.fallback_failure;
   stats["total_time_ms"] = stats_.total_time_ms;
+  stats["execution_mode"] = executionModeName(execution_mode_);
+
+  if (stats_.race_calls > 0) {
+    nlohmann::json race;
+    race["calls"] = stats_.race_calls;
+    race["primary_wins"] = stats_.race_primary_wins;
+    race["primary_late"] = stats_.race_primary_late;
+    race["primary_busy"] = stats_.race_primary_busy;
+    race["fallback_wins"] = stats_.race_fallback_wins;
+    race["no_winner"] = stats_.race_no_winner;
+    race["latency_saved_ms"] = stats_.race_latency_saved_ms;
+    race["max_latency_saved_ms"] = stats_.race_max_latency_saved_ms;
+    if (stats_.race_fallback_wins > 0) {
+      race["avg_latency_saved_ms"] = stats_.race_latency_saved_ms / stats_.race_fallback_wins;
+    }
+    stats["race"] = race;
+  }
+
+  if (!portfolio_.empty()) {
+    nlohmann::json portfolio;
+    portfolio["planners"] = getPortfolioPlannerNames();
+    portfolio["calls"] = stats_.portfolio_calls;
+    portfolio["no_winner"] = stats_.portfolio_no_winner;
+    portfolio["wins"] = stats_.portfolio_wins;
+    portfolio["late"] = stats_.portfolio_late;
+    stats["portfolio"] = portfolio;
+  }
   
   if (stats_.total_calls > 0) {
     stats["primary_success_rate"] = 
@@ -175,12 +734,15 @@ bool PlannerPluginManager::tryPlan(
     const std::string& planner_name,
     const planning::PlanningContext& context,
     std::chrono::milliseconds deadline,
-    PlanningResult& result) {
+    PlanningResult& result,
+    double& elapsed_ms) {
+  elapsed_ms = 0.0;
+
   // 检查规划器是否可用
   auto [available, reason] = planner->isAvailable(context);
   if (!available) {
-    std::cerr << "[PlannerPluginManager] Planner '" << planner_name 
-              << "' is not available: " << reason << std::endl;
+    NAVSIM_LOG_THROTTLE(WARN, "PlannerPluginManager", 1.0)
+        << "Planner '" << planner_name << "' is not available: " << reason;
     result.success = false;
     result.failure_reason = reason;
     result.planner_name = planner_name;
@@ -189,21 +751,21 @@ bool PlannerPluginManager::tryPlan(
   
   // 执行规划
   auto start_time = std::chrono::steady_clock::now();
+  trace::TraceScope plan_trace("planning", planner_name);
   
   bool success = planner->plan(context, deadline, result);
+  plan_trace.end();
   
   auto end_time = std::chrono::steady_clock::now();
-  double elapsed_ms = 
+  elapsed_ms = 
       std::chrono::duration<double, std::milli>(end_time - start_time).count();
   
-  stats_.total_time_ms += elapsed_ms;
-  
   if (success) {
-    std::cout << "[PlannerPluginManager] Planner '" << planner_name 
-              << "' succeeded in " << elapsed_ms << " ms" << std::endl;
+    NAVSIM_LOG(DEBUG, "PlannerPluginManager")
+        << "Planner '" << planner_name << "' succeeded in " << elapsed_ms << " ms";
   } else {
-    std::cerr << "[PlannerPluginManager] Planner '" << planner_name 
-              << "' failed: " << result.failure_reason << std::endl;
+    NAVSIM_LOG(WARN, "PlannerPluginManager")
+        << "Planner '" << planner_name << "' failed: " << result.failure_reason;
   }
   
   return success;
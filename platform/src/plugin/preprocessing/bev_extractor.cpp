@@ -8,13 +8,19 @@ namespace perception {
 std::unique_ptr<planning::BEVObstacles> BEVExtractor::extract(
     const proto::WorldTick& world_tick) {
   auto obstacles = std::make_unique<planning::BEVObstacles>();
+  extract(world_tick, *obstacles);
+  return obstacles;
+}
+
+void BEVExtractor::extract(const proto::WorldTick& world_tick,
+                           planning::BEVObstacles& obstacles) {
+  obstacles.circles.clear();
+  obstacles.rectangles.clear();
 
   // 提取静态障碍物
-  extractStaticObstacles(world_tick, *obstacles);
+  extractStaticObstacles(world_tick, obstacles);
 
   total_extractions_++;
-
-  return obstacles;
 }
 
 void BEVExtractor::extractStaticObstacles(const proto::WorldTick& world_tick,
@@ -27,6 +33,7 @@ void BEVExtractor::extractStaticObstacles(const proto::WorldTick& world_tick,
 
   // 如果没有缓存的静态地图，则跳过
   if (!has_cached_static_map_) {
+    obstacles.polygons.clear();
     return;
   }
 
@@ -51,7 +58,8 @@ void BEVExtractor::extractStaticObstacles(const proto::WorldTick& world_tick,
     }
   }
 
-  // 处理静态多边形障碍物
+  // 处理静态多边形障碍物（复用已有多边形的顶点容量）
+  size_t polygon_count = 0;
   for (const auto& polygon : static_map.polygons()) {
     if (polygon.points().empty()) continue;
 
@@ -69,19 +77,16 @@ void BEVExtractor::extractStaticObstacles(const proto::WorldTick& world_tick,
     double distance = std::sqrt(dx * dx + dy * dy);
 
     if (distance <= config_.detection_range) {
-      planning::BEVObstacles::Polygon poly_obs;
+      auto& poly_obs = reuseSlot(obstacles.polygons, polygon_count);
       poly_obs.confidence = 1.0;  // 静态障碍物置信度为1.0
 
+      poly_obs.vertices.clear();
       for (const auto& point : polygon.points()) {
-        planning::Point2d vertex;
-        vertex.x = point.x();
-        vertex.y = point.y();
-        poly_obs.vertices.push_back(vertex);
+        poly_obs.vertices.emplace_back(point.x(), point.y());
       }
-
-      obstacles.polygons.push_back(poly_obs);
     }
   }
+  obstacles.polygons.resize(polygon_count);
 }
 
 void BEVExtractor::extractDynamicObstacles(const proto::WorldTick& world_tick,
@@ -8,14 +8,19 @@ namespace perception {
 std::vector<planning::DynamicObstacle> DynamicObstaclePredictor::predict(
     const proto::WorldTick& world_tick) {
   std::vector<planning::DynamicObstacle> predicted_obstacles;
+  predict(world_tick, predicted_obstacles);
+  return predicted_obstacles;
+}
 
+void DynamicObstaclePredictor::predict(const proto::WorldTick& world_tick,
+                                       std::vector<planning::DynamicObstacle>& obstacles) {
   if (config_.prediction_model == "constant_velocity") {
-    predictConstantVelocity(world_tick, predicted_obstacles);
+    predictConstantVelocity(world_tick, obstacles);
+  } else {
+    obstacles.clear();
   }
 
   total_predictions_++;
-
-  return predicted_obstacles;
 }
 
 void DynamicObstaclePredictor::predictConstantVelocity(
@@ -24,6 +29,8 @@ void DynamicObstaclePredictor::predictConstantVelocity(
   const auto& ego_pose = world_tick.ego().pose();
   const double detection_range = 50.0;  // 固定检测范围50m
 
+  // 原地覆写上一帧的结果，保留各障碍物的字符串与轨迹容量
+  size_t count = 0;
   for (const auto& dyn_obs : world_tick.dynamic_obstacles()) {
     // 检查距离是否在检测范围内
     double dx = dyn_obs.pose().x() - ego_pose.x();
@@ -31,7 +38,7 @@ void DynamicObstaclePredictor::predictConstantVelocity(
     double distance = std::sqrt(dx * dx + dy * dy);
 
     if (distance <= detection_range) {
-      planning::DynamicObstacle pred_obs;
+      auto& pred_obs = reuseSlot(obstacles, count);
 
       // 将string id转换为int hash
       std::hash<std::string> hasher;
@@ -70,8 +77,11 @@ void DynamicObstaclePredictor::predictConstantVelocity(
       }
 
       // 生成恒定速度预测轨迹
-      planning::DynamicObstacle::Trajectory trajectory;
+      pred_obs.predicted_trajectories.resize(1);
+      auto& trajectory = pred_obs.predicted_trajectories.front();
       trajectory.probability = 1.0;  // 单一轨迹概率为1.0
+      trajectory.poses.clear();
+      trajectory.timestamps.clear();
 
       double dt = config_.time_step;
       int num_steps = static_cast<int>(config_.prediction_horizon / dt);
@@ -87,11 +97,9 @@ void DynamicObstaclePredictor::predictConstantVelocity(
         trajectory.poses.push_back(future_pose);
         trajectory.timestamps.push_back(t);
       }
-
-      pred_obs.predicted_trajectories.push_back(trajectory);
-      obstacles.push_back(pred_obs);
     }
   }
+  obstacles.resize(count);
 }
 
 void DynamicObstaclePredictor::reset() {
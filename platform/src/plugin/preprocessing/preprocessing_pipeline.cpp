@@ -1,4 +1,6 @@
 #include "plugin/preprocessing/preprocessing.hpp"
+#include "core/trace.hpp"
+#include "core/log.hpp"
 #include <chrono>
 #include <iostream>
 
@@ -13,31 +15,42 @@ PreprocessingPipeline::PreprocessingPipeline(const Config& config)
 
 plugin::PerceptionInput PreprocessingPipeline::process(
     const proto::WorldTick& world_tick) {
-  auto start_time = std::chrono::steady_clock::now();
-
   plugin::PerceptionInput input;
+  process(world_tick, input);
+  return input;
+}
+
+void PreprocessingPipeline::process(const proto::WorldTick& world_tick,
+                                    plugin::PerceptionInput& input) {
+  auto start_time = std::chrono::steady_clock::now();
 
   // 1. 提取自车状态
   input.ego = BasicDataConverter::convertEgo(world_tick);
 
+  // 🔍 调试：每秒打印一次规划器接收到的自车状态
+  if (world_tick.tick_id() % 30 == 0 && world_tick.tick_id() != last_ego_log_tick_) {
+    NAVSIM_LOG(INFO, "BasicDataConverter::convertEgo")
+        << "Planner received ego state: pose=(" << input.ego.pose.x << ", " << input.ego.pose.y
+        << ", " << input.ego.pose.yaw << "), twist=(vx=" << input.ego.twist.vx
+        << ", vy=" << input.ego.twist.vy << ", omega=" << input.ego.twist.omega << ")";
+    last_ego_log_tick_ = world_tick.tick_id();
+  }
+
   // 2. 提取规划任务
   input.task = BasicDataConverter::convertTask(world_tick);
 
   // 3. 提取 BEV 障碍物
   // std::cout << "[PreprocessingPipeline] Extracting BEV obstacles..." << std::endl;
-  auto bev_obstacles = bev_extractor_.extract(world_tick);
-  if (bev_obstacles) {
-    input.bev_obstacles = *bev_obstacles;
-    // std::cout << "[PreprocessingPipeline] BEV obstacles extracted successfully:" << std::endl;
-    // std::cout << "[PreprocessingPipeline]   Circles: " << input.bev_obstacles.circles.size() << std::endl;
-    // std::cout << "[PreprocessingPipeline]   Rectangles: " << input.bev_obstacles.rectangles.size() << std::endl;
-    // std::cout << "[PreprocessingPipeline]   Polygons: " << input.bev_obstacles.polygons.size() << std::endl;
-  } else {
-    std::cout << "[PreprocessingPipeline] WARNING: BEV extractor returned nullptr!" << std::endl;
+  {
+    NAVSIM_TRACE_SCOPE("preprocessing", "BEVExtractor::extract");
+    bev_extractor_.extract(world_tick, input.bev_obstacles);
   }
 
   // 4. 预测动态障碍物
-  input.dynamic_obstacles = dynamic_predictor_.predict(world_tick);
+  {
+    NAVSIM_TRACE_SCOPE("preprocessing", "DynamicObstaclePredictor::predict");
+    dynamic_predictor_.predict(world_tick, input.dynamic_obstacles);
+  }
 
   // 5. 保存原始数据指针（可选）
   input.raw_world_tick = &world_tick;
@@ -57,8 +70,6 @@ plugin::PerceptionInput PreprocessingPipeline::process(
   stats_.average_time_ms =
       (stats_.average_time_ms * (stats_.total_processed - 1) + elapsed_ms) /
       stats_.total_processed;
-
-  return input;
 }
 
 void PreprocessingPipeline::setConfig(const Config& config) {
@@ -0,0 +1,492 @@
+#include "sim/collision_world.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace navsim {
+namespace sim {
+
+namespace {
+
+// 线段与轴对齐矩形相交测试（Liang-Barsky 裁剪）
+bool segmentIntersectsRect(double x0, double y0, double x1, double y1,
+                           double half_x, double half_y) {
+  const double dx = x1 - x0;
+  const double dy = y1 - y0;
+  const double p[4] = {-dx, dx, -dy, dy};
+  const double q[4] = {x0 + half_x, half_x - x0, y0 + half_y, half_y - y0};
+
+  double t0 = 0.0;
+  double t1 = 1.0;
+  for (int i = 0; i < 4; ++i) {
+    if (p[i] == 0.0) {
+      if (q[i] < 0.0) {
+        return false;  // 平行且在边界外
+      }
+      continue;
+    }
+    const double t = q[i] / p[i];
+    if (p[i] < 0.0) {
+      if (t > t1) return false;
+      t0 = std::max(t0, t);
+    } else {
+      if (t < t0) return false;
+      t1 = std::min(t1, t);
+    }
+  }
+  return true;
+}
+
+// 射线法判断点是否在多边形内
+bool pointInPolygon(double x, double y, const std::vector<planning::Point2d>& polygon) {
+  bool inside = false;
+  const size_t n = polygon.size();
+  for (size_t i = 0, j = n - 1; i < n; j = i++) {
+    const auto& a = polygon[i];
+    const auto& b = polygon[j];
+    if ((a.y > y) != (b.y > y) &&
+        x < (b.x - a.x) * (y - a.y) / (b.y - a.y) + a.x) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+int clampCell(double value, double origin, double cell, int count) {
+  int index = static_cast<int>(std::floor((value - origin) / cell));
+  return std::max(0, std::min(count - 1, index));
+}
+
+int64_t packCell(int64_t ix, int64_t iy) {
+  return (ix << 32) ^ (iy & 0xffffffffLL);
+}
+
+} // namespace
+
+// ========== 几何图元 ==========
+
+Aabb OrientedBox::bounds() const {
+  const double c = std::abs(std::cos(yaw));
+  const double s = std::abs(std::sin(yaw));
+  const double ex = c * half_length + s * half_width;
+  const double ey = s * half_length + c * half_width;
+  return {cx - ex, cy - ey, cx + ex, cy + ey};
+}
+
+// ========== 窄相测试 ==========
+
+bool boxIntersectsCircle(const OrientedBox& box, double cx, double cy, double radius) {
+  const double c = std::cos(box.yaw);
+  const double s = std::sin(box.yaw);
+  const double dx = cx - box.cx;
+  const double dy = cy - box.cy;
+
+  // 圆心转到盒局部坐标系，求盒上最近点
+  const double lx = c * dx + s * dy;
+  const double ly = -s * dx + c * dy;
+  const double nx = lx - std::max(-box.half_length, std::min(box.half_length, lx));
+  const double ny = ly - std::max(-box.half_width, std::min(box.half_width, ly));
+  return nx * nx + ny * ny <= radius * radius;
+}
+
+bool boxIntersectsBox(const OrientedBox& a, const OrientedBox& b) {
+  // 分离轴定理：两个盒各自的两条边方向
+  const double ca = std::cos(a.yaw), sa = std::sin(a.yaw);
+  const double cb = std::cos(b.yaw), sb = std::sin(b.yaw);
+  const double axes[4][2] = {{ca, sa}, {-sa, ca}, {cb, sb}, {-sb, cb}};
+  const double dx = b.cx - a.cx;
+  const double dy = b.cy - a.cy;
+
+  for (const auto& axis : axes) {
+    const double ra = a.half_length * std::abs(axis[0] * ca + axis[1] * sa) +
+                      a.half_width * std::abs(-axis[0] * sa + axis[1] * ca);
+    const double rb = b.half_length * std::abs(axis[0] * cb + axis[1] * sb) +
+                      b.half_width * std::abs(-axis[0] * sb + axis[1] * cb);
+    if (std::abs(dx * axis[0] + dy * axis[1]) > ra + rb) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool boxIntersectsPolygon(const OrientedBox& box, const std::vector<planning::Point2d>& polygon) {
+  if (polygon.empty()) {
+    return false;
+  }
+
+  const double c = std::cos(box.yaw);
+  const double s = std::sin(box.yaw);
+  auto to_local = [&](const planning::Point2d& p, double& lx, double& ly) {
+    const double dx = p.x - box.cx;
+    const double dy = p.y - box.cy;
+    lx = c * dx + s * dy;
+    ly = -s * dx + c * dy;
+  };
+
+  if (polygon.size() == 1) {
+    double lx, ly;
+    to_local(polygon[0], lx, ly);
+    return std::abs(lx) <= box.half_length && std::abs(ly) <= box.half_width;
+  }
+
+  // 任一边与盒相交
+  double x0, y0;
+  to_local(polygon.back(), x0, y0);
+  for (const auto& point : polygon) {
+    double x1, y1;
+    to_local(point, x1, y1);
+    if (segmentIntersectsRect(x0, y0, x1, y1, box.half_length, box.half_width)) {
+      return true;
+    }
+    x0 = x1;
+    y0 = y1;
+  }
+
+  // 盒完全在多边形内部
+  return polygon.size() >= 3 && pointInPolygon(box.cx, box.cy, polygon);
+}
+
+// ========== 静态网格 ==========
+
+void CollisionWorld::buildStatic(const std::vector<StaticObstacle>& obstacles) {
+  // 构建新网格后整体替换，已共享旧网格的副本不受影响
+  auto grid = std::make_shared<StaticGrid>();
+  StaticGrid& g = *grid;
+  g.shapes.reserve(obstacles.size());
+
+  double extent_sum = 0.0;
+  for (uint32_t i = 0; i < obstacles.size(); ++i) {
+    const auto& obs = obstacles[i];
+    StaticShape shape;
+    shape.source = i;
+    shape.type = obs.type;
+    if (obs.type == StaticObstacle::Type::CIRCLE) {
+      shape.cx = obs.circle.center.x;
+      shape.cy = obs.circle.center.y;
+      shape.radius = obs.circle.radius;
+      shape.bounds = {shape.cx - shape.radius, shape.cy - shape.radius,
+                      shape.cx + shape.radius, shape.cy + shape.radius};
+    } else {
+      if (obs.polygon.points.empty()) {
+        continue;
+      }
+      shape.points = obs.polygon.points;
+      shape.bounds = {shape.points[0].x, shape.points[0].y, shape.points[0].x, shape.points[0].y};
+      for (const auto& p : shape.points) {
+        shape.bounds.min_x = std::min(shape.bounds.min_x, p.x);
+        shape.bounds.min_y = std::min(shape.bounds.min_y, p.y);
+        shape.bounds.max_x = std::max(shape.bounds.max_x, p.x);
+        shape.bounds.max_y = std::max(shape.bounds.max_y, p.y);
+      }
+    }
+
+    if (g.shapes.empty()) {
+      g.bounds = shape.bounds;
+    } else {
+      g.bounds.min_x = std::min(g.bounds.min_x, shape.bounds.min_x);
+      g.bounds.min_y = std::min(g.bounds.min_y, shape.bounds.min_y);
+      g.bounds.max_x = std::max(g.bounds.max_x, shape.bounds.max_x);
+      g.bounds.max_y = std::max(g.bounds.max_y, shape.bounds.max_y);
+    }
+    extent_sum += std::max(shape.bounds.max_x - shape.bounds.min_x,
+                           shape.bounds.max_y - shape.bounds.min_y);
+    g.shapes.push_back(std::move(shape));
+  }
+
+  if (g.shapes.empty()) {
+    static_grid_ = std::move(grid);
+    return;
+  }
+
+  // 格子边长：默认取障碍物平均尺寸，使每个障碍物覆盖少量格子
+  g.cell = config_.static_cell_size > 0.0
+      ? config_.static_cell_size
+      : std::max(0.5, extent_sum / g.shapes.size());
+
+  const double width = g.bounds.max_x - g.bounds.min_x;
+  const double height = g.bounds.max_y - g.bounds.min_y;
+  auto grid_size = [&]() {
+    g.cols = static_cast<int>(width / g.cell) + 1;
+    g.rows = static_cast<int>(height / g.cell) + 1;
+    return static_cast<size_t>(g.cols) * g.rows;
+  };
+  while (grid_size() > config_.max_static_cells) {
+    g.cell *= 2.0;
+  }
+
+  // CSR：先计数，再前缀和，最后填充
+  const size_t cell_count = static_cast<size_t>(g.cols) * g.rows;
+  g.cell_start.assign(cell_count + 1, 0);
+
+  auto for_each_cell = [&](const Aabb& bounds, auto&& fn) {
+    const int ix0 = clampCell(bounds.min_x, g.bounds.min_x, g.cell, g.cols);
+    const int ix1 = clampCell(bounds.max_x, g.bounds.min_x, g.cell, g.cols);
+    const int iy0 = clampCell(bounds.min_y, g.bounds.min_y, g.cell, g.rows);
+    const int iy1 = clampCell(bounds.max_y, g.bounds.min_y, g.cell, g.rows);
+    for (int iy = iy0; iy <= iy1; ++iy) {
+      for (int ix = ix0; ix <= ix1; ++ix) {
+        fn(static_cast<size_t>(iy) * g.cols + ix);
+      }
+    }
+  };
+
+  for (const auto& shape : g.shapes) {
+    for_each_cell(shape.bounds, [&](size_t cell) { g.cell_start[cell + 1]++; });
+  }
+  for (size_t i = 0; i < cell_count; ++i) {
+    g.cell_start[i + 1] += g.cell_start[i];
+  }
+
+  g.items.resize(g.cell_start[cell_count]);
+  std::vector<uint32_t> cursor(g.cell_start.begin(), g.cell_start.end() - 1);
+  for (uint32_t i = 0; i < g.shapes.size(); ++i) {
+    for_each_cell(g.shapes[i].bounds, [&](size_t cell) { g.items[cursor[cell]++] = i; });
+  }
+  static_grid_ = std::move(grid);
+}
+
+template <typename Visitor>
+bool CollisionWorld::visitStatic(const OrientedBox& box, Visitor&& visitor) const {
+  if (!static_grid_ || static_grid_->shapes.empty()) {
+    return true;
+  }
+  const StaticGrid& g = *static_grid_;
+
+  const Aabb query = box.bounds();
+  if (!query.overlaps(g.bounds)) {
+    return true;
+  }
+
+  const int ix0 = clampCell(query.min_x, g.bounds.min_x, g.cell, g.cols);
+  const int ix1 = clampCell(query.max_x, g.bounds.min_x, g.cell, g.cols);
+  const int iy0 = clampCell(query.min_y, g.bounds.min_y, g.cell, g.rows);
+  const int iy1 = clampCell(query.max_y, g.bounds.min_y, g.cell, g.rows);
+
+  for (int iy = iy0; iy <= iy1; ++iy) {
+    for (int ix = ix0; ix <= ix1; ++ix) {
+      const size_t cell = static_cast<size_t>(iy) * g.cols + ix;
+      for (uint32_t k = g.cell_start[cell]; k < g.cell_start[cell + 1]; ++k) {
+        const uint32_t index = g.items[k];
+        const Aabb& bounds = g.shapes[index].bounds;
+        if (!bounds.overlaps(query)) {
+          continue;
+        }
+        // 跨格障碍物只在交集最小角所在的格子中处理一次
+        const int ref_x = clampCell(std::max(bounds.min_x, query.min_x),
+                                    g.bounds.min_x, g.cell, g.cols);
+        const int ref_y = clampCell(std::max(bounds.min_y, query.min_y),
+                                    g.bounds.min_y, g.cell, g.rows);
+        if (ref_x != ix || ref_y != iy) {
+          continue;
+        }
+        if (!visitor(index)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool CollisionWorld::testStatic(const OrientedBox& box, const StaticShape& shape) const {
+  if (shape.type == StaticObstacle::Type::CIRCLE) {
+    return boxIntersectsCircle(box, shape.cx, shape.cy, shape.radius);
+  }
+  return boxIntersectsPolygon(box, shape.points);
+}
+
+// ========== 动态网格 ==========
+
+int64_t CollisionWorld::dynamicCellKey(double x, double y) const {
+  return packCell(static_cast<int64_t>(std::floor(x / dynamic_cell_)),
+                  static_cast<int64_t>(std::floor(y / dynamic_cell_)));
+}
+
+void CollisionWorld::insertDynamic(uint32_t index, int64_t cell) {
+  auto& members = dynamic_cells_[cell];
+  dynamic_refs_[index].cell = cell;
+  dynamic_refs_[index].slot = static_cast<uint32_t>(members.size());
+  members.push_back(index);
+}
+
+void CollisionWorld::eraseDynamic(uint32_t index) {
+  const DynamicRef& ref = dynamic_refs_[index];
+  auto it = dynamic_cells_.find(ref.cell);
+  auto& members = it->second;
+
+  // 与末尾元素交换后弹出
+  const uint32_t last = members.back();
+  members[ref.slot] = last;
+  dynamic_refs_[last].slot = ref.slot;
+  members.pop_back();
+  if (members.empty()) {
+    dynamic_cells_.erase(it);
+  }
+}
+
+void CollisionWorld::rebuildDynamic(const DynamicObstacleStore& store) {
+  dynamic_refs_.clear();
+  dynamic_cells_.clear();
+  dynamic_max_extent_ = 0.0;
+  dynamic_refs_.reserve(store.size());
+
+  for (size_t m = 0; m < kMotionModelCount; ++m) {
+    const auto model = static_cast<MotionModel>(m);
+    const auto& block = store.block(model);
+    for (uint32_t row = 0; row < block.size(); ++row) {
+      DynamicRef ref;
+      ref.model = model;
+      ref.row = row;
+      dynamic_refs_.push_back(ref);
+
+      const double extent = block.shape[row] == DynamicObstacle::Shape::CIRCLE
+          ? block.radius[row]
+          : std::hypot(0.5 * block.height[row], 0.5 * block.width[row]);
+      dynamic_max_extent_ = std::max(dynamic_max_extent_, extent);
+    }
+  }
+
+  // 格子边长不小于障碍物直径，查询框扩展后最多多覆盖一圈格子
+  dynamic_cell_ = config_.dynamic_cell_size > 0.0
+      ? config_.dynamic_cell_size
+      : std::max(1.0, 2.0 * dynamic_max_extent_);
+
+  for (uint32_t i = 0; i < dynamic_refs_.size(); ++i) {
+    const auto& block = store.block(dynamic_refs_[i].model);
+    const uint32_t row = dynamic_refs_[i].row;
+    insertDynamic(i, dynamicCellKey(block.x[row], block.y[row]));
+  }
+}
+
+void CollisionWorld::updateDynamic(const DynamicObstacleStore& store) {
+  if (dynamic_refs_.size() != store.size()) {
+    rebuildDynamic(store);
+    return;
+  }
+
+  for (uint32_t i = 0; i < dynamic_refs_.size(); ++i) {
+    const auto& block = store.block(dynamic_refs_[i].model);
+    const uint32_t row = dynamic_refs_[i].row;
+    const int64_t cell = dynamicCellKey(block.x[row], block.y[row]);
+    if (cell != dynamic_refs_[i].cell) {
+      eraseDynamic(i);
+      insertDynamic(i, cell);
+    }
+  }
+}
+
+template <typename Visitor>
+bool CollisionWorld::visitDynamic(const OrientedBox& box, const DynamicObstacleStore& store,
+                                  Visitor&& visitor) const {
+  if (dynamic_refs_.empty()) {
+    return true;
+  }
+
+  // 障碍物按中心分格，查询框按最大外接半径扩展
+  Aabb query = box.bounds();
+  query.min_x -= dynamic_max_extent_;
+  query.min_y -= dynamic_max_extent_;
+  query.max_x += dynamic_max_extent_;
+  query.max_y += dynamic_max_extent_;
+
+  auto visit_members = [&](const std::vector<uint32_t>& members) {
+    for (uint32_t index : members) {
+      const DynamicRef& ref = dynamic_refs_[index];
+      const auto& block = store.block(ref.model);
+      const double x = block.x[ref.row];
+      const double y = block.y[ref.row];
+      if (x < query.min_x || x > query.max_x || y < query.min_y || y > query.max_y) {
+        continue;
+      }
+      if (!visitor(ref)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  const int64_t ix0 = static_cast<int64_t>(std::floor(query.min_x / dynamic_cell_));
+  const int64_t ix1 = static_cast<int64_t>(std::floor(query.max_x / dynamic_cell_));
+  const int64_t iy0 = static_cast<int64_t>(std::floor(query.min_y / dynamic_cell_));
+  const int64_t iy1 = static_cast<int64_t>(std::floor(query.max_y / dynamic_cell_));
+
+  // 查询框覆盖的格子比已占用的格子还多时，直接遍历已占用的格子
+  const double range_cells = static_cast<double>(ix1 - ix0 + 1) * static_cast<double>(iy1 - iy0 + 1);
+  if (range_cells > static_cast<double>(dynamic_cells_.size())) {
+    for (const auto& entry : dynamic_cells_) {
+      if (!visit_members(entry.second)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  for (int64_t iy = iy0; iy <= iy1; ++iy) {
+    for (int64_t ix = ix0; ix <= ix1; ++ix) {
+      auto it = dynamic_cells_.find(packCell(ix, iy));
+      if (it != dynamic_cells_.end() && !visit_members(it->second)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool CollisionWorld::testDynamic(const OrientedBox& box, const DynamicObstacleStore& store,
+                                 const DynamicRef& ref) const {
+  const auto& block = store.block(ref.model);
+  const uint32_t row = ref.row;
+  if (block.shape[row] == DynamicObstacle::Shape::CIRCLE) {
+    return boxIntersectsCircle(box, block.x[row], block.y[row], block.radius[row]);
+  }
+  // 矩形：height 为沿朝向的长度，width 为宽度
+  OrientedBox obstacle{block.x[row], block.y[row], block.yaw[row],
+                       0.5 * block.height[row], 0.5 * block.width[row]};
+  return boxIntersectsBox(box, obstacle);
+}
+
+// ========== 查询 ==========
+
+bool CollisionWorld::collides(const OrientedBox& box, const DynamicObstacleStore& store) const {
+  bool hit = false;
+  visitStatic(box, [&](uint32_t index) {
+    hit = testStatic(box, static_grid_->shapes[index]);
+    return !hit;
+  });
+  if (hit) {
+    return true;
+  }
+
+  visitDynamic(box, store, [&](const DynamicRef& ref) {
+    hit = testDynamic(box, store, ref);
+    return !hit;
+  });
+  return hit;
+}
+
+void CollisionWorld::collect(const OrientedBox& box, const DynamicObstacleStore& store,
+                             std::vector<Hit>& hits) const {
+  visitStatic(box, [&](uint32_t index) {
+    if (testStatic(box, static_grid_->shapes[index])) {
+      Hit hit;
+      hit.kind = Hit::Kind::STATIC;
+      hit.index = static_grid_->shapes[index].source;
+      hits.push_back(hit);
+    }
+    return true;
+  });
+
+  visitDynamic(box, store, [&](const DynamicRef& ref) {
+    if (testDynamic(box, store, ref)) {
+      Hit hit;
+      hit.kind = Hit::Kind::DYNAMIC;
+      hit.index = ref.row;
+      hit.model = ref.model;
+      hits.push_back(hit);
+    }
+    return true;
+  });
+}
+
+} // namespace sim
+} // namespace navsim
@@ -0,0 +1,350 @@
+#include "sim/dynamic_obstacle_store.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace navsim {
+namespace sim {
+
+namespace {
+
+constexpr double kTwoPi = 2.0 * M_PI;
+
+// 角度标准化到 [-π, π)，无循环，便于在积分循环中内联
+inline double wrapAngle(double angle) {
+  return angle - kTwoPi * std::floor((angle + M_PI) / kTwoPi);
+}
+
+// 对 Block 的每一列执行同一操作，保证各列长度一致
+template <typename Fn>
+void forEachColumn(DynamicObstacleStore::Block& block, Fn&& fn) {
+  fn(block.id);
+  fn(block.x);
+  fn(block.y);
+  fn(block.yaw);
+  fn(block.vx);
+  fn(block.vy);
+  fn(block.omega);
+  fn(block.ax);
+  fn(block.ay);
+  fn(block.shape);
+  fn(block.radius);
+  fn(block.width);
+  fn(block.height);
+}
+
+bool parseInt(const std::string& text, int& value) {
+  if (text.empty()) {
+    return false;
+  }
+  errno = 0;
+  char* end = nullptr;
+  long parsed = std::strtol(text.c_str(), &end, 10);
+  if (errno != 0 || *end != '\0' || parsed < INT_MIN || parsed > INT_MAX) {
+    return false;
+  }
+  value = static_cast<int>(parsed);
+  return true;
+}
+
+} // namespace
+
+// ========== 运动模型 ==========
+
+const char* motionModelName(MotionModel model) {
+  switch (model) {
+    case MotionModel::CV: return "cv";
+    case MotionModel::CA: return "ca";
+    case MotionModel::CTRV: return "ctrv";
+    case MotionModel::CUSTOM: return "custom";
+  }
+  return "cv";
+}
+
+bool parseMotionModel(const std::string& name, MotionModel& model) {
+  for (size_t i = 0; i < kMotionModelCount; ++i) {
+    auto candidate = static_cast<MotionModel>(i);
+    if (name == motionModelName(candidate)) {
+      model = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+// ========== ObstacleIdTable ==========
+
+uint32_t ObstacleIdTable::intern(const std::string& id) {
+  auto it = lookup_.find(id);
+  if (it != lookup_.end()) {
+    return it->second;
+  }
+
+  auto index = static_cast<uint32_t>(names_.size());
+  int numeric_id = 0;
+  if (!parseInt(id, numeric_id)) {
+    numeric_id = -static_cast<int>(index) - 1;
+  }
+
+  names_.push_back(id);
+  numeric_ids_.push_back(numeric_id);
+  lookup_.emplace(id, index);
+  return index;
+}
+
+bool ObstacleIdTable::find(const std::string& id, uint32_t& index) const {
+  auto it = lookup_.find(id);
+  if (it == lookup_.end()) {
+    return false;
+  }
+  index = it->second;
+  return true;
+}
+
+void ObstacleIdTable::clear() {
+  names_.clear();
+  numeric_ids_.clear();
+  lookup_.clear();
+}
+
+// ========== DynamicObstacleStore 编辑 ==========
+
+size_t DynamicObstacleStore::size() const {
+  size_t total = 0;
+  for (const auto& block : blocks_) {
+    total += block.size();
+  }
+  return total;
+}
+
+void DynamicObstacleStore::reserve(size_t count) {
+  // 场景中绝大多数障碍物使用恒速模型，只为 CV 预留
+  forEachColumn(blocks_[static_cast<size_t>(MotionModel::CV)],
+                [count](auto& column) { column.reserve(count); });
+}
+
+void DynamicObstacleStore::add(const DynamicObstacle& obstacle) {
+  Block& target = blocks_[static_cast<size_t>(obstacle.model)];
+  target.id.push_back(ids_.intern(obstacle.id));
+  target.x.push_back(obstacle.pose.x);
+  target.y.push_back(obstacle.pose.y);
+  target.yaw.push_back(obstacle.pose.yaw);
+  target.vx.push_back(obstacle.twist.vx);
+  target.vy.push_back(obstacle.twist.vy);
+  target.omega.push_back(obstacle.twist.omega);
+  target.ax.push_back(obstacle.accel_x);
+  target.ay.push_back(obstacle.accel_y);
+  target.shape.push_back(obstacle.shape);
+  target.radius.push_back(obstacle.radius);
+  target.width.push_back(obstacle.width);
+  target.height.push_back(obstacle.height);
+}
+
+bool DynamicObstacleStore::remove(const std::string& id) {
+  uint32_t index = 0;
+  if (!ids_.find(id, index)) {
+    return false;
+  }
+
+  bool removed = false;
+  for (auto& block : blocks_) {
+    // 原地压缩，保持剩余障碍物的相对顺序
+    size_t kept = 0;
+    for (size_t row = 0; row < block.size(); ++row) {
+      if (block.id[row] == index) {
+        continue;
+      }
+      if (kept != row) {
+        forEachColumn(block, [kept, row](auto& column) { column[kept] = column[row]; });
+      }
+      ++kept;
+    }
+    if (kept != block.size()) {
+      removed = true;
+      forEachColumn(block, [kept](auto& column) { column.resize(kept); });
+    }
+  }
+  return removed;
+}
+
+void DynamicObstacleStore::clear() {
+  for (auto& block : blocks_) {
+    forEachColumn(block, [](auto& column) { column.clear(); });
+  }
+  ids_.clear();
+}
+
+// ========== DynamicObstacleStore 访问 ==========
+
+DynamicObstacle DynamicObstacleStore::operator[](size_t index) const {
+  for (size_t m = 0; m < kMotionModelCount; ++m) {
+    const Block& block = blocks_[m];
+    if (index >= block.size()) {
+      index -= block.size();
+      continue;
+    }
+
+    DynamicObstacle obstacle(ids_.name(block.id[index]));
+    obstacle.pose = {block.x[index], block.y[index], block.yaw[index]};
+    obstacle.twist = {block.vx[index], block.vy[index], block.omega[index]};
+    obstacle.accel_x = block.ax[index];
+    obstacle.accel_y = block.ay[index];
+    obstacle.shape = block.shape[index];
+    obstacle.radius = block.radius[index];
+    obstacle.width = block.width[index];
+    obstacle.height = block.height[index];
+    obstacle.model = static_cast<MotionModel>(m);
+    return obstacle;
+  }
+  throw std::out_of_range("DynamicObstacleStore index out of range");
+}
+
+// ========== 积分内核 ==========
+
+void DynamicObstacleStore::integrate(double dt) {
+  integrateConstantVelocity(blocks_[static_cast<size_t>(MotionModel::CV)], dt);
+  integrateConstantAcceleration(blocks_[static_cast<size_t>(MotionModel::CA)], dt);
+  integrateCtrv(blocks_[static_cast<size_t>(MotionModel::CTRV)], dt);
+  // CUSTOM 模型由外部控制，不在这里积分
+}
+
+void DynamicObstacleStore::integrateConstantVelocity(Block& block, double dt) {
+  const size_t n = block.size();
+  double* x = block.x.data();
+  double* y = block.y.data();
+  double* yaw = block.yaw.data();
+  const double* vx = block.vx.data();
+  const double* vy = block.vy.data();
+  const double* omega = block.omega.data();
+
+  for (size_t i = 0; i < n; ++i) {
+    x[i] += vx[i] * dt;
+    y[i] += vy[i] * dt;
+    yaw[i] = wrapAngle(yaw[i] + omega[i] * dt);
+  }
+}
+
+void DynamicObstacleStore::integrateConstantAcceleration(Block& block, double dt) {
+  const size_t n = block.size();
+  const double half_dt2 = 0.5 * dt * dt;
+  double* x = block.x.data();
+  double* y = block.y.data();
+  double* yaw = block.yaw.data();
+  double* vx = block.vx.data();
+  double* vy = block.vy.data();
+  const double* omega = block.omega.data();
+  const double* ax = block.ax.data();
+  const double* ay = block.ay.data();
+
+  for (size_t i = 0; i < n; ++i) {
+    x[i] += vx[i] * dt + ax[i] * half_dt2;
+    y[i] += vy[i] * dt + ay[i] * half_dt2;
+    vx[i] += ax[i] * dt;
+    vy[i] += ay[i] * dt;
+    yaw[i] = wrapAngle(yaw[i] + omega[i] * dt);
+  }
+}
+
+void DynamicObstacleStore::integrateCtrv(Block& block, double dt) {
+  const size_t n = block.size();
+  double* x = block.x.data();
+  double* y = block.y.data();
+  double* yaw = block.yaw.data();
+  double* vx = block.vx.data();
+  double* vy = block.vy.data();
+  const double* omega = block.omega.data();
+
+  for (size_t i = 0; i < n; ++i) {
+    const double speed = std::sqrt(vx[i] * vx[i] + vy[i] * vy[i]);
+    const double yaw0 = yaw[i];
+    const double yaw1 = yaw0 + omega[i] * dt;
+    const double s0 = std::sin(yaw0), c0 = std::cos(yaw0);
+    const double s1 = std::sin(yaw1), c1 = std::cos(yaw1);
+
+    // 角速度接近 0 时退化为沿 yaw 直线运动，避免除零
+    const bool turning = std::abs(omega[i]) > 1e-6;
+    const double r = turning ? speed / omega[i] : 0.0;
+    x[i] += turning ? r * (s1 - s0) : speed * c0 * dt;
+    y[i] += turning ? r * (c0 - c1) : speed * s0 * dt;
+
+    vx[i] = speed * c1;
+    vy[i] = speed * s1;
+    yaw[i] = wrapAngle(yaw1);
+  }
+}
+
+// ========== 批量转换 ==========
+
+void DynamicObstacleStore::appendTo(proto::WorldTick& world_tick) const {
+  auto* obstacles = world_tick.mutable_dynamic_obstacles();
+  obstacles->Reserve(obstacles->size() + static_cast<int>(size()));
+
+  for (size_t m = 0; m < kMotionModelCount; ++m) {
+    const Block& block = blocks_[m];
+    const std::string model_name = motionModelName(static_cast<MotionModel>(m));
+
+    for (size_t i = 0; i < block.size(); ++i) {
+      auto* dyn_obs = obstacles->Add();
+      dyn_obs->set_id(ids_.name(block.id[i]));
+
+      auto* pose = dyn_obs->mutable_pose();
+      pose->set_x(block.x[i]);
+      pose->set_y(block.y[i]);
+      pose->set_yaw(block.yaw[i]);
+
+      auto* twist = dyn_obs->mutable_twist();
+      twist->set_vx(block.vx[i]);
+      twist->set_vy(block.vy[i]);
+      twist->set_omega(block.omega[i]);
+
+      auto* shape = dyn_obs->mutable_shape();
+      if (block.shape[i] == DynamicObstacle::Shape::CIRCLE) {
+        auto* circle = shape->mutable_circle();
+        circle->set_x(0.0);  // 圆心相对于障碍物位姿的偏移
+        circle->set_y(0.0);
+        circle->set_r(block.radius[i]);
+      } else {
+        auto* rect = shape->mutable_rectangle();
+        // 🔧 重要：protobuf 的 w/h 与内部表示的 width/height 映射关系对调
+        // 参考 DynamicObstaclePredictor::predictConstantVelocity() 中的注释
+        rect->set_w(block.height[i]);  // protobuf.w ← sim.height (车辆长度)
+        rect->set_h(block.width[i]);   // protobuf.h ← sim.width (车辆宽度)
+        rect->set_yaw(0.0);  // 矩形相对于障碍物位姿的朝向偏移
+      }
+
+      dyn_obs->set_model(model_name);
+    }
+  }
+}
+
+void DynamicObstacleStore::appendTo(std::vector<planning::DynamicObstacle>& obstacles) const {
+  obstacles.reserve(obstacles.size() + size());
+
+  for (const auto& block : blocks_) {
+    for (size_t i = 0; i < block.size(); ++i) {
+      planning::DynamicObstacle dyn_obs;
+      dyn_obs.id = ids_.numericId(block.id[i]);
+      dyn_obs.current_pose = {block.x[i], block.y[i], block.yaw[i]};
+      dyn_obs.current_twist = {block.vx[i], block.vy[i], block.omega[i]};
+      dyn_obs.type = "vehicle";  // 默认类型
+
+      if (block.shape[i] == DynamicObstacle::Shape::CIRCLE) {
+        dyn_obs.shape_type = "circle";
+        dyn_obs.length = block.radius[i] * 2.0;  // 直径
+        dyn_obs.width = block.radius[i] * 2.0;
+      } else {
+        dyn_obs.shape_type = "rectangle";
+        dyn_obs.length = block.height[i];  // 注意：DynamicObstacle 使用 height 表示长度
+        dyn_obs.width = block.width[i];
+      }
+
+      obstacles.push_back(std::move(dyn_obs));
+    }
+  }
+}
+
+} // namespace sim
+} // namespace navsim
@@ -0,0 +1,123 @@
+#include "sim/ego_integrator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace navsim {
+namespace sim {
+
+namespace {
+
+struct State {
+  double x;
+  double y;
+  double yaw;
+};
+
+State operator+(const State& a, const State& b) {
+  return {a.x + b.x, a.y + b.y, a.yaw + b.yaw};
+}
+
+State operator*(double k, const State& s) {
+  return {k * s.x, k * s.y, k * s.yaw};
+}
+
+/**
+ * @brief 控制输入在步长内恒定时的状态导数
+ */
+class Derivative {
+public:
+  Derivative(const planning::Twist2d& twist, const EgoKinematics& kinematics)
+    : vx_(twist.vx), vy_(twist.vy), yaw_rate_(twist.omega) {
+    if (kinematics.type == EgoKinematics::Type::ACKERMANN && kinematics.wheelbase > 0.0) {
+      vy_ = 0.0;
+      if (std::abs(vx_) < 1e-6) {
+        yaw_rate_ = 0.0;
+      } else {
+        double steer = std::atan(twist.omega * kinematics.wheelbase / vx_);
+        if (kinematics.max_steer > 0.0) {
+          steer = std::max(-kinematics.max_steer, std::min(kinematics.max_steer, steer));
+        }
+        yaw_rate_ = vx_ * std::tan(steer) / kinematics.wheelbase;
+      }
+    }
+  }
+
+  State operator()(const State& s) const {
+    const double c = std::cos(s.yaw);
+    const double sn = std::sin(s.yaw);
+    return {vx_ * c - vy_ * sn, vx_ * sn + vy_ * c, yaw_rate_};
+  }
+
+private:
+  double vx_;
+  double vy_;
+  double yaw_rate_;
+};
+
+double normalizeAngle(double angle) {
+  while (angle > M_PI) angle -= 2.0 * M_PI;
+  while (angle < -M_PI) angle += 2.0 * M_PI;
+  return angle;
+}
+
+} // namespace
+
+bool parseIntegrationMethod(const std::string& name, IntegrationMethod& method) {
+  if (name == "euler") {
+    method = IntegrationMethod::EULER;
+  } else if (name == "midpoint") {
+    method = IntegrationMethod::MIDPOINT;
+  } else if (name == "rk4") {
+    method = IntegrationMethod::RK4;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+EgoKinematics EgoKinematics::fromChassis(const proto::ChassisConfig& chassis) {
+  EgoKinematics kinematics;
+  if ((chassis.model() == "ackermann" || chassis.model() == "four_wheel") &&
+      chassis.wheelbase() > 0.0) {
+    kinematics.type = Type::ACKERMANN;
+    kinematics.wheelbase = chassis.wheelbase();
+    kinematics.max_steer = chassis.limits().steer_max();
+  }
+  return kinematics;
+}
+
+planning::Pose2d integrateEgoPose(const planning::Pose2d& pose,
+                                  const planning::Twist2d& twist,
+                                  const EgoKinematics& kinematics,
+                                  IntegrationMethod method,
+                                  double dt) {
+  const Derivative f(twist, kinematics);
+  const State s0{pose.x, pose.y, pose.yaw};
+  State s1;
+
+  switch (method) {
+    case IntegrationMethod::EULER:
+      s1 = s0 + dt * f(s0);
+      break;
+    case IntegrationMethod::MIDPOINT: {
+      const State k1 = f(s0);
+      s1 = s0 + dt * f(s0 + (0.5 * dt) * k1);
+      break;
+    }
+    case IntegrationMethod::RK4:
+    default: {
+      const State k1 = f(s0);
+      const State k2 = f(s0 + (0.5 * dt) * k1);
+      const State k3 = f(s0 + (0.5 * dt) * k2);
+      const State k4 = f(s0 + dt * k3);
+      s1 = s0 + (dt / 6.0) * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+      break;
+    }
+  }
+
+  return planning::Pose2d(s1.x, s1.y, normalizeAngle(s1.yaw));
+}
+
+} // namespace sim
+} // namespace navsim
@@ -1,10 +1,15 @@
 #include "sim/local_simulator.hpp"
 #include "core/scenario_loader.hpp"
+#include "core/trace.hpp"
+#include "core/log.hpp"
+#include "sim/collision_world.hpp"
+#include "sim/ego_integrator.hpp"
 
 #include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <chrono>
+#include <stdexcept>
 
 namespace navsim {
 namespace sim {
@@ -25,8 +30,8 @@ public:
   bool is_running_ = false;
   double real_time_factor_ = 1.0;  // 实际运行的时间缩放
 
-  // 初始状态（用于重置）
-  WorldState initial_state_;
+  // 初始状态（用于重置），与快照及分叉出的仿真器共享
+  std::shared_ptr<const WorldState> initial_state_ = std::make_shared<WorldState>();
 
   // 回调函数
   SimulationStateCallback state_callback_;
@@ -35,7 +40,27 @@ public:
 
   // 统计信息
   std::chrono::steady_clock::time_point last_step_time_;
+
+  // 固定步长积分：累加器保存尚未推进的仿真时间（不足一个子步）
   double accumulated_time_ = 0.0;
+  IntegrationMethod integration_method_ = IntegrationMethod::RK4;
+  planning::Pose2d previous_ego_pose_;     // 最后一个子步之前的自车位姿，用于渲染插值
+  uint64_t dropped_substeps_ = 0;          // 因超过 max_substeps 而丢弃的子步数
+
+  // 场景修订号：任何改变世界状态的操作都会递增
+  uint64_t scene_revision_ = 0;
+
+  // 碰撞检测：障碍物增删后标记为脏，下次查询前重建
+  CollisionWorld collision_world_;
+  bool static_collision_dirty_ = true;
+  bool dynamic_collision_dirty_ = true;
+  std::vector<CollisionWorld::Hit> collision_hits_;
+  std::vector<CollisionWorld::Hit> step_collision_hits_;  // 本次 step() 各子步的碰撞（去重）
+
+  // 调试日志节流：上次打印时的 tick / 帧号
+  uint64_t last_ego_log_tick_ = 0;
+  uint64_t last_map_log_tick_ = 0;
+  uint64_t last_empty_map_log_tick_ = 0;
 
   // ========== 内部方法 ==========
 
@@ -46,33 +71,40 @@ public:
   void integrate_dynamic_obstacles(double dt);
 
   /**
-   * @brief 检查并处理碰撞
+   * @brief 以固定子步推进物理状态
+   * @param frame_dt 本帧（时间缩放后）的仿真时长
+   */
+  void advance_physics(double frame_dt);
+
+  /**
+   * @brief 检测当前子步的碰撞，记录到 step_collision_hits_
    */
   void check_and_handle_collisions();
 
   /**
-   * @brief 自车运动积分（如果有外部控制输入）
-   * @param dt 时间步长
+   * @brief 触发本次 step() 记录的碰撞回调
    */
-  void integrate_ego_motion(double dt);
+  void dispatch_collision_callbacks();
 
   /**
-   * @brief 碰撞检测：点与圆
+   * @brief 自车运动积分（如果有外部控制输入）
+   * @param dt 时间步长
+   * @param kinematics 自车运动学模型
    */
-  bool point_circle_collision(const planning::Point2d& point,
-                              const planning::Point2d& center,
-                              double radius) const;
+  void integrate_ego_motion(double dt, const EgoKinematics& kinematics);
 
   /**
-   * @brief 碰撞检测：圆与圆
+   * @brief 重建标记为脏的碰撞网格
    */
-  bool circle_circle_collision(const planning::Point2d& center1, double radius1,
-                               const planning::Point2d& center2, double radius2) const;
+  void sync_collision_world();
 
   /**
-   * @brief 自车几何模型（简化为圆形）
+   * @brief 自车轮廓（有向包围盒）
+   *
+   * 与可视化一致：原点为驱动轴/后轴中心，车身从 -rear_overhang 延伸到
+   * wheelbase + front_overhang；未配置悬伸时以 body_length 居中。
    */
-  double get_ego_radius() const;
+  OrientedBox get_ego_footprint(const planning::Pose2d& pose) const;
 
   /**
    * @brief 角度标准化到 [-π, π]
@@ -82,7 +114,7 @@ public:
   /**
    * @brief 从 PlanningContext 转换动态障碍物
    */
-  std::vector<DynamicObstacle> convert_dynamic_obstacles(
+  DynamicObstacleStore convert_dynamic_obstacles(
       const std::vector<planning::DynamicObstacle>& obstacles) const;
 
   /**
@@ -92,6 +124,31 @@ public:
       const planning::BEVObstacles& bev_obstacles) const;
 };
 
+// ========== SimulationSnapshot ==========
+
+struct SimulationSnapshot::Data {
+  SimulatorConfig config;
+  IntegrationMethod integration_method = IntegrationMethod::RK4;
+  WorldState world_state;
+  std::shared_ptr<const WorldState> initial_state;
+  bool is_running = false;
+  double accumulated_time = 0.0;
+  planning::Pose2d previous_ego_pose;
+  uint64_t scene_revision = 0;
+
+  // 碰撞网格：静态部分在拷贝之间共享，脏标记保证恢复后按需重建
+  CollisionWorld collision_world;
+  bool static_collision_dirty = true;
+  bool dynamic_collision_dirty = true;
+};
+
+const WorldState& SimulationSnapshot::world_state() const {
+  if (!data_) {
+    throw std::logic_error("SimulationSnapshot: empty snapshot");
+  }
+  return data_->world_state;
+}
+
 // ========== LocalSimulator 实现 ==========
 
 LocalSimulator::LocalSimulator() : impl_(std::make_unique<Impl>()) {
@@ -123,17 +180,28 @@ LocalSimulator::~LocalSimulator() = default;
 
 bool LocalSimulator::initialize(const SimulatorConfig& config) {
   impl_->config_ = config;
+  if (impl_->config_.time_step <= 0.0) {
+    std::cerr << "[LocalSimulator] Invalid time_step " << config.time_step
+              << ", using 0.01s" << std::endl;
+    impl_->config_.time_step = 0.01;
+  }
+  if (!parseIntegrationMethod(config.physics.integration_method, impl_->integration_method_)) {
+    std::cerr << "[LocalSimulator] Unknown integration method '" << config.physics.integration_method
+              << "', using rk4" << std::endl;
+    impl_->integration_method_ = IntegrationMethod::RK4;
+  }
   impl_->world_state_.timestamp = 0.0;
   impl_->world_state_.frame_id = 0;
   impl_->is_running_ = false;
   impl_->accumulated_time_ = 0.0;
 
   // 保存初始状态
-  impl_->initial_state_ = impl_->world_state_;
+  impl_->initial_state_ = std::make_shared<const WorldState>(impl_->world_state_);
 
   impl_->initialized_ = true;
   std::cout << "[LocalSimulator] Initialized with time_step="
-            << config.time_step << "s, time_scale=" << config.time_scale << std::endl;
+            << impl_->config_.time_step << "s, time_scale=" << config.time_scale
+            << ", integration=" << config.physics.integration_method << std::endl;
 
   return true;
 }
@@ -146,6 +214,8 @@ bool LocalSimulator::load_scenario(const std::string& scenario_file,
     return false;
   }
 
+  impl_->scene_revision_++;
+
   std::cout << "[LocalSimulator] ========================================" << std::endl;
   std::cout << "[LocalSimulator] Loading scenario: " << scenario_file << std::endl;
 
@@ -174,6 +244,8 @@ bool LocalSimulator::load_scenario(const std::string& scenario_file,
   impl_->world_state_.ego_pose = context.ego.pose;
   impl_->world_state_.ego_twist = context.ego.twist;
   impl_->world_state_.goal_pose = context.task.goal_pose;
+  impl_->previous_ego_pose_ = context.ego.pose;
+  impl_->accumulated_time_ = 0.0;
 
   // 转换动态障碍物
   impl_->world_state_.dynamic_obstacles = impl_->convert_dynamic_obstacles(context.dynamic_obstacles);
@@ -219,6 +291,11 @@ bool LocalSimulator::load_scenario(const std::string& scenario_file,
     }
   }
 
+  // 碰撞网格在加载场景后立即构建
+  impl_->static_collision_dirty_ = true;
+  impl_->dynamic_collision_dirty_ = true;
+  impl_->sync_collision_world();
+
   // 更新地图版本
   impl_->world_state_.map_version++;
   std::cout << "[LocalSimulator] Map version updated to: " << impl_->world_state_.map_version << std::endl;
@@ -227,7 +304,7 @@ bool LocalSimulator::load_scenario(const std::string& scenario_file,
   }
 
   // 保存为初始状态
-  impl_->initial_state_ = impl_->world_state_;
+  impl_->initial_state_ = std::make_shared<const WorldState>(impl_->world_state_);
 
   std::cout << "[LocalSimulator] ========================================" << std::endl;
   std::cout << "[LocalSimulator] Loaded scenario: " << scenario_file << std::endl;
@@ -254,7 +331,7 @@ bool LocalSimulator::load_scenario(const std::string& scenario_file,
 
   // 调试：打印前3个动态障碍物的速度
   for (size_t i = 0; i < std::min(size_t(3), impl_->world_state_.dynamic_obstacles.size()); ++i) {
-    const auto& obs = impl_->world_state_.dynamic_obstacles[i];
+    const auto obs = impl_->world_state_.dynamic_obstacles[i];
     std::cout << "    Obstacle " << i << ": pos=(" << obs.pose.x << ", " << obs.pose.y
               << "), vel=(" << obs.twist.vx << ", " << obs.twist.vy << ")" << std::endl;
   }
@@ -295,11 +372,15 @@ void LocalSimulator::pause() {
 }
 
 void LocalSimulator::reset() {
+  impl_->scene_revision_++;
   impl_->is_running_ = false;
-  impl_->world_state_ = impl_->initial_state_;
+  impl_->world_state_ = *impl_->initial_state_;
   impl_->world_state_.timestamp = 0.0;
   impl_->world_state_.frame_id = 0;
   impl_->accumulated_time_ = 0.0;
+  impl_->previous_ego_pose_ = impl_->world_state_.ego_pose;
+  impl_->static_collision_dirty_ = true;
+  impl_->dynamic_collision_dirty_ = true;
 
   if (impl_->state_callback_) {
     impl_->state_callback_(false);
@@ -313,7 +394,7 @@ void LocalSimulator::reset() {
 
   // 调试：打印前3个动态障碍物的速度
   for (size_t i = 0; i < std::min(size_t(3), impl_->world_state_.dynamic_obstacles.size()); ++i) {
-    const auto& obs = impl_->world_state_.dynamic_obstacles[i];
+    const auto obs = impl_->world_state_.dynamic_obstacles[i];
     std::cout << "    Obstacle " << i << ": pos=(" << obs.pose.x << ", " << obs.pose.y
               << "), vel=(" << obs.twist.vx << ", " << obs.twist.vy << ")" << std::endl;
   }
@@ -330,31 +411,19 @@ bool LocalSimulator::step(double dt) {
     dt = impl_->config_.time_step;
   }
 
-  // 应用时间缩放
-  double scaled_dt = dt * impl_->config_.time_scale;
-
-  // 限制最大步长
-  if (scaled_dt > impl_->config_.max_time_step) {
-    scaled_dt = impl_->config_.max_time_step;
-  }
+  // 先截断单帧时长（避免卡顿后一次追赶过久），再应用时间缩放
+  double frame_dt = std::min(dt, impl_->config_.max_time_step) * impl_->config_.time_scale;
 
   // 只有运行状态才积分
   if (impl_->is_running_) {
-    // 积分动态障碍物
-    impl_->integrate_dynamic_obstacles(scaled_dt);
-
-    // 自车运动积分（目前保持静止，等待外部控制）
-    impl_->integrate_ego_motion(scaled_dt);
-
-    // 检查碰撞
-    impl_->check_and_handle_collisions();
-
-    // 更新时间
-    impl_->world_state_.timestamp += scaled_dt;
+    impl_->advance_physics(frame_dt);
   }
 
   // 无论是否运行都更新帧ID
   impl_->world_state_.frame_id++;
+  if (impl_->is_running_) {
+    impl_->scene_revision_++;
+  }
 
   // 触发帧更新回调
   if (impl_->frame_callback_) {
@@ -368,6 +437,59 @@ bool LocalSimulator::is_running() const {
   return impl_->is_running_;
 }
 
+SimulationSnapshot LocalSimulator::snapshot() const {
+  auto data = std::make_shared<SimulationSnapshot::Data>();
+  data->config = impl_->config_;
+  data->integration_method = impl_->integration_method_;
+  data->world_state = impl_->world_state_;
+  data->initial_state = impl_->initial_state_;
+  data->is_running = impl_->is_running_;
+  data->accumulated_time = impl_->accumulated_time_;
+  data->previous_ego_pose = impl_->previous_ego_pose_;
+  data->scene_revision = impl_->scene_revision_;
+  data->collision_world = impl_->collision_world_;
+  data->static_collision_dirty = impl_->static_collision_dirty_;
+  data->dynamic_collision_dirty = impl_->dynamic_collision_dirty_;
+  return SimulationSnapshot(std::move(data));
+}
+
+bool LocalSimulator::restore(const SimulationSnapshot& snapshot) {
+  if (!snapshot.valid()) {
+    std::cerr << "[LocalSimulator] Cannot restore from an empty snapshot" << std::endl;
+    return false;
+  }
+
+  const auto& data = *snapshot.data_;
+  impl_->config_ = data.config;
+  impl_->integration_method_ = data.integration_method;
+  impl_->world_state_ = data.world_state;
+  impl_->initial_state_ = data.initial_state;
+  impl_->is_running_ = data.is_running;
+  impl_->accumulated_time_ = data.accumulated_time;
+  impl_->previous_ego_pose_ = data.previous_ego_pose;
+  impl_->collision_world_ = data.collision_world;
+  impl_->static_collision_dirty_ = data.static_collision_dirty;
+  impl_->dynamic_collision_dirty_ = data.dynamic_collision_dirty;
+  impl_->initialized_ = true;
+
+  // 修订号继续递增而不是回退，保证观察者能看到状态变化
+  impl_->scene_revision_ = std::max(impl_->scene_revision_, data.scene_revision) + 1;
+  return true;
+}
+
+std::unique_ptr<LocalSimulator> LocalSimulator::from_snapshot(const SimulationSnapshot& snapshot) {
+  if (!snapshot.valid()) {
+    return nullptr;
+  }
+  auto simulator = std::make_unique<LocalSimulator>();
+  simulator->restore(snapshot);
+  return simulator;
+}
+
+std::unique_ptr<LocalSimulator> LocalSimulator::fork() const {
+  return from_snapshot(snapshot());
+}
+
 const WorldState& LocalSimulator::get_world_state() const {
   return impl_->world_state_;
 }
@@ -380,44 +502,72 @@ uint64_t LocalSimulator::get_frame_id() const {
   return impl_->world_state_.frame_id;
 }
 
+uint64_t LocalSimulator::get_scene_revision() const {
+  return impl_->scene_revision_;
+}
+
+double LocalSimulator::get_interpolation_alpha() const {
+  return std::min(1.0, impl_->accumulated_time_ / impl_->config_.time_step);
+}
+
+planning::Pose2d LocalSimulator::get_interpolated_ego_pose() const {
+  const double alpha = get_interpolation_alpha();
+  const auto& prev = impl_->previous_ego_pose_;
+  const auto& curr = impl_->world_state_.ego_pose;
+  const double dyaw = impl_->normalize_angle(curr.yaw - prev.yaw);
+  return planning::Pose2d(prev.x + alpha * (curr.x - prev.x),
+                          prev.y + alpha * (curr.y - prev.y),
+                          impl_->normalize_angle(prev.yaw + alpha * dyaw));
+}
+
 void LocalSimulator::set_ego_pose(const planning::Pose2d& pose) {
+  impl_->scene_revision_++;
   impl_->world_state_.ego_pose = pose;
+  impl_->previous_ego_pose_ = pose;
   std::cout << "[LocalSimulator] Set ego pose: (" << pose.x << ", " << pose.y << ", " << pose.yaw << ")" << std::endl;
 }
 
 void LocalSimulator::set_ego_twist(const planning::Twist2d& twist) {
+  impl_->scene_revision_++;
   impl_->world_state_.ego_twist = twist;
 }
 
 void LocalSimulator::apply_ego_state(const planning::Pose2d& pose, const planning::Twist2d& twist) {
+  impl_->scene_revision_++;
   impl_->world_state_.ego_pose = pose;
   impl_->world_state_.ego_twist = twist;
+  impl_->previous_ego_pose_ = pose;
 }
 
 void LocalSimulator::set_goal_pose(const planning::Pose2d& pose) {
+  impl_->scene_revision_++;
   impl_->world_state_.goal_pose = pose;
   std::cout << "[LocalSimulator] Set goal pose: (" << pose.x << ", " << pose.y << ", " << pose.yaw << ")" << std::endl;
 }
 
 void LocalSimulator::set_goal_tolerance(double pos_tol, double yaw_tol) {
+  impl_->scene_revision_++;
   impl_->world_state_.goal_tolerance_pos = pos_tol;
   impl_->world_state_.goal_tolerance_yaw = yaw_tol;
 }
 
 void LocalSimulator::add_static_obstacle(const StaticObstacle& obstacle) {
+  impl_->scene_revision_++;
   impl_->world_state_.static_obstacles.push_back(obstacle);
   impl_->world_state_.map_version++;
+  impl_->static_collision_dirty_ = true;
 }
 
 void LocalSimulator::add_dynamic_obstacle(const DynamicObstacle& obstacle) {
-  impl_->world_state_.dynamic_obstacles.push_back(obstacle);
+  impl_->scene_revision_++;
+  impl_->world_state_.dynamic_obstacles.add(obstacle);
+  impl_->dynamic_collision_dirty_ = true;
 }
 
 void LocalSimulator::remove_dynamic_obstacle(const std::string& id) {
-  auto& obstacles = impl_->world_state_.dynamic_obstacles;
-  obstacles.erase(std::remove_if(obstacles.begin(), obstacles.end(),
-                                 [&id](const DynamicObstacle& obs) { return obs.id == id; }),
-                  obstacles.end());
+  impl_->scene_revision_++;
+  impl_->world_state_.dynamic_obstacles.remove(id);
+  impl_->dynamic_collision_dirty_ = true;
 }
 
 void LocalSimulator::clear_obstacles() {
@@ -426,12 +576,16 @@ void LocalSimulator::clear_obstacles() {
 }
 
 void LocalSimulator::clear_static_obstacles() {
+  impl_->scene_revision_++;
   impl_->world_state_.static_obstacles.clear();
   impl_->world_state_.map_version++;
+  impl_->static_collision_dirty_ = true;
 }
 
 void LocalSimulator::clear_dynamic_obstacles() {
+  impl_->scene_revision_++;
   impl_->world_state_.dynamic_obstacles.clear();
+  impl_->dynamic_collision_dirty_ = true;
 }
 
 void LocalSimulator::set_time_scale(double scale) {
@@ -460,33 +614,9 @@ bool LocalSimulator::check_collision() const {
 }
 
 bool LocalSimulator::check_collision_at(const planning::Pose2d& pose) const {
-  double ego_radius = impl_->get_ego_radius();
-  planning::Point2d ego_center{pose.x, pose.y};
-
-  // 检查与静态障碍物的碰撞
-  for (const auto& obs : impl_->world_state_.static_obstacles) {
-    if (obs.type == StaticObstacle::Type::CIRCLE) {
-      if (impl_->circle_circle_collision(ego_center, ego_radius,
-                                         obs.circle.center, obs.circle.radius)) {
-        return true;
-      }
-    }
-    // TODO: 多边形碰撞检测
-  }
-
-  // 检查与动态障碍物的碰撞
-  for (const auto& obs : impl_->world_state_.dynamic_obstacles) {
-    planning::Point2d obs_center{obs.pose.x, obs.pose.y};
-    if (obs.shape == DynamicObstacle::Shape::CIRCLE) {
-      if (impl_->circle_circle_collision(ego_center, ego_radius,
-                                         obs_center, obs.radius)) {
-        return true;
-      }
-    }
-    // TODO: 矩形碰撞检测
-  }
-
-  return false;
+  impl_->sync_collision_world();
+  return impl_->collision_world_.collides(impl_->get_ego_footprint(pose),
+                                          impl_->world_state_.dynamic_obstacles);
 }
 
 planning::PlanningContext LocalSimulator::to_planning_context() const {
@@ -502,27 +632,9 @@ planning::PlanningContext LocalSimulator::to_planning_context() const {
   // 任务信息
   context.task.goal_pose = impl_->world_state_.goal_pose;
 
-  // 动态障碍物（需要转换格式）
-  for (const auto& obs : impl_->world_state_.dynamic_obstacles) {
-    planning::DynamicObstacle dyn_obs;
-    dyn_obs.id = std::stoi(obs.id);  // 转换字符串ID为整数
-    dyn_obs.current_pose = obs.pose;
-    dyn_obs.current_twist = obs.twist;
-    dyn_obs.type = "vehicle";  // 默认类型
-    dyn_obs.shape_type = (obs.shape == DynamicObstacle::Shape::CIRCLE) ? "circle" : "rectangle";
-
-    // 🔧 设置形状尺寸
-    if (obs.shape == DynamicObstacle::Shape::CIRCLE) {
-      dyn_obs.length = obs.radius * 2.0;  // 直径
-      dyn_obs.width = obs.radius * 2.0;   // 直径
-    } else {
-      dyn_obs.length = obs.height;  // 注意：DynamicObstacle 使用 height 表示长度
-      dyn_obs.width = obs.width;
-    }
-
-    // TODO: 完善预测信息
-    context.dynamic_obstacles.push_back(dyn_obs);
-  }
+  // 动态障碍物（需要转换格式，字符串ID使用驻留表缓存的整数形式）
+  // TODO: 完善预测信息
+  impl_->world_state_.dynamic_obstacles.appendTo(context.dynamic_obstacles);
 
   // TODO: 转换静态障碍物到 BEV 格式
 
@@ -530,6 +642,7 @@ planning::PlanningContext LocalSimulator::to_planning_context() const {
 }
 
 void LocalSimulator::from_world_tick(const proto::WorldTick& world_tick) {
+  impl_->scene_revision_++;
   // 更新自车状态
   if (world_tick.has_ego()) {
     const auto& ego = world_tick.ego();
@@ -563,6 +676,7 @@ void LocalSimulator::from_world_tick(const proto::WorldTick& world_tick) {
 }
 
 proto::WorldTick LocalSimulator::to_world_tick() const {
+  NAVSIM_TRACE_SCOPE("sim", "LocalSimulator::to_world_tick");
   proto::WorldTick world_tick;
 
   world_tick.set_tick_id(impl_->world_state_.frame_id);
@@ -581,16 +695,15 @@ proto::WorldTick LocalSimulator::to_world_tick() const {
   ego_twist->set_omega(impl_->world_state_.ego_twist.omega);
 
   // 🔍 调试：每秒打印一次自车状态
-  static uint64_t last_ego_log_tick = 0;
-  if (world_tick.tick_id() % 30 == 0 && world_tick.tick_id() != last_ego_log_tick) {
-    std::cout << "[LocalSimulator::to_world_tick] Ego state:" << std::endl;
-    std::cout << "  Pose: (" << impl_->world_state_.ego_pose.x
-              << ", " << impl_->world_state_.ego_pose.y
-              << ", " << impl_->world_state_.ego_pose.yaw << ")" << std::endl;
-    std::cout << "  Twist: vx=" << impl_->world_state_.ego_twist.vx
-              << ", vy=" << impl_->world_state_.ego_twist.vy
-              << ", omega=" << impl_->world_state_.ego_twist.omega << std::endl;
-    last_ego_log_tick = world_tick.tick_id();
+  if (world_tick.tick_id() % 30 == 0 && world_tick.tick_id() != impl_->last_ego_log_tick_) {
+    NAVSIM_LOG(INFO, "LocalSimulator::to_world_tick")
+        << "Ego state: pose=(" << impl_->world_state_.ego_pose.x
+        << ", " << impl_->world_state_.ego_pose.y
+        << ", " << impl_->world_state_.ego_pose.yaw << "), twist=(vx="
+        << impl_->world_state_.ego_twist.vx
+        << ", vy=" << impl_->world_state_.ego_twist.vy
+        << ", omega=" << impl_->world_state_.ego_twist.omega << ")";
+    impl_->last_ego_log_tick_ = world_tick.tick_id();
   }
 
   // 目标
@@ -630,62 +743,25 @@ proto::WorldTick LocalSimulator::to_world_tick() const {
     }
 
     // 🔍 调试日志：确认 to_world_tick() 返回的静态地图数据
-    static uint64_t last_logged_tick = 0;
-    if (world_tick.tick_id() % 30 == 0 && world_tick.tick_id() != last_logged_tick) {
-      std::cout << "[LocalSimulator::to_world_tick] tick_id=" << world_tick.tick_id()
-                << ", map_version=" << impl_->world_state_.map_version
-                << ", circles=" << circle_count
-                << ", polygons=" << polygon_count << std::endl;
-      last_logged_tick = world_tick.tick_id();
+    if (world_tick.tick_id() % 30 == 0 && world_tick.tick_id() != impl_->last_map_log_tick_) {
+      NAVSIM_LOG(INFO, "LocalSimulator::to_world_tick")
+          << "tick_id=" << world_tick.tick_id()
+          << ", map_version=" << impl_->world_state_.map_version
+          << ", circles=" << circle_count
+          << ", polygons=" << polygon_count;
+      impl_->last_map_log_tick_ = world_tick.tick_id();
     }
   } else {
     // 🔍 调试日志：没有静态障碍物
-    static uint64_t last_logged_tick_empty = 0;
-    if (world_tick.tick_id() % 30 == 0 && world_tick.tick_id() != last_logged_tick_empty) {
-      std::cout << "[LocalSimulator::to_world_tick] tick_id=" << world_tick.tick_id()
-                << ", NO STATIC OBSTACLES" << std::endl;
-      last_logged_tick_empty = world_tick.tick_id();
+    if (world_tick.tick_id() % 30 == 0 && world_tick.tick_id() != impl_->last_empty_map_log_tick_) {
+      NAVSIM_LOG(INFO, "LocalSimulator::to_world_tick")
+          << "tick_id=" << world_tick.tick_id() << ", NO STATIC OBSTACLES";
+      impl_->last_empty_map_log_tick_ = world_tick.tick_id();
     }
   }
 
-  // 转换动态障碍物
-  for (const auto& obs : impl_->world_state_.dynamic_obstacles) {
-    auto* dyn_obs = world_tick.add_dynamic_obstacles();
-
-    // 设置ID
-    dyn_obs->set_id(obs.id);
-
-    // 设置位姿
-    auto* pose = dyn_obs->mutable_pose();
-    pose->set_x(obs.pose.x);
-    pose->set_y(obs.pose.y);
-    pose->set_yaw(obs.pose.yaw);
-
-    // 设置速度
-    auto* twist = dyn_obs->mutable_twist();
-    twist->set_vx(obs.twist.vx);
-    twist->set_vy(obs.twist.vy);
-    twist->set_omega(obs.twist.omega);
-
-    // 设置形状 (使用 oneof)
-    auto* shape = dyn_obs->mutable_shape();
-    if (obs.shape == DynamicObstacle::Shape::CIRCLE) {
-      auto* circle = shape->mutable_circle();
-      circle->set_x(0.0);  // 圆心相对于障碍物位姿的偏移
-      circle->set_y(0.0);
-      circle->set_r(obs.radius);
-    } else if (obs.shape == DynamicObstacle::Shape::RECTANGLE) {
-      auto* rect = shape->mutable_rectangle();
-      // 🔧 重要：protobuf 的 w/h 与内部表示的 width/height 映射关系对调
-      // 参考 DynamicObstaclePredictor::predictConstantVelocity() 中的注释
-      rect->set_w(obs.height);  // protobuf.w ← sim.height (车辆长度)
-      rect->set_h(obs.width);   // protobuf.h ← sim.width (车辆宽度)
-      rect->set_yaw(0.0);  // 矩形相对于障碍物位姿的朝向偏移
-    }
-
-    // 设置运动模型
-    dyn_obs->set_model(obs.model);
-  }
+  // 转换动态障碍物（按运动模型分块批量写入）
+  impl_->world_state_.dynamic_obstacles.appendTo(world_tick);
 
   return world_tick;
 }
@@ -693,68 +769,56 @@ proto::WorldTick LocalSimulator::to_world_tick() const {
 // ========== LocalSimulator::Impl 内部方法实现 ==========
 
 void LocalSimulator::Impl::integrate_dynamic_obstacles(double dt) {
-  for (auto& obs : world_state_.dynamic_obstacles) {
-    if (obs.model == "cv") {
-      // 恒速模型
-      obs.pose.x += obs.twist.vx * dt;
-      obs.pose.y += obs.twist.vy * dt;
-      obs.pose.yaw = normalize_angle(obs.pose.yaw + obs.twist.omega * dt);
-    } else if (obs.model == "ca") {
-      // TODO: 恒加速模型
-    }
-    // "custom" 模型由外部控制，不在这里积分
-  }
+  // 按运动模型分块积分（CV / CA / CTRV），"custom" 模型由外部控制
+  world_state_.dynamic_obstacles.integrate(dt);
 }
 
-void LocalSimulator::Impl::integrate_ego_motion(double dt) {
-  // 🚗 自车运动积分：根据当前速度更新位姿
-  // 使用简单的欧拉积分（一阶积分）
+void LocalSimulator::Impl::advance_physics(double frame_dt) {
+  NAVSIM_TRACE_SCOPE("sim", "LocalSimulator::advance_physics");
+  const double h = config_.time_step;
+  accumulated_time_ += frame_dt;
 
-  // 获取当前速度
-  double vx = world_state_.ego_twist.vx;      // 纵向速度 (m/s)
-  double vy = world_state_.ego_twist.vy;      // 横向速度 (m/s)
-  double omega = world_state_.ego_twist.omega; // 角速度 (rad/s)
+  // 容差避免 0.03 / 0.01 之类的浮点除法少算一个子步
+  int substeps = static_cast<int>(std::floor(accumulated_time_ / h + 1e-9));
+  accumulated_time_ = std::max(0.0, accumulated_time_ - substeps * h);
 
-  // 获取当前位姿
-  double x = world_state_.ego_pose.x;
-  double y = world_state_.ego_pose.y;
-  double yaw = world_state_.ego_pose.yaw;
-
-  // 🔍 调试：每秒打印一次积分前的状态
-  static uint64_t last_integrate_log = 0;
-  if (world_state_.frame_id % 30 == 0 && world_state_.frame_id != last_integrate_log) {
-    // std::cout << "[LocalSimulator::integrate_ego_motion] BEFORE integration:" << std::endl;
-    // std::cout << "  dt=" << dt << "s" << std::endl;
-    // std::cout << "  Pose: (" << x << ", " << y << ", " << yaw << ")" << std::endl;
-    // std::cout << "  Twist: vx=" << vx << ", vy=" << vy << ", omega=" << omega << std::endl;
-    last_integrate_log = world_state_.frame_id;
+  const int max_substeps = std::max(1, config_.physics.max_substeps);
+  if (substeps > max_substeps) {
+    if (dropped_substeps_ == 0) {
+      std::cerr << "[LocalSimulator] Physics cannot keep up (" << substeps
+                << " substeps requested, max " << max_substeps
+                << "), dropping excess simulated time" << std::endl;
+    }
+    dropped_substeps_ += substeps - max_substeps;
+    substeps = max_substeps;
   }
 
-  // 积分更新位姿
-  // 方法：在车体坐标系下积分，然后转换到世界坐标系
-  // 车体坐标系：x轴向前，y轴向左
+  // 底盘配置只在加载场景时变化，一帧内的子步共用同一运动学模型
+  const EgoKinematics kinematics = EgoKinematics::fromChassis(world_state_.chassis_config);
 
-  // 世界坐标系下的速度分量
-  double vx_world = vx * std::cos(yaw) - vy * std::sin(yaw);
-  double vy_world = vx * std::sin(yaw) + vy * std::cos(yaw);
+  step_collision_hits_.clear();
+  for (int i = 0; i < substeps; ++i) {
+    integrate_dynamic_obstacles(h);
+    if (!dynamic_collision_dirty_) {
+      collision_world_.updateDynamic(world_state_.dynamic_obstacles);
+    }
 
-  // 更新位置（欧拉积分）
-  world_state_.ego_pose.x = x + vx_world * dt;
-  world_state_.ego_pose.y = y + vy_world * dt;
+    // 控制输入在一帧内保持不变
+    previous_ego_pose_ = world_state_.ego_pose;
+    integrate_ego_motion(h, kinematics);
 
-  // 更新朝向
-  world_state_.ego_pose.yaw = normalize_angle(yaw + omega * dt);
+    // 每个子步都检查碰撞，避免高速时穿透
+    check_and_handle_collisions();
 
-  // 🔍 调试：打印积分后的状态
-  if (world_state_.frame_id % 30 == 0) {
-    // std::cout << "[LocalSimulator::integrate_ego_motion] AFTER integration:" << std::endl;
-    // std::cout << "  Pose: (" << world_state_.ego_pose.x
-    //           << ", " << world_state_.ego_pose.y
-    //           << ", " << world_state_.ego_pose.yaw << ")" << std::endl;
-    // std::cout << "  Delta: dx=" << (world_state_.ego_pose.x - x)
-    //           << ", dy=" << (world_state_.ego_pose.y - y)
-    //           << ", dyaw=" << (world_state_.ego_pose.yaw - yaw) << std::endl;
+    world_state_.timestamp += h;
   }
+  dispatch_collision_callbacks();
+}
+
+void LocalSimulator::Impl::integrate_ego_motion(double dt, const EgoKinematics& kinematics) {
+  // 🚗 自车运动积分：车体系速度 (x轴向前，y轴向左) 在子步内保持不变
+  world_state_.ego_pose = integrateEgoPose(world_state_.ego_pose, world_state_.ego_twist,
+                                           kinematics, integration_method_, dt);
 }
 
 void LocalSimulator::Impl::check_and_handle_collisions() {
@@ -762,46 +826,67 @@ void LocalSimulator::Impl::check_and_handle_collisions() {
     return;
   }
 
-  double ego_radius = get_ego_radius();
-  planning::Point2d ego_center{world_state_.ego_pose.x, world_state_.ego_pose.y};
+  sync_collision_world();
+  collision_hits_.clear();
+  collision_world_.collect(get_ego_footprint(world_state_.ego_pose),
+                           world_state_.dynamic_obstacles, collision_hits_);
 
-  // 检查与动态障碍物的碰撞
-  for (const auto& obs : world_state_.dynamic_obstacles) {
-    if (obs.shape == DynamicObstacle::Shape::CIRCLE) {
-      planning::Point2d obs_center{obs.pose.x, obs.pose.y};
-      if (circle_circle_collision(ego_center, ego_radius, obs_center, obs.radius)) {
-        if (collision_callback_) {
-          collision_callback_(obs.id);
-        }
-      }
+  for (const auto& hit : collision_hits_) {
+    auto same = [&hit](const CollisionWorld::Hit& other) {
+      return other.kind == hit.kind && other.model == hit.model && other.index == hit.index;
+    };
+    if (std::none_of(step_collision_hits_.begin(), step_collision_hits_.end(), same)) {
+      step_collision_hits_.push_back(hit);
     }
   }
 }
 
-bool LocalSimulator::Impl::point_circle_collision(const planning::Point2d& point,
-                                                   const planning::Point2d& center,
-                                                   double radius) const {
-  double dx = point.x - center.x;
-  double dy = point.y - center.y;
-  double dist_sq = dx * dx + dy * dy;
-  return dist_sq <= radius * radius;
+void LocalSimulator::Impl::dispatch_collision_callbacks() {
+  if (!collision_callback_) {
+    return;
+  }
+
+  const auto& obstacles = world_state_.dynamic_obstacles;
+  for (const auto& hit : step_collision_hits_) {
+    if (hit.kind == CollisionWorld::Hit::Kind::STATIC) {
+      collision_callback_("static_" + std::to_string(hit.index));
+    } else {
+      collision_callback_(obstacles.ids().name(obstacles.block(hit.model).id[hit.index]));
+    }
+  }
 }
 
-bool LocalSimulator::Impl::circle_circle_collision(const planning::Point2d& center1, double radius1,
-                                                    const planning::Point2d& center2, double radius2) const {
-  double dx = center1.x - center2.x;
-  double dy = center1.y - center2.y;
-  double dist_sq = dx * dx + dy * dy;
-  double radius_sum = radius1 + radius2;
-  return dist_sq <= radius_sum * radius_sum;
+void LocalSimulator::Impl::sync_collision_world() {
+  if (static_collision_dirty_) {
+    collision_world_.buildStatic(world_state_.static_obstacles);
+    static_collision_dirty_ = false;
+  }
+  if (dynamic_collision_dirty_) {
+    collision_world_.rebuildDynamic(world_state_.dynamic_obstacles);
+    dynamic_collision_dirty_ = false;
+  }
 }
 
-double LocalSimulator::Impl::get_ego_radius() const {
-  // 简化为圆形，半径取车体对角线的一半
-  const auto& geometry = world_state_.chassis_config.geometry();
-  double length = geometry.body_length();
-  double width = geometry.body_width();
-  return std::sqrt(length * length + width * width) / 2.0;
+OrientedBox LocalSimulator::Impl::get_ego_footprint(const planning::Pose2d& pose) const {
+  const auto& chassis = world_state_.chassis_config;
+  const auto& geometry = chassis.geometry();
+
+  double x_front = chassis.wheelbase() + geometry.front_overhang();
+  double x_rear = -geometry.rear_overhang();
+  if (x_front - x_rear <= 1e-6) {
+    x_front = 0.5 * geometry.body_length();
+    x_rear = -0.5 * geometry.body_length();
+  }
+
+  // 车身中心相对位姿原点沿朝向的偏移
+  const double offset = 0.5 * (x_front + x_rear);
+  OrientedBox box;
+  box.cx = pose.x + offset * std::cos(pose.yaw);
+  box.cy = pose.y + offset * std::sin(pose.yaw);
+  box.yaw = pose.yaw;
+  box.half_length = 0.5 * (x_front - x_rear);
+  box.half_width = 0.5 * geometry.body_width();
+  return box;
 }
 
 double LocalSimulator::Impl::normalize_angle(double angle) const {
@@ -810,9 +895,10 @@ double LocalSimulator::Impl::normalize_angle(double angle) const {
   return angle;
 }
 
-std::vector<DynamicObstacle> LocalSimulator::Impl::convert_dynamic_obstacles(
+DynamicObstacleStore LocalSimulator::Impl::convert_dynamic_obstacles(
     const std::vector<planning::DynamicObstacle>& obstacles) const {
-  std::vector<DynamicObstacle> result;
+  DynamicObstacleStore result;
+  result.reserve(obstacles.size());
 
   for (const auto& obs : obstacles) {
     DynamicObstacle dyn_obs;
@@ -832,9 +918,9 @@ std::vector<DynamicObstacle> LocalSimulator::Impl::convert_dynamic_obstacles(
       dyn_obs.height = obs.length;  // 注意：DynamicObstacle 使用 height 表示长度
     }
 
-    dyn_obs.model = "cv";  // 恒速模型
+    dyn_obs.model = MotionModel::CV;  // 恒速模型
 
-    result.push_back(dyn_obs);
+    result.add(dyn_obs);
   }
 
   return result;
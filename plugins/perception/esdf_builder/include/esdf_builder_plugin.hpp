@@ -91,6 +91,7 @@ private:
   std::vector<uint8_t> occupancy_grid_;  // 临时占据栅格 (0=自由, 100=占据)
   int grid_width_ = 0;                   // 栅格宽度 (cells)
   int grid_height_ = 0;                  // 栅格高度 (cells)
+  int frame_count_ = 0;                  // 已处理帧数（用于周期性日志）
 
   // ========== 辅助函数 ==========
 
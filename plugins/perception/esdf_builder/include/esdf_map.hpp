@@ -177,6 +177,10 @@ private:
   // ========== 内部数据 ==========
   std::vector<uint8_t> gridmap_;           // 占据栅格地图
   std::vector<double> distance_buffer_all_; // 距离场缓冲区
+  std::vector<double> scan_buffer_;         // computeESDF 中间结果（跨帧复用）
+  std::vector<double> negative_buffer_;     // 负距离场（跨帧复用）
+  std::vector<int> envelope_v_;             // fillESDF 下包络抛物线顶点
+  std::vector<double> envelope_z_;          // fillESDF 下包络分界点
   Eigen::Vector2d origin_;                 // 地图原点（世界坐标）
   double max_distance_ = 5.0;              // 最大距离（米）
 
@@ -1,5 +1,6 @@
 #include "esdf_builder_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
+#include "core/trace.hpp"
 #include <iostream>
 #include <chrono>
 
@@ -82,32 +83,32 @@ bool ESDFBuilderPlugin::process(const plugin::PerceptionInput& input, planning::
   origin.y = input.ego.pose.y - map_height_ / 2.0;
 
   // 1. 构建占据栅格
-  auto grid_start = std::chrono::high_resolution_clock::now();
+  trace::TraceScope grid_trace("perception", "EsdfBuilder::buildOccupancyGrid");
   buildOccupancyGrid(input, origin);
-  auto grid_end = std::chrono::high_resolution_clock::now();
-  double grid_time_ms = std::chrono::duration<double, std::milli>(grid_end - grid_start).count();
+  grid_trace.end();
 
   // 2. 更新 ESDFMap
   Eigen::Vector2d origin_eigen(origin.x, origin.y);
-  auto build_start = std::chrono::high_resolution_clock::now();
+  trace::TraceScope build_trace("perception", "EsdfBuilder::buildFromOccupancyGrid");
   esdf_map_->buildFromOccupancyGrid(occupancy_grid_, origin_eigen);
-  auto build_end = std::chrono::high_resolution_clock::now();
-  double build_time_ms = std::chrono::duration<double, std::milli>(build_end - build_start).count();
+  build_trace.end();
 
   // 3. 计算 ESDF
-  auto esdf_start = std::chrono::high_resolution_clock::now();
+  trace::TraceScope esdf_trace("perception", "EsdfBuilder::computeESDF");
   esdf_map_->computeESDF();
-  auto esdf_end = std::chrono::high_resolution_clock::now();
-  double esdf_time_ms = std::chrono::duration<double, std::milli>(esdf_end - esdf_start).count();
+  esdf_trace.end();
 
-  // 4. 创建 NavSim 格式的 ESDF 地图（用于规划器和可视化）
-  auto esdf_map_navsim = std::make_unique<planning::ESDFMap>();
+  trace::TraceScope copy_trace("perception", "EsdfBuilder::export");
+
+  // 4. 导出 NavSim 格式的 ESDF 地图（用于规划器和可视化）
+  //    复用上下文中上一帧的地图对象，每个栅格都会被覆写
+  planning::ESDFMap* esdf_map_navsim = &context.acquireESDFMap();
   esdf_map_navsim->config.origin = origin;
   esdf_map_navsim->config.resolution = resolution_;
   esdf_map_navsim->config.width = grid_width_;
   esdf_map_navsim->config.height = grid_height_;
   esdf_map_navsim->config.max_distance = max_distance_;
-  esdf_map_navsim->data.resize(grid_width_ * grid_height_, max_distance_);
+  esdf_map_navsim->data.resize(grid_width_ * grid_height_);
 
   // 复制距离场数据（保留原始值，包括负值）
   // ⚠️ 重要：planning::ESDFMap 应该保留负值（障碍物内部）
@@ -142,14 +143,10 @@ bool ESDFBuilderPlugin::process(const plugin::PerceptionInput& input, planning::
     max_dist = std::max(max_dist, abs_dist);
   }
 
-  // 每 60 帧打印一次 ESDF 统计信息和计时
-  static int esdf_frame_count = 0;
-  if (++esdf_frame_count % 60 == 0) {
-    // std::cout << "[ESDFBuilder] ⏱️  Timing breakdown:" << std::endl;
-    // std::cout << "  - Build occupancy grid: " << grid_time_ms << " ms" << std::endl;
-    // std::cout << "  - Build ESDF map: " << build_time_ms << " ms" << std::endl;
-    // std::cout << "  - Compute ESDF: " << esdf_time_ms << " ms" << std::endl;
-    // std::cout << "  - Total: " << (grid_time_ms + build_time_ms + esdf_time_ms) << " ms" << std::endl;
+  copy_trace.end();
+
+  // 每 60 帧打印一次 ESDF 统计信息（分阶段耗时见 trace）
+  if (++frame_count_ % 60 == 0) {
     // std::cout << "[ESDFBuilder] ESDF stats:\n"
     //           << "  Occupied cells: " << occupied_count << "\n"
     //           << "  Distance < 0.5m:  " << count_0_05 << " cells\n"
@@ -161,18 +158,16 @@ bool ESDFBuilderPlugin::process(const plugin::PerceptionInput& input, planning::
     //           << "  Max distance:     " << max_dist << "m" << std::endl;
   }
 
-  // 5. 存储到规划上下文
-  context.esdf_map = std::move(esdf_map_navsim);
-
-  // 6. 同时将 perception::ESDFMap 存储到 custom_data 中供 JPS 等规划器使用
-  context.setCustomData<navsim::perception::ESDFMap>("perception_esdf_map", esdf_map_);
+  // 5. 同时将 perception::ESDFMap 存储到 custom_data 中供 JPS 等规划器使用
+  //    键名超出短字符串优化长度，缓存为静态对象以免每帧构造临时字符串
+  static const std::string kESDFMapKey = "perception_esdf_map";
+  context.setCustomData<navsim::perception::ESDFMap>(kESDFMapKey, esdf_map_);
 
   auto end_time = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
 
   // 每 60 帧打印一次统计信息
-  static int frame_count = 0;
-  if (++frame_count % 60 == 0) {
+  if (frame_count_ % 60 == 0) {
     std::cout << "[ESDFBuilder] Processing time: " << duration.count() / 1000.0 << " ms" << std::endl;
   }
 
@@ -64,9 +64,16 @@ void ESDFMap::computeESDF() {
   // ⚠️ 此实现参考 sdf_map.cpp 中的 SDFmap::updateESDF2d()
   // 但简化为全局更新（不使用局部更新）
 
-  std::vector<double> tmp_buffer1(GLXY_SIZE_, 0.0);
-  std::vector<double> distance_buffer_pos(GLXY_SIZE_, 0.0);
-  std::vector<double> distance_buffer_neg(GLXY_SIZE_, 0.0);
+  // 中间缓冲区作为成员跨帧复用，每个元素都会被 fillESDF 覆写，无需清零；
+  // 正距离场直接写入 distance_buffer_all_
+  std::vector<double>& tmp_buffer1 = scan_buffer_;
+  std::vector<double>& distance_buffer_pos = distance_buffer_all_;
+  std::vector<double>& distance_buffer_neg = negative_buffer_;
+  tmp_buffer1.resize(GLXY_SIZE_);
+  distance_buffer_pos.resize(GLXY_SIZE_);
+  distance_buffer_neg.resize(GLXY_SIZE_);
+  envelope_v_.resize(std::max(GLX_SIZE_, GLY_SIZE_));
+  envelope_z_.resize(std::max(GLX_SIZE_, GLY_SIZE_) + 1);
 
   // ========== 计算正距离场（自由空间到障碍物的距离） ==========
 
@@ -131,8 +138,6 @@ void ESDFMap::computeESDF() {
   for (int x = 0; x < GLX_SIZE_; x++) {
     for (int y = 0; y < GLY_SIZE_; y++) {
       int idx = x * GLY_SIZE_ + y;
-      distance_buffer_all_[idx] = distance_buffer_pos[idx];
-
       if (distance_buffer_neg[idx] > 0.0) {
         distance_buffer_all_[idx] += (-distance_buffer_neg[idx] + grid_interval_);
       }
@@ -146,10 +151,10 @@ void ESDFMap::fillESDF(F_get_val f_get_val, F_set_val f_set_val, int start, int
   // 参考：Distance Transforms of Sampled Functions (Felzenszwalb & Huttenlocher, 2012)
   //
   // ⚠️ 此实现必须与 sdf_map.cpp 中的 SDFmap::fillESDF() 完全一致
-  // 唯一的改动：使用 std::vector 代替 VLA（可变长度数组）
-
-  std::vector<int> v(dim_size);
-  std::vector<double> z(dim_size + 1);
+  // 唯一的改动：VLA（可变长度数组）改为 computeESDF 中预分配的成员缓冲区
+  (void)dim_size;
+  std::vector<int>& v = envelope_v_;
+  std::vector<double>& z = envelope_z_;
 
   int k = start;
   v[start] = start;
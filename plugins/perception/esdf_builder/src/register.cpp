@@ -2,6 +2,7 @@
 #include "esdf_builder_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
 #include <iostream>
+#include <mutex>
 
 namespace navsim {
 namespace plugins {
@@ -9,17 +10,16 @@ namespace perception {
 
 // 插件自注册函数
 void registerEsdfBuilderPlugin() {
-  static bool registered = false;
-  if (!registered) {
+  static std::once_flag registered;
+  std::call_once(registered, []() {
     std::cout << "[DEBUG] Registering EsdfBuilder plugin..." << std::endl;
     plugin::PerceptionPluginRegistry::getInstance().registerPlugin(
         "EsdfBuilder",
         []() -> std::unique_ptr<plugin::PerceptionPluginInterface> {
           return std::make_unique<ESDFBuilderPlugin>();
         });
-    registered = true;
     std::cout << "[DEBUG] EsdfBuilder plugin registered successfully" << std::endl;
-  }
+  });
 }
 
 } // namespace perception
@@ -180,6 +180,9 @@ private:
     double average_time_ms = 0.0;
   };
   Statistics stats_;
+
+  // 膨胀用的双缓冲（与栅格数据交换，跨帧复用）
+  std::vector<uint8_t> inflate_buffer_;
 };
 
 } // namespace perception
@@ -1,5 +1,6 @@
 #include "grid_map_builder_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
+#include "core/trace.hpp"
 #include <cmath>
 #include <chrono>
 #include <iostream>
@@ -74,32 +75,34 @@ bool GridMapBuilderPlugin::process(const plugin::PerceptionInput& input,
                                    planning::PlanningContext& context) {
   auto start_time = std::chrono::steady_clock::now();
   
-  // 创建栅格地图
-  auto grid = std::make_unique<planning::OccupancyGrid>();
-  
+  // 复用上下文中上一帧的栅格地图（每帧复用上下文时不再重新分配）
+  auto& grid = context.acquireOccupancyGrid();
+
   // 配置地图参数
-  grid->config.resolution = config_.resolution;
-  grid->config.width = static_cast<int>(config_.map_width / config_.resolution);
-  grid->config.height = static_cast<int>(config_.map_height / config_.resolution);
+  grid.config.resolution = config_.resolution;
+  grid.config.width = static_cast<int>(config_.map_width / config_.resolution);
+  grid.config.height = static_cast<int>(config_.map_height / config_.resolution);
   
   // 以自车为中心的地图
-  grid->config.origin.x = input.ego.pose.x - config_.map_width / 2.0;
-  grid->config.origin.y = input.ego.pose.y - config_.map_height / 2.0;
+  grid.config.origin.x = input.ego.pose.x - config_.map_width / 2.0;
+  grid.config.origin.y = input.ego.pose.y - config_.map_height / 2.0;
   
   // 初始化栅格数据
-  grid->data.resize(grid->config.width * grid->config.height, 0);
+  grid.data.assign(grid.config.width * grid.config.height, 0);
 
   // 添加 BEV 静态障碍物
-  addBEVObstacles(input.bev_obstacles, *grid);
+  trace::TraceScope rasterize_trace("perception", "GridMapBuilder::rasterize");
+  addBEVObstacles(input.bev_obstacles, grid);
 
   // 🔧 添加动态障碍物
-  addDynamicObstacles(input.dynamic_obstacles, *grid);
+  addDynamicObstacles(input.dynamic_obstacles, grid);
+  rasterize_trace.end();
 
   // 膨胀处理
-  inflateObstacles(*grid);
-  
-  // 保存到上下文
-  context.occupancy_grid = std::move(grid);
+  {
+    NAVSIM_TRACE_SCOPE("perception", "GridMapBuilder::inflate");
+    inflateObstacles(grid);
+  }
   
   // 更新统计信息
   auto end_time = std::chrono::steady_clock::now();
@@ -374,7 +377,8 @@ void GridMapBuilderPlugin::inflateObstacles(planning::OccupancyGrid& grid) {
   if (config_.inflation_radius <= 0.0) return;
   
   int inflation_cells = static_cast<int>(std::ceil(config_.inflation_radius / grid.config.resolution));
-  std::vector<uint8_t> inflated_data = grid.data;
+  std::vector<uint8_t>& inflated_data = inflate_buffer_;
+  inflated_data.assign(grid.data.begin(), grid.data.end());
   
   for (int y = 0; y < grid.config.height; ++y) {
     for (int x = 0; x < grid.config.width; ++x) {
@@ -398,7 +402,7 @@ void GridMapBuilderPlugin::inflateObstacles(planning::OccupancyGrid& grid) {
     }
   }
   
-  grid.data = std::move(inflated_data);
+  grid.data.swap(inflated_data);
 }
 
 bool GridMapBuilderPlugin::worldToGrid(double world_x, double world_y,
@@ -1,6 +1,7 @@
 #include "grid_map_builder_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
 #include <iostream>
+#include <mutex>
 
 namespace navsim {
 namespace plugins {
@@ -8,17 +9,16 @@ namespace perception {
 
 // 插件自注册函数
 void registerGridMapBuilderPlugin() {
-  static bool registered = false;
-  if (!registered) {
+  static std::once_flag registered;
+  std::call_once(registered, []() {
     std::cout << "[DEBUG] Registering GridMapBuilder plugin..." << std::endl;
     plugin::PerceptionPluginRegistry::getInstance().registerPlugin(
         "GridMapBuilder",
         []() -> std::shared_ptr<plugin::PerceptionPluginInterface> {
           return std::make_shared<GridMapBuilderPlugin>();
         });
-    registered = true;
     std::cout << "[DEBUG] GridMapBuilder plugin registered successfully" << std::endl;
-  }
+  });
 }
 
 } // namespace perception
@@ -1,23 +1,23 @@
 #include "astar_planner_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
 #include <memory>
+#include <mutex>
 
 namespace astar_planner {
 namespace adapter {
 
 // 插件自注册函数
 void registerAstarPlannerPlugin() {
-  static bool registered = false;
-  if (!registered) {
+  static std::once_flag registered;
+  std::call_once(registered, []() {
     std::cout << "[DEBUG] Registering AstarPlanner plugin..." << std::endl;
     navsim::plugin::PlannerPluginRegistry::getInstance().registerPlugin(
         "AstarPlanner",
         []() -> std::shared_ptr<navsim::plugin::PlannerPluginInterface> {
           return std::make_shared<AstarPlannerPlugin>();
         });
-    registered = true;
     std::cout << "[DEBUG] AstarPlanner plugin registered successfully" << std::endl;
-  }
+  });
 }
 
 } // namespace adapter
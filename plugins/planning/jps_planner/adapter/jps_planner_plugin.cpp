@@ -4,6 +4,8 @@
  */
 
 #include "jps_planner_plugin.hpp"
+#include "core/trace.hpp"
+#include "core/log.hpp"
 #include <iostream>
 #include <fstream>
 #include <iomanip>
@@ -233,10 +235,12 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
 
   // Call JPS planner
   auto jps_start = std::chrono::steady_clock::now();
+  navsim::trace::TraceScope search_trace("planning", "JpsPlanner::search");
   bool success = jps_planner_->plan(start, goal);
+  search_trace.end();
   auto jps_end = std::chrono::steady_clock::now();
   double jps_time_ms = std::chrono::duration<double, std::milli>(jps_end - jps_start).count();
-  std::cout << "[JPSPlannerPlugin] ⏱️  JPS path search took " << jps_time_ms << " ms" << std::endl;
+  NAVSIM_LOG(DEBUG, "JPSPlannerPlugin") << "JPS path search took " << jps_time_ms << " ms";
 
   if(!success) {
     std::cerr << "[JPSPlannerPlugin] JPS planning failed!" << std::endl;
@@ -246,16 +250,26 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
     return false;
   }
 
+  // 竞速模式下若已被取消，跳过耗时的轨迹优化
+  if (isCancelled()) {
+    result.success = false;
+    result.failure_reason = "Cancelled";
+    failed_plans_++;
+    return false;
+  }
+
   // Trajectory optimization
   // if (verbose_) {
   //   std::cout << "[JPSPlannerPlugin] Running trajectory optimization..." << std::endl;
   // }
 
   auto opt_start = std::chrono::steady_clock::now();
+  navsim::trace::TraceScope optimize_trace("planning", "JpsPlanner::minco_plan");
   bool optimize_result = msplanner_->minco_plan(jps_planner_->flat_traj_);
+  optimize_trace.end();
   auto opt_end = std::chrono::steady_clock::now();
   double opt_time_ms = std::chrono::duration<double, std::milli>(opt_end - opt_start).count();
-  std::cout << "[JPSPlannerPlugin] ⏱️  Trajectory optimization took " << opt_time_ms << " ms" << std::endl;
+  NAVSIM_LOG(DEBUG, "JPSPlannerPlugin") << "Trajectory optimization took " << opt_time_ms << " ms";
 
   std::string optimization_status;
   if(!optimize_result) {
@@ -382,10 +396,10 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
   result.metadata["has_debug_paths"] = 1.0;
   result.metadata["optimization_success"] = optimize_result ? 1.0 : 0.0;
 
-  // Store debug paths using a global variable (temporary solution)
+  // Store debug paths in a member buffer; the result only carries its address,
+  // which stays valid until this instance plans again
   // TODO: Improve this by using proper data structure in PlanningResult
-  static std::vector<std::vector<navsim::planning::Pose2d>> global_debug_paths;
-  global_debug_paths.clear();
+  debug_paths_.clear();
 
   if (verbose_) {
     std::cout << "[JPSPlannerPlugin] Preparing debug paths for visualization..." << std::endl;
@@ -402,7 +416,7 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
     pose.yaw = 0.0;
     raw_poses.push_back(pose);
   }
-  global_debug_paths.push_back(raw_poses);
+  debug_paths_.push_back(raw_poses);
 
   // Collect Optimized path
   const auto& opt_path = jps_planner_->getOptimizedPath();
@@ -414,7 +428,7 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
     pose.yaw = 0.0;
     opt_poses.push_back(pose);
   }
-  global_debug_paths.push_back(opt_poses);
+  debug_paths_.push_back(opt_poses);
 
   // Collect Sample trajectory
   const auto& sample_trajs = jps_planner_->getSampleTrajs();
@@ -428,7 +442,7 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
       sample_poses.push_back(pose);
     }
   }
-  global_debug_paths.push_back(sample_poses);
+  debug_paths_.push_back(sample_poses);
 
   // Collect MINCO optimized trajectory (even if optimization failed, we can still visualize the attempt)
   if (msplanner_) {
@@ -440,7 +454,7 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
       for (const auto& traj_pt : minco_trajectory) {
         minco_poses.push_back(traj_pt.pose);
       }
-      global_debug_paths.push_back(minco_poses);
+      debug_paths_.push_back(minco_poses);
       if (verbose_) {
         std::cout << "[JPSPlannerPlugin] === PATH 5: MINCO final trajectory size: " << minco_poses.size() << std::endl;
         // if (!minco_poses.empty()) {
@@ -461,7 +475,7 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
 
     std::vector<navsim::planning::Pose2d> preprocessing_poses = extractPreprocessingTrajectory();
     if (!preprocessing_poses.empty()) {
-      global_debug_paths.push_back(preprocessing_poses);
+      debug_paths_.push_back(preprocessing_poses);
       if (verbose_) {
         std::cout << "[JPSPlannerPlugin] === PATH 6: MINCO preprocessing trajectory (Stage 1) size: "
                   << preprocessing_poses.size() << std::endl;
@@ -475,7 +489,7 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
     // Collect main optimization trajectory (Stage 2)
     std::vector<navsim::planning::Pose2d> optimization_poses = extractMainOptimizationTrajectory();
     if (!optimization_poses.empty()) {
-      global_debug_paths.push_back(optimization_poses);
+      debug_paths_.push_back(optimization_poses);
       if (verbose_) {
         std::cout << "[JPSPlannerPlugin] === PATH 7: MINCO main optimization trajectory (Stage 2) size: "
                   << optimization_poses.size() << std::endl;
@@ -488,7 +502,7 @@ bool JpsPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
   }
 
   // Store a way for the main app to access this data
-  result.metadata["debug_paths_ptr"] = static_cast<double>(reinterpret_cast<uintptr_t>(&global_debug_paths));
+  result.metadata["debug_paths_ptr"] = static_cast<double>(reinterpret_cast<uintptr_t>(&debug_paths_));
 
   return true;
 }
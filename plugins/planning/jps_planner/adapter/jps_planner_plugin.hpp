@@ -70,6 +70,19 @@ public:
    */
   nlohmann::json getStatistics() const override;
 
+  /**
+   * @brief Get the loaded JPS / optimizer configuration
+   */
+  const JPS::JPSConfig& getConfig() const { return jps_config_; }
+
+  /**
+   * @brief Update optimizer config from ego vehicle chassis configuration
+   * @param ego Ego vehicle from planning context
+   * @param config Optimizer config to update (output)
+   */
+  void updateOptimizerConfigFromChassis(const navsim::planning::EgoVehicle& ego,
+                                         JPS::OptimizerConfig& config) const;
+
 private:
   // ========== Configuration ==========
 
@@ -135,14 +148,6 @@ private:
   bool convertMincoOutputToResult(const navsim::planning::PlanningContext& context,
                                    navsim::plugin::PlanningResult& result) const;
 
-  /**
-   * @brief Update optimizer config from ego vehicle chassis configuration
-   * @param ego Ego vehicle from planning context
-   * @param config Optimizer config to update (output)
-   */
-  void updateOptimizerConfigFromChassis(const navsim::planning::EgoVehicle& ego,
-                                         JPS::OptimizerConfig& config) const;
-
   /**
    * @brief Save trajectory to log file with metadata
    * @param context Planning context (for start/goal states and vehicle params)
@@ -173,6 +178,9 @@ private:
   // Trajectory total time (from optimizer)
   double Traj_total_time_ = 0.0;
 
+  // Debug paths of the last plan (exposed through result.metadata["debug_paths_ptr"])
+  std::vector<std::vector<navsim::planning::Pose2d>> debug_paths_;
+
   // Statistics
   mutable int total_plans_ = 0;
   mutable int successful_plans_ = 0;
@@ -1,23 +1,23 @@
 #include "jps_planner_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
 #include <memory>
+#include <mutex>
 
 namespace jps_planner {
 namespace adapter {
 
 // 插件自注册函数
 void registerJpsPlannerPlugin() {
-  static bool registered = false;
-  if (!registered) {
+  static std::once_flag registered;
+  std::call_once(registered, []() {
     std::cout << "[DEBUG] Registering JpsPlanner plugin..." << std::endl;
     navsim::plugin::PlannerPluginRegistry::getInstance().registerPlugin(
         "JpsPlanner",
         []() -> std::shared_ptr<navsim::plugin::PlannerPluginInterface> {
           return std::make_shared<JpsPlannerPlugin>();
         });
-    registered = true;
     std::cout << "[DEBUG] JpsPlanner plugin registered successfully" << std::endl;
-  }
+  });
 }
 
 } // namespace adapter
@@ -688,8 +688,8 @@ namespace sdlp
     {
         typedef std::uniform_int_distribution<int> rand_int;
         typedef rand_int::param_type rand_range;
-        static std::mt19937_64 gen;
-        static rand_int rdi(0, 1);
+        static thread_local std::mt19937_64 gen;
+        static thread_local rand_int rdi(0, 1);
         int j, k;
         for (int i = 0; i < n; i++)
         {
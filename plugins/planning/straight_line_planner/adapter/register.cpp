@@ -1,23 +1,23 @@
 #include "straight_line_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
 #include <memory>
+#include <mutex>
 
 namespace straight_line {
 namespace adapter {
 
 // 插件自注册函数
 void registerStraightLinePlugin() {
-  static bool registered = false;
-  if (!registered) {
+  static std::once_flag registered;
+  std::call_once(registered, []() {
     std::cout << "[DEBUG] Registering StraightLine plugin..." << std::endl;
     navsim::plugin::PlannerPluginRegistry::getInstance().registerPlugin(
         "StraightLine",
         []() -> std::shared_ptr<navsim::plugin::PlannerPluginInterface> {
           return std::make_shared<StraightLinePlugin>();
         });
-    registered = true;
     std::cout << "[DEBUG] StraightLine plugin registered successfully" << std::endl;
-  }
+  });
 }
 
 } // namespace adapter
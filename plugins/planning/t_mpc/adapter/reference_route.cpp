@@ -0,0 +1,430 @@
+/**
+ * @file reference_route.cpp
+ * @brief Implementation of ReferenceRoute
+ */
+
+#include "reference_route.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace tmpc_planner {
+namespace adapter {
+
+using navsim::planning::ESDFMap;
+using navsim::planning::OccupancyGrid;
+using navsim::planning::Point2d;
+using navsim::planning::Pose2d;
+
+namespace {
+
+constexpr uint8_t kOccupiedThreshold = 50;
+constexpr int kSmoothingIterations = 3;
+constexpr size_t kBacktrackPoints = 2;  // Route points behind the last progress that are still searched
+
+}  // namespace
+
+// ============================================================================
+// Map View
+// ============================================================================
+
+ReferenceRoute::MapView::MapView(const ESDFMap* esdf_map, const OccupancyGrid* occupancy_grid) {
+  auto usable = [](const auto& config, size_t size) {
+    return config.width > 0 && config.height > 0 && config.resolution > 0.0 &&
+           size == static_cast<size_t>(config.width) * config.height;
+  };
+
+  if (esdf_map && usable(esdf_map->config, esdf_map->data.size())) {
+    esdf = esdf_map;
+    origin = Eigen::Vector2d(esdf_map->config.origin.x, esdf_map->config.origin.y);
+    resolution = esdf_map->config.resolution;
+    width = esdf_map->config.width;
+    height = esdf_map->config.height;
+  } else if (occupancy_grid && usable(occupancy_grid->config, occupancy_grid->data.size())) {
+    grid = occupancy_grid;
+    origin = Eigen::Vector2d(occupancy_grid->config.origin.x, occupancy_grid->config.origin.y);
+    resolution = occupancy_grid->config.resolution;
+    width = occupancy_grid->config.width;
+    height = occupancy_grid->config.height;
+  }
+}
+
+bool ReferenceRoute::MapView::toCell(const Eigen::Vector2d& point, int& x, int& y) const {
+  x = static_cast<int>(std::floor((point.x() - origin.x()) / resolution));
+  y = static_cast<int>(std::floor((point.y() - origin.y()) / resolution));
+  return contains(x, y);
+}
+
+Eigen::Vector2d ReferenceRoute::MapView::cellCenter(int x, int y) const {
+  return origin + Eigen::Vector2d((x + 0.5) * resolution, (y + 0.5) * resolution);
+}
+
+double ReferenceRoute::MapView::clearance(const Eigen::Vector2d& point, double max_range) const {
+  int cx, cy;
+  if (!toCell(point, cx, cy)) {
+    return max_range;
+  }
+
+  if (esdf) {
+    return std::min(max_range, esdf->getDistanceInterpolated(Point2d(point.x(), point.y())));
+  }
+
+  // Occupancy grid: nearest occupied cell within max_range
+  int range = static_cast<int>(std::ceil(max_range / resolution));
+  double nearest = max_range;
+  for (int y = std::max(0, cy - range); y <= std::min(height - 1, cy + range); ++y) {
+    for (int x = std::max(0, cx - range); x <= std::min(width - 1, cx + range); ++x) {
+      if (grid->data[y * width + x] >= kOccupiedThreshold) {
+        nearest = std::min(nearest, (cellCenter(x, y) - point).norm());
+      }
+    }
+  }
+  return nearest;
+}
+
+void ReferenceRoute::MapView::clearanceGrid(std::vector<float>& clearance) const {
+  size_t cells = static_cast<size_t>(width) * height;
+  clearance.resize(cells);
+
+  if (esdf) {
+    for (size_t i = 0; i < cells; ++i) {
+      clearance[i] = static_cast<float>(esdf->data[i]);
+    }
+    return;
+  }
+
+  // Two-pass chamfer distance transform of the occupied cells
+  const float straight = static_cast<float>(resolution);
+  const float diagonal = static_cast<float>(resolution * std::sqrt(2.0));
+  for (size_t i = 0; i < cells; ++i) {
+    clearance[i] = grid->data[i] >= kOccupiedThreshold ? 0.0f : std::numeric_limits<float>::max();
+  }
+
+  auto relax = [&](int x, int y, int nx, int ny, float step) {
+    if (!contains(nx, ny)) {
+      return;
+    }
+    float& value = clearance[y * width + x];
+    float neighbour = clearance[ny * width + nx];
+    if (neighbour + step < value) {
+      value = neighbour + step;
+    }
+  };
+
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      relax(x, y, x - 1, y, straight);
+      relax(x, y, x - 1, y - 1, diagonal);
+      relax(x, y, x, y - 1, straight);
+      relax(x, y, x + 1, y - 1, diagonal);
+    }
+  }
+  for (int y = height - 1; y >= 0; --y) {
+    for (int x = width - 1; x >= 0; --x) {
+      relax(x, y, x + 1, y, straight);
+      relax(x, y, x + 1, y + 1, diagonal);
+      relax(x, y, x, y + 1, straight);
+      relax(x, y, x - 1, y + 1, diagonal);
+    }
+  }
+}
+
+// ============================================================================
+// Route Update
+// ============================================================================
+
+bool ReferenceRoute::update(const Pose2d& ego, const Pose2d& goal, const ESDFMap* esdf, const OccupancyGrid* grid) {
+  MapView map(esdf, grid);
+  Eigen::Vector2d ego_position(ego.x, ego.y);
+  Eigen::Vector2d goal_position(goal.x, goal.y);
+
+  if (!needsReplan(ego_position, goal_position, map)) {
+    return false;
+  }
+
+  plan(ego_position, goal_position, map);
+  replans_++;
+  return true;
+}
+
+void ReferenceRoute::reset() {
+  source_ = Source::NONE;
+  planned_with_map_ = false;
+  goal_ = Eigen::Vector2d::Zero();
+  points_.clear();
+  arc_lengths_.clear();
+  planned_clearance_.clear();
+  spline_.reset();
+  progress_index_ = 0;
+}
+
+bool ReferenceRoute::needsReplan(const Eigen::Vector2d& ego, const Eigen::Vector2d& goal, const MapView& map) {
+  if (!valid() || points_.empty()) {
+    return true;
+  }
+  if ((goal - goal_).norm() > config_.goal_tolerance) {
+    return true;
+  }
+  if (!planned_with_map_ && map.valid()) {
+    return true;
+  }
+
+  // Track the progress in a window around the previous progress
+  size_t first = progress_index_ > kBacktrackPoints ? progress_index_ - kBacktrackPoints : 0;
+  double window = config_.check_distance + config_.max_deviation;
+  size_t closest = progress_index_;
+  double closest_distance = std::numeric_limits<double>::max();
+  for (size_t i = first; i < points_.size(); ++i) {
+    if (arc_lengths_[i] - arc_lengths_[progress_index_] > window) {
+      break;
+    }
+    double distance = (Eigen::Vector2d(points_[i].x, points_[i].y) - ego).norm();
+    if (distance < closest_distance) {
+      closest_distance = distance;
+      closest = i;
+    }
+  }
+  progress_index_ = closest;
+
+  if (closest_distance > config_.max_deviation) {
+    return true;
+  }
+
+  if (!map.valid()) {
+    return false;
+  }
+
+  // Check the route ahead against the map of this tick
+  double tolerance = 0.5 * map.resolution;
+  for (size_t i = progress_index_; i < points_.size(); ++i) {
+    if (arc_lengths_[i] - arc_lengths_[progress_index_] > config_.check_distance) {
+      break;
+    }
+    double required = std::min(config_.clearance, planned_clearance_[i]) - tolerance;
+    if (map.clearance(Eigen::Vector2d(points_[i].x, points_[i].y), config_.clearance) < required) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ReferenceRoute::plan(const Eigen::Vector2d& ego, const Eigen::Vector2d& goal, const MapView& map) {
+  std::vector<Eigen::Vector2d> path;
+  if (map.valid() && search(ego, goal, map, path)) {
+    source_ = map.esdf ? Source::ESDF : Source::OCCUPANCY;
+  } else {
+    path = {ego, goal};
+    source_ = Source::STRAIGHT;
+  }
+
+  planned_with_map_ = map.valid();
+  goal_ = goal;
+  setRoute(path, map);
+}
+
+// ============================================================================
+// A* Search
+// ============================================================================
+
+bool ReferenceRoute::search(const Eigen::Vector2d& start, const Eigen::Vector2d& goal, const MapView& map,
+                            std::vector<Eigen::Vector2d>& path) {
+  int sx, sy, gx, gy;
+  if (!map.toCell(start, sx, sy)) {
+    return false;
+  }
+  bool goal_inside = map.toCell(goal, gx, gy);
+
+  map.clearanceGrid(clearance_);
+  const int width = map.width;
+  const int start_index = sy * width + sx;
+  const int goal_index = goal_inside ? gy * width + gx : -1;
+
+  // Never block the start or the goal cell: the route may begin or end closer to an obstacle than the clearance
+  double threshold = std::min<double>(config_.clearance, clearance_[start_index]);
+  if (goal_inside) {
+    threshold = std::min<double>(threshold, clearance_[goal_index]);
+  }
+
+  size_t cells = clearance_.size();
+  cost_.assign(cells, std::numeric_limits<double>::max());
+  parent_.assign(cells, -1);
+  closed_.assign(cells, 0);
+
+  auto heuristic = [&](int x, int y) { return (map.cellCenter(x, y) - goal).norm(); };
+
+  typedef std::pair<double, int> Entry;  // (cost + heuristic, cell)
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+  cost_[start_index] = 0.0;
+  open.push({heuristic(sx, sy), start_index});
+
+  static const int kNeighbours[8][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+  int reached = -1;
+  int expansions = 0;
+  while (!open.empty()) {
+    int index = open.top().second;
+    open.pop();
+    if (closed_[index]) {
+      continue;
+    }
+    closed_[index] = 1;
+
+    int x = index % width;
+    int y = index / width;
+    bool done = goal_inside ? index == goal_index : (x == 0 || y == 0 || x == width - 1 || y == map.height - 1);
+    if (done) {
+      reached = index;
+      break;
+    }
+    if (++expansions > config_.max_expansions) {
+      break;
+    }
+
+    for (const auto& offset : kNeighbours) {
+      int nx = x + offset[0];
+      int ny = y + offset[1];
+      if (!map.contains(nx, ny)) {
+        continue;
+      }
+      int next = ny * width + nx;
+      double clearance = clearance_[next];
+      if (closed_[next] || clearance < threshold) {
+        continue;
+      }
+
+      double step = (offset[0] != 0 && offset[1] != 0 ? std::sqrt(2.0) : 1.0) * map.resolution;
+      double penalty = 0.0;
+      if (config_.comfort_distance > 0.0 && clearance < config_.comfort_distance) {
+        penalty = config_.obstacle_cost * (config_.comfort_distance - clearance) / config_.comfort_distance;
+      }
+      double cost = cost_[index] + step * (1.0 + penalty);
+      if (cost < cost_[next]) {
+        cost_[next] = cost;
+        parent_[next] = index;
+        open.push({cost + heuristic(nx, ny), next});
+      }
+    }
+  }
+
+  if (reached < 0) {
+    return false;
+  }
+
+  path.clear();
+  for (int index = reached; index >= 0; index = parent_[index]) {
+    path.push_back(map.cellCenter(index % width, index / width));
+  }
+  std::reverse(path.begin(), path.end());
+
+  path.front() = start;
+  if (goal_inside && path.size() > 1) {
+    path.back() = goal;
+  } else {
+    path.push_back(goal);  // Straight tail beyond the map
+  }
+
+  shortcut(map, threshold, path);
+  return true;
+}
+
+void ReferenceRoute::shortcut(const MapView& map, double threshold, std::vector<Eigen::Vector2d>& path) const {
+  if (path.size() < 3) {
+    return;
+  }
+
+  std::vector<Eigen::Vector2d> result = {path.front()};
+  size_t anchor = 0;
+  for (size_t i = 1; i + 1 < path.size(); ++i) {
+    if (!segmentIsFree(path[anchor], path[i + 1], map, threshold)) {
+      result.push_back(path[i]);
+      anchor = i;
+    }
+  }
+  result.push_back(path.back());
+  path = std::move(result);
+}
+
+bool ReferenceRoute::segmentIsFree(const Eigen::Vector2d& a, const Eigen::Vector2d& b, const MapView& map,
+                                   double threshold) const {
+  double length = (b - a).norm();
+  int samples = std::max(1, static_cast<int>(std::ceil(length / (0.5 * map.resolution))));
+  for (int i = 0; i <= samples; ++i) {
+    int x, y;
+    if (map.toCell(a + (b - a) * (static_cast<double>(i) / samples), x, y) &&
+        clearance_[y * map.width + x] < threshold) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ============================================================================
+// Route Points and Spline
+// ============================================================================
+
+void ReferenceRoute::setRoute(const std::vector<Eigen::Vector2d>& polyline, const MapView& map) {
+  std::vector<Eigen::Vector2d> corners = polyline;
+  std::vector<double> corner_s(corners.size(), 0.0);
+  for (size_t i = 1; i < corners.size(); ++i) {
+    corner_s[i] = corner_s[i - 1] + (corners[i] - corners[i - 1]).norm();
+  }
+  if (corner_s.back() < 1e-3) {
+    // Already at the goal: keep a short route so that the spline is well defined
+    corners = {corners.front(), corners.front() + Eigen::Vector2d(config_.point_spacing, 0.0)};
+    corner_s = {0.0, config_.point_spacing};
+  }
+
+  // Resample at (about) point_spacing, at least three points
+  double length = corner_s.back();
+  int segments = std::max(2, static_cast<int>(std::ceil(length / std::max(config_.point_spacing, 1e-3))));
+  std::vector<Eigen::Vector2d> samples;
+  samples.reserve(segments + 1);
+  size_t corner = 0;
+  for (int i = 0; i <= segments; ++i) {
+    double s = length * i / segments;
+    while (corner + 2 < corners.size() && corner_s[corner + 1] < s) {
+      corner++;
+    }
+    double span = corner_s[corner + 1] - corner_s[corner];
+    double ratio = span > 1e-9 ? std::clamp((s - corner_s[corner]) / span, 0.0, 1.0) : 0.0;
+    samples.push_back(corners[corner] + ratio * (corners[corner + 1] - corners[corner]));
+  }
+
+  // Round the grid corners a little, the end points stay in place
+  for (int iteration = 0; iteration < kSmoothingIterations; ++iteration) {
+    std::vector<Eigen::Vector2d> smoothed = samples;
+    for (size_t i = 1; i + 1 < samples.size(); ++i) {
+      smoothed[i] = 0.25 * samples[i - 1] + 0.5 * samples[i] + 0.25 * samples[i + 1];
+    }
+    samples = std::move(smoothed);
+  }
+
+  points_.clear();
+  arc_lengths_.clear();
+  planned_clearance_.clear();
+  std::vector<double> x, y;
+  for (size_t i = 0; i < samples.size(); ++i) {
+    double s = i == 0 ? 0.0 : arc_lengths_.back() + (samples[i] - samples[i - 1]).norm();
+    if (i > 0 && s - arc_lengths_.back() < 1e-6) {
+      continue;  // The spline needs strictly increasing arc lengths
+    }
+    const Eigen::Vector2d& previous = samples[i == 0 ? 0 : i - 1];
+    const Eigen::Vector2d& next = samples[std::min(i + 1, samples.size() - 1)];
+    Eigen::Vector2d tangent = i == 0 ? samples[1] - samples[0] : next - previous;
+
+    points_.emplace_back(samples[i].x(), samples[i].y(), std::atan2(tangent.y(), tangent.x()));
+    arc_lengths_.push_back(s);
+    planned_clearance_.push_back(map.valid() ? map.clearance(samples[i], config_.clearance) : config_.clearance);
+    x.push_back(samples[i].x());
+    y.push_back(samples[i].y());
+  }
+
+  spline_ = std::make_shared<RosTools::Spline2D>(x, y, arc_lengths_);
+  progress_index_ = 0;
+}
+
+} // namespace adapter
+} // namespace tmpc_planner
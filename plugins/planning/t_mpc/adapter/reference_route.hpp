@@ -0,0 +1,134 @@
+#pragma once
+
+#include "core/planning_context.hpp"
+#include "ros_tools/spline.h"
+#include <Eigen/Dense>
+#include <memory>
+#include <vector>
+
+namespace tmpc_planner {
+namespace adapter {
+
+/**
+ * @brief Global reference route of the T-MPC plugin
+ *
+ * The route from the ego position to the goal is planned with A* on the ESDF (or on the occupancy grid if there is no
+ * ESDF) and kept, together with its spline, between ticks. It is only re-planned when the goal moves, when the map
+ * blocks the route ahead, or when the ego vehicle left the route. Without a map, or if the search fails, the route is
+ * a straight line to the goal.
+ */
+class ReferenceRoute {
+public:
+  struct Config {
+    double clearance = 0.4;         // Minimum obstacle distance of the route (m)
+    double comfort_distance = 1.5;  // Obstacles closer than this make the route more expensive (m)
+    double obstacle_cost = 2.0;     // Relative cost of passing an obstacle at zero distance
+    double point_spacing = 0.5;     // Distance between the route points (m)
+    double goal_tolerance = 0.5;    // Goal motion that triggers a new route (m)
+    double max_deviation = 2.0;     // Distance from the route that triggers a new route (m)
+    double check_distance = 15.0;   // Route length ahead of the ego vehicle that is checked against the map (m)
+    int max_expansions = 200000;    // A* expansions before falling back to a straight line
+  };
+
+  enum class Source {
+    NONE,       // No route yet
+    STRAIGHT,   // Straight line (no map or no route found)
+    ESDF,       // A* on the ESDF
+    OCCUPANCY   // A* on the occupancy grid
+  };
+
+  void setConfig(const Config& config) { config_ = config; }
+  const Config& config() const { return config_; }
+
+  /**
+   * @brief Keep the route, or plan a new one
+   * @param ego Ego pose
+   * @param goal Goal pose
+   * @param esdf ESDF of this tick (may be null)
+   * @param grid Occupancy grid of this tick (may be null, only used without ESDF)
+   * @return true if a new route was planned (points and spline changed)
+   */
+  bool update(const navsim::planning::Pose2d& ego,
+              const navsim::planning::Pose2d& goal,
+              const navsim::planning::ESDFMap* esdf,
+              const navsim::planning::OccupancyGrid* grid);
+
+  /** @brief Forget the route */
+  void reset();
+
+  bool valid() const { return spline_ != nullptr; }
+
+  /** @brief Route points (x, y, heading of the route) */
+  const std::vector<navsim::planning::Pose2d>& points() const { return points_; }
+
+  /** @brief Distance along the route of each point (m) */
+  const std::vector<double>& arcLengths() const { return arc_lengths_; }
+
+  /** @brief Spline through the route points, parameterized by arc length */
+  const std::shared_ptr<RosTools::Spline2D>& spline() const { return spline_; }
+
+  /** @brief Route point closest to the ego vehicle at the last update */
+  size_t progressIndex() const { return progress_index_; }
+
+  Source source() const { return source_; }
+  int replans() const { return replans_; }
+
+private:
+  /** @brief Read-only view of the ESDF or occupancy grid of this tick */
+  struct MapView {
+    const navsim::planning::ESDFMap* esdf = nullptr;
+    const navsim::planning::OccupancyGrid* grid = nullptr;
+    Eigen::Vector2d origin = Eigen::Vector2d::Zero();
+    double resolution = 1.0;
+    int width = 0;
+    int height = 0;
+
+    MapView(const navsim::planning::ESDFMap* esdf_map, const navsim::planning::OccupancyGrid* occupancy_grid);
+
+    bool valid() const { return width > 0; }
+    bool contains(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+    bool toCell(const Eigen::Vector2d& point, int& x, int& y) const;
+    Eigen::Vector2d cellCenter(int x, int y) const;
+
+    /** @brief Obstacle distance at the point, at most max_range (max_range outside the map) */
+    double clearance(const Eigen::Vector2d& point, double max_range) const;
+
+    /** @brief Obstacle distance of every cell (ESDF values, or a chamfer distance transform of the occupancy grid) */
+    void clearanceGrid(std::vector<float>& clearance) const;
+  };
+
+  bool needsReplan(const Eigen::Vector2d& ego, const Eigen::Vector2d& goal, const MapView& map);
+  void plan(const Eigen::Vector2d& ego, const Eigen::Vector2d& goal, const MapView& map);
+
+  /** @brief A* over the map cells. Leaves the map towards the goal if the goal is outside of it */
+  bool search(const Eigen::Vector2d& start, const Eigen::Vector2d& goal, const MapView& map,
+              std::vector<Eigen::Vector2d>& path);
+
+  /** @brief Remove grid corners: keep a point only if the previous kept point cannot see the next one */
+  void shortcut(const MapView& map, double threshold, std::vector<Eigen::Vector2d>& path) const;
+  bool segmentIsFree(const Eigen::Vector2d& a, const Eigen::Vector2d& b, const MapView& map, double threshold) const;
+
+  /** @brief Resample the polyline at point_spacing and build the spline */
+  void setRoute(const std::vector<Eigen::Vector2d>& polyline, const MapView& map);
+
+  Config config_;
+
+  Source source_ = Source::NONE;
+  bool planned_with_map_ = false;
+  Eigen::Vector2d goal_ = Eigen::Vector2d::Zero();
+  std::vector<navsim::planning::Pose2d> points_;
+  std::vector<double> arc_lengths_;
+  std::vector<double> planned_clearance_;  // Obstacle distance of each point when it was planned
+  std::shared_ptr<RosTools::Spline2D> spline_;
+  size_t progress_index_ = 0;               // Route point closest to the ego vehicle
+  int replans_ = 0;
+
+  // Search storage, kept between searches
+  std::vector<float> clearance_;
+  std::vector<double> cost_;
+  std::vector<int> parent_;
+  std::vector<uint8_t> closed_;
+};
+
+} // namespace adapter
+} // namespace tmpc_planner
@@ -7,23 +7,23 @@
 #include "plugin/framework/plugin_registry.hpp"
 #include <memory>
 #include <iostream>
+#include <mutex>
 
 namespace tmpc_planner {
 namespace adapter {
 
 // 插件自注册函数
 void registerTMPCPlannerPlugin() {
-  static bool registered = false;
-  if (!registered) {
+  static std::once_flag registered;
+  std::call_once(registered, []() {
     std::cout << "[DEBUG] Registering TMPCPlanner plugin..." << std::endl;
     navsim::plugin::PlannerPluginRegistry::getInstance().registerPlugin(
         "TMPCPlanner",
         []() -> std::shared_ptr<navsim::plugin::PlannerPluginInterface> {
           return std::make_shared<TMPCPlannerPlugin>();
         });
-    registered = true;
     std::cout << "[DEBUG] TMPCPlanner plugin registered successfully" << std::endl;
-  }
+  });
 }
 
 } // namespace adapter
@@ -0,0 +1,353 @@
+/**
+ * @file static_obstacle_selector.cpp
+ * @brief Implementation of StaticObstacleSelector
+ */
+
+#include "static_obstacle_selector.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace tmpc_planner {
+namespace adapter {
+
+using navsim::planning::BEVObstacles;
+
+namespace {
+
+constexpr int kMaxCells = 256;  // Per axis
+
+/**
+ * @brief FNV-1a over the values of the obstacles
+ */
+class Hasher {
+public:
+  void add(double value) {
+    if (value == 0.0) {
+      value = 0.0;  // -0 == 0
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    add(bits);
+  }
+
+  void add(uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+      hash_ ^= (value >> (8 * i)) & 0xff;
+      hash_ *= 1099511628211ULL;
+    }
+  }
+
+  uint64_t value() const { return hash_; }
+
+private:
+  uint64_t hash_ = 14695981039346656037ULL;
+};
+
+}  // namespace
+
+// ============================================================================
+// Fitting
+// ============================================================================
+
+uint64_t StaticObstacleSelector::hashObstacles(const BEVObstacles& bev_obstacles) {
+  Hasher hasher;
+  hasher.add(static_cast<uint64_t>(bev_obstacles.circles.size()));
+  for (const auto& circle : bev_obstacles.circles) {
+    hasher.add(circle.center.x);
+    hasher.add(circle.center.y);
+    hasher.add(circle.radius);
+  }
+  hasher.add(static_cast<uint64_t>(bev_obstacles.rectangles.size()));
+  for (const auto& rect : bev_obstacles.rectangles) {
+    hasher.add(rect.pose.x);
+    hasher.add(rect.pose.y);
+    hasher.add(rect.pose.yaw);
+    hasher.add(rect.width);
+    hasher.add(rect.height);
+  }
+  hasher.add(static_cast<uint64_t>(bev_obstacles.polygons.size()));
+  for (const auto& polygon : bev_obstacles.polygons) {
+    hasher.add(static_cast<uint64_t>(polygon.vertices.size()));
+    for (const auto& vertex : polygon.vertices) {
+      hasher.add(vertex.x);
+      hasher.add(vertex.y);
+    }
+  }
+  return hasher.value();
+}
+
+bool StaticObstacleSelector::update(const BEVObstacles& bev_obstacles) {
+  uint64_t version = hashObstacles(bev_obstacles);
+  if (fitted_ && version == version_) {
+    return false;
+  }
+
+  fit(bev_obstacles);
+  buildIndex();
+  version_ = version;
+  fitted_ = true;
+  fits_++;
+  return true;
+}
+
+void StaticObstacleSelector::reset() {
+  fitted_ = false;
+  version_ = 0;
+  circles_.clear();
+  max_radius_ = 0.0;
+  size_x_ = 0;
+  size_y_ = 0;
+  cell_start_.clear();
+  cell_items_.clear();
+  candidates_ = 0;
+  merged_ = 0;
+  dropped_ = 0;
+  filled_ = 0;
+}
+
+void StaticObstacleSelector::fit(const BEVObstacles& bev_obstacles) {
+  circles_.clear();
+
+  for (const auto& circle : bev_obstacles.circles) {
+    circles_.push_back({Eigen::Vector2d(circle.center.x, circle.center.y), circle.radius, 0.0});
+  }
+
+  // Rectangles: circles along the major axis
+  for (const auto& rect : bev_obstacles.rectangles) {
+    double cos_yaw = std::cos(rect.pose.yaw);
+    double sin_yaw = std::sin(rect.pose.yaw);
+    Eigen::Vector2d major_dir = rect.width >= rect.height ? Eigen::Vector2d(cos_yaw, sin_yaw)
+                                                          : Eigen::Vector2d(-sin_yaw, cos_yaw);
+    addBox(Eigen::Vector2d(rect.pose.x, rect.pose.y), major_dir, std::max(rect.width, rect.height),
+           std::min(rect.width, rect.height), rect.pose.yaw);
+  }
+
+  for (const auto& polygon : bev_obstacles.polygons) {
+    if (polygon.vertices.empty()) {
+      continue;
+    }
+
+    Eigen::Vector2d centroid = Eigen::Vector2d::Zero();
+    for (const auto& vertex : polygon.vertices) {
+      centroid += Eigen::Vector2d(vertex.x, vertex.y);
+    }
+    centroid /= static_cast<double>(polygon.vertices.size());
+
+    if (polygon.vertices.size() == 4) {
+      // Rectangle: major axis along the longer of the first two edges
+      Eigen::Vector2d edge1(polygon.vertices[1].x - polygon.vertices[0].x,
+                            polygon.vertices[1].y - polygon.vertices[0].y);
+      Eigen::Vector2d edge2(polygon.vertices[2].x - polygon.vertices[1].x,
+                            polygon.vertices[2].y - polygon.vertices[1].y);
+      const Eigen::Vector2d& major = edge1.norm() >= edge2.norm() ? edge1 : edge2;
+      if (major.norm() > 1e-9) {
+        addBox(centroid, major.normalized(), std::max(edge1.norm(), edge2.norm()),
+               std::min(edge1.norm(), edge2.norm()), 0.0);
+        continue;
+      }
+    }
+
+    // Other polygons: circumscribed circle around the centroid
+    double radius = 0.0;
+    for (const auto& vertex : polygon.vertices) {
+      radius = std::max(radius, (Eigen::Vector2d(vertex.x, vertex.y) - centroid).norm());
+    }
+    circles_.push_back({centroid, radius, 0.0});
+  }
+}
+
+void StaticObstacleSelector::addBox(const Eigen::Vector2d& center, const Eigen::Vector2d& major_dir,
+                                    double major_axis, double minor_axis, double yaw) {
+  if (minor_axis < 1e-6) {
+    // Degenerate box (a line): a single circle around it
+    minor_axis = std::max(major_axis, 1e-6);
+  }
+
+  // Circles with the half minor axis as radius, spaced to cover the major axis
+  double radius = minor_axis / 2.0;
+  int count = std::max(1, static_cast<int>(std::ceil(major_axis / minor_axis)));
+  double spacing = count > 1 ? (major_axis - minor_axis) / (count - 1) : 0.0;
+  Eigen::Vector2d start = center - major_dir * (major_axis / 2.0 - radius);
+
+  for (int i = 0; i < count; ++i) {
+    circles_.push_back({start + major_dir * (i * spacing), radius, yaw});
+  }
+}
+
+// ============================================================================
+// Spatial Index
+// ============================================================================
+
+void StaticObstacleSelector::buildIndex() {
+  max_radius_ = 0.0;
+  cell_start_.clear();
+  cell_items_.clear();
+  size_x_ = 0;
+  size_y_ = 0;
+  if (circles_.empty()) {
+    return;
+  }
+
+  Eigen::Vector2d lower = circles_.front().center;
+  Eigen::Vector2d upper = circles_.front().center;
+  for (const auto& circle : circles_) {
+    lower = lower.cwiseMin(circle.center);
+    upper = upper.cwiseMax(circle.center);
+    max_radius_ = std::max(max_radius_, circle.radius);
+  }
+
+  // Larger cells for large maps, to bound the number of cells
+  Eigen::Vector2d extent = upper - lower;
+  cell_size_ = std::max({config_.cell_size, extent.x() / (kMaxCells - 1), extent.y() / (kMaxCells - 1), 1e-3});
+  origin_ = lower;
+  size_x_ = static_cast<int>(extent.x() / cell_size_) + 1;
+  size_y_ = static_cast<int>(extent.y() / cell_size_) + 1;
+
+  // Counting sort of the circles by cell
+  auto cellOf = [&](const Eigen::Vector2d& point) {
+    int x = std::min(size_x_ - 1, static_cast<int>((point.x() - origin_.x()) / cell_size_));
+    int y = std::min(size_y_ - 1, static_cast<int>((point.y() - origin_.y()) / cell_size_));
+    return y * size_x_ + x;
+  };
+
+  cell_start_.assign(static_cast<size_t>(size_x_) * size_y_ + 1, 0);
+  for (const auto& circle : circles_) {
+    cell_start_[cellOf(circle.center) + 1]++;
+  }
+  for (size_t i = 1; i < cell_start_.size(); ++i) {
+    cell_start_[i] += cell_start_[i - 1];
+  }
+  cell_items_.resize(circles_.size());
+  std::vector<int> fill(cell_start_.begin(), cell_start_.end() - 1);
+  for (size_t i = 0; i < circles_.size(); ++i) {
+    cell_items_[fill[cellOf(circles_[i].center)]++] = static_cast<int>(i);
+  }
+}
+
+// ============================================================================
+// Selection
+// ============================================================================
+
+void StaticObstacleSelector::select(const Eigen::Vector2d& ego, const std::vector<CorridorPoint>& corridor,
+                                    size_t max_count, std::vector<Circle>& selected) {
+  selected.clear();
+  candidates_ = 0;
+  merged_ = 0;
+  dropped_ = 0;
+  filled_ = 0;
+  if (circles_.empty() || max_count == 0) {
+    return;
+  }
+
+  // Best score of each circle near the corridor: clearance, plus a penalty for the distance along the corridor
+  const double infinity = std::numeric_limits<double>::infinity();
+  score_.assign(circles_.size(), infinity);
+  candidates_list_.clear();
+
+  const double range = config_.corridor_width + max_radius_;
+  for (const auto& point : corridor) {
+    int x_first = std::max(0, static_cast<int>(std::floor((point.position.x() - range - origin_.x()) / cell_size_)));
+    int x_last = std::min(size_x_ - 1, static_cast<int>(std::floor((point.position.x() + range - origin_.x()) / cell_size_)));
+    int y_first = std::max(0, static_cast<int>(std::floor((point.position.y() - range - origin_.y()) / cell_size_)));
+    int y_last = std::min(size_y_ - 1, static_cast<int>(std::floor((point.position.y() + range - origin_.y()) / cell_size_)));
+    if (x_first > x_last || y_first > y_last) {
+      continue;
+    }
+
+    for (int y = y_first; y <= y_last; ++y) {
+      // Cells of one row are consecutive
+      for (int item = cell_start_[y * size_x_ + x_first]; item < cell_start_[y * size_x_ + x_last + 1]; ++item) {
+        int index = cell_items_[item];
+        double clearance = (circles_[index].center - point.position).norm() - circles_[index].radius;
+        if (clearance > config_.corridor_width) {
+          continue;
+        }
+
+        double score = std::max(0.0, clearance) + config_.distance_weight * point.distance;
+        if (score_[index] == infinity) {
+          candidates_list_.push_back(index);
+        }
+        score_[index] = std::min(score_[index], score);
+      }
+    }
+  }
+  candidates_ = static_cast<int>(candidates_list_.size());
+
+  std::sort(candidates_list_.begin(), candidates_list_.end(), [&](int a, int b) {
+    return score_[a] < score_[b] || (score_[a] == score_[b] && a < b);
+  });
+
+  // Most relevant first; clustered circles are merged into an enclosing circle
+  for (int index : candidates_list_) {
+    const Circle& circle = circles_[index];
+    bool merged = false;
+    for (auto& other : selected) {
+      if (tryMerge(other, circle)) {
+        merged = true;
+        break;
+      }
+    }
+
+    if (merged) {
+      merged_++;
+    } else if (selected.size() < max_count) {
+      selected.push_back(circle);
+    } else {
+      dropped_++;
+    }
+  }
+
+  // Remaining slots: the other circles with the smallest clearance from the ego
+  if (selected.size() >= max_count) {
+    return;
+  }
+  fill_list_.clear();
+  for (size_t i = 0; i < circles_.size(); ++i) {
+    if (score_[i] == infinity) {
+      score_[i] = (circles_[i].center - ego).norm() - circles_[i].radius;
+      fill_list_.push_back(static_cast<int>(i));
+    }
+  }
+
+  size_t count = std::min(max_count - selected.size(), fill_list_.size());
+  std::partial_sort(fill_list_.begin(), fill_list_.begin() + count, fill_list_.end(), [&](int a, int b) {
+    return score_[a] < score_[b] || (score_[a] == score_[b] && a < b);
+  });
+  for (size_t i = 0; i < count; ++i) {
+    selected.push_back(circles_[fill_list_[i]]);
+  }
+  filled_ = static_cast<int>(count);
+}
+
+bool StaticObstacleSelector::tryMerge(Circle& circle, const Circle& c) const {
+  double distance = (c.center - circle.center).norm();
+  if (distance - circle.radius - c.radius >= config_.merge_gap) {
+    return false;
+  }
+
+  if (distance + c.radius <= circle.radius) {
+    return true;  // Already covered
+  }
+  if (distance + circle.radius <= c.radius) {
+    if (c.radius > config_.max_merge_radius) {
+      return false;
+    }
+    circle = c;
+    return true;
+  }
+
+  // Smallest circle that encloses both
+  double radius = 0.5 * (distance + circle.radius + c.radius);
+  if (radius > config_.max_merge_radius) {
+    return false;
+  }
+  circle.center += (c.center - circle.center) * ((radius - circle.radius) / distance);
+  circle.radius = radius;
+  circle.yaw = 0.0;
+  return true;
+}
+
+} // namespace adapter
+} // namespace tmpc_planner
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "core/planning_context.hpp"
+#include <Eigen/Dense>
+#include <cstdint>
+#include <vector>
+
+namespace tmpc_planner {
+namespace adapter {
+
+/**
+ * @brief Selection of the static BEV obstacles that are passed to the MPC
+ *
+ * The BEV circles, rectangles and polygons are fitted with circles once per map version (a hash of the BEV
+ * obstacles) and bucketed in a grid. Each tick only the circles within corridor_width of the corridor (the
+ * reference route ahead and the predicted ego positions) are looked up, ranked by clearance and distance along
+ * the corridor, and clustered circles are merged into an enclosing circle. The most relevant circles fill the
+ * obstacle slots, instead of the first ones in the BEV lists. Slots that are left over go to the remaining circles
+ * nearest to the ego, so that the MPC still sees the closest obstacles when it deviates from the corridor.
+ */
+class StaticObstacleSelector {
+public:
+  struct Config {
+    double corridor_width = 3.0;    // Circles further than this from the corridor are ignored (m)
+    double lookahead = 15.0;        // Length of the reference route in the corridor (m)
+    double distance_weight = 0.1;   // Ranking penalty per meter along the corridor (m/m)
+    double merge_gap = 0.3;         // Circles with a smaller gap are merged (m)
+    double max_merge_radius = 1.0;  // Largest circle produced by merging (m)
+    double cell_size = 2.0;         // Grid cell size of the spatial index (m)
+  };
+
+  struct Circle {
+    Eigen::Vector2d center = Eigen::Vector2d::Zero();
+    double radius = 0.0;
+    double yaw = 0.0;
+  };
+
+  struct CorridorPoint {
+    Eigen::Vector2d position = Eigen::Vector2d::Zero();
+    double distance = 0.0;  // Distance from the ego position along the corridor (m)
+  };
+
+  void setConfig(const Config& config) { config_ = config; }
+  const Config& config() const { return config_; }
+
+  /**
+   * @brief Fit and index the BEV obstacles, unless they are the same as in the last call
+   * @return true if the obstacles changed and were fitted again
+   */
+  bool update(const navsim::planning::BEVObstacles& bev_obstacles);
+
+  /**
+   * @brief Select the circles along the corridor, most relevant first, then the nearest other circles
+   * @param ego Ego position, used to rank the circles away from the corridor
+   * @param corridor Corridor points
+   * @param max_count Number of obstacle slots
+   * @param selected Output circles (at most max_count)
+   */
+  void select(const Eigen::Vector2d& ego, const std::vector<CorridorPoint>& corridor, size_t max_count,
+              std::vector<Circle>& selected);
+
+  /** @brief Forget the fitted obstacles */
+  void reset();
+
+  /** @brief All fitted circles of the current map version */
+  const std::vector<Circle>& circles() const { return circles_; }
+
+  int fits() const { return fits_; }
+  int candidates() const { return candidates_; }  // Circles near the corridor in the last selection
+  int merged() const { return merged_; }          // Circles merged into another in the last selection
+  int dropped() const { return dropped_; }        // Circles left out for lack of slots in the last selection
+  int filled() const { return filled_; }          // Circles away from the corridor added in the last selection
+
+private:
+  static uint64_t hashObstacles(const navsim::planning::BEVObstacles& bev_obstacles);
+
+  void fit(const navsim::planning::BEVObstacles& bev_obstacles);
+
+  /** @brief Circles along the major axis of a box (centre, major axis direction, lengths) */
+  void addBox(const Eigen::Vector2d& center, const Eigen::Vector2d& major_dir, double major_axis, double minor_axis,
+              double yaw);
+
+  void buildIndex();
+
+  /** @brief Merge c into circle if both fit in an enclosing circle of at most max_merge_radius */
+  bool tryMerge(Circle& circle, const Circle& c) const;
+
+  Config config_;
+
+  bool fitted_ = false;
+  uint64_t version_ = 0;
+  std::vector<Circle> circles_;
+  double max_radius_ = 0.0;
+  int fits_ = 0;
+
+  // Grid index: circles of cell i are cell_items_[cell_start_[i] .. cell_start_[i + 1])
+  Eigen::Vector2d origin_ = Eigen::Vector2d::Zero();
+  double cell_size_ = 1.0;
+  int size_x_ = 0;
+  int size_y_ = 0;
+  std::vector<int> cell_start_;
+  std::vector<int> cell_items_;
+
+  // Selection storage, kept between ticks
+  std::vector<double> score_;
+  std::vector<int> candidates_list_;
+  std::vector<int> fill_list_;
+
+  int candidates_ = 0;
+  int merged_ = 0;
+  int dropped_ = 0;
+  int filled_ = 0;
+};
+
+} // namespace adapter
+} // namespace tmpc_planner
@@ -16,6 +16,9 @@
 #include "ros_tools/profiling.h"
 #include "ros_tools/data_saver.h"
 
+#include "core/worker_pool.hpp"
+#include "guidance_planner/parallel.h"
+
 namespace tmpc_planner {
 namespace adapter {
 
@@ -80,10 +83,17 @@ bool TMPCPlannerPlugin::initialize(const json& config) {
   }
 
   // Read parameters from T-MPC settings.yaml (override default.json values if present)
-  horizon_steps_ = CONFIG["N"].as<int>();
-  integrator_step_ = CONFIG["integrator_step"].as<double>();
-  max_obstacles_ = CONFIG["max_obstacles"].as<int>();
-  n_discs_ = CONFIG["n_discs"].as<int>();
+  horizon_steps_ = SETTINGS.N;
+  integrator_step_ = SETTINGS.integrator_step;
+  max_obstacles_ = SETTINGS.max_obstacles;
+  n_discs_ = SETTINGS.n_discs;
+
+  // Run the guidance search and the parallel topology solves on the platform's shared worker pool
+  GuidancePlanner::SetParallelExecutor([](int n, const std::function<void(int)>& body) {
+    navsim::worker::WorkerPool::shared().parallelFor(static_cast<size_t>(n), [&body](size_t i) {
+      body(static_cast<int>(i));
+    });
+  });
 
   // Create planner
   planner_ = std::make_unique<MPCPlanner::Planner>();
@@ -131,6 +141,9 @@ void TMPCPlannerPlugin::reset() {
   reference_segment_ = -1;
   reference_parameter_ = 0.0;
   reference_spline_.reset();
+  reference_route_.reset();
+  static_obstacles_.reset();
+  data_.reference_path.clear();
 
   // Clear past trajectory
   data_.past_trajectory = MPCPlanner::FixedSizeTrajectory(200);
@@ -143,6 +156,8 @@ nlohmann::json TMPCPlannerPlugin::getStatistics() const {
   stats["failed_plans"] = failed_plans_;
   stats["success_rate"] = (total_plans_ > 0) ? (double)successful_plans_ / total_plans_ : 0.0;
   stats["avg_planning_time_ms"] = (total_plans_ > 0) ? total_planning_time_ms_ / total_plans_ : 0.0;
+  stats["reference_route_replans"] = reference_route_.replans();
+  stats["static_obstacle_fits"] = static_obstacles_.fits();
   return stats;
 }
 
@@ -157,7 +172,7 @@ std::pair<bool, std::string> TMPCPlannerPlugin::isAvailable(
   }
 
   // T-MPC requires a goal
-  // We will generate a simple reference path from current position to goal
+  // The reference route is planned from the current position to the goal on the map (or a straight line)
   (void)context;  // Suppress unused warning for now
 
   return {true, ""};
@@ -211,38 +226,35 @@ bool TMPCPlannerPlugin::plan(const navsim::planning::PlanningContext& context,
     }
   }
 
-  // ========== Step 3: Generate Reference Path ==========
-  // Generate a simple straight-line reference path from current position to goal
-  std::vector<navsim::planning::Pose2d> reference_line;
-
-  // Start from current position
-  navsim::planning::Pose2d start_pose = context.ego.pose;
-  navsim::planning::Pose2d goal_pose = context.task.goal_pose;
+  // ========== Step 3: Update Reference Path ==========
+  // The route to the goal is kept between ticks and only re-planned when the goal moves, the map blocks it
+  // or the ego vehicle left it. The MPC modules only rebuild their spline when it changed.
+  bool route_changed = reference_route_.update(context.ego.pose, context.task.goal_pose,
+                                               context.esdf_map.get(), context.occupancy_grid.get());
+
+  if (route_changed || data_.reference_path.x.empty()) {
+    if (!convertReferencePath(reference_route_.points(), data_.reference_path)) {
+      std::cerr << "[TMPCPlannerPlugin] Failed to convert reference path!" << std::endl;
+      result.success = false;
+      result.failure_reason = "Failed to convert reference path";
+      failed_plans_++;
+      return false;
+    }
 
-  // Generate waypoints along straight line
-  int num_waypoints = 50;
-  for (int i = 0; i <= num_waypoints; ++i) {
-    double t = static_cast<double>(i) / num_waypoints;
-    navsim::planning::Pose2d waypoint;
-    waypoint.x = start_pose.x + t * (goal_pose.x - start_pose.x);
-    waypoint.y = start_pose.y + t * (goal_pose.y - start_pose.y);
-    waypoint.yaw = std::atan2(goal_pose.y - start_pose.y, goal_pose.x - start_pose.x);
-    reference_line.push_back(waypoint);
-  }
+    reference_spline_ = reference_route_.spline();
+    reference_progress_initialized_ = false;
 
-  if (!convertReferencePath(reference_line, data_.reference_path)) {
-    std::cerr << "[TMPCPlannerPlugin] Failed to convert reference path!" << std::endl;
-    result.success = false;
-    result.failure_reason = "Failed to convert reference path";
-    failed_plans_++;
-    return false;
+    // Notify planner that reference path has been updated
+    planner_->onDataReceived(data_, "reference_path");
   }
 
-  // Notify planner that reference path has been updated
-  planner_->onDataReceived(data_, "reference_path");
-
-  if (verbose_) {
-    std::cout << "[TMPCPlannerPlugin] Reference path converted: "
+  if (verbose_ && !route_changed) {
+    std::cout << "[TMPCPlannerPlugin] Reference route reused ("
+              << reference_route_.replans() << " replans)" << std::endl;
+  } else if (verbose_) {
+    static const char* kSources[] = {"none", "straight line", "ESDF", "occupancy grid"};
+    std::cout << "[TMPCPlannerPlugin] Reference route planned on "
+              << kSources[static_cast<int>(reference_route_.source())] << ": "
               << data_.reference_path.x.size() << " points" << std::endl;
     if (!data_.reference_path.x.empty()) {
       std::cout << "  - Start: (" << data_.reference_path.x.front() << ", "
@@ -487,6 +499,34 @@ bool TMPCPlannerPlugin::loadConfig(const json& config) {
     max_obstacles_ = config.value("max_obstacles", 12);
     n_discs_ = config.value("n_discs", 1);
 
+    // Load reference route parameters
+    if (config.contains("reference_route")) {
+      const auto& route = config["reference_route"];
+      ReferenceRoute::Config route_config;
+      route_config.clearance = route.value("clearance", route_config.clearance);
+      route_config.comfort_distance = route.value("comfort_distance", route_config.comfort_distance);
+      route_config.obstacle_cost = route.value("obstacle_cost", route_config.obstacle_cost);
+      route_config.point_spacing = route.value("point_spacing", route_config.point_spacing);
+      route_config.goal_tolerance = route.value("goal_tolerance", route_config.goal_tolerance);
+      route_config.max_deviation = route.value("max_deviation", route_config.max_deviation);
+      route_config.check_distance = route.value("check_distance", route_config.check_distance);
+      route_config.max_expansions = route.value("max_expansions", route_config.max_expansions);
+      reference_route_.setConfig(route_config);
+    }
+
+    // Load static obstacle selection parameters
+    if (config.contains("static_obstacles")) {
+      const auto& selection = config["static_obstacles"];
+      StaticObstacleSelector::Config selection_config;
+      selection_config.corridor_width = selection.value("corridor_width", selection_config.corridor_width);
+      selection_config.lookahead = selection.value("lookahead", selection_config.lookahead);
+      selection_config.distance_weight = selection.value("distance_weight", selection_config.distance_weight);
+      selection_config.merge_gap = selection.value("merge_gap", selection_config.merge_gap);
+      selection_config.max_merge_radius = selection.value("max_merge_radius", selection_config.max_merge_radius);
+      selection_config.cell_size = selection.value("cell_size", selection_config.cell_size);
+      static_obstacles_.setConfig(selection_config);
+    }
+
     // Load plugin configuration
     verbose_ = config.value("verbose", true);
 
@@ -518,6 +558,18 @@ bool TMPCPlannerPlugin::validateConfig() const {
     return false;
   }
 
+  if (reference_route_.config().point_spacing <= 0.0) {
+    std::cerr << "[TMPCPlannerPlugin] Invalid reference_route.point_spacing: "
+              << reference_route_.config().point_spacing << std::endl;
+    return false;
+  }
+
+  if (static_obstacles_.config().cell_size <= 0.0) {
+    std::cerr << "[TMPCPlannerPlugin] Invalid static_obstacles.cell_size: "
+              << static_obstacles_.config().cell_size << std::endl;
+    return false;
+  }
+
   return true;
 }
 
@@ -589,10 +641,6 @@ bool TMPCPlannerPlugin::convertReferencePath(
     }
   }
 
-  // Create spline for path tracking
-  reference_spline_ = std::make_shared<RosTools::Spline2D>(
-      reference_path.x, reference_path.y);
-
   return true;
 }
 
@@ -689,37 +737,52 @@ bool TMPCPlannerPlugin::convertDynamicObstacles(
 void TMPCPlannerPlugin::convertStaticBEVObstacles(
     const navsim::planning::BEVObstacles& bev_obstacles,
     const MPCPlanner::State& state,
-    std::vector<MPCPlanner::DynamicObstacle>& mpc_obstacles) const {
+    std::vector<MPCPlanner::DynamicObstacle>& mpc_obstacles) {
 
   int start_index = mpc_obstacles.size();
 
+  // Circle fits are only recomputed when the BEV obstacles changed
+  bool refit = static_obstacles_.update(bev_obstacles);
+
   if (verbose_) {
     std::cout << "[TMPCPlannerPlugin] Converting static BEV obstacles, start_index=" << start_index
-              << ", max_obstacles=" << max_obstacles_ << std::endl;
+              << ", max_obstacles=" << max_obstacles_ << ", circles=" << static_obstacles_.circles().size()
+              << (refit ? " (fitted)" : " (cached)") << std::endl;
   }
 
-  // Convert circle obstacles
-  for (const auto& circle : bev_obstacles.circles) {
-    if (start_index >= max_obstacles_) {
-      if (verbose_) {
-        std::cout << "[TMPCPlannerPlugin]   Skipping circle: start_index=" << start_index << " >= max_obstacles=" << max_obstacles_ << std::endl;
-      }
-      break;
+  // Corridor: the predicted ego positions at the current speed and heading, and the reference route ahead
+  static_corridor_.clear();
+  Eigen::Vector2d position = state.getPos();
+  Eigen::Vector2d direction(std::cos(state.get("psi")), std::sin(state.get("psi")));
+  double step = state.get("v") * integrator_step_;
+  for (int k = 0; k <= horizon_steps_; ++k) {
+    static_corridor_.push_back({position + direction * (step * k), step * k});
+  }
+
+  if (reference_route_.valid()) {
+    const auto& points = reference_route_.points();
+    const auto& arc_lengths = reference_route_.arcLengths();
+    size_t first = std::min(reference_route_.progressIndex(), points.size() - 1);
+    double lookahead = std::max(static_obstacles_.config().lookahead, step * horizon_steps_);
+    for (size_t i = first; i < points.size() && arc_lengths[i] - arc_lengths[first] <= lookahead; ++i) {
+      static_corridor_.push_back({Eigen::Vector2d(points[i].x, points[i].y), arc_lengths[i] - arc_lengths[first]});
     }
+  }
 
-    Eigen::Vector2d position(circle.center.x, circle.center.y);
-    Eigen::Vector2d velocity = Eigen::Vector2d::Zero();
+  size_t slots = static_cast<size_t>(std::max(0, max_obstacles_ - start_index));
+  static_obstacles_.select(position, static_corridor_, slots, static_selection_);
 
+  for (const auto& circle : static_selection_) {
     MPCPlanner::DynamicObstacle mpc_obs(
         start_index,
-        position,
-        0.0,  // yaw
+        circle.center,
+        circle.yaw,
         circle.radius
     );
 
     // Static obstacle - zero velocity prediction
     mpc_obs.prediction = getConstantVelocityPrediction(
-        position, velocity, integrator_step_, horizon_steps_);
+        circle.center, Eigen::Vector2d::Zero(), integrator_step_, horizon_steps_);
     mpc_obs.type = MPCPlanner::ObstacleType::STATIC;
 
     mpc_obstacles.push_back(mpc_obs);
@@ -727,224 +790,30 @@ void TMPCPlannerPlugin::convertStaticBEVObstacles(
 
     if (verbose_) {
       std::cout << "[TMPCPlannerPlugin]   Added static circle: pos=("
-                << position.x() << ", " << position.y() << "), r=" << circle.radius << std::endl;
-    }
-  }
-
-  // Convert polygon obstacles (approximate with multiple circles)
-  for (const auto& polygon : bev_obstacles.polygons) {
-    if (start_index >= max_obstacles_) break;
-    if (polygon.vertices.empty()) continue;
-
-    // Compute centroid
-    Eigen::Vector2d centroid = Eigen::Vector2d::Zero();
-    for (const auto& vertex : polygon.vertices) {
-      centroid.x() += vertex.x;
-      centroid.y() += vertex.y;
-    }
-    centroid /= polygon.vertices.size();
-
-    // For 4-vertex polygons (rectangles), use multi-circle approximation
-    if (polygon.vertices.size() == 4) {
-      // Compute the two diagonal lengths to find major/minor axes
-      std::vector<Eigen::Vector2d> verts;
-      for (const auto& v : polygon.vertices) {
-        verts.emplace_back(v.x, v.y);
-      }
-
-      // Compute edge lengths
-      double edge1 = (verts[1] - verts[0]).norm();
-      double edge2 = (verts[2] - verts[1]).norm();
-
-      // Major and minor axes
-      double major_axis = std::max(edge1, edge2);
-      double minor_axis = std::min(edge1, edge2);
-
-      // Major axis direction
-      Eigen::Vector2d major_dir;
-      if (edge1 >= edge2) {
-        major_dir = (verts[1] - verts[0]).normalized();
-      } else {
-        major_dir = (verts[2] - verts[1]).normalized();
-      }
-
-      // Circle radius = half of minor axis
-      double circle_radius = minor_axis / 2.0;
-
-      // Number of circles
-      int num_circles = std::max(1, static_cast<int>(std::ceil(major_axis / minor_axis)));
-      num_circles = std::min(num_circles, std::max(1, max_obstacles_ - start_index));
-
-      // Spacing between circles
-      double spacing = (num_circles > 1) ? (major_axis - minor_axis) / (num_circles - 1) : 0.0;
-
-      // Starting position
-      Eigen::Vector2d start_pos = centroid - major_dir * (major_axis / 2.0 - circle_radius);
-
-      if (verbose_) {
-        std::cout << "[TMPCPlannerPlugin]   Adding static polygon (rectangle): centroid=("
-                  << centroid.x() << ", " << centroid.y() << "), major=" << major_axis
-                  << ", minor=" << minor_axis << " → " << num_circles << " circles (r="
-                  << circle_radius << ")" << std::endl;
-      }
-
-      // Create circles along major axis
-      for (int i = 0; i < num_circles && start_index < max_obstacles_; ++i) {
-        Eigen::Vector2d circle_pos = start_pos + major_dir * (i * spacing);
-        Eigen::Vector2d velocity = Eigen::Vector2d::Zero();
-
-        MPCPlanner::DynamicObstacle mpc_obs(
-            start_index,
-            circle_pos,
-            0.0,  // yaw
-            circle_radius
-        );
-
-        // Static obstacle - zero velocity prediction
-        mpc_obs.prediction = getConstantVelocityPrediction(
-            circle_pos, velocity, integrator_step_, horizon_steps_);
-        mpc_obs.type = MPCPlanner::ObstacleType::STATIC;
-
-        mpc_obstacles.push_back(mpc_obs);
-        start_index++;
-
-        if (verbose_) {
-          std::cout << "[TMPCPlannerPlugin]     Circle " << i << ": pos=("
-                    << circle_pos.x() << ", " << circle_pos.y() << ")" << std::endl;
-        }
-      }
-    } else {
-      // For non-rectangular polygons, use single circumscribed circle
-      double max_radius = 0.0;
-      for (const auto& vertex : polygon.vertices) {
-        double dx = vertex.x - centroid.x();
-        double dy = vertex.y - centroid.y();
-        double dist = std::hypot(dx, dy);
-        max_radius = std::max(max_radius, dist);
-      }
-
-      Eigen::Vector2d velocity = Eigen::Vector2d::Zero();
-
-      MPCPlanner::DynamicObstacle mpc_obs(
-          start_index,
-          centroid,
-          0.0,  // yaw
-          max_radius
-      );
-
-      // Static obstacle - zero velocity prediction
-      mpc_obs.prediction = getConstantVelocityPrediction(
-          centroid, velocity, integrator_step_, horizon_steps_);
-      mpc_obs.type = MPCPlanner::ObstacleType::STATIC;
-
-      mpc_obstacles.push_back(mpc_obs);
-      start_index++;
-
-      if (verbose_) {
-        std::cout << "[TMPCPlannerPlugin]   Added static polygon: centroid=("
-                  << centroid.x() << ", " << centroid.y() << "), r=" << max_radius
-                  << " (vertices=" << polygon.vertices.size() << ")" << std::endl;
-      }
+                << circle.center.x() << ", " << circle.center.y() << "), r=" << circle.radius << std::endl;
     }
   }
 
-  // Convert rectangle obstacles (approximate with multiple circles along major axis)
-  for (const auto& rect : bev_obstacles.rectangles) {
-    if (start_index >= max_obstacles_) break;
-
-    // Determine major and minor axes
-    double major_axis = std::max(rect.width, rect.height);
-    double minor_axis = std::min(rect.width, rect.height);
-    bool width_is_major = (rect.width >= rect.height);
-
-    // Circle radius = half of minor axis (so circles cover the width)
-    double circle_radius = minor_axis / 2.0;
-
-    // Number of circles needed to cover the major axis
-    // Use spacing = minor_axis to ensure overlap
-    int num_circles = std::max(1, static_cast<int>(std::ceil(major_axis / minor_axis)));
-
-    // Limit number of circles to avoid using too many obstacle slots
-    num_circles = std::min(num_circles, std::max(1, max_obstacles_ - start_index));
-
-    // Spacing between circle centers
-    double spacing = (num_circles > 1) ? (major_axis - minor_axis) / (num_circles - 1) : 0.0;
-
-    // Direction along major axis (in world frame)
-    double cos_yaw = std::cos(rect.pose.yaw);
-    double sin_yaw = std::sin(rect.pose.yaw);
-    Eigen::Vector2d major_axis_dir;
-    if (width_is_major) {
-      major_axis_dir = Eigen::Vector2d(cos_yaw, sin_yaw);  // Along width
-    } else {
-      major_axis_dir = Eigen::Vector2d(-sin_yaw, cos_yaw);  // Along height (perpendicular)
-    }
-
-    // Starting position (one end of the rectangle)
-    Eigen::Vector2d center(rect.pose.x, rect.pose.y);
-    Eigen::Vector2d start_pos = center - major_axis_dir * (major_axis / 2.0 - circle_radius);
-
-    if (verbose_) {
-      std::cout << "[TMPCPlannerPlugin]   Adding static rectangle: center=("
-                << center.x() << ", " << center.y() << "), w=" << rect.width
-                << ", h=" << rect.height << " → " << num_circles << " circles (r="
-                << circle_radius << ")" << std::endl;
-    }
-
-    // Create circles along the major axis
-    for (int i = 0; i < num_circles && start_index < max_obstacles_; ++i) {
-      Eigen::Vector2d circle_pos = start_pos + major_axis_dir * (i * spacing);
-      Eigen::Vector2d velocity = Eigen::Vector2d::Zero();
-
-      MPCPlanner::DynamicObstacle mpc_obs(
-          start_index,
-          circle_pos,
-          rect.pose.yaw,
-          circle_radius
-      );
-
-      // Static obstacle - zero velocity prediction
-      mpc_obs.prediction = getConstantVelocityPrediction(
-          circle_pos, velocity, integrator_step_, horizon_steps_);
-      mpc_obs.type = MPCPlanner::ObstacleType::STATIC;
-
-      mpc_obstacles.push_back(mpc_obs);
-      start_index++;
-
-      if (verbose_) {
-        std::cout << "[TMPCPlannerPlugin]     Circle " << i << ": pos=("
-                  << circle_pos.x() << ", " << circle_pos.y() << ")" << std::endl;
-      }
-    }
+  if (verbose_) {
+    std::cout << "[TMPCPlannerPlugin]   Static obstacles near the corridor: " << static_obstacles_.candidates()
+              << ", merged: " << static_obstacles_.merged()
+              << ", added: " << static_selection_.size()
+              << " (nearest to the ego: " << static_obstacles_.filled() << ")"
+              << ", dropped: " << static_obstacles_.dropped() << std::endl;
   }
 }
 
-double TMPCPlannerPlugin::computeReferenceProgress(const MPCPlanner::State& state) const {
+double TMPCPlannerPlugin::computeReferenceProgress(const MPCPlanner::State& state) {
   if (!reference_spline_) {
     return 0.0;
   }
 
-  Eigen::Vector2d robot_pos = state.getPos();
-
-  // Find closest point on spline
-  double best_param = 0.0;
-  double best_dist = std::numeric_limits<double>::infinity();
-
-  // Sample along spline to find closest point
-  double max_param = reference_spline_->parameterLength();
-  int samples = 100;
-  for (int i = 0; i <= samples; ++i) {
-    double param = max_param * i / samples;
-    Eigen::Vector2d spline_point = reference_spline_->getPoint(param);
-    double dist = (spline_point - robot_pos).norm();
+  // The spline keeps the closest segment of the previous call and only searches the segments around it
+  // (a new route starts with a full search)
+  reference_spline_->findClosestPoint(state.getPos(), reference_segment_, reference_parameter_);
+  reference_progress_initialized_ = true;
 
-    if (dist < best_dist) {
-      best_dist = dist;
-      best_param = param;
-    }
-  }
-
-  return best_param;
+  return reference_parameter_;
 }
 
 void TMPCPlannerPlugin::updateGuidanceTrajectories(const MPCPlanner::State& state,
@@ -1073,19 +942,11 @@ void TMPCPlannerPlugin::updateGuidanceTrajectories(const MPCPlanner::State& stat
 void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
                                           const MPCPlanner::RealTimeData& data,
                                           navsim::plugin::PlanningResult& result) {
-  // Use static variable to store debug paths (same as JPS planner)
-  static std::vector<std::vector<navsim::planning::Pose2d>> global_debug_paths;
-  static std::vector<std::string> global_debug_path_types;  // Store path types
-
-  // Store approximation circles for obstacles
-  struct ApproximationCircle {
-    double x, y, radius;
-  };
-  static std::vector<ApproximationCircle> global_approximation_circles;
-
-  global_debug_paths.clear();
-  global_debug_path_types.clear();
-  global_approximation_circles.clear();
+  // Debug data lives in member buffers (same as JPS planner); the result only
+  // carries their addresses, valid until this instance plans again
+  debug_paths_.clear();
+  debug_path_types_.clear();
+  approximation_circles_.clear();
 
   if (verbose_) {
     std::cout << "[TMPCPlannerPlugin] Extracting debug paths for visualization..." << std::endl;
@@ -1101,8 +962,8 @@ void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
       pose.yaw = data.reference_path.psi[i];
       ref_path.push_back(pose);
     }
-    global_debug_paths.push_back(ref_path);
-    global_debug_path_types.push_back("reference");
+    debug_paths_.push_back(ref_path);
+    debug_path_types_.push_back("reference");
     if (verbose_) {
       std::cout << "[TMPCPlannerPlugin] === PATH 1: Reference path size: " << ref_path.size() << std::endl;
     }
@@ -1138,8 +999,8 @@ void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
         guidance_path.push_back(pose);
       }
 
-      global_debug_paths.push_back(guidance_path);
-      global_debug_path_types.push_back("guidance");
+      debug_paths_.push_back(guidance_path);
+      debug_path_types_.push_back("guidance");
       guidance_count++;
       if (verbose_) {
         std::cout << "[TMPCPlannerPlugin] === PATH " << (1 + guidance_count)
@@ -1169,8 +1030,8 @@ void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
         candidate_path.push_back(pose);
       }
 
-      global_debug_paths.push_back(candidate_path);
-      global_debug_path_types.push_back("mpc_candidate");
+      debug_paths_.push_back(candidate_path);
+      debug_path_types_.push_back("mpc_candidate");
       candidate_count++;
       if (verbose_) {
         std::cout << "[TMPCPlannerPlugin] === PATH " << (1 + guidance_count + candidate_count)
@@ -1193,10 +1054,10 @@ void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
     circle.x = obs.position.x();
     circle.y = obs.position.y();
     circle.radius = obs.radius;
-    global_approximation_circles.push_back(circle);
+    approximation_circles_.push_back(circle);
 
     if (verbose_) {
-      std::cout << "[TMPCPlannerPlugin]   Approximation circle " << global_approximation_circles.size() - 1
+      std::cout << "[TMPCPlannerPlugin]   Approximation circle " << approximation_circles_.size() - 1
                 << ": pos=(" << circle.x << ", " << circle.y << "), radius=" << circle.radius << std::endl;
     }
 
@@ -1219,8 +1080,8 @@ void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
         pred_path.push_back(pose);
       }
 
-      global_debug_paths.push_back(pred_path);
-      global_debug_path_types.push_back("obstacle_prediction");
+      debug_paths_.push_back(pred_path);
+      debug_path_types_.push_back("obstacle_prediction");
       pred_count++;
       if (verbose_) {
         std::cout << "[TMPCPlannerPlugin] === PATH " << (1 + guidance_count + candidate_count + pred_count)
@@ -1239,8 +1100,8 @@ void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
       pose.yaw = 0.0;
       past_path.push_back(pose);
     }
-    global_debug_paths.push_back(past_path);
-    global_debug_path_types.push_back("past_trajectory");
+    debug_paths_.push_back(past_path);
+    debug_path_types_.push_back("past_trajectory");
     if (verbose_) {
       std::cout << "[TMPCPlannerPlugin] === PATH " << (1 + guidance_count + candidate_count + pred_count + 1)
                 << ": Past trajectory size: " << past_path.size() << std::endl;
@@ -1250,16 +1111,16 @@ void TMPCPlannerPlugin::extractDebugPaths(const MPCPlanner::State& state,
   // Store debug paths in result metadata
   result.metadata["has_debug_paths"] = 1.0;
   result.metadata["debug_paths_ptr"] = static_cast<double>(
-      reinterpret_cast<uintptr_t>(&global_debug_paths));
+      reinterpret_cast<uintptr_t>(&debug_paths_));
   result.metadata["debug_path_types_ptr"] = static_cast<double>(
-      reinterpret_cast<uintptr_t>(&global_debug_path_types));
+      reinterpret_cast<uintptr_t>(&debug_path_types_));
   result.metadata["approximation_circles_ptr"] = static_cast<double>(
-      reinterpret_cast<uintptr_t>(&global_approximation_circles));
-  result.metadata["approximation_circles_count"] = static_cast<double>(global_approximation_circles.size());
+      reinterpret_cast<uintptr_t>(&approximation_circles_));
+  result.metadata["approximation_circles_count"] = static_cast<double>(approximation_circles_.size());
 
   if (verbose_) {
-    std::cout << "[TMPCPlannerPlugin] Total debug paths: " << global_debug_paths.size() << std::endl;
-    std::cout << "[TMPCPlannerPlugin] Total approximation circles: " << global_approximation_circles.size() << std::endl;
+    std::cout << "[TMPCPlannerPlugin] Total debug paths: " << debug_paths_.size() << std::endl;
+    std::cout << "[TMPCPlannerPlugin] Total approximation circles: " << approximation_circles_.size() << std::endl;
   }
 }
 
@@ -3,6 +3,8 @@
 #include "plugin/framework/planner_plugin_interface.hpp"
 #include "plugin/data/planning_result.hpp"
 #include "core/planning_context.hpp"
+#include "reference_route.hpp"
+#include "static_obstacle_selector.hpp"
 #include <nlohmann/json.hpp>
 #include <memory>
 #include <string>
@@ -106,7 +108,7 @@ private:
 
   /**
    * @brief Convert reference line to T-MPC ReferencePath
-   * @param reference_line Input reference line from context
+   * @param reference_line Input reference line (route points)
    * @param reference_path Output T-MPC reference path
    * @return true if conversion succeeded
    */
@@ -126,13 +128,17 @@ private:
 
   /**
    * @brief Convert static BEV obstacles to T-MPC format
+   *
+   * Only the obstacles along the reference route ahead and the predicted ego positions are converted,
+   * most relevant first, until max_obstacles is reached.
+   *
    * @param bev_obstacles BEV obstacles from context
    * @param state Current robot state
    * @param mpc_obstacles Output T-MPC obstacles (appended to existing)
    */
   void convertStaticBEVObstacles(const navsim::planning::BEVObstacles& bev_obstacles,
                                   const MPCPlanner::State& state,
-                                  std::vector<MPCPlanner::DynamicObstacle>& mpc_obstacles) const;
+                                  std::vector<MPCPlanner::DynamicObstacle>& mpc_obstacles);
 
   /**
    * @brief Create robot area (multi-disc collision model)
@@ -165,10 +171,13 @@ private:
 
   /**
    * @brief Compute reference path progress (spline parameter)
+   *
+   * Only searches the spline segments around the progress of the previous tick.
+   *
    * @param state Current robot state
    * @return Spline parameter value
    */
-  double computeReferenceProgress(const MPCPlanner::State& state) const;
+  double computeReferenceProgress(const MPCPlanner::State& state);
 
   /**
    * @brief Update guidance trajectories
@@ -203,9 +212,15 @@ private:
   std::unique_ptr<MPCPlanner::Planner> planner_;
   std::shared_ptr<GuidancePlanner::GlobalGuidance> global_guidance_;
 
-  // Reference path spline
+  // Reference route (kept between ticks) and its spline
+  ReferenceRoute reference_route_;
   std::shared_ptr<RosTools::Spline2D> reference_spline_;
 
+  // Static obstacle fits (kept while the BEV obstacles are unchanged) and selection
+  StaticObstacleSelector static_obstacles_;
+  std::vector<StaticObstacleSelector::CorridorPoint> static_corridor_;
+  std::vector<StaticObstacleSelector::Circle> static_selection_;
+
   // T-MPC state and data
   MPCPlanner::State state_;
   MPCPlanner::RealTimeData data_;
@@ -232,10 +247,13 @@ private:
   // Configuration
   bool verbose_ = false;
 
-  // Debug visualization storage
+  // Debug visualization storage of the last plan (exposed by address through result.metadata)
+  struct ApproximationCircle {
+    double x, y, radius;
+  };
   std::vector<std::vector<navsim::planning::Pose2d>> debug_paths_;
-  std::vector<std::string> debug_path_names_;
-  std::vector<std::string> debug_path_colors_;
+  std::vector<std::string> debug_path_types_;
+  std::vector<ApproximationCircle> approximation_circles_;
 };
 
 /**
@@ -7,6 +7,7 @@
 
 #include <decomp_geometry/ellipsoid.h>
 #include <decomp_geometry/polyhedron.h>
+#include <decomp_util/obstacle_grid.h>
 //#include <decomp_geometry/geometry_utils.h>
 
 /**
@@ -37,6 +38,27 @@ class DecompBase {
       obs_ = vs.points_inside(obs);
     }
 
+    ///Import obstacle points from a grid, same result as set_obs(grid.points())
+    void set_obs(const ObstacleGrid<Dim> &grid) {
+      Polyhedron<Dim> vs;
+      add_local_bbox(vs);
+      Vecf<Dim> lower, upper;
+      if (local_bbox_bounds(lower, upper))
+        obs_ = vs.points_inside(grid.points_in_box(lower, upper));
+      else
+        obs_ = vs.points_inside(grid.points());
+    }
+
+    /**
+     * @brief Axis aligned box around the local bounding box
+     * @return false if there is no local bounding box
+     */
+    virtual bool local_bbox_bounds(Vecf<Dim> &lower, Vecf<Dim> &upper) const {
+      (void)lower;
+      (void)upper;
+      return false;
+    }
+
     ///Get obstacel points
     vec_Vecf<Dim> get_obs() const { return obs_; }
 
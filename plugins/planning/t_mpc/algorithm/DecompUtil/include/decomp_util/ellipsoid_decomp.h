@@ -5,17 +5,29 @@
 #ifndef ELLIPSOID_DECOMP_H
 #define ELLIPSOID_DECOMP_H
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <vector>
 #include <decomp_util/line_segment.h>
+#include <decomp_util/obstacle_grid.h>
 
 /**
  * @brief EllipsoidDecomp Class
  *
  * EllipsoidDecomp takes input as a given path and find the Safe Flight Corridor around it using Ellipsoids
+ *
+ * The obstacle points are bucketed in an ObstacleGrid when they are set, so set them once per map and dilate as
+ * often as needed. With a reuse tolerance, a segment whose end points moved less than the tolerance keeps the
+ * polyhedron of the previous dilation, as long as it still contains the segment and no obstacle point is inside it.
+ * This also holds when the obstacles changed in between; a reused polyhedron may then be smaller than necessary.
  */
 template <int Dim>
 class EllipsoidDecomp {
 public:
+ ///Runs body(0), ..., body(n - 1) and returns when all have finished
+ typedef std::function<void(int n, const std::function<void(int)> &body)> Executor;
+
  ///Simple constructor
  EllipsoidDecomp() {}
  /**
@@ -29,10 +41,26 @@ public:
  }
 
  ///Set obstacle points
- void set_obs(const vec_Vecf<Dim> &obs) { obs_ = obs; }
+ void set_obs(const vec_Vecf<Dim> &obs) {
+   obs_ = obs;
+   grid_valid_ = false;
+ }
 
  ///Set dimension of bounding box
- void set_local_bbox(const Vecf<Dim>& bbox) { local_bbox_ = bbox; }
+ void set_local_bbox(const Vecf<Dim>& bbox) {
+   local_bbox_ = bbox;
+   grid_valid_ = false;
+   lines_.clear();
+ }
+
+ ///Reuse the previous polyhedron of segments whose end points moved less than tolerance (0: never reuse)
+ void set_reuse_tolerance(decimal_t tolerance) { reuse_tolerance_ = tolerance; }
+
+ ///Dilate the segments with a parallel loop, e.g. a worker pool (serial if empty)
+ void set_executor(Executor executor) { executor_ = std::move(executor); }
+
+ ///Number of segments that kept their previous polyhedron in the last dilation
+ int reused() const { return reused_; }
 
  ///Get the path that is used for dilation
  vec_Vecf<Dim> get_path() const { return path_; }
@@ -54,27 +82,69 @@ public:
    return constraints;
  }
 
+ /**
+  * @brief Write the constraints of SFC as \f$Ax\leq b \f$ into an existing container
+  * @param constraints Output constraints, one per segment
+  * @param offset Distance by which every hyperplane is moved inwards
+  */
+ template <typename Container>
+ void set_constraints(Container &constraints, decimal_t offset = 0) const {
+   constraints.resize(polyhedrons_.size());
+   for (unsigned int i = 0; i < polyhedrons_.size(); i++){
+     const Vecf<Dim> pt = (path_[i] + path_[i+1])/2;
+     constraints[i] = LinearConstraint<Dim>(pt, polyhedrons_[i].hyperplanes());
+     if (offset != 0)
+       constraints[i].b_ -= offset * constraints[i].A_.rowwise().norm();
+   }
+ }
+
  /**
   * @brief Decomposition thread
   * @param path The path to dilate
   * @param offset_x offset added to the long semi-axis, default is 0
   */
  void dilate(const vec_Vecf<Dim> &path, double offset_x = 0) {
-   const unsigned int N = path.size() - 1;
-   lines_.resize(N);
+   if (!grid_valid_) {
+     // Cells of about half the local box, the grid is only rebuilt when the obstacles change
+     const decimal_t cell_size = local_bbox_.norm() > 0 ? local_bbox_.maxCoeff() / 2 : 1;
+     grid_.build(obs_, cell_size);
+     grid_valid_ = true;
+   }
+
+   const int N = std::max(static_cast<int>(path.size()) - 1, 0);
+   if (offset_x != previous_offset_x_)
+     lines_.clear();
+   previous_offset_x_ = offset_x;
+
+   lines_.swap(previous_lines_);
+   lines_.assign(N, nullptr);
    ellipsoids_.resize(N);
    polyhedrons_.resize(N);
 
-   for (unsigned int i = 0; i < N; i++) {
-     lines_[i] = std::make_shared<LineSegment<Dim>>(path[i], path[i+1]);
-     lines_[i]->set_local_bbox(local_bbox_);
-     lines_[i]->set_obs(obs_);
-     lines_[i]->dilate(offset_x);
+   std::atomic<int> reused{0};
+   auto dilate_segment = [&](int i) {
+     lines_[i] = find_reusable(path[i], path[i+1]);
+     if (lines_[i]) {
+       reused++;
+     } else {
+       lines_[i] = std::make_shared<LineSegment<Dim>>(path[i], path[i+1]);
+       lines_[i]->set_local_bbox(local_bbox_);
+       lines_[i]->set_obs(grid_);
+       lines_[i]->dilate(offset_x);
+     }
 
      ellipsoids_[i] = lines_[i]->get_ellipsoid();
      polyhedrons_[i] = lines_[i]->get_polyhedron();
-   }
+   };
 
+   if (executor_ && N > 1)
+     executor_(N, dilate_segment);
+   else {
+     for (int i = 0; i < N; i++)
+       dilate_segment(i);
+   }
+   reused_ = reused;
+   previous_lines_.clear();
 
    path_ = path;
 
@@ -86,6 +156,43 @@ public:
  }
 
 protected:
+ /// Segment of the previous dilation whose polyhedron is still valid for p1 -> p2, if any
+ std::shared_ptr<LineSegment<Dim>> find_reusable(const Vecf<Dim> &p1, const Vecf<Dim> &p2) const {
+   if (reuse_tolerance_ <= 0)
+     return nullptr;
+
+   for (const auto &line : previous_lines_) {
+     const auto ends = line->get_line_segment();
+     if ((ends[0] - p1).norm() > reuse_tolerance_ || (ends[1] - p2).norm() > reuse_tolerance_)
+       continue;
+
+     const auto poly = line->get_polyhedron();
+     if (!poly.inside(p1) || !poly.inside(p2))
+       continue;
+
+     // The obstacles may have changed: no point may be inside the polyhedron (points on it are fine)
+     Vecf<Dim> lower, upper;
+     const auto obs = line->local_bbox_bounds(lower, upper) ? grid_.points_in_box(lower, upper) : grid_.points();
+     bool free = true;
+     for (const auto &pt : obs) {
+       bool interior = true;
+       for (const auto &v : poly.vs_) {
+         if (v.signed_dist(pt) > -1e-6) {
+           interior = false;
+           break;
+         }
+       }
+       if (interior) {
+         free = false;
+         break;
+       }
+     }
+     if (free)
+       return line;
+   }
+   return nullptr;
+ }
+
  template<int U = Dim>
    typename std::enable_if<U == 2>::type
    add_global_bbox(Polyhedron<Dim> &Vs) {
@@ -121,6 +228,15 @@ protected:
  vec_E<Ellipsoid<Dim>> ellipsoids_;
  vec_E<Polyhedron<Dim>> polyhedrons_;
  std::vector<std::shared_ptr<LineSegment<Dim>>> lines_;
+ std::vector<std::shared_ptr<LineSegment<Dim>>> previous_lines_;
+
+ ObstacleGrid<Dim> grid_;
+ bool grid_valid_{false};
+
+ decimal_t reuse_tolerance_{0};
+ decimal_t previous_offset_x_{0};
+ Executor executor_;
+ int reused_{0};
 
  Vecf<Dim> local_bbox_{Vecf<Dim>::Zero()};
  Vecf<Dim> global_bbox_min_{Vecf<Dim>::Zero()}; // bounding box params
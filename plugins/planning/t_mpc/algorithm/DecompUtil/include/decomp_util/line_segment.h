@@ -34,6 +34,17 @@ class LineSegment : public DecompBase<Dim> {
       add_local_bbox(this->polyhedron_);
     }
 
+    /// Axis aligned box around the local bounding box of the line
+    bool local_bbox_bounds(Vecf<Dim> &lower, Vecf<Dim> &upper) const {
+      if(this->local_bbox_.norm() == 0)
+        return false;
+      // The box is oriented along the line, its corners are at most |local_bbox| away from the line ends
+      const Vecf<Dim> margin = Vecf<Dim>::Constant(this->local_bbox_.norm() + epsilon_);
+      lower = p1_.cwiseMin(p2_) - margin;
+      upper = p1_.cwiseMax(p2_) + margin;
+      return true;
+    }
+
     /// Get the line
     vec_Vecf<Dim> get_line_segment() const {
       vec_Vecf<Dim> line;
@@ -0,0 +1,152 @@
+/**
+ * @file obstacle_grid.h
+ * @brief ObstacleGrid Class
+ */
+#ifndef OBSTACLE_GRID_H
+#define OBSTACLE_GRID_H
+
+#include <decomp_basis/data_type.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Obstacle Grid Class
+ *
+ * Buckets the obstacle points in a uniform grid once per map, so that each line segment only visits the points
+ * around its local bounding box instead of every point. Queries are read-only and may run in parallel.
+ */
+template <int Dim>
+class ObstacleGrid {
+  public:
+    ///Simple constructor
+    ObstacleGrid() {}
+    /**
+     * @brief Basic constructor
+     * @param obs Obstacle points
+     * @param cell_size Grid cell size, enlarged if the grid would have too many cells
+     */
+    ObstacleGrid(const vec_Vecf<Dim> &obs, decimal_t cell_size) { build(obs, cell_size); }
+
+    ///Bucket the obstacle points
+    void build(const vec_Vecf<Dim> &obs, decimal_t cell_size) {
+      points_ = obs;
+      cell_start_.clear();
+      cell_items_.clear();
+      if (points_.empty())
+        return;
+
+      origin_ = points_.front();
+      Vecf<Dim> upper = points_.front();
+      for (const auto &it : points_) {
+        origin_ = origin_.cwiseMin(it);
+        upper = upper.cwiseMax(it);
+      }
+
+      const int max_cells = Dim == 2 ? 512 : 64; // Per axis
+      const Vecf<Dim> extent = upper - origin_;
+      cell_size_ = std::max<decimal_t>(cell_size, extent.maxCoeff() / (max_cells - 1));
+      cell_size_ = std::max<decimal_t>(cell_size_, 1e-3);
+
+      size_t cells = 1;
+      for (int d = 0; d < Dim; d++) {
+        size_(d) = static_cast<int>(extent(d) / cell_size_) + 1;
+        cells *= size_(d);
+      }
+
+      // Counting sort of the point indices by cell, each cell keeps the input order
+      cell_start_.assign(cells + 1, 0);
+      for (const auto &it : points_)
+        cell_start_[cell_index(cell_of(it)) + 1]++;
+      for (size_t i = 1; i < cell_start_.size(); i++)
+        cell_start_[i] += cell_start_[i - 1];
+      cell_items_.resize(points_.size());
+      std::vector<int> fill(cell_start_.begin(), cell_start_.end() - 1);
+      for (size_t i = 0; i < points_.size(); i++)
+        cell_items_[fill[cell_index(cell_of(points_[i]))]++] = static_cast<int>(i);
+    }
+
+    ///Get all obstacle points
+    const vec_Vecf<Dim> &points() const { return points_; }
+
+    /**
+     * @brief Obstacle points inside the axis aligned box [lower, upper], in input order
+     *
+     * The result is the same as filtering points() with the box.
+     */
+    vec_Vecf<Dim> points_in_box(const Vecf<Dim> &lower, const Vecf<Dim> &upper) const {
+      vec_Vecf<Dim> result;
+      if (points_.empty())
+        return result;
+
+      Veci<Dim> first, last;
+      for (int d = 0; d < Dim; d++) {
+        first(d) = std::max(0, static_cast<int>(std::floor((lower(d) - origin_(d)) / cell_size_)));
+        last(d) = std::min(size_(d) - 1, static_cast<int>(std::floor((upper(d) - origin_(d)) / cell_size_)));
+        if (first(d) > last(d))
+          return result;
+      }
+
+      std::vector<int> indices;
+      Veci<Dim> cell = first;
+      while (true) {
+        // The cells along the first axis are consecutive
+        int begin = cell_start_[cell_index(cell)];
+        Veci<Dim> row_end = cell;
+        row_end(0) = last(0);
+        int end = cell_start_[cell_index(row_end) + 1];
+        for (int i = begin; i < end; i++) {
+          const auto &pt = points_[cell_items_[i]];
+          if ((pt.array() >= lower.array()).all() && (pt.array() <= upper.array()).all())
+            indices.push_back(cell_items_[i]);
+        }
+
+        int d = 1;
+        for (; d < Dim; d++) {
+          if (++cell(d) <= last(d))
+            break;
+          cell(d) = first(d);
+        }
+        if (d == Dim)
+          break;
+      }
+
+      std::sort(indices.begin(), indices.end());
+      result.reserve(indices.size());
+      for (int i : indices)
+        result.push_back(points_[i]);
+      return result;
+    }
+
+  protected:
+    Veci<Dim> cell_of(const Vecf<Dim> &pt) const {
+      Veci<Dim> cell;
+      for (int d = 0; d < Dim; d++)
+        cell(d) = std::min(size_(d) - 1, static_cast<int>((pt(d) - origin_(d)) / cell_size_));
+      return cell;
+    }
+
+    size_t cell_index(const Veci<Dim> &cell) const {
+      size_t index = 0;
+      for (int d = Dim - 1; d >= 0; d--)
+        index = index * size_(d) + cell(d);
+      return index;
+    }
+
+    /// Obstacle points, input
+    vec_Vecf<Dim> points_;
+
+    Vecf<Dim> origin_{Vecf<Dim>::Zero()};
+    decimal_t cell_size_{1};
+    Veci<Dim> size_{Veci<Dim>::Zero()};
+
+    /// Points of cell i are cell_items_[cell_start_[i] .. cell_start_[i + 1])
+    std::vector<int> cell_start_;
+    std::vector<int> cell_items_;
+};
+
+typedef ObstacleGrid<2> ObstacleGrid2D;
+
+typedef ObstacleGrid<3> ObstacleGrid3D;
+
+#endif
@@ -33,6 +33,16 @@ class SeedDecomp : public DecompBase<Dim> {
       add_local_bbox(this->polyhedron_);
     }
 
+    /// Axis aligned box around the local bounding box of the seed
+    bool local_bbox_bounds(Vecf<Dim> &lower, Vecf<Dim> &upper) const {
+      if(this->local_bbox_.norm() == 0)
+        return false;
+      const Vecf<Dim> margin = this->local_bbox_.cwiseAbs() + Vecf<Dim>::Constant(epsilon_);
+      lower = p_ - margin;
+      upper = p_ + margin;
+      return true;
+    }
+
     /// Get the center
     Vecf<Dim> get_seed() const {
       return p_;
@@ -12,6 +12,7 @@
 #define __ENVIRONMENT_H__
 
 #include <guidance_planner/types/types.h>
+#include <guidance_planner/obstacle_index.h>
 
 #include <Eigen/Dense>
 
@@ -46,6 +47,13 @@ namespace GuidancePlanner
     virtual bool IsVisible(const SpaceTimePoint &point_one, const SpaceTimePoint &point_two);
     virtual bool IsVisible(const Node &a, const Node &b); // Wrapper
 
+    /** @brief Smallest distance between the line from point_one to point_two and the dynamic obstacles (minus their radius),
+     * at most max_clearance. Negative (and returned early) exactly when IsVisible() is false */
+    double Clearance(const SpaceTimePoint &point_one, const SpaceTimePoint &point_two, double max_clearance = 1.);
+
+    /** @brief Distance between the line a + t * b (t in [0, 1], in (x, y, k)) and segment k -> k + 1 of an obstacle prediction */
+    static double SegmentDistance(const Eigen::Vector3d &a, const Eigen::Vector3d &b, const Obstacle &obstacle, int k);
+
     /** @brief Project a point from the obstacles with an additional margin */
     virtual void ProjectToFreeSpace(Eigen::Vector2d &point, int k, double with_margin = 0.);
     virtual void ProjectToFreeSpace(SpaceTimePoint &point, double with_margin = 0.); // wrapper
@@ -55,10 +63,18 @@ namespace GuidancePlanner
 
     virtual std::vector<Obstacle> &GetDynamicObstacles() { return dynamic_obstacles_; };
 
+    /** @brief Use the space-time obstacle index for collision and visibility queries (default), or check every obstacle */
+    void SetUseObstacleIndex(bool use_index) { use_index_ = use_index; }
+
   protected:
     std::vector<Obstacle> dynamic_obstacles_;
     std::vector<Halfspace> static_obstacles_;
 
+    ObstacleIndex index_; // Rebuilt in LoadObstacles
+    bool use_index_{true};
+
+    bool IndexValid() const { return use_index_ && index_.Valid(); }
+
     /** @brief Various implementations of visibility checks */
     virtual bool IsVisibleRayCast(const SpaceTimePoint &point_one, const SpaceTimePoint &point_two); // Fast for constant velocity prediction
     virtual bool IsVisibleRaySampling(const SpaceTimePoint &point_one, const SpaceTimePoint &point_two);
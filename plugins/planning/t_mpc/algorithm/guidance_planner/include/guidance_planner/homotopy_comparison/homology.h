@@ -30,6 +30,15 @@ namespace GuidancePlanner
 #define HSIGNATURE_RANGE 250.0
 
   struct GSLParams;
+
+  /**
+   * @brief H-signature comparison of paths
+   *
+   * The H-value of a path w.r.t. an obstacle is the sum of integrals over its segments. These integrals are cached per
+   * obstacle loop, keyed by the segment end points, so that every segment is integrated once per iteration no matter in
+   * how many comparisons it appears. Missing integrals are computed in parallel. Obstacles that did not change keep their
+   * integrals for the next iteration (e.g., static obstacles and nodes that did not move).
+   */
   class Homology : public HomotopyComparison
   {
   public:
@@ -42,6 +51,15 @@ namespace GuidancePlanner
     /** @brief Get the cost between two paths in the given environment */
     double GetCost(const GeometricPath &a, const GeometricPath &b, Environment &environment);
 
+    /**
+     * @brief Integrate all segments of these paths in one parallel pass, so that comparing them afterwards only adds cached values
+     * @note Covers the comparisons AreEquivalent(*paths[i], *paths[j], ...) with i < j. Other comparisons integrate what they miss.
+     */
+    void Prepare(const std::vector<const GeometricPath *> &paths, Environment &environment) override;
+
+    /** @brief The H-value of the path w.r.t. each obstacle */
+    std::vector<double> HSignature(const GeometricPath &path, Environment &environment);
+
     /**
      * @brief Check if the path passes left or right by comparing with a "left-always" trajectory. Relies on a somewhat heuristic definition of what is "left".
      *
@@ -54,26 +72,64 @@ namespace GuidancePlanner
     /** @brief Visualize obstacle and trajectory loops for homology computation */
     void Visualize(Environment &environment) override;
 
-    /** @brief Clear the cache */
-    void Clear() override
+    /** @brief Start a new iteration: obstacles are reloaded, integrals over unchanged obstacles are kept for one iteration */
+    void Clear() override;
+
+    int Reused() const { return reused_; }
+    int Computed() const { return computed_; }
+
+  private:
+    struct Segment
     {
-      cached_values_.clear();
-      obstacle_points_ready_ = false;
-      obstacle_points_.clear();
+      Eigen::Vector3d start, end;
+
+      bool operator==(const Segment &other) const { return start == other.start && end == other.end; }
     };
 
-  private:
-    /** @brief Integrate the H-value over a geometric path (with cached values) */
-    double PathHValue(const GeometricPath &path, std::vector<double> &cached_h, const int obstacle_id);
+    struct SegmentHash
+    {
+      size_t operator()(const Segment &segment) const;
+    };
+
+    typedef std::unordered_map<Segment, double, SegmentHash> SegmentValues;
+
+    struct ObstacleLoop
+    {
+      std::vector<Eigen::Vector3d> points;
+      SegmentValues values;          // Integrals used in this iteration
+      SegmentValues previous_values; // Integrals used in the previous iteration (only if the loop did not change)
+    };
+
+    struct IntegrationJob
+    {
+      const std::vector<Eigen::Vector3d> *loop;
+      const Segment *segment;
+      double *result;
+    };
+
+    /** @brief Append the segments between the integration nodes of the path */
+    static void AddPathSegments(const GeometricPath &path, std::vector<Segment> &segments);
+
+    /** @brief Make sure that every segment is integrated over every obstacle loop */
+    void IntegrateSegments(const std::vector<Segment> &segments);
+
+    /** @brief Sum of the cached integrals of the given segments over obstacle o */
+    double SumSegments(int o, std::vector<Segment>::const_iterator begin, std::vector<Segment>::const_iterator end) const;
+
+    /** @brief H-value over obstacle o of the loop: path a, end of a to end of b, path b reversed */
+    void LoadComparison(const GeometricPath &a, const GeometricPath &b, Environment &environment);
+    double ComparisonHValue(int o) const;
 
     /** @brief Integrate the H-value in a point over an obstacle */
-    double ObstacleHValue(const Eigen::Vector3d &r, const Eigen::Vector3d &dr);
+    static double ObstacleHValue(const std::vector<Eigen::Vector3d> &loop, const Eigen::Vector3d &r, const Eigen::Vector3d &dr);
 
     /** @brief Integrate the H-value in a point over a segment of an obstacle */
-    double SegmentHValue(const Eigen::Vector3d &start, const Eigen::Vector3d &end, const Eigen::Vector3d &r, const Eigen::Vector3d &dr);
+    static double SegmentHValue(const Eigen::Vector3d &start, const Eigen::Vector3d &end, const Eigen::Vector3d &r, const Eigen::Vector3d &dr);
+
+    /** @brief Integrate the H-value over a path segment (thread-safe) */
+    static double Integrate(const std::vector<Eigen::Vector3d> &loop, const Segment &segment);
 
     void ComputeObstacleLoops(const std::vector<Obstacle> &obstacles);
-    void LoadObstacle(int i);
 
     /** @brief Function that integrates the H value over a segment */
     static double GSLHValue(double x, void *params);
@@ -86,26 +142,24 @@ namespace GuidancePlanner
     };
 
   private:
-    std::vector<gsl_integration_workspace *> gsl_ws_;
-    std::vector<gsl_function> gsl_f_;
-    std::vector<GSLParams> gsl_params_;
+    bool assume_constant_velocity_;
+    bool obstacle_loops_ready_ = false;
+    std::vector<ObstacleLoop> loops_;          // One per obstacle
+    std::vector<ObstacleLoop> previous_loops_; // Loops of the previous iteration, matched to the new obstacles by their points
 
-    /** Cached H-Values (over all obstacles) */
-    std::unordered_map<GeometricPath, std::vector<double>> cached_values_;
+    std::vector<IntegrationJob> jobs_;
+    std::vector<Segment> segments_; // Path a, path b and the connection of their end points
+    size_t segments_a_{0}, segments_b_{0};
 
-    bool assume_constant_velocity_;
-    bool obstacle_points_ready_ = false;
-    std::vector<std::vector<Eigen::Vector3d>> obstacle_points_; // For efficiency (4 x num_obstacles)
+    int reused_{0}, computed_{0};
 
-    /** Parameters for obstacle integration */
-    std::vector<Eigen::Vector3d> obstacle_segments_;
     double fraction_;
   };
 
   struct GSLParams
   {
     Eigen::Vector3d start, end;
-    Homology *homology_class;
+    const std::vector<Eigen::Vector3d> *loop;
   };
 
 } // namespace Homotopy
@@ -20,6 +20,13 @@ namespace GuidancePlanner
       return std::vector<bool>({});
     };
 
+    /** @brief Called before comparing these paths with each other, so that their comparison data can be computed at once */
+    virtual void Prepare(const std::vector<const GeometricPath *> &paths, Environment &environment)
+    {
+      (void)paths;
+      (void)environment;
+    };
+
     virtual void Visualize(Environment &environment) { (void)environment; };
     virtual void Clear() {};
   };
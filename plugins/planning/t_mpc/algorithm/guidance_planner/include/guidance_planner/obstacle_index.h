@@ -0,0 +1,134 @@
+/**
+ * @file obstacle_index.h
+ * @brief Space-time buckets of the obstacle predictions for collision and visibility queries
+ *
+ * Rebuilt on every Environment::LoadObstacles(). For each time step the obstacle positions, and the midpoints of their
+ * segments to the next step, are sorted by (x, y) grid cell. A query then only visits the obstacles in the cells around
+ * it instead of every obstacle at every step. Queries are read-only and may run in parallel.
+ */
+#ifndef __OBSTACLE_INDEX_H__
+#define __OBSTACLE_INDEX_H__
+
+#include <guidance_planner/types/types.h>
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace GuidancePlanner
+{
+  class ObstacleIndex
+  {
+  public:
+    /** @brief Bucket the obstacles. The index stays invalid if a prediction is shorter than N + 1 or not finite */
+    void Build(const std::vector<Obstacle> &obstacles);
+
+    bool Valid() const { return valid_; }
+    double MaxRadius() const { return max_radius_; }
+
+    /** @brief visit(o) for every obstacle whose position at step k may be closer than range to point. Stops when visit returns false */
+    template <typename Visit>
+    bool ForPositionsNear(const Eigen::Vector2d &point, int k, double range, Visit &&visit) const
+    {
+      range += EPSILON;
+      return ForCells(positions_, k, point - Eigen::Vector2d(range, range), point + Eigen::Vector2d(range, range), visit);
+    }
+
+    /**
+     * @brief visit(o, k) for every obstacle segment k -> k + 1 that may be closer than range to the line a + s * b (s in [0, 1])
+     * in (x, y, k) space. Stops when visit returns false.
+     */
+    template <typename Visit>
+    bool ForSegmentsNear(const Eigen::Vector3d &a, const Eigen::Vector3d &b, double range, Visit &&visit) const
+    {
+      range += EPSILON;
+      double t_min = std::min(a(2), a(2) + b(2));
+      double t_max = std::max(a(2), a(2) + b(2));
+
+      // Segment k spans [k, k + 1] in time, so only the part of the line within range of that interval can reach it
+      int k_first = std::max(0, (int)std::ceil(t_min - range - 1.));
+      int k_last = std::min(steps_ - 1, (int)std::floor(t_max + range));
+      double reach = range + max_half_segment_; // Segments are bucketed by their midpoint
+
+      for (int k = k_first; k <= k_last; k++)
+      {
+        double s_min = 0., s_max = 1.;
+        if (std::abs(b(2)) > 1e-12)
+        {
+          double s_lo = (k - range - a(2)) / b(2);
+          double s_hi = (k + 1. + range - a(2)) / b(2);
+          s_min = std::max(0., std::min(s_lo, s_hi));
+          s_max = std::min(1., std::max(s_lo, s_hi));
+          if (s_min > s_max)
+            continue;
+        }
+        else if (a(2) < k - range || a(2) > k + 1. + range)
+        {
+          continue;
+        }
+
+        Eigen::Vector2d p_min = a.head<2>() + s_min * b.head<2>();
+        Eigen::Vector2d p_max = a.head<2>() + s_max * b.head<2>();
+        Eigen::Vector2d lower = p_min.cwiseMin(p_max) - Eigen::Vector2d(reach, reach);
+        Eigen::Vector2d upper = p_min.cwiseMax(p_max) + Eigen::Vector2d(reach, reach);
+
+        if (!ForCells(segments_, k, lower, upper, [&](int o)
+                      { return visit(o, k); }))
+          return false;
+      }
+      return true;
+    }
+
+  private:
+    static constexpr double EPSILON = 1e-6;
+    static constexpr int MAX_CELLS = 64; // Per axis
+
+    typedef std::pair<int64_t, int> Entry; // (layer and cell, obstacle)
+
+    int64_t Key(int layer, int i_x, int i_y) const { return ((int64_t)layer * size_y_ + i_y) * size_x_ + i_x; }
+    int CellX(double x) const { return (int)std::floor((x - origin_(0)) / cell_size_); }
+    int CellY(double y) const { return (int)std::floor((y - origin_(1)) / cell_size_); }
+
+    template <typename Visit>
+    bool ForCells(const std::vector<Entry> &entries, int layer, const Eigen::Vector2d &lower, const Eigen::Vector2d &upper, Visit &&visit) const
+    {
+      if (upper(0) < origin_(0) || lower(0) > max_(0) || upper(1) < origin_(1) || lower(1) > max_(1))
+        return true;
+
+      int x_first = std::max(0, CellX(std::max(lower(0), origin_(0))));
+      int x_last = std::min(size_x_ - 1, CellX(std::min(upper(0), max_(0))));
+      int y_first = std::max(0, CellY(std::max(lower(1), origin_(1))));
+      int y_last = std::min(size_y_ - 1, CellY(std::min(upper(1), max_(1))));
+
+      for (int i_y = y_first; i_y <= y_last; i_y++) // Cells of one row are consecutive keys
+      {
+        int64_t last = Key(layer, x_last, i_y);
+        auto it = std::lower_bound(entries.begin(), entries.end(), Entry(Key(layer, x_first, i_y), -1));
+        for (; it != entries.end() && it->first <= last; ++it)
+        {
+          if (!visit(it->second))
+            return false;
+        }
+      }
+      return true;
+    }
+
+    bool valid_{false};
+    int steps_{0};
+
+    Eigen::Vector2d origin_, max_;
+    double cell_size_{1.};
+    int size_x_{1}, size_y_{1};
+
+    double max_radius_{0.};
+    double max_half_segment_{0.};
+
+    std::vector<Entry> positions_; // Layer k: positions at step k
+    std::vector<Entry> segments_;  // Layer k: midpoints of segment k -> k + 1
+  };
+}
+#endif // __OBSTACLE_INDEX_H__
@@ -0,0 +1,30 @@
+/**
+ * @file parallel.h
+ * @brief Parallel loops of the guidance planner and the T-MPC modules
+ *
+ * By default the loops run with OpenMP (or serially without it). A host application can install its own executor,
+ * e.g., a persistent worker pool, so that the parallel solves do not spin up thread teams every control iteration.
+ */
+
+#ifndef GUIDANCE_PLANNER_PARALLEL_H
+#define GUIDANCE_PLANNER_PARALLEL_H
+
+#include <functional>
+
+namespace GuidancePlanner
+{
+  /** @brief Runs body(0), ..., body(n - 1) and returns when all have finished */
+  using ParallelExecutor = std::function<void(int n, const std::function<void(int)> &body)>;
+
+  /** @brief Install the executor used by ParallelFor (an empty executor restores the default) */
+  void SetParallelExecutor(ParallelExecutor executor);
+
+  /**
+   * @brief Run body(i) for i in [0, n) in parallel
+   * @note Iteration i is always dispatched to the same worker of the installed executor (if it supports this), so that
+   * per-solver data stays on the same core.
+   */
+  void ParallelFor(int n, const std::function<void(int)> &body);
+}
+
+#endif // GUIDANCE_PLANNER_PARALLEL_H
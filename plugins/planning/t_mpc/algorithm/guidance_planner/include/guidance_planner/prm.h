@@ -14,6 +14,7 @@
 #include <guidance_planner/cubic_spline.h>
 #include <guidance_planner/graph_search.h>
 #include <guidance_planner/config.h>
+#include <guidance_planner/visibility_cache.h>
 
 #include <guidance_planner/types/paths.h>
 
@@ -81,6 +82,9 @@ namespace GuidancePlanner
     /** @brief Are paths a, b in an equivalent topology class */
     bool AreHomotopicEquivalent(const GeometricPath &a, const GeometricPath &b);
 
+    /** @brief Prepare comparing these paths with each other (in order, i.e., AreHomotopicEquivalent(paths[i], paths[j]) with i < j) */
+    void PrepareHomotopicComparison(const std::vector<const GeometricPath *> &paths);
+
     /** @brief Do we prefer the first path or the second path */
     bool FirstPathIsBetter(const GeometricPath &new_path, const GeometricPath &old_path);
 
@@ -103,12 +107,13 @@ namespace GuidancePlanner
   private:
     void SampleNewPoints();
 
-    void FindVisibleGuards(SpaceTimePoint sample, std::vector<Node *> &visible_guards);
+    /** @brief Guards visible from the sample, in graph order. Stops after three: such a sample is never added */
+    void FindVisibleGuards(const SpaceTimePoint &sample, int roadmap_key, std::vector<Node *> &visible_guards);
     bool IsGoalVisible(SpaceTimePoint sample, int goal_index) const;
     Node *CheckGoalConnection(Node &new_node, Node *guard, Node *goal) const;
 
-    void AddSample(int i, SpaceTimePoint &sample, const std::vector<Node *> guards, bool sample_is_from_previous_iteration);
-    void AddGuard(int i, SpaceTimePoint &sample);
+    void AddSample(int i, SpaceTimePoint &sample, const std::vector<Node *> guards, bool sample_is_from_previous_iteration, int roadmap_key);
+    void AddGuard(int i, SpaceTimePoint &sample, int roadmap_key);
     void AddNewConnector(Node &new_node, const std::vector<Node *> &visible_guards);
     void ReplaceConnector(Node &new_node, Node *neighbour, const std::vector<Node *> &visible_guards);
 
@@ -133,6 +138,12 @@ namespace GuidancePlanner
     std::shared_ptr<Sampler> sampler_;
 
     std::vector<Node> previous_nodes_; // Save nodes from previous iterations to enforce consistency between multiple iterations
+    bool nodes_propagated_{false};     // Were previous_nodes_ propagated after the last Update()?
+
+    VisibilityCache visibility_cache_; // Sample-guard visibility of propagated nodes, reused between iterations
+    std::vector<Node *> guards_;       // Guards of graph_ (including the start) in graph order
+    std::vector<std::pair<double, size_t>> guard_order_; // (squared distance, index in guards_)
+    std::vector<size_t> visible_guard_indices_;
 
     // Real-time data
     std::shared_ptr<Environment> environment_;
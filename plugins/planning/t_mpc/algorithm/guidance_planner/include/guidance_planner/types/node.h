@@ -31,6 +31,8 @@ namespace GuidancePlanner
 
         int belongs_to_path_ = -1; /** @note Set a posteriori for visualization */
 
+        int roadmap_key_ = -1; // Identifies the node across PRM iterations while its position is unchanged (-1: none)
+
         std::vector<Node *> neighbours_; // Neighbouring nodes
 
         Node(int id, const SpaceTimePoint &point, const NodeType &node_type);
@@ -0,0 +1,69 @@
+/**
+ * @file visibility_cache.h
+ * @brief Reuse PRM visibility checks between iterations
+ *
+ * Nodes propagated to the next PRM iteration keep their position and only move down in time by the control period,
+ * so in absolute time the line between two of them is unchanged. If it was visible with a clearance c, it stays
+ * visible as long as no obstacle segment moved more than c: only segments that moved further are checked again.
+ * Results are identical to Environment::IsVisible (ray cast).
+ */
+#ifndef __VISIBILITY_CACHE_H__
+#define __VISIBILITY_CACHE_H__
+
+#include <guidance_planner/types/types.h>
+
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace GuidancePlanner
+{
+  class Environment;
+
+  class VisibilityCache
+  {
+  public:
+    /**
+     * @brief Start a new iteration: compare the obstacles with those of the previous iteration
+     *
+     * @param obstacles The obstacles loaded in the environment for this iteration
+     * @param time_shift How many steps the previous iteration's nodes were moved down in time
+     * @param nodes_were_propagated False if the nodes were not propagated since the last call (cached lines are dropped)
+     */
+    void Update(const std::vector<Obstacle> &obstacles, double time_shift, bool nodes_were_propagated);
+
+    /** @brief Same result as environment.IsVisible(a, b), reused from the previous iteration when both nodes have a key */
+    bool IsVisible(Environment &environment, const Node &a, const Node &b);
+
+    /** @brief A key for a node that is new or moved in space */
+    int NewKey()
+    {
+      int key = next_key_;
+      next_key_ = next_key_ == std::numeric_limits<int>::max() ? 0 : next_key_ + 1;
+      return key;
+    }
+
+    /** @brief Forget all cached lines and obstacles */
+    void Clear();
+
+    int Reused() const { return reused_; }
+    int Checked() const { return checked_; }
+
+  private:
+    double Revalidate(Environment &environment, const Node &a, const Node &b, double previous_clearance) const;
+
+    /** @brief Upper bound on how far segment k -> k + 1 of an obstacle moved w.r.t. the previous prediction */
+    static double SegmentMotion(const Obstacle &previous, const Obstacle &current, int k, double time_shift);
+
+    std::unordered_map<uint64_t, double> clearance_;          // Visible lines found in this iteration
+    std::unordered_map<uint64_t, double> previous_clearance_; // Visible lines found in the previous iteration
+
+    std::vector<Obstacle> previous_obstacles_;
+    std::vector<std::vector<double>> motion_; // [obstacle][k]
+
+    int next_key_{0};
+    int reused_{0}, checked_{0};
+  };
+}
+#endif // __VISIBILITY_CACHE_H__
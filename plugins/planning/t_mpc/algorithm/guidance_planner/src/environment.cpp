@@ -1,6 +1,7 @@
 #include "guidance_planner/environment.h"
 
 #include <guidance_planner/utils.h>
+#include <guidance_planner/parallel.h>
 
 #include <ros_tools/math.h>
 
@@ -12,13 +13,22 @@ namespace GuidancePlanner
 
   bool Environment::InCollision(const SpaceTimePoint &point, double with_margin)
   {
-
-    for (auto &obstacle : dynamic_obstacles_)
+    int k = std::round(point.Time()); // Round the time index to the nearest integer
+    if (IndexValid() && k >= 0 && k <= Config::N)
     {
-      // Round the time index to the nearest integer
-      if (RosTools::distance(obstacle.positions_[std::round(point.Time())], point.Pos()) < obstacle.radius_ + with_margin) // Note that the obstacle positions at k = 0 is the initial state
+      bool collision = !index_.ForPositionsNear(point.Pos(), k, index_.MaxRadius() + with_margin, [&](int o)
+                                                { return RosTools::distance(dynamic_obstacles_[o].positions_[k], point.Pos()) >= dynamic_obstacles_[o].radius_ + with_margin; });
+      if (collision)
         return true;
     }
+    else
+    {
+      for (auto &obstacle : dynamic_obstacles_)
+      {
+        if (RosTools::distance(obstacle.positions_[std::round(point.Time())], point.Pos()) < obstacle.radius_ + with_margin) // Note that the obstacle positions at k = 0 is the initial state
+          return true;
+      }
+    }
 
     for (auto &halfspace : static_obstacles_)
     {
@@ -34,6 +44,8 @@ namespace GuidancePlanner
 
     dynamic_obstacles_ = dynamic_obstacles;
     static_obstacles_ = static_obstacles;
+
+    index_.Build(dynamic_obstacles_);
   }
 
   bool Environment::IsVisible(const Node &a, const Node &b) { return IsVisible(a.point_, b.point_); }
@@ -49,45 +61,82 @@ namespace GuidancePlanner
 
     /** @note raycast implementation: scales with horizon length */
     /*https: // math.stackexchange.com/questions/2213165/find-shortest-distance-between-lines-in-3d (second solution )*/
-    Eigen::Vector3d a, b, c, d, e;
-    double A;
-    double dist;
+    Eigen::Vector3d a, b;
 
     a = point_one.PosTime();
     b = (point_two - point_one).PosTime();
 
+    if (IndexValid()) // Only the obstacle segments near the line
+    {
+      return index_.ForSegmentsNear(a, b, index_.MaxRadius(), [&](int o, int k)
+                                    { return !(SegmentDistance(a, b, dynamic_obstacles_[o], k) < dynamic_obstacles_[o].radius_); });
+    }
+
     for (auto &obstacle : dynamic_obstacles_)
     {
       if (obstacle.positions_.size() < 2)
         continue;
       for (int k = 0; k < Config::N; k++) // For constant velocity, only one line segment
       {
-        c = Eigen::Vector3d(obstacle.positions_[k](0), obstacle.positions_[k](1), k);
-        d = Eigen::Vector3d(obstacle.positions_[k + 1](0), obstacle.positions_[k + 1](1), k + 1) - c;
-        // c = Eigen::Vector3d(obstacle.positions_[0](0), obstacle.positions_[0](1), 0);
-        // d = Eigen::Vector3d(obstacle.positions_.back()(0), obstacle.positions_.back()(1), Config::N) - c;
+        if (SegmentDistance(a, b, obstacle, k) < obstacle.radius_)
+          return false;
+      }
+    }
 
-        e = a - c;
+    return true;
+  }
 
-        A = -(b.dot(b) * d.dot(d) - std::pow(b.dot(d), 2.));
+  double Environment::Clearance(const SpaceTimePoint &point_one, const SpaceTimePoint &point_two, double max_clearance)
+  {
+    Eigen::Vector3d a = point_one.PosTime();
+    Eigen::Vector3d b = (point_two - point_one).PosTime();
 
-        double s = (-(b.dot(b)) * (d.dot(e)) + (b.dot(e)) * (d.dot(b))) / A;
-        double t = ((d.dot(d)) * (b.dot(e)) - (d.dot(e)) * (d.dot(b))) / A;
+    double clearance = max_clearance;
+    if (IndexValid()) // Segments outside of the searched range have at least max_clearance
+    {
+      index_.ForSegmentsNear(a, b, index_.MaxRadius() + max_clearance, [&](int o, int k)
+                             {
+        clearance = std::min(clearance, SegmentDistance(a, b, dynamic_obstacles_[o], k) - dynamic_obstacles_[o].radius_);
+        return !(clearance < 0.); });
+      return clearance;
+    }
 
-        s = std::max(0., std::min(s, 1.));
-        t = std::max(0., std::min(t, 1.));
+    for (auto &obstacle : dynamic_obstacles_)
+    {
+      if (obstacle.positions_.size() < 2)
+        continue;
+      for (int k = 0; k < Config::N; k++)
+      {
+        double dist = SegmentDistance(a, b, obstacle, k) - obstacle.radius_;
+        if (dist < 0.)
+          return dist;
+        clearance = std::min(clearance, dist);
+      }
+    }
+    return clearance;
+  }
 
-        // std::cout << "s: " << s << ", t: " << t << std::endl;
-        dist = (e + b * t - d * s).norm();
+  double Environment::SegmentDistance(const Eigen::Vector3d &a, const Eigen::Vector3d &b, const Obstacle &obstacle, int k)
+  {
+    Eigen::Vector3d c, d, e;
+    double A;
 
-        // std::cout << "distance: " << dist << std::endl;
+    c = Eigen::Vector3d(obstacle.positions_[k](0), obstacle.positions_[k](1), k);
+    d = Eigen::Vector3d(obstacle.positions_[k + 1](0), obstacle.positions_[k + 1](1), k + 1) - c;
+    // c = Eigen::Vector3d(obstacle.positions_[0](0), obstacle.positions_[0](1), 0);
+    // d = Eigen::Vector3d(obstacle.positions_.back()(0), obstacle.positions_.back()(1), Config::N) - c;
 
-        if (dist < obstacle.radius_)
-          return false;
-      }
-    }
+    e = a - c;
 
-    return true;
+    A = -(b.dot(b) * d.dot(d) - std::pow(b.dot(d), 2.));
+
+    double s = (-(b.dot(b)) * (d.dot(e)) + (b.dot(e)) * (d.dot(b))) / A;
+    double t = ((d.dot(d)) * (b.dot(e)) - (d.dot(e)) * (d.dot(b))) / A;
+
+    s = std::max(0., std::min(s, 1.));
+    t = std::max(0., std::min(t, 1.));
+
+    return (e + b * t - d * s).norm();
   }
 
   /** Spawn a line between a and b, take steps along the line, discretize the time axis and validate collisions */
@@ -213,9 +262,8 @@ namespace GuidancePlanner
     size_x_ = new_size_x;
     size_y_ = new_size_y;
 
-#pragma omp parallel for num_threads(8)
-    for (size_t k = 0; k < grid_.size(); k++)
-    {
+    ParallelFor(static_cast<int>(grid_.size()), [&](int k)
+                {
       // Initialize
       grid_[k].resize(size_x_);
 
@@ -224,8 +272,7 @@ namespace GuidancePlanner
         grid_[k][i_x].resize(size_y_);
         for (size_t i_y = 0; i_y < grid_[k][i_x].size(); i_y++)
           grid_[k][i_x][i_y].reserve(2);
-      }
-    }
+      } });
   }
 
   void GriddedEnvironment::ObstacleGrid::SetOrigin(const Eigen::Vector2d &pos)
@@ -236,15 +283,13 @@ namespace GuidancePlanner
 
   void GriddedEnvironment::ObstacleGrid::Clear()
   {
-#pragma omp parallel for num_threads(8)
-    for (size_t k = 0; k < grid_.size(); k++)
-    {
+    ParallelFor(static_cast<int>(grid_.size()), [&](int k)
+                {
       for (size_t i_x = 0; i_x < grid_[k].size(); i_x++)
       {
         for (size_t i_y = 0; i_y < grid_[k][i_x].size(); i_y++)
           grid_[k][i_x][i_y].clear();
-      }
-    }
+      } });
   }
 
   void GriddedEnvironment::ObstacleGrid::InsertObstacle(int k, const SingleObstacle &obstacle)
@@ -252,8 +297,7 @@ namespace GuidancePlanner
     int i_x, i_y;
     GetGridIndices(obstacle.position, i_x, i_y);
 
-    // Add the obstacle in all neighbouring cells
-#pragma omp parallel for num_threads(8)
+    // Add the obstacle in all neighbouring cells (3x3 cells, not worth a parallel region)
     for (int i = -1; i <= 1; i++)
     {
       for (int j = -1; j <= 1; j++)
@@ -8,13 +8,12 @@
 
 #include <guidance_planner/utils.h>
 #include <guidance_planner/types/paths.h>
+#include <guidance_planner/parallel.h>
 
 #include <ros_tools/profiling.h>
 #include <ros_tools/data_saver.h>
 #include <ros_tools/logging.h>
 
-#include <omp.h>
-
 namespace GuidancePlanner
 {
   GlobalGuidance::OutputTrajectory::OutputTrajectory(const GeometricPath &_path, const CubicSpline3D &_spline)
@@ -272,13 +271,11 @@ namespace GuidancePlanner
         cur_paths.resize(graph.goal_nodes_.size());
 
         // Search for n_paths to each goal
-#pragma omp parallel for num_threads(8)
-        for (size_t g = 0; g < graph.goal_nodes_.size(); g++)
-        {
+        ParallelFor(static_cast<int>(graph.goal_nodes_.size()), [&](int g)
+                    {
           std::vector<Node *> L = {graph.start_node_};
 
-          graph_search_.Search(graph, config_->n_paths_, L, cur_paths[g], graph.goal_nodes_[g]); // Find paths via a graph-search
-        }
+          graph_search_.Search(graph, config_->n_paths_, L, cur_paths[g], graph.goal_nodes_[g]); }); // Find paths via a graph-search
 
         // Join all paths
         for (auto &cur_path : cur_paths)
@@ -421,6 +418,14 @@ namespace GuidancePlanner
     for (auto &previous_output : previous_outputs_)
       id_assigner_.MarkIDAsUsed(previous_output.topology_class); // Mark all previous IDs as used
 
+    // Integrate the paths in one pass (new outputs are compared with previous outputs)
+    std::vector<const GeometricPath *> compared_paths;
+    for (auto &output : outputs)
+      compared_paths.push_back(&output.path.path);
+    for (auto &previous_output : previous_outputs_)
+      compared_paths.push_back(&previous_output.path.path);
+    prm_.PrepareHomotopicComparison(compared_paths);
+
     // Find previously existing topology classes in the new outputs
     int previous_outputs_identified = 0;
     for (auto &output : outputs)
@@ -616,6 +621,12 @@ namespace GuidancePlanner
 
     /** @note paths are sorted, so that the first occurence in the list is the best path and all equivalent further paths can be removed in favor of the first */
 
+    // Integrate all paths in one pass, the comparisons below then only add cached values
+    std::vector<const GeometricPath *> compared_paths;
+    for (auto &path : paths)
+      compared_paths.push_back(&path);
+    prm_.PrepareHomotopicComparison(compared_paths);
+
     std::vector<GeometricPath> topology_distinct_paths; // Construct a new list with topology distinct paths
     topology_distinct_paths.emplace_back(paths.front());
 
@@ -1,6 +1,11 @@
 #include "guidance_planner/homotopy_comparison/homology.h"
 
 #include <guidance_planner/environment.h>
+#include <guidance_planner/parallel.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 
 // Visualization is disabled in non-ROS builds
 #ifdef MPC_PLANNER_ROS
@@ -9,72 +14,60 @@
 
 namespace GuidancePlanner
 {
-  Homology::Homology(bool assume_constant_velocity)
-      : assume_constant_velocity_(assume_constant_velocity)
+  namespace
   {
-    // Initialize workspace, parameters, functions
-    // For multithreading!
-    gsl_ws_.resize(8);
-    gsl_params_.resize(8);
-    gsl_f_.resize(8);
-    for (int i = 0; i < 8; i++)
-    {
-      gsl_ws_[i] = gsl_integration_workspace_alloc(GSL_POINTS);
-      gsl_params_[i].homology_class = this;
+    constexpr int JOBS_PER_TASK = 8; // Integrals per parallel task
 
-      gsl_f_[i].function = &Homology::GSLHValue;
-      gsl_f_[i].params = &gsl_params_[i];
+    /** @brief One integration workspace per thread */
+    gsl_integration_workspace *ThreadWorkspace()
+    {
+      struct Workspace
+      {
+        Workspace() : workspace(gsl_integration_workspace_alloc(GSL_POINTS)) {}
+        ~Workspace() { gsl_integration_workspace_free(workspace); }
+        gsl_integration_workspace *workspace;
+      };
+      thread_local Workspace workspace;
+      return workspace.workspace;
     }
+  }
 
+  Homology::Homology(bool assume_constant_velocity)
+      : assume_constant_velocity_(assume_constant_velocity)
+  {
     fraction_ = 1. / ((double)Config::N);
   }
 
   Homology::~Homology()
   {
+  }
 
-    for (int i = 0; i < 8; i++)
+  size_t Homology::SegmentHash::operator()(const Segment &segment) const
+  {
+    size_t seed = 0;
+    for (const Eigen::Vector3d *point : {&segment.start, &segment.end})
     {
-      gsl_integration_workspace_free(gsl_ws_[i]);
+      for (int i = 0; i < 3; i++)
+      {
+        uint64_t bits;
+        double value = (*point)(i) + 0.; // -0. and 0. hash the same
+        std::memcpy(&bits, &value, sizeof(bits));
+        seed ^= std::hash<uint64_t>()(bits) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
     }
+    return seed;
   }
 
   /** @brief: https://link.springer.com/article/10.1007/s10514-012-9304-1 */
   bool Homology::AreEquivalent(const GeometricPath &a, const GeometricPath &b, Environment &environment, bool compute_all)
   {
     bool equivalent = true;
-    // Retrieve cached h values over the obstacles (i.e., a vector)
-    std::vector<double> &cached_a = cached_values_[a]; // Note: will create the cache if it does not exist
-    std::vector<double> &cached_b = cached_values_[b]; // Note: will create the cache if it does not exist
-
-    auto &obstacles = environment.GetDynamicObstacles();
-    double h;
-
-    ComputeObstacleLoops(obstacles);
+    LoadComparison(a, b, environment);
 
     // For each obstacle
-    for (size_t obstacle_id = 0; obstacle_id < obstacles.size(); obstacle_id++)
+    for (size_t obstacle_id = 0; obstacle_id < loops_.size(); obstacle_id++)
     {
-      LoadObstacle(obstacle_id);
-
-      // Initialize the integration
-      h = 0;
-      h += PathHValue(a, cached_a, obstacle_id); // Integrate over path A
-
-      // Connect end points of a and b
-      {
-        gsl_params_[0].start = a.GetEnd()->point_.PosTime();
-        gsl_params_[0].end = b.GetEnd()->point_.PosTime();
-
-        // double result = 0.;
-        // NumericalIntegration(result, &gsl_params_[0]);
-
-        double result, error;
-        gsl_integration_qag(&gsl_f_[0], 0, 1, GSL_ACCURACY, 0, GSL_POINTS, GSL_INTEG_GAUSS15, gsl_ws_[0], &result, &error);
-
-        h += result;
-      }
-
-      h -= PathHValue(b, cached_b, obstacle_id); // Integrate over path B
+      double h = ComparisonHValue(obstacle_id);
 
       // If it is not zero, then these paths are homology distinct!
       if (std::abs(h) >= 1e-1)
@@ -93,42 +86,135 @@ namespace GuidancePlanner
   /** @brief: https://link.springer.com/article/10.1007/s10514-012-9304-1 */
   double Homology::GetCost(const GeometricPath &a, const GeometricPath &b, Environment &environment)
   {
-    // Retrieve cached h values over the obstacles (i.e., a vector)
-    std::vector<double> &cached_a = cached_values_[a]; // Note: will create the cache if it does not exist
-    std::vector<double> &cached_b = cached_values_[b]; // Note: will create the cache if it does not exist
+    double h_total = 0;
+    LoadComparison(a, b, environment);
 
-    auto &obstacles = environment.GetDynamicObstacles();
-    double h, h_total = 0;
+    for (size_t obstacle_id = 0; obstacle_id < loops_.size(); obstacle_id++)
+      h_total += abs(ComparisonHValue(obstacle_id));
 
-    ComputeObstacleLoops(obstacles);
+    return sqrt(h_total); // If none of them are distinct, then the two paths are homology equivalent!
+  }
 
-    // For each obstacle
-    for (size_t obstacle_id = 0; obstacle_id < obstacles.size(); obstacle_id++)
+  void Homology::Prepare(const std::vector<const GeometricPath *> &paths, Environment &environment)
+  {
+    ComputeObstacleLoops(environment.GetDynamicObstacles());
+
+    segments_.clear();
+    for (auto *path : paths)
+      AddPathSegments(*path, segments_);
+
+    // Paths are compared by connecting their end points (earlier paths come first in the comparison)
+    for (size_t i = 0; i < paths.size(); i++)
     {
-      LoadObstacle(obstacle_id);
+      for (size_t j = i + 1; j < paths.size(); j++)
+        segments_.push_back(Segment{paths[i]->GetEnd()->point_.PosTime(), paths[j]->GetEnd()->point_.PosTime()});
+    }
 
-      // Initialize the integration
-      h = 0;
-      h += PathHValue(a, cached_a, obstacle_id); // Integrate over path A
+    IntegrateSegments(segments_);
+  }
 
-      // Connect end points of a and b
-      {
-        gsl_params_[0].start = a.GetEnd()->point_.PosTime();
-        gsl_params_[0].end = b.GetEnd()->point_.PosTime();
+  std::vector<double> Homology::HSignature(const GeometricPath &path, Environment &environment)
+  {
+    ComputeObstacleLoops(environment.GetDynamicObstacles());
 
-        double result, error;
+    segments_.clear();
+    AddPathSegments(path, segments_);
+    IntegrateSegments(segments_);
 
-        gsl_integration_qag(&gsl_f_[0], 0, 1, GSL_ACCURACY, 0, GSL_POINTS, GSL_INTEG_GAUSS15, gsl_ws_[0], &result, &error);
+    std::vector<double> signature(loops_.size());
+    for (size_t o = 0; o < loops_.size(); o++)
+      signature[o] = SumSegments(o, segments_.begin(), segments_.end());
+    return signature;
+  }
 
-        h += result;
-      }
+  void Homology::LoadComparison(const GeometricPath &a, const GeometricPath &b, Environment &environment)
+  {
+    ComputeObstacleLoops(environment.GetDynamicObstacles());
 
-      h -= PathHValue(b, cached_b, obstacle_id); // Integrate over path B
-      h_total += abs(h);
-      // If is zero, keep checking the other obstacles
+    segments_.clear();
+    AddPathSegments(a, segments_);
+    segments_a_ = segments_.size();
+    AddPathSegments(b, segments_);
+    segments_b_ = segments_.size() - segments_a_;
+    segments_.push_back(Segment{a.GetEnd()->point_.PosTime(), b.GetEnd()->point_.PosTime()}); // Connect end points of a and b
+
+    IntegrateSegments(segments_);
+  }
+
+  double Homology::ComparisonHValue(int o) const
+  {
+    // Initialize the integration
+    double h = 0;
+    h += SumSegments(o, segments_.begin(), segments_.begin() + segments_a_);                                // Integrate over path A
+    h += SumSegments(o, segments_.end() - 1, segments_.end());                                              // Connect end points of a and b
+    h -= SumSegments(o, segments_.begin() + segments_a_, segments_.begin() + segments_a_ + segments_b_); // Integrate over path B
+    return h;
+  }
+
+  void Homology::AddPathSegments(const GeometricPath &path, std::vector<Segment> &segments)
+  {
+    std::vector<SpaceTimePoint> integration_points = path.GetIntegrationNodes();
+    for (size_t n = 1; n < integration_points.size(); n++) // From the start to the end of the path
+      segments.push_back(Segment{integration_points[n - 1].PosTime(), integration_points[n].PosTime()});
+  }
+
+  void Homology::IntegrateSegments(const std::vector<Segment> &segments)
+  {
+    // Look up every segment, reusing the previous iteration where possible, and collect the missing integrals
+    jobs_.clear();
+    for (auto &loop : loops_)
+    {
+      for (auto &segment : segments)
+      {
+        auto inserted = loop.values.emplace(segment, 0.);
+        if (!inserted.second)
+          continue;
+
+        auto previous = loop.previous_values.find(segment);
+        if (previous != loop.previous_values.end())
+        {
+          inserted.first->second = previous->second;
+          reused_++;
+          continue;
+        }
+
+        jobs_.push_back(IntegrationJob{&loop.points, &inserted.first->first, &inserted.first->second}); // Map entries do not move
+      }
     }
 
-    return sqrt(h_total); // If none of them are distinct, then the two paths are homology equivalent!
+    if (jobs_.empty())
+      return;
+
+    computed_ += jobs_.size();
+    int tasks = (jobs_.size() + JOBS_PER_TASK - 1) / JOBS_PER_TASK;
+    ParallelFor(tasks, [&](int task)
+                {
+      size_t end = std::min(jobs_.size(), (size_t)(task + 1) * JOBS_PER_TASK);
+      for (size_t j = task * JOBS_PER_TASK; j < end; j++)
+        *jobs_[j].result = Integrate(*jobs_[j].loop, *jobs_[j].segment); });
+  }
+
+  double Homology::SumSegments(int o, std::vector<Segment>::const_iterator begin, std::vector<Segment>::const_iterator end) const
+  {
+    double h_value = 0;
+    for (auto segment = begin; segment != end; ++segment)
+      h_value += loops_[o].values.at(*segment);
+    return h_value;
+  }
+
+  double Homology::Integrate(const std::vector<Eigen::Vector3d> &loop, const Segment &segment)
+  {
+    GSLParams params{segment.start, segment.end, &loop};
+
+    gsl_function f;
+    f.function = &Homology::GSLHValue;
+    f.params = &params;
+
+    // NumericalIntegration(result, &params);
+
+    double result, error;
+    gsl_integration_qag(&f, 0, 1, GSL_ACCURACY, 0, GSL_POINTS, GSL_INTEG_GAUSS15, ThreadWorkspace(), &result, &error);
+    return result;
   }
 
   std::vector<bool> Homology::LeftPassingVector(const GeometricPath &path, Environment &environment)
@@ -203,18 +289,18 @@ namespace GuidancePlanner
     Eigen::Vector3d r = Homology::Line(p->start, p->end, lambda);
     Eigen::Vector3d dr = p->end - p->start;
 
-    return p->homology_class->ObstacleHValue(r, dr);
+    return Homology::ObstacleHValue(*p->loop, r, dr);
   }
 
-  double Homology::ObstacleHValue(const Eigen::Vector3d &r, const Eigen::Vector3d &dr)
+  double Homology::ObstacleHValue(const std::vector<Eigen::Vector3d> &loop, const Eigen::Vector3d &r, const Eigen::Vector3d &dr)
   {
     double h = 0;
 
     // H-signature over the segments in the obstacle skeleton from start to end
-    for (size_t obstacle_segment = 1; obstacle_segment < obstacle_segments_.size(); obstacle_segment++)
-      h += SegmentHValue(obstacle_segments_[obstacle_segment - 1], obstacle_segments_[obstacle_segment], r, dr);
+    for (size_t obstacle_segment = 1; obstacle_segment < loop.size(); obstacle_segment++)
+      h += SegmentHValue(loop[obstacle_segment - 1], loop[obstacle_segment], r, dr);
 
-    h += SegmentHValue(obstacle_segments_.back(), obstacle_segments_[0], r, dr); // Connect the end and the start
+    h += SegmentHValue(loop.back(), loop[0], r, dr); // Connect the end and the start
 
     // h += SegmentHValue(obstacle_p1_, obstacle_p2_, r, dr); // The obstacle itself
     // h += SegmentHValue(obstacle_p2_, obstacle_p3_, r, dr); // A line above the state-space
@@ -234,89 +320,68 @@ namespace GuidancePlanner
     return h.transpose() * dr;
   }
 
-  void Homology::LoadObstacle(int i)
-  {
-    obstacle_segments_ = obstacle_points_[i];
-  }
-
   void Homology::ComputeObstacleLoops(const std::vector<Obstacle> &obstacles)
   {
-    if (!obstacle_points_ready_ && obstacles.size() > 0)
+    if (obstacle_loops_ready_)
+      return;
+
+    loops_.resize(obstacles.size());
+    for (size_t o = 0; o < loops_.size(); o++)
     {
-      obstacle_points_.resize(obstacles.size());
-      for (size_t o = 0; o < obstacle_points_.size(); o++)
-      {
-        obstacle_points_[o].clear();
-        obstacle_points_[o].reserve(obstacles[o].positions_.size() + 4); // Positions is from 0 to N, we need 0 / 1 - N / +
-      }
+      loops_[o].values.clear();
+      loops_[o].previous_values.clear();
+
+      auto &points = loops_[o].points;
+      points.clear();
+      points.reserve(obstacles[o].positions_.size() + 4); // Positions is from 0 to N, we need 0 / 1 - N / +
 
       // Retrieve and set the obstacle skeleton
-      for (size_t o = 0; o < obstacles.size(); o++)
+      const auto &obstacle = obstacles[o];
+
+      Eigen::Vector3d start(obstacle.positions_[0](0), obstacle.positions_[0](1), 0);
+      points.push_back(Eigen::Vector3d(start(0), start(1), -1)); // A start below the actual start
+
+      if (!assume_constant_velocity_)
+      {
+        for (size_t p = 0; p < obstacle.positions_.size(); p++) // Add the obstacle predictions, skipping the current position
+          points.push_back(Eigen::Vector3d(obstacle.positions_[p](0), obstacle.positions_[p](1), p));
+      }
+      else
       {
-        const auto &obstacle = obstacles[o];
+        // For constant velocity, one line is sufficient
+        points.push_back(Eigen::Vector3d(obstacle.positions_.back()(0), obstacle.positions_.back()(1), obstacle.positions_.size() - 1));
+      }
 
-        Eigen::Vector3d start(obstacle.positions_[0](0), obstacle.positions_[0](1), 0);
-        // Eigen::Vector3d end(obstacle.positions_.back()(0), obstacle.positions_.back()(1), Config::N);
-        obstacle_points_[o].push_back(Eigen::Vector3d(start(0), start(1), -1)); // A start below the actual start
+      points.push_back(points.back() + Eigen::Vector3d(0., 0., 1.));                // An end above the actual end
+      points.push_back(points.back() + Eigen::Vector3d(-HSIGNATURE_RANGE, 0., 0.)); // Move outside of the region
+      points.push_back(points.back());                                              // In that same (x,y) move down
+      points.back()(2) = points[0](2);
 
-        if (!assume_constant_velocity_)
-        {
-          for (size_t p = 0; p < obstacle.positions_.size(); p++) // Add the obstacle predictions, skipping the current position
-            obstacle_points_[o].push_back(Eigen::Vector3d(obstacle.positions_[p](0), obstacle.positions_[p](1), p));
-        }
-        else
+      // The integrals over an identical loop from the previous iteration still hold (usually the same obstacle index)
+      for (size_t i = 0; i < previous_loops_.size(); i++)
+      {
+        auto &previous = previous_loops_[(o + i) % previous_loops_.size()];
+        if (previous.points == points)
         {
-          // For constant velocity, one line is sufficient
-          obstacle_points_[o].push_back(Eigen::Vector3d(obstacle.positions_.back()(0), obstacle.positions_.back()(1), obstacle.positions_.size() - 1));
+          loops_[o].previous_values.swap(previous.values);
+          previous.points.clear(); // Matched
+          break;
         }
-        // obstacle_points_[o].push_back(Line(start, end, -fraction_)); // A start below the actual start
-        // obstacle_points_[0][i] = Line(start, end, -fraction_);                            // A start below the actual start
-        // obstacle_points_[1][i] = Line(start, end, 1 + fraction_);                         // An end above the actual end
-        // obstacle_points_[2][i] = obstacle_points_[1][i] + Eigen::Vector3d(-250., 0., 0.); // Move outside of the region
-
-        obstacle_points_[o].push_back(obstacle_points_[o].back() + Eigen::Vector3d(0., 0., 1.));                // An end above the actual end
-        obstacle_points_[o].push_back(obstacle_points_[o].back() + Eigen::Vector3d(-HSIGNATURE_RANGE, 0., 0.)); // Move outside of the region
-        obstacle_points_[o].push_back(obstacle_points_[o].back());                                              // In that same (x,y) move down
-        obstacle_points_[o].back()(2) = obstacle_points_[o][0](2);
-        // obstacle_points_[3][i] = obstacle_points_[2][i];
-        // obstacle_points_[3][i](2) = obstacle_points_[0][i](2); // Move down
       }
-      obstacle_points_ready_ = true;
     }
+
+    previous_loops_.clear();
+    obstacle_loops_ready_ = true;
   }
 
-  double Homology::PathHValue(const GeometricPath &path, std::vector<double> &cached_h, const int obstacle_id)
+  void Homology::Clear()
   {
-    if (obstacle_id < (int)cached_h.size())
-      return cached_h[obstacle_id]; // Retrieve from cache
+    if (obstacle_loops_ready_)
+      previous_loops_.swap(loops_);
 
-    std::vector<SpaceTimePoint> integration_points = path.GetIntegrationNodes();
-
-    std::vector<double> results(integration_points.size() - 1, 0);
-    // #pragma omp parallel for num_threads(8)
-    for (size_t n = 1; n < integration_points.size(); n++) // From the start to the end of a
-    {
-      double error;
-
-      // #ifdef _OPENMP
-      int thread_id = omp_get_thread_num();
-      // #else
-      // int thread_id = 0;
-      // #endif
-      gsl_params_[thread_id].start = integration_points[n - 1].PosTime();
-      gsl_params_[thread_id].end = integration_points[n].PosTime();
-
-      // NumericalIntegration(results[n - 1], &gsl_params_[thread_id]);
-
-      gsl_integration_qag(&gsl_f_[thread_id], 0, 1, GSL_ACCURACY, 0, GSL_POINTS, GSL_INTEG_GAUSS15, gsl_ws_[thread_id], &results[n - 1], &error);
-    }
-
-    double h_value = 0;
-    for (auto &partial_result : results)
-      h_value += partial_result;
-
-    cached_h.push_back(h_value); // Save in the cache
-    return h_value;
+    obstacle_loops_ready_ = false;
+    reused_ = 0;
+    computed_ = 0;
   }
 
   inline void Homology::NumericalIntegration(double &result, void *params)
@@ -344,16 +409,19 @@ namespace GuidancePlanner
       const auto &obstacle = obstacles[i];
       line.setColorInt(obstacle.id_, 1., RosTools::Colormap::BRUNO);
 
-      LoadObstacle(i);
+      if (i >= loops_.size())
+        break;
+
+      std::vector<Eigen::Vector3d> obstacle_segments = loops_[i].points;
 
-      for (auto &p : obstacle_segments_)
+      for (auto &p : obstacle_segments)
         p(2) *= Config::DT; // Scale the time axis
 
-      for (size_t p = 1; p < obstacle_segments_.size(); p++)
-        line.addLine(obstacle_segments_[p - 1], obstacle_segments_[p]);
-      // line.addBrokenLine(obstacle_segments_[p - 1], obstacle_segments_[p], 1.);
+      for (size_t p = 1; p < obstacle_segments.size(); p++)
+        line.addLine(obstacle_segments[p - 1], obstacle_segments[p]);
+      // line.addBrokenLine(obstacle_segments[p - 1], obstacle_segments[p], 1.);
 
-      line.addLine(obstacle_segments_.back(), obstacle_segments_.front());
+      line.addLine(obstacle_segments.back(), obstacle_segments.front());
       // line.addBrokenLine(obstacle_segments_.back(), obstacle_segments_.front(), 1.);
 
       // obstacle_p1_(2) *= Config::DT;
@@ -0,0 +1,74 @@
+#include "guidance_planner/obstacle_index.h"
+
+#include <guidance_planner/config.h>
+
+#include <limits>
+
+namespace GuidancePlanner
+{
+  void ObstacleIndex::Build(const std::vector<Obstacle> &obstacles)
+  {
+    valid_ = false;
+    steps_ = Config::N;
+    positions_.clear();
+    segments_.clear();
+
+    origin_ = Eigen::Vector2d::Constant(std::numeric_limits<double>::infinity());
+    max_ = -origin_;
+    max_radius_ = 0.;
+    max_half_segment_ = 0.;
+
+    for (auto &obstacle : obstacles)
+    {
+      if ((int)obstacle.positions_.size() < steps_ + 1 || !std::isfinite(obstacle.radius_))
+        return; // Queries fall back to checking every obstacle
+
+      max_radius_ = std::max(max_radius_, obstacle.radius_);
+      for (int k = 0; k <= steps_; k++)
+      {
+        const Eigen::Vector2d &pos = obstacle.positions_[k];
+        if (!pos.allFinite())
+          return;
+
+        origin_ = origin_.cwiseMin(pos);
+        max_ = max_.cwiseMax(pos);
+        if (k < steps_)
+          max_half_segment_ = std::max(max_half_segment_, 0.5 * (obstacle.positions_[k + 1] - pos).norm());
+      }
+    }
+
+    if (obstacles.empty())
+    {
+      origin_ = max_ = Eigen::Vector2d::Zero();
+      valid_ = true;
+      return;
+    }
+
+    // Cells about the size of an obstacle, but not more than MAX_CELLS per axis
+    Eigen::Vector2d extent = max_ - origin_;
+    cell_size_ = std::max({max_radius_ + max_half_segment_, extent.maxCoeff() / MAX_CELLS, EPSILON});
+    size_x_ = CellX(max_(0)) + 1;
+    size_y_ = CellY(max_(1)) + 1;
+
+    positions_.reserve(obstacles.size() * (steps_ + 1));
+    segments_.reserve(obstacles.size() * steps_);
+    for (size_t o = 0; o < obstacles.size(); o++)
+    {
+      auto &positions = obstacles[o].positions_;
+      for (int k = 0; k <= steps_; k++)
+      {
+        positions_.emplace_back(Key(k, CellX(positions[k](0)), CellY(positions[k](1))), (int)o);
+
+        if (k < steps_)
+        {
+          Eigen::Vector2d mid = 0.5 * (positions[k] + positions[k + 1]);
+          segments_.emplace_back(Key(k, CellX(mid(0)), CellY(mid(1))), (int)o);
+        }
+      }
+    }
+    std::sort(positions_.begin(), positions_.end());
+    std::sort(segments_.begin(), segments_.end());
+
+    valid_ = true;
+  }
+}
@@ -0,0 +1,37 @@
+#include <guidance_planner/parallel.h>
+
+#include <mutex>
+
+namespace GuidancePlanner
+{
+  namespace
+  {
+    std::mutex executor_mutex;
+    ParallelExecutor executor;
+  }
+
+  void SetParallelExecutor(ParallelExecutor new_executor)
+  {
+    std::lock_guard<std::mutex> lock(executor_mutex);
+    executor = std::move(new_executor);
+  }
+
+  void ParallelFor(int n, const std::function<void(int)> &body)
+  {
+    ParallelExecutor current;
+    {
+      std::lock_guard<std::mutex> lock(executor_mutex);
+      current = executor;
+    }
+
+    if (current)
+    {
+      current(n, body);
+      return;
+    }
+
+#pragma omp parallel for
+    for (int i = 0; i < n; i++)
+      body(i);
+  }
+}
@@ -10,11 +10,14 @@
 #include <guidance_planner/homotopy_comparison/winding_angle.h>
 
 #include <guidance_planner/utils.h>
+#include <guidance_planner/parallel.h>
 
 #include <ros_tools/profiling.h>
 #include <ros_tools/math.h>
 #include <ros_tools/data_saver.h>
 
+#include <algorithm>
+
 namespace GuidancePlanner
 {
 
@@ -78,6 +81,7 @@ namespace GuidancePlanner
       environment_->SetPosition(start);
       PRM_LOG("Static obstacles size: " << static_obstacles.size());
       environment_->LoadObstacles(obstacles, static_obstacles);
+      visibility_cache_.Update(environment_->GetDynamicObstacles(), Config::CONTROL_DT / Config::DT, nodes_propagated_);
       PRM_LOG("Obstacles loaded");
     }
 
@@ -153,8 +157,11 @@ namespace GuidancePlanner
     prm_timer.start();
 
     graph_->Initialize(start_, goals_);
+    guards_.clear();
+    guards_.push_back(graph_->start_node_); // The start counts as a guard
 
     SampleNewPoints(); // Draw random samples
+    nodes_propagated_ = false;
     PRM_LOG("New candidate nodes ready. Inserting them into the Visibility-PRM graph");
 
     // Then add them to the graph
@@ -173,14 +180,18 @@ namespace GuidancePlanner
 
       bool sample_is_from_previous_iteration = i < (int)previous_nodes_.size();
 
+      // Nodes that were propagated unchanged keep their key, so that their visibility checks can be reused
+      int roadmap_key = (sample_is_from_previous_iteration && previous_nodes_[i].roadmap_key_ >= 0) ? previous_nodes_[i].roadmap_key_
+                                                                                                     : visibility_cache_.NewKey();
+
       // Find the number of visible guards from this node
       std::vector<Node *> visible_guards;
-      FindVisibleGuards(sample.point, visible_guards);
+      FindVisibleGuards(sample.point, roadmap_key, visible_guards);
 
-      // Find out if at least one goal is visible, if it is, save it
+      // Find out if at least one goal is visible, if it is, save it (not needed if the sample is rejected anyway)
       Node *goal_node = nullptr;
       int goal_index = 0;
-      for (size_t g = 0; g < graph_->goal_nodes_.size(); g++)
+      for (size_t g = 0; g < graph_->goal_nodes_.size() && visible_guards.size() <= 2; g++)
       {
         if (IsGoalVisible(sample.point, g))
         {
@@ -204,12 +215,12 @@ namespace GuidancePlanner
       // CREATE A GUARD: If we see no goals and no guards
       if (!goal_visible && visible_guards.size() == 0)
       {
-        AddGuard(i, sample.point);
+        AddGuard(i, sample.point, roadmap_key);
         continue;
       } // CREATE A CONNECTOR: If we found one guard and at least one goal
       else if (visible_guards.size() == 2 && !goal_visible)
       {
-        AddSample(i, sample.point, visible_guards, sample_is_from_previous_iteration);
+        AddSample(i, sample.point, visible_guards, sample_is_from_previous_iteration, roadmap_key);
       }
       else if (goal_visible && visible_guards.size() == 1) // visible_goals.size() <= 1 && visible_goals.size() + visible_guards.size() == 2)
       {
@@ -233,7 +244,7 @@ namespace GuidancePlanner
 
         visible_guards.push_back(valid_goal);
 
-        AddSample(i, sample.point, visible_guards, sample_is_from_previous_iteration); // single threaded
+        AddSample(i, sample.point, visible_guards, sample_is_from_previous_iteration, roadmap_key); // single threaded
 
         // Swap goals if there are equal cost goals, to make the graph more robust
         if (valid_goal_index == graph_->goal_nodes_.size() - 1)
@@ -249,7 +260,8 @@ namespace GuidancePlanner
       }
     }
 
-    PRM_LOG("Visibility-PRM Graph Done.");
+    PRM_LOG("Visibility-PRM Graph Done (" << visibility_cache_.Reused() << " visibility checks reused, "
+                                           << visibility_cache_.Checked() << " computed).");
 
     done_ = true;
     return *graph_;
@@ -268,10 +280,9 @@ namespace GuidancePlanner
 
   void PRM::SampleNewPoints()
   {
-// First sample all the points in parallel
-#pragma omp parallel for num_threads(8)
-    for (int i = 0; i < config_->n_samples_; i++)
-    {
+    // First sample all the points in parallel
+    ParallelFor(config_->n_samples_, [&](int i)
+                {
       bool sample_is_from_previous_iteration = i < (int)previous_nodes_.size(); // First resample previous nodes
 
       // Get a new sample (either from the previous iteration, or a new one)
@@ -287,17 +298,19 @@ namespace GuidancePlanner
         environment_->ProjectToFreeSpace(sample.point, 0.1);
         if (environment_->InCollision(sample.point))
           sample.success = false; // If that didn't work, then try another sample
+
+        if (sample_is_from_previous_iteration)
+          previous_nodes_[i].roadmap_key_ = -1; // The node moved, its cached visibility no longer applies
       }
 
       if (sample.success)
       {
         if (sample_is_from_previous_iteration)
           previous_nodes_[i].point_ = sample.point; // Update the previous node's position if necessary (for construction later)
-      }
-    }
+      } });
   }
 
-  void PRM::AddSample(int i, SpaceTimePoint &sample, const std::vector<Node *> guards, bool sample_is_from_previous_iteration)
+  void PRM::AddSample(int i, SpaceTimePoint &sample, const std::vector<Node *> guards, bool sample_is_from_previous_iteration, int roadmap_key)
   {
     PRM_LOG("Guards: " << *guards[0] << " and " << *guards[1]);
 
@@ -314,20 +327,34 @@ namespace GuidancePlanner
                         ? Node(graph_->GetNodeID(), previous_nodes_[i])
                         : Node(graph_->GetNodeID(), sample, NodeType::CONNECTOR);
     new_node.type_ = NodeType::CONNECTOR;
+    new_node.roadmap_key_ = roadmap_key;
 
     std::vector<Node *> shared_neighbours;
     shared_neighbours = graph_->GetSharedNeighbours(guards); // Get all nodes with the same neighbours. The goal guards count as one.
     PRM_LOG("Found " << shared_neighbours.size() << " shared neighbours");
 
-    GeometricPath new_path, other_path;
+    GeometricPath new_path;
+    std::vector<GeometricPath> other_paths;
     if (shared_neighbours.size() > 0)
+    {
       new_path = GeometricPath({guards[0], &new_node, guards[1]});
 
+      std::vector<const GeometricPath *> compared_paths = {&new_path};
+      other_paths.reserve(shared_neighbours.size());
+      for (auto &neighbour : shared_neighbours)
+      {
+        ROSTOOLS_ASSERT(neighbour->type_ == NodeType::CONNECTOR, "Shared neighbours should not be guards");
+        other_paths.emplace_back(std::vector<Node *>({guards[0], neighbour, guards[1]}));
+        compared_paths.push_back(&other_paths.back());
+      }
+      PrepareHomotopicComparison(compared_paths); // The new path is compared with each of the others
+    }
+
     bool path_is_distinct = true;
-    for (auto &neighbour : shared_neighbours)
+    for (size_t n = 0; n < shared_neighbours.size(); n++)
     {
-      ROSTOOLS_ASSERT(neighbour->type_ == NodeType::CONNECTOR, "Shared neighbours should not be guards");
-      other_path = GeometricPath({guards[0], neighbour, guards[1]});
+      Node *neighbour = shared_neighbours[n];
+      const GeometricPath &other_path = other_paths[n];
 
       if (AreHomotopicEquivalent(new_path, other_path))
       {
@@ -378,11 +405,17 @@ namespace GuidancePlanner
       PropagateNode(node, node_path);
     }
     do_not_propagate_nodes_ = false;
+    nodes_propagated_ = true;
   }
 
   void PRM::PropagateNode(const Node &node, const GeometricPath *path)
   {
     previous_nodes_.push_back(node); // Copy the given node to save it (by value, because the graph will be reset)
+    auto &propagated_node = previous_nodes_.back();
+
+    // Visibility can only be reused for nodes that moved down in time together with the obstacles
+    if (!config_->dynamically_propagate_nodes_ || do_not_propagate_nodes_)
+      propagated_node.roadmap_key_ = -1;
 
     if (!config_->dynamically_propagate_nodes_) // Setting must be enabled in general
       return;
@@ -390,8 +423,6 @@ namespace GuidancePlanner
     if (do_not_propagate_nodes_) // This setting can be enabled externally to stop node propagation for one iteration
       return;
 
-    auto &propagated_node = previous_nodes_.back();
-
     // Then, we would like to propagate this node on its path so that it remains on the path at the same point in time
     // (next iteration) All our current nodes will be the same nodes in the next time step, but one step earlier in time
 
@@ -410,6 +441,7 @@ namespace GuidancePlanner
         // Sample halfway up to the next node (0.5(T2 + T1) / (T_end - T_start)) \in [0, 1]
         propagated_node.point_ = (*path)((0.5 * (next_node->point_.Time() + node.point_.Time())) /
                                          (path->EndTimeIndex() - path->StartTimeIndex()));
+        propagated_node.roadmap_key_ = -1;
       }
       else
       {
@@ -439,16 +471,32 @@ namespace GuidancePlanner
   //   return SpaceTimePoint(point(0), point(1), random_generator_.Int(Config::N - 2) + 1);
   // }
 
-  void PRM::FindVisibleGuards(SpaceTimePoint sample, std::vector<Node *> &visible_guards)
+  void PRM::FindVisibleGuards(const SpaceTimePoint &sample, int roadmap_key, std::vector<Node *> &visible_guards)
   {
-    for (Node &node : graph_->nodes_)
+    Node sample_node(-1, sample, NodeType::NONE);
+    sample_node.roadmap_key_ = roadmap_key;
+
+    // Check the closest guards first, they are the most likely to be visible
+    guard_order_.clear();
+    for (size_t g = 0; g < guards_.size(); g++)
+      guard_order_.emplace_back((guards_[g]->point_.PosTime() - sample.PosTime()).squaredNorm(), g);
+    std::sort(guard_order_.begin(), guard_order_.end());
+
+    visible_guard_indices_.clear();
+    for (auto &candidate : guard_order_)
     {
-      if (node.type_ == NodeType::GUARD)
+      size_t g = candidate.second;
+      if (visibility_cache_.IsVisible(*environment_, sample_node, *guards_[g]))
       {
-        if (environment_->IsVisible(sample, node.point_))
-          visible_guards.push_back(&node);
+        visible_guard_indices_.push_back(g);
+        if (visible_guard_indices_.size() == 3)
+          break;
       }
     }
+
+    std::sort(visible_guard_indices_.begin(), visible_guard_indices_.end()); // Same order as a scan over the graph
+    for (size_t g : visible_guard_indices_)
+      visible_guards.push_back(guards_[g]);
   }
 
   void PRM::ReplaceConnector(Node &new_node, Node *neighbour, const std::vector<Node *> &visible_guards)
@@ -478,16 +526,17 @@ namespace GuidancePlanner
     visible_guards[1]->neighbours_.push_back(new_node_ptr);
   }
 
-  void PRM::AddGuard(int i, SpaceTimePoint &sample)
+  void PRM::AddGuard(int i, SpaceTimePoint &sample, int roadmap_key)
   {
     Node new_guard(i, sample, NodeType::GUARD); // Define the new node
+    new_guard.roadmap_key_ = roadmap_key;
 
     /* There is space here to check if this guard has some favourable properties */
     if (environment_->InCollision(sample, 0.1))
       return;
 
     PRM_LOG("Adding new guard");
-    graph_->AddNode(new_guard); // Add the new guard
+    guards_.push_back(graph_->AddNode(new_guard)); // Add the new guard
   }
 
   bool PRM::AreHomotopicEquivalent(const GeometricPath &a, const GeometricPath &b)
@@ -499,6 +548,13 @@ namespace GuidancePlanner
     return homology_result;
   }
 
+  void PRM::PrepareHomotopicComparison(const std::vector<const GeometricPath *> &paths)
+  {
+    BENCHMARKERS.getBenchmarker("homotopy_comparison").start();
+    topology_comparison_->Prepare(paths, *environment_);
+    BENCHMARKERS.getBenchmarker("homotopy_comparison").stop();
+  }
+
   double PRM::GetHomotopicCost(const GeometricPath &a, const GeometricPath &b)
   {
     // debug_benchmarker_->start();
@@ -547,6 +603,8 @@ namespace GuidancePlanner
     sampler_->Reset();
 
     previous_nodes_.clear(); // Forget nodes
+    nodes_propagated_ = false;
+    visibility_cache_.Clear();
   }
 
   void PRM::Visualize()
@@ -14,6 +14,7 @@ namespace GuidancePlanner
     {
         type_ = other.type_;
         replaced_ = false;
+        roadmap_key_ = other.roadmap_key_;
     }
 
     bool Node::ReplaceNeighbour(Node *node_to_replace, Node *new_node)
@@ -0,0 +1,145 @@
+#include "guidance_planner/visibility_cache.h"
+
+#include <guidance_planner/environment.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace GuidancePlanner
+{
+  namespace
+  {
+    uint64_t LineKey(int key_a, int key_b)
+    {
+      if (key_a > key_b)
+        std::swap(key_a, key_b);
+      return (static_cast<uint64_t>(static_cast<uint32_t>(key_a)) << 32) | static_cast<uint32_t>(key_b);
+    }
+
+    Eigen::Vector2d PositionAt(const Obstacle &obstacle, double t)
+    {
+      int k = std::min((int)std::floor(t), (int)obstacle.positions_.size() - 1);
+      if (k == (int)obstacle.positions_.size() - 1)
+        return obstacle.positions_[k];
+
+      double alpha = t - k;
+      return (1. - alpha) * obstacle.positions_[k] + alpha * obstacle.positions_[k + 1];
+    }
+  }
+
+  void VisibilityCache::Update(const std::vector<Obstacle> &obstacles, double time_shift, bool nodes_were_propagated)
+  {
+    previous_clearance_.swap(clearance_);
+    clearance_.clear();
+    if (!nodes_were_propagated)
+      previous_clearance_.clear();
+
+    reused_ = 0;
+    checked_ = 0;
+
+    motion_.resize(obstacles.size());
+    for (size_t o = 0; o < obstacles.size(); o++)
+    {
+      motion_[o].assign(Config::N, std::numeric_limits<double>::infinity()); // Unknown obstacles are checked again
+
+      for (auto &previous : previous_obstacles_)
+      {
+        if (previous.id_ != obstacles[o].id_ || previous.radius_ != obstacles[o].radius_)
+          continue;
+
+        for (int k = 0; k < Config::N && k + 1 < (int)obstacles[o].positions_.size(); k++)
+          motion_[o][k] = SegmentMotion(previous, obstacles[o], k, time_shift);
+        break;
+      }
+    }
+
+    previous_obstacles_ = obstacles;
+  }
+
+  bool VisibilityCache::IsVisible(Environment &environment, const Node &a, const Node &b)
+  {
+    if (a.roadmap_key_ < 0 || b.roadmap_key_ < 0)
+      return environment.IsVisible(a.point_, b.point_);
+
+    uint64_t key = LineKey(a.roadmap_key_, b.roadmap_key_);
+
+    double clearance;
+    auto previous = previous_clearance_.find(key);
+    if (previous != previous_clearance_.end() && motion_.size() == environment.GetDynamicObstacles().size())
+    {
+      clearance = Revalidate(environment, a, b, previous->second);
+      reused_++;
+    }
+    else
+    {
+      clearance = environment.Clearance(a.point_, b.point_);
+      checked_++;
+    }
+
+    if (clearance < 0.)
+      return false;
+
+    clearance_[key] = clearance;
+    return true;
+  }
+
+  double VisibilityCache::Revalidate(Environment &environment, const Node &a, const Node &b, double previous_clearance) const
+  {
+    Eigen::Vector3d line_start = a.point_.PosTime();
+    Eigen::Vector3d line = (b.point_ - a.point_).PosTime();
+
+    double clearance = std::numeric_limits<double>::infinity();
+
+    const std::vector<Obstacle> &obstacles = environment.GetDynamicObstacles();
+    for (size_t o = 0; o < obstacles.size(); o++)
+    {
+      auto &obstacle = obstacles[o];
+      if (obstacle.positions_.size() < 2)
+        continue;
+
+      for (int k = 0; k < Config::N; k++)
+      {
+        // Moving a segment by at most m changes its distance to the line by at most m
+        if (motion_[o][k] < previous_clearance)
+        {
+          clearance = std::min(clearance, previous_clearance - motion_[o][k]);
+          continue;
+        }
+
+        double dist = Environment::SegmentDistance(line_start, line, obstacle, k) - obstacle.radius_;
+        if (dist < 0.)
+          return dist;
+        clearance = std::min(clearance, dist);
+      }
+    }
+    return clearance;
+  }
+
+  double VisibilityCache::SegmentMotion(const Obstacle &previous, const Obstacle &current, int k, double time_shift)
+  {
+    // Segment k covers [k, k + 1] now and [k + time_shift, k + 1 + time_shift] in the previous prediction
+    if (k + 1 + time_shift > (double)previous.positions_.size() - 1.)
+      return std::numeric_limits<double>::infinity();
+
+    // The difference of the two piecewise linear paths is largest at a segment end or at a knot of the previous prediction
+    double motion = std::max((current.positions_[k] - PositionAt(previous, k + time_shift)).norm(),
+                             (current.positions_[k + 1] - PositionAt(previous, k + 1 + time_shift)).norm());
+
+    double knot = std::ceil(k + time_shift) - time_shift;
+    if (knot > k && knot < k + 1)
+      motion = std::max(motion, (PositionAt(current, knot) - PositionAt(previous, knot + time_shift)).norm());
+
+    return motion;
+  }
+
+  void VisibilityCache::Clear()
+  {
+    clearance_.clear();
+    previous_clearance_.clear();
+    previous_obstacles_.clear();
+    motion_.clear();
+    reused_ = 0;
+    checked_ = 0;
+  }
+}
@@ -59,7 +59,7 @@ namespace MPCPlanner
         {
                 Prediction prediction;
                 double noise = 0.;
-                if (CONFIG["probabilistic"]["enable"].as<bool>())
+                if (SETTINGS.probabilistic.enable)
                 {
                         prediction = Prediction(PredictionType::GAUSSIAN);
                         noise = 0.3;
@@ -72,7 +72,7 @@ namespace MPCPlanner
                 for (int i = 0; i < steps; i++)
                         prediction.modes[0].push_back(PredictionStep(position + velocity * dt * i, 0., noise, noise));
 
-                if (CONFIG["probabilistic"]["enable"].as<bool>())
+                if (SETTINGS.probabilistic.enable)
                         propagatePredictionUncertainty(prediction);
 
                 return prediction;
@@ -85,7 +85,7 @@ namespace MPCPlanner
                 const Eigen::Vector2d pos = state.getPos();
                 for (auto &obstacle : obstacles)
                 {
-                        if (RosTools::distance(pos, obstacle.position) < CONFIG["max_obstacle_distance"].as<double>())
+                        if (RosTools::distance(pos, obstacle.position) < SETTINGS.max_obstacle_distance)
                                 nearby_obstacles.push_back(obstacle);
                 }
 
@@ -94,7 +94,7 @@ namespace MPCPlanner
 
         void ensureObstacleSize(std::vector<DynamicObstacle> &obstacles, const State &state)
         {
-                size_t max_obstacles = CONFIG["max_obstacles"].as<int>();
+                size_t max_obstacles = SETTINGS.max_obstacles;
 
                 // Create an index list
                 std::vector<int> indices;
@@ -116,7 +116,7 @@ namespace MPCPlanner
                                 double min_dist = 1e5;
 
                                 Eigen::Vector2d direction(std::cos(state.get("psi")), std::sin(state.get("psi")));
-                                for (int k = 0; k < CONFIG["N"].as<int>(); k++)
+                                for (int k = 0; k < SETTINGS.N; k++)
                                 {
                                         // Linearly scaled
                                         dist = (double)(k + 1) * 0.6 *
@@ -159,8 +159,8 @@ namespace MPCPlanner
                                 auto &obstacle = obstacles.back();
                                 obstacle.prediction = getConstantVelocityPrediction(obstacle.position,
                                                                                     Eigen::Vector2d(0., 0.),
-                                                                                    CONFIG["integrator_step"].as<double>(),
-                                                                                    CONFIG["N"].as<int>());
+                                                                                    SETTINGS.integrator_step,
+                                                                                    SETTINGS.N);
                         }
                 }
 
@@ -172,11 +172,11 @@ namespace MPCPlanner
                 if (prediction.type != PredictionType::GAUSSIAN)
                         return;
 
-                double dt = CONFIG["integrator_step"].as<double>();
+                double dt = SETTINGS.integrator_step;
                 double major = 0.;
                 double minor = 0.;
 
-                for (int k = 0; k < CONFIG["N"].as<int>(); k++)
+                for (int k = 0; k < SETTINGS.N; k++)
                 {
                         major = std::sqrt(std::pow(major, 2.0) + std::pow(prediction.modes[0][k].major_radius * dt, 2.));
                         minor = std::sqrt(std::pow(minor, 2.0) + std::pow(prediction.modes[0][k].minor_radius * dt, 2.));
@@ -17,13 +17,13 @@ namespace MPCPlanner
     ExperimentUtil::ExperimentUtil()
     {
 #ifdef MPC_PLANNER_ROS
-        _save_folder = CONFIG["recording"]["folder"].as<std::string>();
-        _save_file = CONFIG["recording"]["file"].as<std::string>();
+        _save_folder = SETTINGS.recording.folder;
+        _save_file = SETTINGS.recording.file;
 
         _data_saver = std::make_unique<RosTools::DataSaver>();
-        _data_saver->SetAddTimestamp(CONFIG["recording"]["timestamp"].as<bool>());
+        _data_saver->SetAddTimestamp(SETTINGS.recording.timestamp);
 
-        if (CONFIG["recording"]["enable"].as<bool>())
+        if (SETTINGS.recording.enable)
             LOG_VALUE("Planner Save File", _data_saver->getFilePath(_save_folder, _save_file, false));
 #else
         // Data saving disabled in non-ROS mode
@@ -49,7 +49,7 @@ namespace MPCPlanner
         _data_saver->AddData("vehicle_orientation", state.get("psi"));
 
         // Save the planned trajectory
-        for (int k = 0; k < CONFIG["N"].as<int>(); k++)
+        for (int k = 0; k < SETTINGS.N; k++)
             _data_saver->AddData("vehicle_plan_" + std::to_string(k), solver->getEgoPredictionPosition(k));
 
         // SAVE OBSTACLE DATA
@@ -100,7 +100,7 @@ namespace MPCPlanner
         // Add the duration (assume control frequency is constant)
         _data_saver->AddData(
             "metric_duration",
-            (_control_iteration - _iteration_at_last_reset) * (1.0 / CONFIG["control_frequency"].as<double>()));
+            (_control_iteration - _iteration_at_last_reset) * (1.0 / SETTINGS.control_frequency));
 
         _data_saver->AddData("metric_completed", (int)(objective_reached));
         _iteration_at_last_reset = _control_iteration;
@@ -108,7 +108,7 @@ namespace MPCPlanner
         _experiment_counter++;
 
         // Save data to FILE when a number of experiments have been completed
-        int num_experiments = CONFIG["recording"]["num_experiments"].as<int>();
+        int num_experiments = SETTINGS.recording.num_experiments;
         if (_experiment_counter % num_experiments == 0 && _experiment_counter > 0)
             exportData();
 
@@ -77,8 +77,8 @@ namespace MPCPlanner
             planning_benchmarker.start();
 
             // Set the initial guess
-            bool shift_forward = CONFIG["shift_previous_solution_forward"].as<bool>() &&
-                                 CONFIG["enable_output"].as<bool>();
+            bool shift_forward = SETTINGS.shift_previous_solution_forward &&
+                                 SETTINGS.enable_output;
             if (was_feasible)
                 _solver->initializeWarmstart(state, shift_forward);
             else
@@ -112,12 +112,12 @@ namespace MPCPlanner
 
             _warmstart = Trajectory();
             for (int k = 0; k < _solver->N; k++)
-                _warmstart.add(_solver->getEgoPrediction(k, "x"), _solver->getEgoPrediction(k, "y"));
+                _warmstart.add(_solver->getEgoPrediction(k, ModelIndex::X), _solver->getEgoPrediction(k, ModelIndex::Y));
 
             _solver->loadWarmstart();
 
             std::chrono::duration<double> used_time = std::chrono::system_clock::now() - data.planning_start_time;
-            _solver->_params.solver_timeout = 1. / CONFIG["control_frequency"].as<double>() - used_time.count() - 0.006;
+            _solver->_params.solver_timeout = 1. / SETTINGS.control_frequency - used_time.count() - 0.006;
 
             // Solve MPC
             LOG_MARK("Solve optimization");
@@ -149,9 +149,9 @@ namespace MPCPlanner
 
         _output.success = true;
         for (int k = 1; k < _solver->N; k++)
-            _output.trajectory.add(_solver->getOutput(k, "x"), _solver->getOutput(k, "y"));
+            _output.trajectory.add(_solver->getOutput(k, ModelIndex::X), _solver->getOutput(k, ModelIndex::Y));
 
-        if (_output.success && CONFIG["debug_limits"].as<bool>())
+        if (_output.success && SETTINGS.debug_limits)
             _solver->printIfBoundLimited();
 
         LOG_MARK("Planner::solveMPC done");
@@ -186,7 +186,7 @@ namespace MPCPlanner
 
         visualizeTrajectory(_output.trajectory, "planned_trajectory", true, 0.2);
 
-        if (CONFIG["debug_visuals"].as<bool>())
+        if (SETTINGS.debug_visuals)
             visualizeTrajectory(_warmstart, "warmstart_trajectory", true, 0.2);
 
         visualizeObstacles(data.dynamic_obstacles, "obstacles", true, 1.0);
@@ -195,10 +195,10 @@ namespace MPCPlanner
 
         std::vector<double> angles;
         for (int k = 1; k < _solver->N; k++)
-            angles.emplace_back(_solver->getOutput(k, "psi"));
+            angles.emplace_back(_solver->getOutput(k, ModelIndex::PSI));
 
         visualizeRectangularRobotArea(state.getPos(), state.get("psi"),
-                                      CONFIG["robot"]["length"].as<double>(), CONFIG["robot"]["width"].as<double>(),
+                                      SETTINGS.robot.length, SETTINGS.robot.width,
                                       "robot_rect_area", true);
 
         visualizeRobotAreaTrajectory(_output.trajectory, angles, data.robot_area, "robot_area_trajectory", true, 0.1);
@@ -215,7 +215,7 @@ namespace MPCPlanner
         // Save planning data
         double planning_time = BENCHMARKERS.getBenchmarker("planning").getLast();
         data_saver.AddData("runtime_control_loop", planning_time);
-        if (planning_time > 1. / CONFIG["control_frequency"].as<double>())
+        if (planning_time > 1. / SETTINGS.control_frequency)
             LOG_WARN("Planning took too long: " << planning_time << " ms");
         data_saver.AddData("runtime_optimization", BENCHMARKERS.getBenchmarker("optimization").getLast());
 
@@ -232,7 +232,7 @@ namespace MPCPlanner
 
     void Planner::reset(State &state, RealTimeData &data, bool success)
     {
-        if (CONFIG["recording"]["enable"].as<bool>())
+        if (SETTINGS.recording.enable)
             _experiment_util->onTaskComplete(success); // Save data
 
         _solver->reset(); // Reset the solver
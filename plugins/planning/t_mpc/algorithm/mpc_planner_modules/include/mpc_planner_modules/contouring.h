@@ -33,6 +33,11 @@ namespace MPCPlanner
     int _n_segments;
 
     bool _add_road_constraints{false}, _two_way_road{false}, _dynamic_velocity_reference{false};
+    double _road_width{0.}; // Measured from the road boundaries when received, SETTINGS.road.width otherwise
+
+    // Weights, retrieved at stage k = 0 and reused for the remaining stages
+    double _contouring_weight{0.}, _lag_weight{0.}, _reference_velocity{0.}, _velocity_weight{0.};
+    double _terminal_angle_weight{0.}, _terminal_contouring_weight{0.};
 
     void constructRoadConstraints(const RealTimeData &data, ModuleData &module_data);
     void constructRoadConstraintsFromCenterline(const RealTimeData &data, ModuleData &module_data);
@@ -28,6 +28,8 @@ namespace MPCPlanner
 
     std::unique_ptr<EllipsoidDecomp2D> _decomp_util;
     vec_Vec2f _occ_pos;
+    vec_Vec2f _occ_pos_new; // Occupied positions of the current costmap, compared with _occ_pos
+    bool _occ_pos_initialized{false};
     std::vector<LinearConstraint<2>> _constraints; // Static 2D halfspace constraints set in DecompUtil
     vec_E<Polyhedron<2>> _polyhedrons;
     std::vector<std::unique_ptr<vec_Vec2f>> occ_pos_vec_stages_;
@@ -40,6 +42,7 @@ namespace MPCPlanner
 
     int _max_constraints;
 
+    /** @brief Update the occupied positions, returns true if they changed */
     bool getOccupiedGridCells(const RealTimeData &data);
 
     void projectToSafety(Eigen::Vector2d &pos);
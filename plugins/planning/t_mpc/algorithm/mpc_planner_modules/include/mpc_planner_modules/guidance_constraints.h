@@ -18,6 +18,7 @@
 
 #include <mpc_planner_modules/controller_module.h>
 #include <mpc_planner_solver/solver_interface.h>
+#include <mpc_planner_solver/solver_arena.h>
 
 #include <mpc_planner_types/data_types.h>
 
@@ -92,16 +93,18 @@ namespace MPCPlanner
             std::unique_ptr<LinearizedConstraints> guidance_constraints;   // Keep the solver in the topology
             std::unique_ptr<GUIDANCE_CONSTRAINTS_TYPE> safety_constraints; // Avoid collisions
 
-            std::shared_ptr<Solver> local_solver; // Distinct solver for each planner
+            std::shared_ptr<Solver> local_solver; // Distinct solver for each planner (slot of the solver arena)
             SolverResult result;
 
+            std::string profile_name; // Profiler scope of this planner's optimization
+
             bool is_original_planner = false;
             bool disabled = true;
 
             bool taken = false;
             bool existing_guidance = false;
 
-            LocalPlanner(int _id, bool _is_original_planner = false);
+            LocalPlanner(int _id, std::shared_ptr<Solver> solver, bool _is_original_planner = false);
         };
 
         void setGoals(State &state, const ModuleData &module_data);
@@ -111,6 +114,7 @@ namespace MPCPlanner
         int FindBestPlanner();
 
     private: // Member variables
+        std::shared_ptr<SolverArena<Solver>> solver_arena_; // The solvers of all planners, in one allocation
         std::vector<LocalPlanner> planners_;
 
         std::shared_ptr<GuidancePlanner::GlobalGuidance> global_guidance_;
@@ -28,7 +28,12 @@ namespace MPCPlanner
     virtual void setParameters(const RealTimeData &data, const ModuleData &module_data, int k) override;
 
   private:
-    std::vector<std::string> _weight_names;
+    struct Weight
+    {
+      int parameter_index;
+      double value;
+    };
+    std::vector<Weight> _weights; // Resolved from WEIGHT_PARAMS and the settings at construction
   };
 }
 
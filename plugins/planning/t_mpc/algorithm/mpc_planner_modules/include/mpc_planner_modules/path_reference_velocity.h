@@ -38,6 +38,7 @@ namespace MPCPlanner
   private:
     std::shared_ptr<tk::spline> _velocity_spline;
     int _n_segments;
+    double _reference_velocity{0.};  // Retrieved at stage k = 0
   };
 }
 
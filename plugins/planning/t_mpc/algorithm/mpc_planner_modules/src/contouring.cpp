@@ -19,10 +19,11 @@ namespace MPCPlanner
       : ControllerModule(ModuleType::OBJECTIVE, solver, "contouring")
   {
     LOG_INITIALIZE("Contouring");
-    _n_segments = CONFIG["contouring"]["num_segments"].as<int>();
-    _add_road_constraints = CONFIG["contouring"]["add_road_constraints"].as<bool>();
-    _two_way_road = CONFIG["road"]["two_way"].as<bool>();
-    _dynamic_velocity_reference = CONFIG["contouring"]["dynamic_velocity_reference"].as<bool>();
+    _n_segments = SETTINGS.contouring.num_segments;
+    _add_road_constraints = SETTINGS.contouring.add_road_constraints;
+    _two_way_road = SETTINGS.road.two_way;
+    _road_width = SETTINGS.road.width;
+    _dynamic_velocity_reference = SETTINGS.contouring.dynamic_velocity_reference;
 
     LOG_INITIALIZED();
   }
@@ -44,6 +45,7 @@ namespace MPCPlanner
     state.set("spline", closest_s); // We need to initialize the spline state here
 
     module_data.current_path_segment = _closest_segment;
+    module_data.road_width = _road_width;
 
     if (_add_road_constraints)
       constructRoadConstraints(data, module_data);
@@ -55,38 +57,32 @@ namespace MPCPlanner
     (void)module_data;
 
     // Retrieve weights once
-    static double contouring_weight, lag_weight, reference_velocity, velocity_weight;
-    static double terminal_angle_weight, terminal_contouring_weight;
     if (k == 0)
     {
-      contouring_weight = CONFIG["weights"]["contour"].as<double>();
-      lag_weight = CONFIG["weights"]["lag"].as<double>();
+      _contouring_weight = SETTINGS.weights.contour;
+      _lag_weight = SETTINGS.weights.lag;
 
-      terminal_angle_weight = CONFIG["weights"]["terminal_angle"].as<double>();
-      terminal_contouring_weight = CONFIG["weights"]["terminal_contouring"].as<double>();
+      _terminal_angle_weight = SETTINGS.weights.terminal_angle;
+      _terminal_contouring_weight = SETTINGS.weights.terminal_contouring;
 
       if (_dynamic_velocity_reference)
       {
-        reference_velocity = CONFIG["weights"]["reference_velocity"].as<double>();
-        velocity_weight = CONFIG["weights"]["velocity"].as<double>();
-      }
-      else
-      {
-        (void)velocity_weight;
+        _reference_velocity = SETTINGS.weights.reference_velocity;
+        _velocity_weight = SETTINGS.weights.velocity;
       }
     }
 
     {
-      setSolverParameterContour(k, _solver->_params, contouring_weight);
-      setSolverParameterLag(k, _solver->_params, lag_weight);
+      setSolverParameterContour(k, _solver->_params, _contouring_weight);
+      setSolverParameterLag(k, _solver->_params, _lag_weight);
 
-      setSolverParameterTerminalAngle(k, _solver->_params, terminal_angle_weight);
-      setSolverParameterTerminalContouring(k, _solver->_params, terminal_contouring_weight);
+      setSolverParameterTerminalAngle(k, _solver->_params, _terminal_angle_weight);
+      setSolverParameterTerminalContouring(k, _solver->_params, _terminal_contouring_weight);
 
       if (_dynamic_velocity_reference)
       {
-        setSolverParameterVelocity(k, _solver->_params, velocity_weight);
-        setSolverParameterReferenceVelocity(k, _solver->_params, reference_velocity);
+        setSolverParameterVelocity(k, _solver->_params, _velocity_weight);
+        setSolverParameterReferenceVelocity(k, _solver->_params, _reference_velocity);
       }
     }
 
@@ -150,8 +146,8 @@ namespace MPCPlanner
             data.right_bound.y,
             _spline->getTVector());
 
-        // Update the road width
-        CONFIG["road"]["width"] = RosTools::distance(_bound_left->getPoint(0), _bound_right->getPoint(0));
+        // Update the road width (published to the other modules through the module data)
+        _road_width = RosTools::distance(_bound_left->getPoint(0), _bound_right->getPoint(0));
       }
 
       _closest_segment = -1;
@@ -202,12 +198,12 @@ namespace MPCPlanner
 
     // OLD VERSION:
     bool two_way = _two_way_road;
-    double road_width_half = CONFIG["road"]["width"].as<double>() / 2.;
+    double road_width_half = _road_width / 2.;
     for (int k = 1; k < _solver->N; k++)
     {
       module_data.static_obstacles[k].clear();
 
-      double cur_s = _solver->getEgoPrediction(k, "spline");
+      double cur_s = _solver->getEgoPrediction(k, ModelIndex::SPLINE);
 
       // This is the final point and the normal vector of the path
       Eigen::Vector2d path_point = _spline->getPoint(cur_s);
@@ -249,7 +245,7 @@ namespace MPCPlanner
     for (int k = 1; k < _solver->N; k++)
     {
       module_data.static_obstacles[k].clear();
-      double cur_s = _solver->getEgoPrediction(k, "spline");
+      double cur_s = _solver->getEgoPrediction(k, ModelIndex::SPLINE);
 
       // Left
       Eigen::Vector2d Al = _bound_left->getOrthogonal(cur_s);
@@ -277,7 +273,7 @@ namespace MPCPlanner
     visualizeReferencePath(data, module_data);
     visualizeRoadConstraints(data, module_data);
 
-    if (CONFIG["debug_visuals"].as<bool>())
+    if (SETTINGS.debug_visuals)
     {
       visualizeCurrentSegment(data, module_data);
       visualizeDebugRoadBoundary(data, module_data);
@@ -364,11 +360,11 @@ namespace MPCPlanner
 
     // OLD VERSION:
     bool two_way = _two_way_road;
-    double road_width_half = CONFIG["road"]["width"].as<double>() / 2.;
+    double road_width_half = _road_width / 2.;
     for (int k = 1; k < _solver->N; k++)
     {
 
-      double cur_s = _solver->getEgoPrediction(k, "spline");
+      double cur_s = _solver->getEgoPrediction(k, ModelIndex::SPLINE);
       Eigen::Vector2d path_point = _spline->getPoint(cur_s);
 
       points.setColorInt(5, 10);
@@ -443,7 +439,7 @@ namespace MPCPlanner
           start = _spline->parameterLength();
         }
 
-        double s = _solver->getEgoPrediction(k, "spline") - start;
+        double s = _solver->getEgoPrediction(k, ModelIndex::SPLINE) - start;
         path_x.push_back(ax * s * s * s + bx * s * s + cx * s + dx);
         path_y.push_back(ay * s * s * s + by * s * s + cy * s + dy);
 
@@ -480,7 +476,7 @@ namespace MPCPlanner
 
     for (int k = 0; k < _solver->N; k++)
     {
-      double cur_s = _solver->getEgoPrediction(k, "spline");
+      double cur_s = _solver->getEgoPrediction(k, ModelIndex::SPLINE);
       Eigen::Vector2d path_point = _spline->getPoint(cur_s);
       points.addPointMarker(path_point);
     }
@@ -492,6 +488,7 @@ namespace MPCPlanner
   {
     _spline.reset();
     _closest_segment = 0;
+    _road_width = SETTINGS.road.width;
   }
 
 } // namespace MPCPlanner
\ No newline at end of file
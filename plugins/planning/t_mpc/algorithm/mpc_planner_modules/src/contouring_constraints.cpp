@@ -16,7 +16,7 @@ namespace MPCPlanner
     LOG_INITIALIZE("Contouring Constraints");
     LOG_INITIALIZED();
 
-    _num_segments = CONFIG["contouring"]["num_segments"].as<int>();
+    _num_segments = SETTINGS.contouring.num_segments;
   }
 
   void ContouringConstraints::update(State &state, const RealTimeData &data, ModuleData &module_data)
@@ -135,7 +135,7 @@ namespace MPCPlanner
     (void)data;
     (void)module_data;
 
-    if (!CONFIG["debug_visuals"].as<bool>())
+    if (!SETTINGS.debug_visuals)
       return;
 
     LOG_MARK("ContouringConstraints::Visualize");
@@ -181,7 +181,7 @@ namespace MPCPlanner
     for (int k = 1; k < _solver->N; k++)
     {
 
-      double cur_s = _solver->getOutput(k, "spline");
+      double cur_s = _solver->getOutput(k, ModelIndex::SPLINE);
       Eigen::Vector2d path_point = module_data.path->getPoint(cur_s);
 
       points.setColorInt(5, 10);
@@ -194,8 +194,8 @@ namespace MPCPlanner
       Eigen::Vector2d boundary_right = path_point + dpath * (_width_right->operator()(cur_s));
 
       // Visualize the contouring error
-      double w_cur = CONFIG["robot"]["width"].as<double>() / 2.;
-      Eigen::Vector2d pos(_solver->getOutput(k, "x"), _solver->getOutput(k, "y"));
+      double w_cur = SETTINGS.robot.width / 2.;
+      Eigen::Vector2d pos(_solver->getOutput(k, ModelIndex::X), _solver->getOutput(k, ModelIndex::Y));
 
       points.setColor(0., 0., 0.);
       points.addPointMarker(pos, 0.2); // Planned positions and black dots
@@ -18,32 +18,30 @@ namespace MPCPlanner
         (void)module_data;
 
         // Retrieve weights once
-        static double contouring_weight, reference_velocity, velocity_weight;
-        static double terminal_angle_weight, terminal_contouring_weight;
         if (k == 0)
         {
-            contouring_weight = CONFIG["weights"]["contour"].as<double>();
+            _contouring_weight = SETTINGS.weights.contour;
 
-            terminal_angle_weight = CONFIG["weights"]["terminal_angle"].as<double>();
-            terminal_contouring_weight = CONFIG["weights"]["terminal_contouring"].as<double>();
+            _terminal_angle_weight = SETTINGS.weights.terminal_angle;
+            _terminal_contouring_weight = SETTINGS.weights.terminal_contouring;
 
             if (_dynamic_velocity_reference)
             {
-                velocity_weight = CONFIG["weights"]["velocity"].as<double>();
-                reference_velocity = CONFIG["weights"]["reference_velocity"].as<double>();
+                _velocity_weight = SETTINGS.weights.velocity;
+                _reference_velocity = SETTINGS.weights.reference_velocity;
             }
         }
 
         {
-            setSolverParameterContour(k, _solver->_params, contouring_weight);
+            setSolverParameterContour(k, _solver->_params, _contouring_weight);
 
-            setSolverParameterTerminalAngle(k, _solver->_params, terminal_angle_weight);
-            setSolverParameterTerminalContouring(k, _solver->_params, terminal_contouring_weight);
+            setSolverParameterTerminalAngle(k, _solver->_params, _terminal_angle_weight);
+            setSolverParameterTerminalContouring(k, _solver->_params, _terminal_contouring_weight);
 
             if (_dynamic_velocity_reference)
             {
-                setSolverParameterVelocity(k, _solver->_params, velocity_weight);
-                setSolverParameterReferenceVelocity(k, _solver->_params, reference_velocity);
+                setSolverParameterVelocity(k, _solver->_params, _velocity_weight);
+                setSolverParameterReferenceVelocity(k, _solver->_params, _reference_velocity);
             }
         }
 
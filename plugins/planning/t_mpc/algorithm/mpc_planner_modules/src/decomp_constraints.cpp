@@ -9,6 +9,8 @@
 #include <mpc_planner_util/parameters.h>
 #include <mpc_planner_util/data_visualization.h>
 
+#include <guidance_planner/parallel.h>
+
 #include <ros_tools/profiling.h>
 #include <ros_tools/visuals.h>
 #include <ros_tools/spline.h>
@@ -24,23 +26,28 @@ namespace MPCPlanner
     _decomp_util = std::make_unique<EllipsoidDecomp2D>();
 
     // Only look around for obstacles using a box with sides of width 2*range
-    double range = CONFIG["decomp"]["range"].as<double>();
+    double range = SETTINGS.decomp.range;
     _decomp_util->set_local_bbox(Vec2f(range, range));
 
+    // Keep the polyhedra of segments that barely moved and are still obstacle free
+    _decomp_util->set_reuse_tolerance(SETTINGS.decomp.reuse_tolerance);
+    if (SETTINGS.decomp.parallel)
+      _decomp_util->set_executor(GuidancePlanner::ParallelFor);
+
     _occ_pos.reserve(1000); // Reserve some space for the occupied positions
 
-    _n_discs = CONFIG["n_discs"].as<int>(); // Is overwritten to 1 for topology constraints
+    _n_discs = SETTINGS.n_discs; // Is overwritten to 1 for topology constraints
 
-    _max_constraints = CONFIG["decomp"]["max_constraints"].as<int>();
+    _max_constraints = SETTINGS.decomp.max_constraints;
     _a1.resize(_n_discs);
     _a2.resize(_n_discs);
     _b.resize(_n_discs);
     for (int d = 0; d < _n_discs; d++)
     {
-      _a1[d].resize(CONFIG["N"].as<int>());
-      _a2[d].resize(CONFIG["N"].as<int>());
-      _b[d].resize(CONFIG["N"].as<int>());
-      for (int k = 0; k < CONFIG["N"].as<int>(); k++)
+      _a1[d].resize(SETTINGS.N);
+      _a2[d].resize(SETTINGS.N);
+      _b[d].resize(SETTINGS.N);
+      for (int k = 0; k < SETTINGS.N; k++)
       {
         _a1[d][k] = Eigen::ArrayXd(_max_constraints);
         _a2[d][k] = Eigen::ArrayXd(_max_constraints);
@@ -61,9 +68,8 @@ namespace MPCPlanner
 
     _dummy_b = state.get("x") + 100.;
 
-    getOccupiedGridCells(data); // Retrieve occupied points from the costmap
-
-    _decomp_util->set_obs(_occ_pos); // Set them
+    if (getOccupiedGridCells(data)) // Retrieve occupied points from the costmap
+      _decomp_util->set_obs(_occ_pos); // Set them (rebuilds the obstacle grid)
 
     // getPath(path);
 
@@ -72,17 +78,17 @@ namespace MPCPlanner
     for (int k = 0; k < _solver->N; k++)
     {
       // Local path //
-      // path.emplace_back(_solver->getEgoPrediction(k, "x"), _solver->getEgoPrediction(k, "y")); // k = 0 is initial state
+      // path.emplace_back(_solver->getEgoPrediction(k, ModelIndex::X), _solver->getEgoPrediction(k, ModelIndex::Y)); // k = 0 is initial state
 
       // Global (reference) path //
       auto path_pos = module_data.path->getPoint(s);
       path.emplace_back(path_pos(0), path_pos(1));
 
-      double v = _solver->getEgoPrediction(k, "v"); // Use the predicted velocity
+      double v = _solver->getEgoPrediction(k, ModelIndex::V); // Use the predicted velocity
 
       s += v * _solver->dt;
     }
-    _decomp_util->dilate(path, 0, false);
+    _decomp_util->dilate(path, 0);
 
     _decomp_util->set_constraints(_constraints, 0.); // Map is already inflated
     _polyhedrons = _decomp_util->get_polyhedrons();
@@ -130,7 +136,7 @@ namespace MPCPlanner
     const auto &costmap = *data.costmap;
 
     // Store all occupied cells in the grid map
-    _occ_pos.clear();
+    _occ_pos_new.clear();
     double x, y;
     for (unsigned int i = 0; i < costmap.getSizeInCellsX(); i++)
     {
@@ -142,16 +148,22 @@ namespace MPCPlanner
         costmap.mapToWorld(i, j, x, y);
         // LOG_INFO("Obstacle at x = " << x << ", y = " << y);
 
-        _occ_pos.emplace_back(x, y);
+        _occ_pos_new.emplace_back(x, y);
       }
     }
-    // LOG_VALUE("Occupied cells", _occ_pos.size());
+    // LOG_VALUE("Occupied cells", _occ_pos_new.size());
 #else
     (void)data;
-    _occ_pos.clear();
+    _occ_pos_new.clear();
     LOG_WARN("DecompConstraints: costmap_2d not available in non-ROS mode");
 #endif
 
+    // Only rebuild the obstacles in DecompUtil when the map changed
+    if (_occ_pos_initialized && _occ_pos_new == _occ_pos)
+      return false;
+
+    _occ_pos.swap(_occ_pos_new);
+    _occ_pos_initialized = true;
     return true;
   }
 
@@ -224,7 +236,7 @@ namespace MPCPlanner
     {
       for (auto &obs : _occ_pos)
       {
-        double radius = CONFIG["robot_radius"].as<double>() + 0.1;
+        double radius = SETTINGS.robot_radius + 0.1;
 
         dr_projection_.douglasRachfordProjection(pos, obs, _occ_pos[0], radius, pos);
       }
@@ -246,7 +258,7 @@ namespace MPCPlanner
 
     auto &polyline = publisher.getNewLine();
     polyline.setScale(0.1, 0.1);
-    for (int k = 0; k < _solver->N; k += CONFIG["visualization"]["draw_every"].as<int>())
+    for (int k = 0; k < _solver->N; k += SETTINGS.visualization.draw_every)
     {
       const auto &poly = _polyhedrons[k];
       polyline.setColorInt(k, _solver->N);
@@ -273,7 +285,7 @@ namespace MPCPlanner
 
     publisher.publish();
 
-    if (!CONFIG["debug_visuals"].as<bool>())
+    if (!SETTINGS.debug_visuals)
       return;
 
     LOG_MARK("DecompConstraints::Visualize");
@@ -16,9 +16,9 @@ namespace MPCPlanner
     LOG_INITIALIZE("Ellipsoid Constraints");
     LOG_INITIALIZED();
 
-    _n_discs = CONFIG["n_discs"].as<int>();
-    _robot_radius = CONFIG["robot_radius"].as<double>();
-    _risk = CONFIG["probabilistic"]["risk"].as<double>();
+    _n_discs = SETTINGS.n_discs;
+    _robot_radius = SETTINGS.robot_radius;
+    _risk = SETTINGS.probabilistic.risk;
   }
 
   void EllipsoidConstraints::update(State &state, const RealTimeData &data, ModuleData &module_data)
@@ -97,7 +97,7 @@ namespace MPCPlanner
       return false;
     }
 
-    if (data.dynamic_obstacles.size() != CONFIG["max_obstacles"].as<unsigned int>())
+    if (data.dynamic_obstacles.size() != static_cast<size_t>(SETTINGS.max_obstacles))
     {
       missing_data += "Obstacles ";
       return false;
@@ -32,8 +32,8 @@ namespace MPCPlanner
   {
     (void)module_data;
 
-    setSolverParameterEgoDiscRadius(k, _solver->_params, CONFIG["robot_radius"].as<double>());
-    for (int d = 0; d < CONFIG["n_discs"].as<int>(); d++)
+    setSolverParameterEgoDiscRadius(k, _solver->_params, SETTINGS.robot_radius);
+    for (int d = 0; d < SETTINGS.n_discs; d++)
       setSolverParameterEgoDiscOffset(k, _solver->_params, data.robot_area[d].offset, d);
 
     if (k == 0) // Dummies
@@ -72,15 +72,15 @@ namespace MPCPlanner
           setSolverParameterGaussianObstMajor(k, _solver->_params, 0.001, i);
           setSolverParameterGaussianObstMinor(k, _solver->_params, 0.001, i);
         }
-        setSolverParameterGaussianObstRisk(k, _solver->_params, CONFIG["probabilistic"]["risk"].as<double>(), i);
-        setSolverParameterGaussianObstR(k, _solver->_params, CONFIG["obstacle_radius"].as<double>(), i);
+        setSolverParameterGaussianObstRisk(k, _solver->_params, SETTINGS.probabilistic.risk, i);
+        setSolverParameterGaussianObstR(k, _solver->_params, SETTINGS.obstacle_radius, i);
       }
     }
   }
 
   bool GaussianConstraints::isDataReady(const RealTimeData &data, std::string &missing_data)
   {
-    if (data.dynamic_obstacles.size() != CONFIG["max_obstacles"].as<unsigned int>())
+    if (data.dynamic_obstacles.size() != static_cast<size_t>(SETTINGS.max_obstacles))
     {
       missing_data += "Obstacles ";
       return false;
@@ -116,12 +116,12 @@ namespace MPCPlanner
     for (auto &obstacle : data.dynamic_obstacles)
     {
 
-      for (int k = 1; k < _solver->N; k += CONFIG["visualization"]["draw_every"].as<int>())
+      for (int k = 1; k < _solver->N; k += SETTINGS.visualization.draw_every)
       {
         ellipsoid.setColorInt(k, _solver->N, 0.5);
 
         double chi = obstacle.type == ObstacleType::DYNAMIC
-                         ? RosTools::ExponentialQuantile(0.5, 1.0 - CONFIG["probabilistic"]["risk"].as<double>())
+                         ? RosTools::ExponentialQuantile(0.5, 1.0 - SETTINGS.probabilistic.risk)
                          : 0.;
         ellipsoid.setScale(2 * (obstacle.prediction.modes[0][k - 1].major_radius * std::sqrt(chi) + obstacle.radius),
                            2 * (obstacle.prediction.modes[0][k - 1].major_radius * std::sqrt(chi) + obstacle.radius), 0.005);
@@ -33,7 +33,7 @@ namespace MPCPlanner
 
         setSolverParameterGoalX(k, _solver->_params, data.goal(0));
         setSolverParameterGoalY(k, _solver->_params, data.goal(1));
-        setSolverParameterGoalWeight(k, _solver->_params, CONFIG["weights"]["goal"].as<double>());
+        setSolverParameterGoalWeight(k, _solver->_params, SETTINGS.weights.goal);
     }
 
     bool GoalModule::isDataReady(const RealTimeData &data, std::string &missing_data)
@@ -10,16 +10,16 @@
 #include <ros_tools/data_saver.h>
 #include <ros_tools/math.h>
 
-#include <omp.h>
+#include <guidance_planner/parallel.h>
 
 using namespace RosTools;
 
 namespace MPCPlanner
 {
-    GuidanceConstraints::LocalPlanner::LocalPlanner(int _id, bool _is_original_planner)
-        : id(_id), is_original_planner(_is_original_planner)
+    GuidanceConstraints::LocalPlanner::LocalPlanner(int _id, std::shared_ptr<Solver> solver, bool _is_original_planner)
+        : id(_id), local_solver(solver), is_original_planner(_is_original_planner)
     {
-        local_solver = std::make_shared<Solver>(_id + 1); // Populate 1-n_solvers (leave 0 for the regular solver)
+        profile_name = "Guidance Constraints: Planner " + std::to_string(_id) + (is_original_planner ? " (T-MPC++)" : "");
         guidance_constraints = std::make_unique<LinearizedConstraints>(local_solver);
         safety_constraints = std::make_unique<GUIDANCE_CONSTRAINTS_TYPE>(local_solver);
 
@@ -32,13 +32,13 @@ namespace MPCPlanner
         LOG_INITIALIZE("Guidance Constraints");
 
         global_guidance_ = std::make_shared<GuidancePlanner::GlobalGuidance>();
-        GuidancePlanner::Config::debug_visuals_ = CONFIG["debug_visuals"].as<bool>();
+        GuidancePlanner::Config::debug_visuals_ = SETTINGS.debug_visuals;
 
-        global_guidance_->SetPlanningFrequency(CONFIG["control_frequency"].as<double>());
+        global_guidance_->SetPlanningFrequency(SETTINGS.control_frequency);
 
-        _use_tmpcpp = CONFIG["t-mpc"]["use_t-mpc++"].as<bool>();
-        _enable_constraints = CONFIG["t-mpc"]["enable_constraints"].as<bool>();
-        _control_frequency = CONFIG["control_frequency"].as<double>();
+        _use_tmpcpp = SETTINGS.tmpc.use_tmpcpp;
+        _enable_constraints = SETTINGS.tmpc.enable_constraints;
+        _control_frequency = SETTINGS.control_frequency;
         _planning_time = 1. / _control_frequency;
 
         // Initialize the constraint modules
@@ -47,15 +47,21 @@ namespace MPCPlanner
         ROSTOOLS_ASSERT(n_solvers > 0 || _use_tmpcpp, "Guidance constraints cannot run with 0 paths and T-MPC++ disabled!");
 
         LOG_VALUE("Solvers", n_solvers);
+
+        // Solver i + 1 for planner i (leave 0 for the regular solver), each constructed on the worker that runs it
+        int n_planners = n_solvers + (_use_tmpcpp ? 1 : 0);
+        solver_arena_ = SolverArena<Solver>::create(1, n_planners, GuidancePlanner::ParallelFor);
+
+        planners_.reserve(n_planners);
         for (int i = 0; i < n_solvers; i++)
         {
-            planners_.emplace_back(i);
+            planners_.emplace_back(i, solver_arena_->get(i));
         }
 
         if (_use_tmpcpp) // ADD IT AS FIRST PLAN
         {
             LOG_INFO("Using T-MPC++ (Adding the non-guided planner in parallel)");
-            planners_.emplace_back(n_solvers, true);
+            planners_.emplace_back(n_solvers, solver_arena_->get(n_solvers), true);
         }
 
         LOG_INITIALIZED();
@@ -93,9 +99,9 @@ namespace MPCPlanner
         if (module_data.path_velocity != nullptr)
             global_guidance_->SetReferenceVelocity(module_data.path_velocity->operator()(state.get("spline")));
         else
-            global_guidance_->SetReferenceVelocity(CONFIG["weights"]["reference_velocity"].as<double>());
+            global_guidance_->SetReferenceVelocity(SETTINGS.weights.reference_velocity);
 
-        if (!CONFIG["enable_output"].as<bool>())
+        if (!SETTINGS.enable_output)
         {
             LOG_INFO_THROTTLE(15000, "Not propagating nodes (output is disabled)");
             global_guidance_->DoNotPropagateNodes();
@@ -119,13 +125,14 @@ namespace MPCPlanner
         LOG_MARK("Setting guidance planner goals");
 
         double current_s = state.get("spline");
-        double robot_radius = CONFIG["robot_radius"].as<double>();
+        double robot_radius = SETTINGS.robot_radius;
 
         if (module_data.path_velocity == nullptr || module_data.path_width_left == nullptr || module_data.path_width_right == nullptr)
         {
+            double road_width = module_data.road_width >= 0. ? module_data.road_width : SETTINGS.road.width;
             global_guidance_->LoadReferencePath(std::max(0., state.get("spline")), module_data.path,
-                                                CONFIG["road"]["width"].as<double>() / 2. - robot_radius - 0.1,
-                                                CONFIG["road"]["width"].as<double>() / 2. - robot_radius - 0.1);
+                                                road_width / 2. - robot_radius - 0.1,
+                                                road_width / 2. - robot_radius - 0.1);
             return;
         }
 
@@ -266,22 +273,19 @@ namespace MPCPlanner
     int GuidanceConstraints::optimize(State &state, const RealTimeData &data, ModuleData &module_data)
     {
         PROFILE_FUNCTION();
-        // Required for parallel call to the solvers when using Forces
-        omp_set_nested(1);
-        omp_set_max_active_levels(2);
-        omp_set_dynamic(0);
         LOG_MARK("Guidance Constraints: optimize");
 
         if (!_use_tmpcpp && !global_guidance_->Succeeded())
             return 0;
 
-        bool shift_forward = CONFIG["shift_previous_solution_forward"].as<bool>() &&
-                             CONFIG["enable_output"].as<bool>();
+        bool shift_forward = SETTINGS.shift_previous_solution_forward &&
+                             SETTINGS.enable_output;
 
-#pragma omp parallel for num_threads(8)
-        for (auto &planner : planners_)
-        {
-            PROFILE_SCOPE("Guidance Constraints: Parallel Optimization");
+        // Planner i always runs on the same pool worker, so its solver memory stays on one core across iterations
+        GuidancePlanner::ParallelFor(static_cast<int>(planners_.size()), [&](int i)
+                                     {
+            auto &planner = planners_[i];
+            PROFILE_SCOPE(planner.profile_name.c_str()); // One row per solver in the profiler
             planner.result.Reset();
             planner.disabled = false;
 
@@ -290,7 +294,7 @@ namespace MPCPlanner
                 if (!planner.is_original_planner) // We still want to add the original planner!
                 {
                     planner.disabled = true;
-                    continue;
+                    return;
                 }
             }
 
@@ -309,7 +313,7 @@ namespace MPCPlanner
             {
                 LOG_MARK("Planner [" << planner.id << "]: Loading guidance into the solver and constructing constraints");
 
-                if (CONFIG["t-mpc"]["warmstart_with_mpc_solution"].as<bool>() && planner.existing_guidance)
+                if (SETTINGS.tmpc.warmstart_with_mpc_solution && planner.existing_guidance)
                     planner.local_solver->initializeWarmstart(state, shift_forward);
                 else
                     initializeSolverWithGuidance(planner);
@@ -359,10 +363,7 @@ namespace MPCPlanner
 
                 if (guidance_trajectory.previously_selected_) // Prefer the selected trajectory
                     planner.result.objective *= global_guidance_->GetConfig()->selection_weight_consistency_;
-            }
-        }
-
-        omp_set_dynamic(1);
+            } });
 
         {
             PROFILE_SCOPE("Decision");
@@ -406,12 +407,12 @@ namespace MPCPlanner
             int index = k;
             Eigen::Vector2d cur_position = trajectory_spline.getPoint((double)(index)*solver->dt); // The plan is one ahead
             // global_guidance_->ProjectToFreeSpace(cur_position, k + 1);
-            solver->setEgoPrediction(k, "x", cur_position(0));
-            solver->setEgoPrediction(k, "y", cur_position(1));
+            solver->setEgoPrediction(k, ModelIndex::X, cur_position(0));
+            solver->setEgoPrediction(k, ModelIndex::Y, cur_position(1));
 
             Eigen::Vector2d cur_velocity = trajectory_spline.getVelocity((double)(index)*solver->dt); // The plan is one ahead
-            solver->setEgoPrediction(k, "psi", std::atan2(cur_velocity(1), cur_velocity(0)));
-            solver->setEgoPrediction(k, "v", cur_velocity.norm());
+            solver->setEgoPrediction(k, ModelIndex::PSI, std::atan2(cur_velocity(1), cur_velocity(0)));
+            solver->setEgoPrediction(k, ModelIndex::V, cur_velocity.norm());
         }
     }
 
@@ -445,7 +446,7 @@ namespace MPCPlanner
 
         // global_guidance_->Visualize(highlight_selected_guidance_, visualized_guidance_trajectory_nr_);
         if (!(_use_tmpcpp && global_guidance_->GetConfig()->n_paths_ == 0)) // If global guidance
-            global_guidance_->Visualize(CONFIG["t-mpc"]["highlight_selected"].as<bool>(), -1);
+            global_guidance_->Visualize(SETTINGS.tmpc.highlight_selected, -1);
         for (size_t i = 0; i < planners_.size(); i++)
         {
             auto &planner = planners_[i];
@@ -459,11 +460,11 @@ namespace MPCPlanner
             }
 
             // Visualize the warmstart
-            if (CONFIG["debug_visuals"].as<bool>())
+            if (SETTINGS.debug_visuals)
             {
                 Trajectory initial_trajectory;
                 for (int k = 1; k < planner.local_solver->N; k++)
-                    initial_trajectory.add(planner.local_solver->getEgoPrediction(k, "x"), planner.local_solver->getEgoPrediction(k, "y"));
+                    initial_trajectory.add(planner.local_solver->getEgoPrediction(k, ModelIndex::X), planner.local_solver->getEgoPrediction(k, ModelIndex::Y));
                 visualizeTrajectory(initial_trajectory, _name + "/warmstart_trajectories", false, 0.2, 20, 20);
             }
 
@@ -472,7 +473,7 @@ namespace MPCPlanner
             {
                 Trajectory trajectory;
                 for (int k = 1; k < _solver->N; k++)
-                    trajectory.add(planner.local_solver->getOutput(k, "x"), planner.local_solver->getOutput(k, "y"));
+                    trajectory.add(planner.local_solver->getOutput(k, ModelIndex::X), planner.local_solver->getOutput(k, ModelIndex::Y));
 
                 if ((int)i == best_planner_index_)
                     visualizeTrajectory(trajectory, _name + "/optimized_trajectories", false, 1.0, -1, 12, true, false);
@@ -487,7 +488,7 @@ namespace MPCPlanner
 
         {
             VISUALS.getPublisher(_name + "/optimized_trajectories").publish();
-            if (CONFIG["debug_visuals"].as<bool>())
+            if (SETTINGS.debug_visuals)
                 VISUALS.getPublisher(_name + "/warmstart_trajectories").publish();
         }
     }
@@ -582,7 +583,7 @@ namespace MPCPlanner
                 // {
                 //     data_saver.AddData(
                 //         "solver" + std::to_string(i) + "_plan" + std::to_string(k),
-                //         Eigen::Vector2d(_solver->getOutput(k, "x"), _solver->getOutput(k, "y")));
+                //         Eigen::Vector2d(_solver->getOutput(k, ModelIndex::X), _solver->getOutput(k, ModelIndex::Y)));
                 // }
             }
             // data_saver.AddData("active_constraints_" + std::to_string(planner.id), planner.guidance_constraints->NumActiveConstraints(planner.local_solver.get()));
@@ -621,8 +622,8 @@ namespace MPCPlanner
             {
                 for (int k = 1; k < _solver->N; ++k)
                 {
-                    c.traj.add(planner.local_solver->getOutput(k, "x"),
-                               planner.local_solver->getOutput(k, "y"));
+                    c.traj.add(planner.local_solver->getOutput(k, ModelIndex::X),
+                               planner.local_solver->getOutput(k, ModelIndex::Y));
                 }
             }
             out.push_back(std::move(c));
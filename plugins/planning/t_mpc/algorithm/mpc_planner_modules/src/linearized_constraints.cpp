@@ -15,20 +15,20 @@ namespace MPCPlanner
       : ControllerModule(ModuleType::CONSTRAINT, solver, "linearized_constraints")
   {
     LOG_INITIALIZE("Linearized Constraints");
-    _n_discs = CONFIG["n_discs"].as<int>(); // Is overwritten to 1 for topology constraints
+    _n_discs = SETTINGS.n_discs; // Is overwritten to 1 for topology constraints
 
-    _n_other_halfspaces = CONFIG["linearized_constraints"]["add_halfspaces"].as<int>();
-    _max_obstacles = CONFIG["max_obstacles"].as<int>();
+    _n_other_halfspaces = SETTINGS.linearized_constraints.add_halfspaces;
+    _max_obstacles = SETTINGS.max_obstacles;
     int n_constraints = _max_obstacles + _n_other_halfspaces;
-    _a1.resize(CONFIG["n_discs"].as<int>());
-    _a2.resize(CONFIG["n_discs"].as<int>());
-    _b.resize(CONFIG["n_discs"].as<int>());
-    for (int d = 0; d < CONFIG["n_discs"].as<int>(); d++)
+    _a1.resize(SETTINGS.n_discs);
+    _a2.resize(SETTINGS.n_discs);
+    _b.resize(SETTINGS.n_discs);
+    for (int d = 0; d < SETTINGS.n_discs; d++)
     {
-      _a1[d].resize(CONFIG["N"].as<int>());
-      _a2[d].resize(CONFIG["N"].as<int>());
-      _b[d].resize(CONFIG["N"].as<int>());
-      for (int k = 0; k < CONFIG["N"].as<int>(); k++)
+      _a1[d].resize(SETTINGS.N);
+      _a2[d].resize(SETTINGS.N);
+      _b[d].resize(SETTINGS.N);
+      for (int k = 0; k < SETTINGS.N; k++)
       {
         _a1[d][k] = Eigen::ArrayXd(n_constraints);
         _a2[d][k] = Eigen::ArrayXd(n_constraints);
@@ -62,13 +62,13 @@ namespace MPCPlanner
     {
       for (int d = 0; d < _n_discs; d++)
       {
-        Eigen::Vector2d pos(_solver->getEgoPrediction(k, "x"), _solver->getEgoPrediction(k, "y")); // k = 0 is initial state
+        Eigen::Vector2d pos(_solver->getEgoPrediction(k, ModelIndex::X), _solver->getEgoPrediction(k, ModelIndex::Y)); // k = 0 is initial state
 
         if (!_use_guidance) // Use discs and their positions
         {
           auto &disc = data.robot_area[d];
 
-          Eigen::Vector2d disc_pos = disc.getPosition(pos, _solver->getEgoPrediction(k, "psi"));
+          Eigen::Vector2d disc_pos = disc.getPosition(pos, _solver->getEgoPrediction(k, ModelIndex::PSI));
           projectToSafety(copied_obstacles, k, disc_pos); // Ensure that the vehicle position is collision-free
 
           /** @todo Set projected disc position */
@@ -101,7 +101,7 @@ namespace MPCPlanner
 
           _b[d][k](obs_id) = _a1[d][k](obs_id) * obstacle_pos(0) +
                              _a2[d][k](obs_id) * obstacle_pos(1) -
-                             (radius + CONFIG["robot_radius"].as<double>());
+                             (radius + SETTINGS.robot_radius);
         }
 
         if (!module_data.static_obstacles.empty() && (int)module_data.static_obstacles[k].size() < _n_other_halfspaces)
@@ -141,7 +141,7 @@ namespace MPCPlanner
 
         dr_projection_.douglasRachfordProjection(pos, obstacle.prediction.modes[0][k - 1].position,
                                                  copied_obstacles[0].prediction.modes[0][k - 1].position,
-                                                 radius + CONFIG["robot_radius"].as<double>(),
+                                                 radius + SETTINGS.robot_radius,
                                                  pos);
       }
     }
@@ -218,7 +218,7 @@ namespace MPCPlanner
   void LinearizedConstraints::visualize(const RealTimeData &data, const ModuleData &module_data)
   {
     (void)module_data;
-    if (_use_guidance && !CONFIG["debug_visuals"].as<bool>())
+    if (_use_guidance && !SETTINGS.debug_visuals)
       return;
 
     PROFILE_FUNCTION();
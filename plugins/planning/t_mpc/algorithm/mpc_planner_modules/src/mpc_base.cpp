@@ -2,15 +2,26 @@
 
 #include <mpc_planner_modules/definitions.h>
 
+#include <mpc_planner_solver/mpc_planner_parameters.h>
+
 #include <mpc_planner_util/parameters.h>
 
+#include <stdexcept>
+
 namespace MPCPlanner
 {
 
   MPCBaseModule::MPCBaseModule(std::shared_ptr<Solver> solver)
       : ControllerModule(ModuleType::OBJECTIVE, solver, "mpc_base")
   {
-    _weight_names = WEIGHT_PARAMS;
+    for (const std::string &weight : std::vector<std::string>(WEIGHT_PARAMS))
+    {
+      int parameter_index = solverParameterIndex(weight);
+      if (parameter_index < 0)
+        throw std::runtime_error("Weight \"" + weight + "\" is not a solver parameter");
+
+      _weights.push_back({parameter_index, SETTINGS.weights.get(weight)});
+    }
   }
 
   void MPCBaseModule::update(State &state, const RealTimeData &data, ModuleData &module_data)
@@ -28,9 +39,9 @@ namespace MPCPlanner
     if (k == 0)
       LOG_MARK("setParameters()");
 
-    for (auto &weight : _weight_names)
+    for (const auto &weight : _weights)
     {
-      _solver->setParameter(k, weight, CONFIG["weights"][weight].as<double>());
+      _solver->setParameter(k, weight.parameter_index, weight.value);
     }
   }
 } // namespace MPCPlanner
\ No newline at end of file
@@ -13,7 +13,7 @@ namespace MPCPlanner
   PathReferenceVelocity::PathReferenceVelocity(std::shared_ptr<Solver> solver)
       : ControllerModule(ModuleType::OBJECTIVE, solver, "path_reference_velocity")
   {
-    _n_segments = CONFIG["contouring"]["num_segments"].as<int>();
+    _n_segments = SETTINGS.contouring.num_segments;
   }
 
   void PathReferenceVelocity::update(State &state, const RealTimeData &data, ModuleData &module_data)
@@ -44,13 +44,11 @@ namespace MPCPlanner
     (void)module_data;
     (void)data;
 
-    static double reference_velocity; //, velocity_weight;
-
     // Retrieve once
     if (k == 0)
     {
       // velocity_weight = CONFIG["weights"]["velocity"].as<double>();
-      reference_velocity = CONFIG["weights"]["reference_velocity"].as<double>();
+      _reference_velocity = SETTINGS.weights.reference_velocity;
     }
 
     // Set the parameters for velocity tracking
@@ -90,7 +88,7 @@ namespace MPCPlanner
         setSolverParameterSplineVA(k, _solver->_params, 0., i);
         setSolverParameterSplineVB(k, _solver->_params, 0., i);
         setSolverParameterSplineVC(k, _solver->_params, 0., i);
-        setSolverParameterSplineVD(k, _solver->_params, reference_velocity, i); // v = d
+        setSolverParameterSplineVD(k, _solver->_params, _reference_velocity, i); // v = d
       }
     }
   }
@@ -101,7 +99,7 @@ namespace MPCPlanner
     if (data.reference_path.empty() || data.reference_path.s.empty())
       return;
 
-    if (!CONFIG["debug_visuals"].as<bool>())
+    if (!SETTINGS.debug_visuals)
       return;
 
     LOG_MARK("PathReferenceVelocity::Visualize");
@@ -7,9 +7,9 @@
 #include <ros_tools/math.h>
 #include <ros_tools/profiling.h>
 
-#include <algorithm>
+#include <guidance_planner/parallel.h>
 
-#include <omp.h>
+#include <algorithm>
 
 namespace MPCPlanner
 {
@@ -25,10 +25,10 @@ namespace MPCPlanner
   {
     LOG_INITIALIZE("Scenario Constraints");
 
-    _planning_time = 1. / CONFIG["control_frequency"].as<double>();
+    _planning_time = 1. / SETTINGS.control_frequency;
 
     _SCENARIO_CONFIG.Init();
-    for (int i = 0; i < CONFIG["scenario_constraints"]["parallel_solvers"].as<int>(); i++)
+    for (int i = 0; i < SETTINGS.scenario_constraints.parallel_solvers; i++)
     {
       _scenario_solvers.emplace_back(std::make_unique<ScenarioSolver>(i)); // May need an integer input
     }
@@ -39,13 +39,12 @@ namespace MPCPlanner
   {
     (void)state;
 
-#pragma omp parallel for num_threads(4)
-    for (auto &solver : _scenario_solvers)
-    {
+    GuidancePlanner::ParallelFor(static_cast<int>(_scenario_solvers.size()), [&](int i)
+                                 {
+      auto &solver = _scenario_solvers[i];
       *solver->solver = *_solver; // Copy the main solver, including its initial guess
 
-      solver->scenario_module.update(data, module_data);
-    }
+      solver->scenario_module.update(data, module_data); });
   }
 
   void ScenarioConstraints::setParameters(const RealTimeData &data, const ModuleData &module_data, int k)
@@ -60,13 +59,10 @@ namespace MPCPlanner
     (void)state;
     (void)module_data;
 
-    omp_set_nested(1);
-    omp_set_max_active_levels(2);
-    omp_set_dynamic(0);
+    GuidancePlanner::ParallelFor(static_cast<int>(_scenario_solvers.size()), [&](int i)
+                                 {
+      auto &solver = _scenario_solvers[i];
 
-#pragma omp parallel for num_threads(4)
-    for (auto &solver : _scenario_solvers)
-    {
       // Set the planning timeout
       std::chrono::duration<double> used_time = std::chrono::system_clock::now() - data.planning_start_time;
       solver->solver->_params.solver_timeout = _planning_time - used_time.count() - 0.008;
@@ -82,9 +78,7 @@ namespace MPCPlanner
 
       solver->solver->loadWarmstart(); // Load the previous solution
 
-      solver->exit_code = solver->scenario_module.optimize(data); // Safe Horizon MPC
-    }
-    omp_set_dynamic(1);
+      solver->exit_code = solver->scenario_module.optimize(data); }); // Safe Horizon MPC
 
     // Retrieve the lowest cost solution
     double lowest_cost = 1e9;
@@ -120,11 +114,9 @@ namespace MPCPlanner
       }
       if (_SCENARIO_CONFIG.enable_safe_horizon_)
       {
-#pragma omp parallel for num_threads(4)
-        for (auto &solver : _scenario_solvers) // Draw different samples for all solvers
-        {
-          solver->scenario_module.GetSampler().IntegrateAndTranslateToMeanAndVariance(data.dynamic_obstacles, _solver->dt);
-        }
+        // Draw different samples for all solvers
+        GuidancePlanner::ParallelFor(static_cast<int>(_scenario_solvers.size()), [&](int i)
+                                     { _scenario_solvers[i]->scenario_module.GetSampler().IntegrateAndTranslateToMeanAndVariance(data.dynamic_obstacles, _solver->dt); });
       }
     }
   }
@@ -132,7 +124,7 @@ namespace MPCPlanner
   bool ScenarioConstraints::isDataReady(const RealTimeData &data, std::string &missing_data)
   {
 
-    if (data.dynamic_obstacles.size() != CONFIG["max_obstacles"].as<unsigned int>())
+    if (data.dynamic_obstacles.size() != static_cast<size_t>(SETTINGS.max_obstacles))
     {
       missing_data += "Obstacles ";
       return false;
@@ -184,7 +176,7 @@ namespace MPCPlanner
       {
         Trajectory trajectory;
         for (int k = 1; k < _solver->N; k++)
-          trajectory.add(solver->solver->getOutput(k, "x"), solver->solver->getOutput(k, "y"));
+          trajectory.add(solver->solver->getOutput(k, ModelIndex::X), solver->solver->getOutput(k, ModelIndex::Y));
 
         visualizeTrajectory(trajectory, _name + "/optimized_trajectories", false, 0.2, solver->solver->_solver_id, 2 * _scenario_solvers.size());
       }
@@ -4,6 +4,7 @@
 #include <iostream>
 
 #include <mpc_planner_solver/state.h>
+#include <mpc_planner_solver/mpc_planner_parameters.h>
 
 #include "acados/utils/print.h"
 #include "acados/utils/math.h"
@@ -193,18 +194,25 @@ namespace MPCPlanner
         int completeOneIteration();
 
         // PARAMETERS //
+        // Names are resolved through the generated tables in mpc_planner_parameters.h; per-stage loops
+        // should use the generated setSolverParameter* setters or the index overloads instead
         bool hasParameter(std::string &&parameter);
         void setParameter(int k, std::string &&parameter, double value);
         void setParameter(int k, std::string &parameter, double value);
+        void setParameter(int k, int parameter_index, double value) { _params.all_parameters[k * npar + parameter_index] = value; }
         double getParameter(int k, std::string &&parameter);
+        double getParameter(int k, int parameter_index) const { return _params.all_parameters[k * npar + parameter_index]; }
 
         // XINIT //
         void setXinit(std::string &&state_name, double value);
+        void setXinit(int var_index, double value) { _params.xinit[var_index - nu] = value; } // var_index: ModelIndex::*
         void setXinit(const State &state);
 
         // WARMSTART //
         void setEgoPrediction(unsigned int k, std::string &&var_name, double value); // Modify the initial guess
         double getEgoPrediction(unsigned int k, std::string &&var_name);             // Get the initial guess
+        void setEgoPrediction(unsigned int k, int var_index, double value) { _params.x0[k * nvar + var_index] = value; }
+        double getEgoPrediction(unsigned int k, int var_index) const { return _params.x0[k * nvar + var_index]; }
         void setEgoPredictionPosition(unsigned int k, const Eigen::Vector2d &value); // (same for positions)
         Eigen::Vector2d getEgoPredictionPosition(unsigned int k);
 
@@ -215,6 +223,10 @@ namespace MPCPlanner
 
         // OUTPUT //
         double getOutput(int k, std::string &&state_name) const;
+        double getOutput(int k, int var_index) const
+        {
+            return var_index >= (int)nu ? _output.xtraj[k * nx + var_index - nu] : _output.utraj[k * nu + var_index];
+        }
 
         // DEBUG //
         std::string explainExitFlag(int exitflag) const;
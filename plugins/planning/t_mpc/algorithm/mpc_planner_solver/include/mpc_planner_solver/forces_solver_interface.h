@@ -5,6 +5,7 @@
 #ifndef ACADOS_SOLVER
 
 #include <mpc_planner_solver/state.h>
+#include <mpc_planner_solver/mpc_planner_parameters.h>
 
 #include <mpc_planner_util/load_yaml.hpp>
 
@@ -72,6 +73,8 @@ namespace MPCPlanner
 
 		void setEgoPrediction(unsigned int k, std::string &&var_name, double value);
 		double getEgoPrediction(unsigned int k, std::string &&var_name);
+		void setEgoPrediction(unsigned int k, int var_index, double value); // var_index: ModelIndex::*
+		double getEgoPrediction(unsigned int k, int var_index) const;
 		void setEgoPredictionPosition(unsigned int k, const Eigen::Vector2d &value);
 		Eigen::Vector2d getEgoPredictionPosition(unsigned int k);
 
@@ -79,9 +82,12 @@ namespace MPCPlanner
 		bool hasParameter(std::string &&parameter);
 		void setParameter(int k, std::string &&parameter, double value);
 		void setParameter(int k, std::string &parameter, double value);
+		void setParameter(int k, int parameter_index, double value);
 		double getParameter(int k, std::string &&parameter);
+		double getParameter(int k, int parameter_index) const;
 
 		void setXinit(std::string &&state_name, double value);
+		void setXinit(int var_index, double value);
 		void setXinit(const State &state);
 
 		void initializeWithState(const State &initial_state);
@@ -100,6 +106,7 @@ namespace MPCPlanner
 		int completeOneIteration();
 
 		double getOutput(int k, std::string &&state_name) const;
+		double getOutput(int k, int var_index) const;
 
 		// Debugging utilities
 		std::string explainExitFlag(int exitflag);
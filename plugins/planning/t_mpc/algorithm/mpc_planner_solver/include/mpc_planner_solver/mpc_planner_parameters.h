@@ -1,10 +1,1138 @@
-/** This file was autogenerated by the mpc_planner_solver package at 02:35PM on November 07, 2025*/
+/** This file was autogenerated by the mpc_planner_solver package at 12:37AM on October 19, 2026*/
 #ifndef __MPC_PLANNER_PARAMETERS_H__
 #define __MPC_PLANNER_PARAMETERS_H__
 
+#include <string_view>
+
 namespace MPCPlanner{
 
 struct AcadosParameters;
+
+// Solver layout at generation time (mirrors parameter_map.yaml and model_map.yaml)
+constexpr int SOLVER_NUM_PARAMETERS = 1055; // Parameters per stage
+constexpr int MODEL_NU = 2; // Inputs come first in z = [u, x]
+constexpr int MODEL_NX = 5;
+constexpr int MODEL_NVAR = 7;
+
+/** @brief Index of each model variable in z = [u, x] */
+namespace ModelIndex{
+	constexpr int A = 0;
+	constexpr int W = 1;
+	constexpr int X = 2;
+	constexpr int Y = 3;
+	constexpr int PSI = 4;
+	constexpr int V = 5;
+	constexpr int SPLINE = 6;
+}
+
+struct ModelVariable{
+	std::string_view name;
+	int index;
+	bool is_state;
+	double lower_bound;
+	double upper_bound;
+};
+
+/** @brief Model variables ordered by index */
+constexpr ModelVariable MODEL_VARIABLES[7] = {
+	{"a", 0, false, -2.0, 2.0},
+	{"w", 1, false, -0.8, 0.8},
+	{"x", 2, true, -2000.0, 2000.0},
+	{"y", 3, true, -2000.0, 2000.0},
+	{"psi", 4, true, -12.566370614359172, 12.566370614359172},
+	{"v", 5, true, -0.01, 3.0},
+	{"spline", 6, true, -1.0, 10000.0},
+};
+
+struct SolverParameterName{
+	std::string_view name;
+	int index;
+};
+
+/** @brief Per-stage parameter indices, sorted by name */
+constexpr SolverParameterName SOLVER_PARAMETER_NAMES[1055] = {
+	{"acceleration", 0},
+	{"angular_velocity", 1},
+	{"contour", 4},
+	{"ego_disc_0_offset", 354},
+	{"ego_disc_radius", 353},
+	{"ellipsoid_obst_0_chi", 360},
+	{"ellipsoid_obst_0_major", 358},
+	{"ellipsoid_obst_0_minor", 359},
+	{"ellipsoid_obst_0_psi", 357},
+	{"ellipsoid_obst_0_r", 361},
+	{"ellipsoid_obst_0_x", 355},
+	{"ellipsoid_obst_0_y", 356},
+	{"ellipsoid_obst_10_chi", 430},
+	{"ellipsoid_obst_10_major", 428},
+	{"ellipsoid_obst_10_minor", 429},
+	{"ellipsoid_obst_10_psi", 427},
+	{"ellipsoid_obst_10_r", 431},
+	{"ellipsoid_obst_10_x", 425},
+	{"ellipsoid_obst_10_y", 426},
+	{"ellipsoid_obst_11_chi", 437},
+	{"ellipsoid_obst_11_major", 435},
+	{"ellipsoid_obst_11_minor", 436},
+	{"ellipsoid_obst_11_psi", 434},
+	{"ellipsoid_obst_11_r", 438},
+	{"ellipsoid_obst_11_x", 432},
+	{"ellipsoid_obst_11_y", 433},
+	{"ellipsoid_obst_12_chi", 444},
+	{"ellipsoid_obst_12_major", 442},
+	{"ellipsoid_obst_12_minor", 443},
+	{"ellipsoid_obst_12_psi", 441},
+	{"ellipsoid_obst_12_r", 445},
+	{"ellipsoid_obst_12_x", 439},
+	{"ellipsoid_obst_12_y", 440},
+	{"ellipsoid_obst_13_chi", 451},
+	{"ellipsoid_obst_13_major", 449},
+	{"ellipsoid_obst_13_minor", 450},
+	{"ellipsoid_obst_13_psi", 448},
+	{"ellipsoid_obst_13_r", 452},
+	{"ellipsoid_obst_13_x", 446},
+	{"ellipsoid_obst_13_y", 447},
+	{"ellipsoid_obst_14_chi", 458},
+	{"ellipsoid_obst_14_major", 456},
+	{"ellipsoid_obst_14_minor", 457},
+	{"ellipsoid_obst_14_psi", 455},
+	{"ellipsoid_obst_14_r", 459},
+	{"ellipsoid_obst_14_x", 453},
+	{"ellipsoid_obst_14_y", 454},
+	{"ellipsoid_obst_15_chi", 465},
+	{"ellipsoid_obst_15_major", 463},
+	{"ellipsoid_obst_15_minor", 464},
+	{"ellipsoid_obst_15_psi", 462},
+	{"ellipsoid_obst_15_r", 466},
+	{"ellipsoid_obst_15_x", 460},
+	{"ellipsoid_obst_15_y", 461},
+	{"ellipsoid_obst_16_chi", 472},
+	{"ellipsoid_obst_16_major", 470},
+	{"ellipsoid_obst_16_minor", 471},
+	{"ellipsoid_obst_16_psi", 469},
+	{"ellipsoid_obst_16_r", 473},
+	{"ellipsoid_obst_16_x", 467},
+	{"ellipsoid_obst_16_y", 468},
+	{"ellipsoid_obst_17_chi", 479},
+	{"ellipsoid_obst_17_major", 477},
+	{"ellipsoid_obst_17_minor", 478},
+	{"ellipsoid_obst_17_psi", 476},
+	{"ellipsoid_obst_17_r", 480},
+	{"ellipsoid_obst_17_x", 474},
+	{"ellipsoid_obst_17_y", 475},
+	{"ellipsoid_obst_18_chi", 486},
+	{"ellipsoid_obst_18_major", 484},
+	{"ellipsoid_obst_18_minor", 485},
+	{"ellipsoid_obst_18_psi", 483},
+	{"ellipsoid_obst_18_r", 487},
+	{"ellipsoid_obst_18_x", 481},
+	{"ellipsoid_obst_18_y", 482},
+	{"ellipsoid_obst_19_chi", 493},
+	{"ellipsoid_obst_19_major", 491},
+	{"ellipsoid_obst_19_minor", 492},
+	{"ellipsoid_obst_19_psi", 490},
+	{"ellipsoid_obst_19_r", 494},
+	{"ellipsoid_obst_19_x", 488},
+	{"ellipsoid_obst_19_y", 489},
+	{"ellipsoid_obst_1_chi", 367},
+	{"ellipsoid_obst_1_major", 365},
+	{"ellipsoid_obst_1_minor", 366},
+	{"ellipsoid_obst_1_psi", 364},
+	{"ellipsoid_obst_1_r", 368},
+	{"ellipsoid_obst_1_x", 362},
+	{"ellipsoid_obst_1_y", 363},
+	{"ellipsoid_obst_20_chi", 500},
+	{"ellipsoid_obst_20_major", 498},
+	{"ellipsoid_obst_20_minor", 499},
+	{"ellipsoid_obst_20_psi", 497},
+	{"ellipsoid_obst_20_r", 501},
+	{"ellipsoid_obst_20_x", 495},
+	{"ellipsoid_obst_20_y", 496},
+	{"ellipsoid_obst_21_chi", 507},
+	{"ellipsoid_obst_21_major", 505},
+	{"ellipsoid_obst_21_minor", 506},
+	{"ellipsoid_obst_21_psi", 504},
+	{"ellipsoid_obst_21_r", 508},
+	{"ellipsoid_obst_21_x", 502},
+	{"ellipsoid_obst_21_y", 503},
+	{"ellipsoid_obst_22_chi", 514},
+	{"ellipsoid_obst_22_major", 512},
+	{"ellipsoid_obst_22_minor", 513},
+	{"ellipsoid_obst_22_psi", 511},
+	{"ellipsoid_obst_22_r", 515},
+	{"ellipsoid_obst_22_x", 509},
+	{"ellipsoid_obst_22_y", 510},
+	{"ellipsoid_obst_23_chi", 521},
+	{"ellipsoid_obst_23_major", 519},
+	{"ellipsoid_obst_23_minor", 520},
+	{"ellipsoid_obst_23_psi", 518},
+	{"ellipsoid_obst_23_r", 522},
+	{"ellipsoid_obst_23_x", 516},
+	{"ellipsoid_obst_23_y", 517},
+	{"ellipsoid_obst_24_chi", 528},
+	{"ellipsoid_obst_24_major", 526},
+	{"ellipsoid_obst_24_minor", 527},
+	{"ellipsoid_obst_24_psi", 525},
+	{"ellipsoid_obst_24_r", 529},
+	{"ellipsoid_obst_24_x", 523},
+	{"ellipsoid_obst_24_y", 524},
+	{"ellipsoid_obst_25_chi", 535},
+	{"ellipsoid_obst_25_major", 533},
+	{"ellipsoid_obst_25_minor", 534},
+	{"ellipsoid_obst_25_psi", 532},
+	{"ellipsoid_obst_25_r", 536},
+	{"ellipsoid_obst_25_x", 530},
+	{"ellipsoid_obst_25_y", 531},
+	{"ellipsoid_obst_26_chi", 542},
+	{"ellipsoid_obst_26_major", 540},
+	{"ellipsoid_obst_26_minor", 541},
+	{"ellipsoid_obst_26_psi", 539},
+	{"ellipsoid_obst_26_r", 543},
+	{"ellipsoid_obst_26_x", 537},
+	{"ellipsoid_obst_26_y", 538},
+	{"ellipsoid_obst_27_chi", 549},
+	{"ellipsoid_obst_27_major", 547},
+	{"ellipsoid_obst_27_minor", 548},
+	{"ellipsoid_obst_27_psi", 546},
+	{"ellipsoid_obst_27_r", 550},
+	{"ellipsoid_obst_27_x", 544},
+	{"ellipsoid_obst_27_y", 545},
+	{"ellipsoid_obst_28_chi", 556},
+	{"ellipsoid_obst_28_major", 554},
+	{"ellipsoid_obst_28_minor", 555},
+	{"ellipsoid_obst_28_psi", 553},
+	{"ellipsoid_obst_28_r", 557},
+	{"ellipsoid_obst_28_x", 551},
+	{"ellipsoid_obst_28_y", 552},
+	{"ellipsoid_obst_29_chi", 563},
+	{"ellipsoid_obst_29_major", 561},
+	{"ellipsoid_obst_29_minor", 562},
+	{"ellipsoid_obst_29_psi", 560},
+	{"ellipsoid_obst_29_r", 564},
+	{"ellipsoid_obst_29_x", 558},
+	{"ellipsoid_obst_29_y", 559},
+	{"ellipsoid_obst_2_chi", 374},
+	{"ellipsoid_obst_2_major", 372},
+	{"ellipsoid_obst_2_minor", 373},
+	{"ellipsoid_obst_2_psi", 371},
+	{"ellipsoid_obst_2_r", 375},
+	{"ellipsoid_obst_2_x", 369},
+	{"ellipsoid_obst_2_y", 370},
+	{"ellipsoid_obst_30_chi", 570},
+	{"ellipsoid_obst_30_major", 568},
+	{"ellipsoid_obst_30_minor", 569},
+	{"ellipsoid_obst_30_psi", 567},
+	{"ellipsoid_obst_30_r", 571},
+	{"ellipsoid_obst_30_x", 565},
+	{"ellipsoid_obst_30_y", 566},
+	{"ellipsoid_obst_31_chi", 577},
+	{"ellipsoid_obst_31_major", 575},
+	{"ellipsoid_obst_31_minor", 576},
+	{"ellipsoid_obst_31_psi", 574},
+	{"ellipsoid_obst_31_r", 578},
+	{"ellipsoid_obst_31_x", 572},
+	{"ellipsoid_obst_31_y", 573},
+	{"ellipsoid_obst_32_chi", 584},
+	{"ellipsoid_obst_32_major", 582},
+	{"ellipsoid_obst_32_minor", 583},
+	{"ellipsoid_obst_32_psi", 581},
+	{"ellipsoid_obst_32_r", 585},
+	{"ellipsoid_obst_32_x", 579},
+	{"ellipsoid_obst_32_y", 580},
+	{"ellipsoid_obst_33_chi", 591},
+	{"ellipsoid_obst_33_major", 589},
+	{"ellipsoid_obst_33_minor", 590},
+	{"ellipsoid_obst_33_psi", 588},
+	{"ellipsoid_obst_33_r", 592},
+	{"ellipsoid_obst_33_x", 586},
+	{"ellipsoid_obst_33_y", 587},
+	{"ellipsoid_obst_34_chi", 598},
+	{"ellipsoid_obst_34_major", 596},
+	{"ellipsoid_obst_34_minor", 597},
+	{"ellipsoid_obst_34_psi", 595},
+	{"ellipsoid_obst_34_r", 599},
+	{"ellipsoid_obst_34_x", 593},
+	{"ellipsoid_obst_34_y", 594},
+	{"ellipsoid_obst_35_chi", 605},
+	{"ellipsoid_obst_35_major", 603},
+	{"ellipsoid_obst_35_minor", 604},
+	{"ellipsoid_obst_35_psi", 602},
+	{"ellipsoid_obst_35_r", 606},
+	{"ellipsoid_obst_35_x", 600},
+	{"ellipsoid_obst_35_y", 601},
+	{"ellipsoid_obst_36_chi", 612},
+	{"ellipsoid_obst_36_major", 610},
+	{"ellipsoid_obst_36_minor", 611},
+	{"ellipsoid_obst_36_psi", 609},
+	{"ellipsoid_obst_36_r", 613},
+	{"ellipsoid_obst_36_x", 607},
+	{"ellipsoid_obst_36_y", 608},
+	{"ellipsoid_obst_37_chi", 619},
+	{"ellipsoid_obst_37_major", 617},
+	{"ellipsoid_obst_37_minor", 618},
+	{"ellipsoid_obst_37_psi", 616},
+	{"ellipsoid_obst_37_r", 620},
+	{"ellipsoid_obst_37_x", 614},
+	{"ellipsoid_obst_37_y", 615},
+	{"ellipsoid_obst_38_chi", 626},
+	{"ellipsoid_obst_38_major", 624},
+	{"ellipsoid_obst_38_minor", 625},
+	{"ellipsoid_obst_38_psi", 623},
+	{"ellipsoid_obst_38_r", 627},
+	{"ellipsoid_obst_38_x", 621},
+	{"ellipsoid_obst_38_y", 622},
+	{"ellipsoid_obst_39_chi", 633},
+	{"ellipsoid_obst_39_major", 631},
+	{"ellipsoid_obst_39_minor", 632},
+	{"ellipsoid_obst_39_psi", 630},
+	{"ellipsoid_obst_39_r", 634},
+	{"ellipsoid_obst_39_x", 628},
+	{"ellipsoid_obst_39_y", 629},
+	{"ellipsoid_obst_3_chi", 381},
+	{"ellipsoid_obst_3_major", 379},
+	{"ellipsoid_obst_3_minor", 380},
+	{"ellipsoid_obst_3_psi", 378},
+	{"ellipsoid_obst_3_r", 382},
+	{"ellipsoid_obst_3_x", 376},
+	{"ellipsoid_obst_3_y", 377},
+	{"ellipsoid_obst_40_chi", 640},
+	{"ellipsoid_obst_40_major", 638},
+	{"ellipsoid_obst_40_minor", 639},
+	{"ellipsoid_obst_40_psi", 637},
+	{"ellipsoid_obst_40_r", 641},
+	{"ellipsoid_obst_40_x", 635},
+	{"ellipsoid_obst_40_y", 636},
+	{"ellipsoid_obst_41_chi", 647},
+	{"ellipsoid_obst_41_major", 645},
+	{"ellipsoid_obst_41_minor", 646},
+	{"ellipsoid_obst_41_psi", 644},
+	{"ellipsoid_obst_41_r", 648},
+	{"ellipsoid_obst_41_x", 642},
+	{"ellipsoid_obst_41_y", 643},
+	{"ellipsoid_obst_42_chi", 654},
+	{"ellipsoid_obst_42_major", 652},
+	{"ellipsoid_obst_42_minor", 653},
+	{"ellipsoid_obst_42_psi", 651},
+	{"ellipsoid_obst_42_r", 655},
+	{"ellipsoid_obst_42_x", 649},
+	{"ellipsoid_obst_42_y", 650},
+	{"ellipsoid_obst_43_chi", 661},
+	{"ellipsoid_obst_43_major", 659},
+	{"ellipsoid_obst_43_minor", 660},
+	{"ellipsoid_obst_43_psi", 658},
+	{"ellipsoid_obst_43_r", 662},
+	{"ellipsoid_obst_43_x", 656},
+	{"ellipsoid_obst_43_y", 657},
+	{"ellipsoid_obst_44_chi", 668},
+	{"ellipsoid_obst_44_major", 666},
+	{"ellipsoid_obst_44_minor", 667},
+	{"ellipsoid_obst_44_psi", 665},
+	{"ellipsoid_obst_44_r", 669},
+	{"ellipsoid_obst_44_x", 663},
+	{"ellipsoid_obst_44_y", 664},
+	{"ellipsoid_obst_45_chi", 675},
+	{"ellipsoid_obst_45_major", 673},
+	{"ellipsoid_obst_45_minor", 674},
+	{"ellipsoid_obst_45_psi", 672},
+	{"ellipsoid_obst_45_r", 676},
+	{"ellipsoid_obst_45_x", 670},
+	{"ellipsoid_obst_45_y", 671},
+	{"ellipsoid_obst_46_chi", 682},
+	{"ellipsoid_obst_46_major", 680},
+	{"ellipsoid_obst_46_minor", 681},
+	{"ellipsoid_obst_46_psi", 679},
+	{"ellipsoid_obst_46_r", 683},
+	{"ellipsoid_obst_46_x", 677},
+	{"ellipsoid_obst_46_y", 678},
+	{"ellipsoid_obst_47_chi", 689},
+	{"ellipsoid_obst_47_major", 687},
+	{"ellipsoid_obst_47_minor", 688},
+	{"ellipsoid_obst_47_psi", 686},
+	{"ellipsoid_obst_47_r", 690},
+	{"ellipsoid_obst_47_x", 684},
+	{"ellipsoid_obst_47_y", 685},
+	{"ellipsoid_obst_48_chi", 696},
+	{"ellipsoid_obst_48_major", 694},
+	{"ellipsoid_obst_48_minor", 695},
+	{"ellipsoid_obst_48_psi", 693},
+	{"ellipsoid_obst_48_r", 697},
+	{"ellipsoid_obst_48_x", 691},
+	{"ellipsoid_obst_48_y", 692},
+	{"ellipsoid_obst_49_chi", 703},
+	{"ellipsoid_obst_49_major", 701},
+	{"ellipsoid_obst_49_minor", 702},
+	{"ellipsoid_obst_49_psi", 700},
+	{"ellipsoid_obst_49_r", 704},
+	{"ellipsoid_obst_49_x", 698},
+	{"ellipsoid_obst_49_y", 699},
+	{"ellipsoid_obst_4_chi", 388},
+	{"ellipsoid_obst_4_major", 386},
+	{"ellipsoid_obst_4_minor", 387},
+	{"ellipsoid_obst_4_psi", 385},
+	{"ellipsoid_obst_4_r", 389},
+	{"ellipsoid_obst_4_x", 383},
+	{"ellipsoid_obst_4_y", 384},
+	{"ellipsoid_obst_50_chi", 710},
+	{"ellipsoid_obst_50_major", 708},
+	{"ellipsoid_obst_50_minor", 709},
+	{"ellipsoid_obst_50_psi", 707},
+	{"ellipsoid_obst_50_r", 711},
+	{"ellipsoid_obst_50_x", 705},
+	{"ellipsoid_obst_50_y", 706},
+	{"ellipsoid_obst_51_chi", 717},
+	{"ellipsoid_obst_51_major", 715},
+	{"ellipsoid_obst_51_minor", 716},
+	{"ellipsoid_obst_51_psi", 714},
+	{"ellipsoid_obst_51_r", 718},
+	{"ellipsoid_obst_51_x", 712},
+	{"ellipsoid_obst_51_y", 713},
+	{"ellipsoid_obst_52_chi", 724},
+	{"ellipsoid_obst_52_major", 722},
+	{"ellipsoid_obst_52_minor", 723},
+	{"ellipsoid_obst_52_psi", 721},
+	{"ellipsoid_obst_52_r", 725},
+	{"ellipsoid_obst_52_x", 719},
+	{"ellipsoid_obst_52_y", 720},
+	{"ellipsoid_obst_53_chi", 731},
+	{"ellipsoid_obst_53_major", 729},
+	{"ellipsoid_obst_53_minor", 730},
+	{"ellipsoid_obst_53_psi", 728},
+	{"ellipsoid_obst_53_r", 732},
+	{"ellipsoid_obst_53_x", 726},
+	{"ellipsoid_obst_53_y", 727},
+	{"ellipsoid_obst_54_chi", 738},
+	{"ellipsoid_obst_54_major", 736},
+	{"ellipsoid_obst_54_minor", 737},
+	{"ellipsoid_obst_54_psi", 735},
+	{"ellipsoid_obst_54_r", 739},
+	{"ellipsoid_obst_54_x", 733},
+	{"ellipsoid_obst_54_y", 734},
+	{"ellipsoid_obst_55_chi", 745},
+	{"ellipsoid_obst_55_major", 743},
+	{"ellipsoid_obst_55_minor", 744},
+	{"ellipsoid_obst_55_psi", 742},
+	{"ellipsoid_obst_55_r", 746},
+	{"ellipsoid_obst_55_x", 740},
+	{"ellipsoid_obst_55_y", 741},
+	{"ellipsoid_obst_56_chi", 752},
+	{"ellipsoid_obst_56_major", 750},
+	{"ellipsoid_obst_56_minor", 751},
+	{"ellipsoid_obst_56_psi", 749},
+	{"ellipsoid_obst_56_r", 753},
+	{"ellipsoid_obst_56_x", 747},
+	{"ellipsoid_obst_56_y", 748},
+	{"ellipsoid_obst_57_chi", 759},
+	{"ellipsoid_obst_57_major", 757},
+	{"ellipsoid_obst_57_minor", 758},
+	{"ellipsoid_obst_57_psi", 756},
+	{"ellipsoid_obst_57_r", 760},
+	{"ellipsoid_obst_57_x", 754},
+	{"ellipsoid_obst_57_y", 755},
+	{"ellipsoid_obst_58_chi", 766},
+	{"ellipsoid_obst_58_major", 764},
+	{"ellipsoid_obst_58_minor", 765},
+	{"ellipsoid_obst_58_psi", 763},
+	{"ellipsoid_obst_58_r", 767},
+	{"ellipsoid_obst_58_x", 761},
+	{"ellipsoid_obst_58_y", 762},
+	{"ellipsoid_obst_59_chi", 773},
+	{"ellipsoid_obst_59_major", 771},
+	{"ellipsoid_obst_59_minor", 772},
+	{"ellipsoid_obst_59_psi", 770},
+	{"ellipsoid_obst_59_r", 774},
+	{"ellipsoid_obst_59_x", 768},
+	{"ellipsoid_obst_59_y", 769},
+	{"ellipsoid_obst_5_chi", 395},
+	{"ellipsoid_obst_5_major", 393},
+	{"ellipsoid_obst_5_minor", 394},
+	{"ellipsoid_obst_5_psi", 392},
+	{"ellipsoid_obst_5_r", 396},
+	{"ellipsoid_obst_5_x", 390},
+	{"ellipsoid_obst_5_y", 391},
+	{"ellipsoid_obst_60_chi", 780},
+	{"ellipsoid_obst_60_major", 778},
+	{"ellipsoid_obst_60_minor", 779},
+	{"ellipsoid_obst_60_psi", 777},
+	{"ellipsoid_obst_60_r", 781},
+	{"ellipsoid_obst_60_x", 775},
+	{"ellipsoid_obst_60_y", 776},
+	{"ellipsoid_obst_61_chi", 787},
+	{"ellipsoid_obst_61_major", 785},
+	{"ellipsoid_obst_61_minor", 786},
+	{"ellipsoid_obst_61_psi", 784},
+	{"ellipsoid_obst_61_r", 788},
+	{"ellipsoid_obst_61_x", 782},
+	{"ellipsoid_obst_61_y", 783},
+	{"ellipsoid_obst_62_chi", 794},
+	{"ellipsoid_obst_62_major", 792},
+	{"ellipsoid_obst_62_minor", 793},
+	{"ellipsoid_obst_62_psi", 791},
+	{"ellipsoid_obst_62_r", 795},
+	{"ellipsoid_obst_62_x", 789},
+	{"ellipsoid_obst_62_y", 790},
+	{"ellipsoid_obst_63_chi", 801},
+	{"ellipsoid_obst_63_major", 799},
+	{"ellipsoid_obst_63_minor", 800},
+	{"ellipsoid_obst_63_psi", 798},
+	{"ellipsoid_obst_63_r", 802},
+	{"ellipsoid_obst_63_x", 796},
+	{"ellipsoid_obst_63_y", 797},
+	{"ellipsoid_obst_64_chi", 808},
+	{"ellipsoid_obst_64_major", 806},
+	{"ellipsoid_obst_64_minor", 807},
+	{"ellipsoid_obst_64_psi", 805},
+	{"ellipsoid_obst_64_r", 809},
+	{"ellipsoid_obst_64_x", 803},
+	{"ellipsoid_obst_64_y", 804},
+	{"ellipsoid_obst_65_chi", 815},
+	{"ellipsoid_obst_65_major", 813},
+	{"ellipsoid_obst_65_minor", 814},
+	{"ellipsoid_obst_65_psi", 812},
+	{"ellipsoid_obst_65_r", 816},
+	{"ellipsoid_obst_65_x", 810},
+	{"ellipsoid_obst_65_y", 811},
+	{"ellipsoid_obst_66_chi", 822},
+	{"ellipsoid_obst_66_major", 820},
+	{"ellipsoid_obst_66_minor", 821},
+	{"ellipsoid_obst_66_psi", 819},
+	{"ellipsoid_obst_66_r", 823},
+	{"ellipsoid_obst_66_x", 817},
+	{"ellipsoid_obst_66_y", 818},
+	{"ellipsoid_obst_67_chi", 829},
+	{"ellipsoid_obst_67_major", 827},
+	{"ellipsoid_obst_67_minor", 828},
+	{"ellipsoid_obst_67_psi", 826},
+	{"ellipsoid_obst_67_r", 830},
+	{"ellipsoid_obst_67_x", 824},
+	{"ellipsoid_obst_67_y", 825},
+	{"ellipsoid_obst_68_chi", 836},
+	{"ellipsoid_obst_68_major", 834},
+	{"ellipsoid_obst_68_minor", 835},
+	{"ellipsoid_obst_68_psi", 833},
+	{"ellipsoid_obst_68_r", 837},
+	{"ellipsoid_obst_68_x", 831},
+	{"ellipsoid_obst_68_y", 832},
+	{"ellipsoid_obst_69_chi", 843},
+	{"ellipsoid_obst_69_major", 841},
+	{"ellipsoid_obst_69_minor", 842},
+	{"ellipsoid_obst_69_psi", 840},
+	{"ellipsoid_obst_69_r", 844},
+	{"ellipsoid_obst_69_x", 838},
+	{"ellipsoid_obst_69_y", 839},
+	{"ellipsoid_obst_6_chi", 402},
+	{"ellipsoid_obst_6_major", 400},
+	{"ellipsoid_obst_6_minor", 401},
+	{"ellipsoid_obst_6_psi", 399},
+	{"ellipsoid_obst_6_r", 403},
+	{"ellipsoid_obst_6_x", 397},
+	{"ellipsoid_obst_6_y", 398},
+	{"ellipsoid_obst_70_chi", 850},
+	{"ellipsoid_obst_70_major", 848},
+	{"ellipsoid_obst_70_minor", 849},
+	{"ellipsoid_obst_70_psi", 847},
+	{"ellipsoid_obst_70_r", 851},
+	{"ellipsoid_obst_70_x", 845},
+	{"ellipsoid_obst_70_y", 846},
+	{"ellipsoid_obst_71_chi", 857},
+	{"ellipsoid_obst_71_major", 855},
+	{"ellipsoid_obst_71_minor", 856},
+	{"ellipsoid_obst_71_psi", 854},
+	{"ellipsoid_obst_71_r", 858},
+	{"ellipsoid_obst_71_x", 852},
+	{"ellipsoid_obst_71_y", 853},
+	{"ellipsoid_obst_72_chi", 864},
+	{"ellipsoid_obst_72_major", 862},
+	{"ellipsoid_obst_72_minor", 863},
+	{"ellipsoid_obst_72_psi", 861},
+	{"ellipsoid_obst_72_r", 865},
+	{"ellipsoid_obst_72_x", 859},
+	{"ellipsoid_obst_72_y", 860},
+	{"ellipsoid_obst_73_chi", 871},
+	{"ellipsoid_obst_73_major", 869},
+	{"ellipsoid_obst_73_minor", 870},
+	{"ellipsoid_obst_73_psi", 868},
+	{"ellipsoid_obst_73_r", 872},
+	{"ellipsoid_obst_73_x", 866},
+	{"ellipsoid_obst_73_y", 867},
+	{"ellipsoid_obst_74_chi", 878},
+	{"ellipsoid_obst_74_major", 876},
+	{"ellipsoid_obst_74_minor", 877},
+	{"ellipsoid_obst_74_psi", 875},
+	{"ellipsoid_obst_74_r", 879},
+	{"ellipsoid_obst_74_x", 873},
+	{"ellipsoid_obst_74_y", 874},
+	{"ellipsoid_obst_75_chi", 885},
+	{"ellipsoid_obst_75_major", 883},
+	{"ellipsoid_obst_75_minor", 884},
+	{"ellipsoid_obst_75_psi", 882},
+	{"ellipsoid_obst_75_r", 886},
+	{"ellipsoid_obst_75_x", 880},
+	{"ellipsoid_obst_75_y", 881},
+	{"ellipsoid_obst_76_chi", 892},
+	{"ellipsoid_obst_76_major", 890},
+	{"ellipsoid_obst_76_minor", 891},
+	{"ellipsoid_obst_76_psi", 889},
+	{"ellipsoid_obst_76_r", 893},
+	{"ellipsoid_obst_76_x", 887},
+	{"ellipsoid_obst_76_y", 888},
+	{"ellipsoid_obst_77_chi", 899},
+	{"ellipsoid_obst_77_major", 897},
+	{"ellipsoid_obst_77_minor", 898},
+	{"ellipsoid_obst_77_psi", 896},
+	{"ellipsoid_obst_77_r", 900},
+	{"ellipsoid_obst_77_x", 894},
+	{"ellipsoid_obst_77_y", 895},
+	{"ellipsoid_obst_78_chi", 906},
+	{"ellipsoid_obst_78_major", 904},
+	{"ellipsoid_obst_78_minor", 905},
+	{"ellipsoid_obst_78_psi", 903},
+	{"ellipsoid_obst_78_r", 907},
+	{"ellipsoid_obst_78_x", 901},
+	{"ellipsoid_obst_78_y", 902},
+	{"ellipsoid_obst_79_chi", 913},
+	{"ellipsoid_obst_79_major", 911},
+	{"ellipsoid_obst_79_minor", 912},
+	{"ellipsoid_obst_79_psi", 910},
+	{"ellipsoid_obst_79_r", 914},
+	{"ellipsoid_obst_79_x", 908},
+	{"ellipsoid_obst_79_y", 909},
+	{"ellipsoid_obst_7_chi", 409},
+	{"ellipsoid_obst_7_major", 407},
+	{"ellipsoid_obst_7_minor", 408},
+	{"ellipsoid_obst_7_psi", 406},
+	{"ellipsoid_obst_7_r", 410},
+	{"ellipsoid_obst_7_x", 404},
+	{"ellipsoid_obst_7_y", 405},
+	{"ellipsoid_obst_80_chi", 920},
+	{"ellipsoid_obst_80_major", 918},
+	{"ellipsoid_obst_80_minor", 919},
+	{"ellipsoid_obst_80_psi", 917},
+	{"ellipsoid_obst_80_r", 921},
+	{"ellipsoid_obst_80_x", 915},
+	{"ellipsoid_obst_80_y", 916},
+	{"ellipsoid_obst_81_chi", 927},
+	{"ellipsoid_obst_81_major", 925},
+	{"ellipsoid_obst_81_minor", 926},
+	{"ellipsoid_obst_81_psi", 924},
+	{"ellipsoid_obst_81_r", 928},
+	{"ellipsoid_obst_81_x", 922},
+	{"ellipsoid_obst_81_y", 923},
+	{"ellipsoid_obst_82_chi", 934},
+	{"ellipsoid_obst_82_major", 932},
+	{"ellipsoid_obst_82_minor", 933},
+	{"ellipsoid_obst_82_psi", 931},
+	{"ellipsoid_obst_82_r", 935},
+	{"ellipsoid_obst_82_x", 929},
+	{"ellipsoid_obst_82_y", 930},
+	{"ellipsoid_obst_83_chi", 941},
+	{"ellipsoid_obst_83_major", 939},
+	{"ellipsoid_obst_83_minor", 940},
+	{"ellipsoid_obst_83_psi", 938},
+	{"ellipsoid_obst_83_r", 942},
+	{"ellipsoid_obst_83_x", 936},
+	{"ellipsoid_obst_83_y", 937},
+	{"ellipsoid_obst_84_chi", 948},
+	{"ellipsoid_obst_84_major", 946},
+	{"ellipsoid_obst_84_minor", 947},
+	{"ellipsoid_obst_84_psi", 945},
+	{"ellipsoid_obst_84_r", 949},
+	{"ellipsoid_obst_84_x", 943},
+	{"ellipsoid_obst_84_y", 944},
+	{"ellipsoid_obst_85_chi", 955},
+	{"ellipsoid_obst_85_major", 953},
+	{"ellipsoid_obst_85_minor", 954},
+	{"ellipsoid_obst_85_psi", 952},
+	{"ellipsoid_obst_85_r", 956},
+	{"ellipsoid_obst_85_x", 950},
+	{"ellipsoid_obst_85_y", 951},
+	{"ellipsoid_obst_86_chi", 962},
+	{"ellipsoid_obst_86_major", 960},
+	{"ellipsoid_obst_86_minor", 961},
+	{"ellipsoid_obst_86_psi", 959},
+	{"ellipsoid_obst_86_r", 963},
+	{"ellipsoid_obst_86_x", 957},
+	{"ellipsoid_obst_86_y", 958},
+	{"ellipsoid_obst_87_chi", 969},
+	{"ellipsoid_obst_87_major", 967},
+	{"ellipsoid_obst_87_minor", 968},
+	{"ellipsoid_obst_87_psi", 966},
+	{"ellipsoid_obst_87_r", 970},
+	{"ellipsoid_obst_87_x", 964},
+	{"ellipsoid_obst_87_y", 965},
+	{"ellipsoid_obst_88_chi", 976},
+	{"ellipsoid_obst_88_major", 974},
+	{"ellipsoid_obst_88_minor", 975},
+	{"ellipsoid_obst_88_psi", 973},
+	{"ellipsoid_obst_88_r", 977},
+	{"ellipsoid_obst_88_x", 971},
+	{"ellipsoid_obst_88_y", 972},
+	{"ellipsoid_obst_89_chi", 983},
+	{"ellipsoid_obst_89_major", 981},
+	{"ellipsoid_obst_89_minor", 982},
+	{"ellipsoid_obst_89_psi", 980},
+	{"ellipsoid_obst_89_r", 984},
+	{"ellipsoid_obst_89_x", 978},
+	{"ellipsoid_obst_89_y", 979},
+	{"ellipsoid_obst_8_chi", 416},
+	{"ellipsoid_obst_8_major", 414},
+	{"ellipsoid_obst_8_minor", 415},
+	{"ellipsoid_obst_8_psi", 413},
+	{"ellipsoid_obst_8_r", 417},
+	{"ellipsoid_obst_8_x", 411},
+	{"ellipsoid_obst_8_y", 412},
+	{"ellipsoid_obst_90_chi", 990},
+	{"ellipsoid_obst_90_major", 988},
+	{"ellipsoid_obst_90_minor", 989},
+	{"ellipsoid_obst_90_psi", 987},
+	{"ellipsoid_obst_90_r", 991},
+	{"ellipsoid_obst_90_x", 985},
+	{"ellipsoid_obst_90_y", 986},
+	{"ellipsoid_obst_91_chi", 997},
+	{"ellipsoid_obst_91_major", 995},
+	{"ellipsoid_obst_91_minor", 996},
+	{"ellipsoid_obst_91_psi", 994},
+	{"ellipsoid_obst_91_r", 998},
+	{"ellipsoid_obst_91_x", 992},
+	{"ellipsoid_obst_91_y", 993},
+	{"ellipsoid_obst_92_chi", 1004},
+	{"ellipsoid_obst_92_major", 1002},
+	{"ellipsoid_obst_92_minor", 1003},
+	{"ellipsoid_obst_92_psi", 1001},
+	{"ellipsoid_obst_92_r", 1005},
+	{"ellipsoid_obst_92_x", 999},
+	{"ellipsoid_obst_92_y", 1000},
+	{"ellipsoid_obst_93_chi", 1011},
+	{"ellipsoid_obst_93_major", 1009},
+	{"ellipsoid_obst_93_minor", 1010},
+	{"ellipsoid_obst_93_psi", 1008},
+	{"ellipsoid_obst_93_r", 1012},
+	{"ellipsoid_obst_93_x", 1006},
+	{"ellipsoid_obst_93_y", 1007},
+	{"ellipsoid_obst_94_chi", 1018},
+	{"ellipsoid_obst_94_major", 1016},
+	{"ellipsoid_obst_94_minor", 1017},
+	{"ellipsoid_obst_94_psi", 1015},
+	{"ellipsoid_obst_94_r", 1019},
+	{"ellipsoid_obst_94_x", 1013},
+	{"ellipsoid_obst_94_y", 1014},
+	{"ellipsoid_obst_95_chi", 1025},
+	{"ellipsoid_obst_95_major", 1023},
+	{"ellipsoid_obst_95_minor", 1024},
+	{"ellipsoid_obst_95_psi", 1022},
+	{"ellipsoid_obst_95_r", 1026},
+	{"ellipsoid_obst_95_x", 1020},
+	{"ellipsoid_obst_95_y", 1021},
+	{"ellipsoid_obst_96_chi", 1032},
+	{"ellipsoid_obst_96_major", 1030},
+	{"ellipsoid_obst_96_minor", 1031},
+	{"ellipsoid_obst_96_psi", 1029},
+	{"ellipsoid_obst_96_r", 1033},
+	{"ellipsoid_obst_96_x", 1027},
+	{"ellipsoid_obst_96_y", 1028},
+	{"ellipsoid_obst_97_chi", 1039},
+	{"ellipsoid_obst_97_major", 1037},
+	{"ellipsoid_obst_97_minor", 1038},
+	{"ellipsoid_obst_97_psi", 1036},
+	{"ellipsoid_obst_97_r", 1040},
+	{"ellipsoid_obst_97_x", 1034},
+	{"ellipsoid_obst_97_y", 1035},
+	{"ellipsoid_obst_98_chi", 1046},
+	{"ellipsoid_obst_98_major", 1044},
+	{"ellipsoid_obst_98_minor", 1045},
+	{"ellipsoid_obst_98_psi", 1043},
+	{"ellipsoid_obst_98_r", 1047},
+	{"ellipsoid_obst_98_x", 1041},
+	{"ellipsoid_obst_98_y", 1042},
+	{"ellipsoid_obst_99_chi", 1053},
+	{"ellipsoid_obst_99_major", 1051},
+	{"ellipsoid_obst_99_minor", 1052},
+	{"ellipsoid_obst_99_psi", 1050},
+	{"ellipsoid_obst_99_r", 1054},
+	{"ellipsoid_obst_99_x", 1048},
+	{"ellipsoid_obst_99_y", 1049},
+	{"ellipsoid_obst_9_chi", 423},
+	{"ellipsoid_obst_9_major", 421},
+	{"ellipsoid_obst_9_minor", 422},
+	{"ellipsoid_obst_9_psi", 420},
+	{"ellipsoid_obst_9_r", 424},
+	{"ellipsoid_obst_9_x", 418},
+	{"ellipsoid_obst_9_y", 419},
+	{"lag", 5},
+	{"lin_constraint_0_a1", 53},
+	{"lin_constraint_0_a2", 54},
+	{"lin_constraint_0_b", 55},
+	{"lin_constraint_10_a1", 83},
+	{"lin_constraint_10_a2", 84},
+	{"lin_constraint_10_b", 85},
+	{"lin_constraint_11_a1", 86},
+	{"lin_constraint_11_a2", 87},
+	{"lin_constraint_11_b", 88},
+	{"lin_constraint_12_a1", 89},
+	{"lin_constraint_12_a2", 90},
+	{"lin_constraint_12_b", 91},
+	{"lin_constraint_13_a1", 92},
+	{"lin_constraint_13_a2", 93},
+	{"lin_constraint_13_b", 94},
+	{"lin_constraint_14_a1", 95},
+	{"lin_constraint_14_a2", 96},
+	{"lin_constraint_14_b", 97},
+	{"lin_constraint_15_a1", 98},
+	{"lin_constraint_15_a2", 99},
+	{"lin_constraint_15_b", 100},
+	{"lin_constraint_16_a1", 101},
+	{"lin_constraint_16_a2", 102},
+	{"lin_constraint_16_b", 103},
+	{"lin_constraint_17_a1", 104},
+	{"lin_constraint_17_a2", 105},
+	{"lin_constraint_17_b", 106},
+	{"lin_constraint_18_a1", 107},
+	{"lin_constraint_18_a2", 108},
+	{"lin_constraint_18_b", 109},
+	{"lin_constraint_19_a1", 110},
+	{"lin_constraint_19_a2", 111},
+	{"lin_constraint_19_b", 112},
+	{"lin_constraint_1_a1", 56},
+	{"lin_constraint_1_a2", 57},
+	{"lin_constraint_1_b", 58},
+	{"lin_constraint_20_a1", 113},
+	{"lin_constraint_20_a2", 114},
+	{"lin_constraint_20_b", 115},
+	{"lin_constraint_21_a1", 116},
+	{"lin_constraint_21_a2", 117},
+	{"lin_constraint_21_b", 118},
+	{"lin_constraint_22_a1", 119},
+	{"lin_constraint_22_a2", 120},
+	{"lin_constraint_22_b", 121},
+	{"lin_constraint_23_a1", 122},
+	{"lin_constraint_23_a2", 123},
+	{"lin_constraint_23_b", 124},
+	{"lin_constraint_24_a1", 125},
+	{"lin_constraint_24_a2", 126},
+	{"lin_constraint_24_b", 127},
+	{"lin_constraint_25_a1", 128},
+	{"lin_constraint_25_a2", 129},
+	{"lin_constraint_25_b", 130},
+	{"lin_constraint_26_a1", 131},
+	{"lin_constraint_26_a2", 132},
+	{"lin_constraint_26_b", 133},
+	{"lin_constraint_27_a1", 134},
+	{"lin_constraint_27_a2", 135},
+	{"lin_constraint_27_b", 136},
+	{"lin_constraint_28_a1", 137},
+	{"lin_constraint_28_a2", 138},
+	{"lin_constraint_28_b", 139},
+	{"lin_constraint_29_a1", 140},
+	{"lin_constraint_29_a2", 141},
+	{"lin_constraint_29_b", 142},
+	{"lin_constraint_2_a1", 59},
+	{"lin_constraint_2_a2", 60},
+	{"lin_constraint_2_b", 61},
+	{"lin_constraint_30_a1", 143},
+	{"lin_constraint_30_a2", 144},
+	{"lin_constraint_30_b", 145},
+	{"lin_constraint_31_a1", 146},
+	{"lin_constraint_31_a2", 147},
+	{"lin_constraint_31_b", 148},
+	{"lin_constraint_32_a1", 149},
+	{"lin_constraint_32_a2", 150},
+	{"lin_constraint_32_b", 151},
+	{"lin_constraint_33_a1", 152},
+	{"lin_constraint_33_a2", 153},
+	{"lin_constraint_33_b", 154},
+	{"lin_constraint_34_a1", 155},
+	{"lin_constraint_34_a2", 156},
+	{"lin_constraint_34_b", 157},
+	{"lin_constraint_35_a1", 158},
+	{"lin_constraint_35_a2", 159},
+	{"lin_constraint_35_b", 160},
+	{"lin_constraint_36_a1", 161},
+	{"lin_constraint_36_a2", 162},
+	{"lin_constraint_36_b", 163},
+	{"lin_constraint_37_a1", 164},
+	{"lin_constraint_37_a2", 165},
+	{"lin_constraint_37_b", 166},
+	{"lin_constraint_38_a1", 167},
+	{"lin_constraint_38_a2", 168},
+	{"lin_constraint_38_b", 169},
+	{"lin_constraint_39_a1", 170},
+	{"lin_constraint_39_a2", 171},
+	{"lin_constraint_39_b", 172},
+	{"lin_constraint_3_a1", 62},
+	{"lin_constraint_3_a2", 63},
+	{"lin_constraint_3_b", 64},
+	{"lin_constraint_40_a1", 173},
+	{"lin_constraint_40_a2", 174},
+	{"lin_constraint_40_b", 175},
+	{"lin_constraint_41_a1", 176},
+	{"lin_constraint_41_a2", 177},
+	{"lin_constraint_41_b", 178},
+	{"lin_constraint_42_a1", 179},
+	{"lin_constraint_42_a2", 180},
+	{"lin_constraint_42_b", 181},
+	{"lin_constraint_43_a1", 182},
+	{"lin_constraint_43_a2", 183},
+	{"lin_constraint_43_b", 184},
+	{"lin_constraint_44_a1", 185},
+	{"lin_constraint_44_a2", 186},
+	{"lin_constraint_44_b", 187},
+	{"lin_constraint_45_a1", 188},
+	{"lin_constraint_45_a2", 189},
+	{"lin_constraint_45_b", 190},
+	{"lin_constraint_46_a1", 191},
+	{"lin_constraint_46_a2", 192},
+	{"lin_constraint_46_b", 193},
+	{"lin_constraint_47_a1", 194},
+	{"lin_constraint_47_a2", 195},
+	{"lin_constraint_47_b", 196},
+	{"lin_constraint_48_a1", 197},
+	{"lin_constraint_48_a2", 198},
+	{"lin_constraint_48_b", 199},
+	{"lin_constraint_49_a1", 200},
+	{"lin_constraint_49_a2", 201},
+	{"lin_constraint_49_b", 202},
+	{"lin_constraint_4_a1", 65},
+	{"lin_constraint_4_a2", 66},
+	{"lin_constraint_4_b", 67},
+	{"lin_constraint_50_a1", 203},
+	{"lin_constraint_50_a2", 204},
+	{"lin_constraint_50_b", 205},
+	{"lin_constraint_51_a1", 206},
+	{"lin_constraint_51_a2", 207},
+	{"lin_constraint_51_b", 208},
+	{"lin_constraint_52_a1", 209},
+	{"lin_constraint_52_a2", 210},
+	{"lin_constraint_52_b", 211},
+	{"lin_constraint_53_a1", 212},
+	{"lin_constraint_53_a2", 213},
+	{"lin_constraint_53_b", 214},
+	{"lin_constraint_54_a1", 215},
+	{"lin_constraint_54_a2", 216},
+	{"lin_constraint_54_b", 217},
+	{"lin_constraint_55_a1", 218},
+	{"lin_constraint_55_a2", 219},
+	{"lin_constraint_55_b", 220},
+	{"lin_constraint_56_a1", 221},
+	{"lin_constraint_56_a2", 222},
+	{"lin_constraint_56_b", 223},
+	{"lin_constraint_57_a1", 224},
+	{"lin_constraint_57_a2", 225},
+	{"lin_constraint_57_b", 226},
+	{"lin_constraint_58_a1", 227},
+	{"lin_constraint_58_a2", 228},
+	{"lin_constraint_58_b", 229},
+	{"lin_constraint_59_a1", 230},
+	{"lin_constraint_59_a2", 231},
+	{"lin_constraint_59_b", 232},
+	{"lin_constraint_5_a1", 68},
+	{"lin_constraint_5_a2", 69},
+	{"lin_constraint_5_b", 70},
+	{"lin_constraint_60_a1", 233},
+	{"lin_constraint_60_a2", 234},
+	{"lin_constraint_60_b", 235},
+	{"lin_constraint_61_a1", 236},
+	{"lin_constraint_61_a2", 237},
+	{"lin_constraint_61_b", 238},
+	{"lin_constraint_62_a1", 239},
+	{"lin_constraint_62_a2", 240},
+	{"lin_constraint_62_b", 241},
+	{"lin_constraint_63_a1", 242},
+	{"lin_constraint_63_a2", 243},
+	{"lin_constraint_63_b", 244},
+	{"lin_constraint_64_a1", 245},
+	{"lin_constraint_64_a2", 246},
+	{"lin_constraint_64_b", 247},
+	{"lin_constraint_65_a1", 248},
+	{"lin_constraint_65_a2", 249},
+	{"lin_constraint_65_b", 250},
+	{"lin_constraint_66_a1", 251},
+	{"lin_constraint_66_a2", 252},
+	{"lin_constraint_66_b", 253},
+	{"lin_constraint_67_a1", 254},
+	{"lin_constraint_67_a2", 255},
+	{"lin_constraint_67_b", 256},
+	{"lin_constraint_68_a1", 257},
+	{"lin_constraint_68_a2", 258},
+	{"lin_constraint_68_b", 259},
+	{"lin_constraint_69_a1", 260},
+	{"lin_constraint_69_a2", 261},
+	{"lin_constraint_69_b", 262},
+	{"lin_constraint_6_a1", 71},
+	{"lin_constraint_6_a2", 72},
+	{"lin_constraint_6_b", 73},
+	{"lin_constraint_70_a1", 263},
+	{"lin_constraint_70_a2", 264},
+	{"lin_constraint_70_b", 265},
+	{"lin_constraint_71_a1", 266},
+	{"lin_constraint_71_a2", 267},
+	{"lin_constraint_71_b", 268},
+	{"lin_constraint_72_a1", 269},
+	{"lin_constraint_72_a2", 270},
+	{"lin_constraint_72_b", 271},
+	{"lin_constraint_73_a1", 272},
+	{"lin_constraint_73_a2", 273},
+	{"lin_constraint_73_b", 274},
+	{"lin_constraint_74_a1", 275},
+	{"lin_constraint_74_a2", 276},
+	{"lin_constraint_74_b", 277},
+	{"lin_constraint_75_a1", 278},
+	{"lin_constraint_75_a2", 279},
+	{"lin_constraint_75_b", 280},
+	{"lin_constraint_76_a1", 281},
+	{"lin_constraint_76_a2", 282},
+	{"lin_constraint_76_b", 283},
+	{"lin_constraint_77_a1", 284},
+	{"lin_constraint_77_a2", 285},
+	{"lin_constraint_77_b", 286},
+	{"lin_constraint_78_a1", 287},
+	{"lin_constraint_78_a2", 288},
+	{"lin_constraint_78_b", 289},
+	{"lin_constraint_79_a1", 290},
+	{"lin_constraint_79_a2", 291},
+	{"lin_constraint_79_b", 292},
+	{"lin_constraint_7_a1", 74},
+	{"lin_constraint_7_a2", 75},
+	{"lin_constraint_7_b", 76},
+	{"lin_constraint_80_a1", 293},
+	{"lin_constraint_80_a2", 294},
+	{"lin_constraint_80_b", 295},
+	{"lin_constraint_81_a1", 296},
+	{"lin_constraint_81_a2", 297},
+	{"lin_constraint_81_b", 298},
+	{"lin_constraint_82_a1", 299},
+	{"lin_constraint_82_a2", 300},
+	{"lin_constraint_82_b", 301},
+	{"lin_constraint_83_a1", 302},
+	{"lin_constraint_83_a2", 303},
+	{"lin_constraint_83_b", 304},
+	{"lin_constraint_84_a1", 305},
+	{"lin_constraint_84_a2", 306},
+	{"lin_constraint_84_b", 307},
+	{"lin_constraint_85_a1", 308},
+	{"lin_constraint_85_a2", 309},
+	{"lin_constraint_85_b", 310},
+	{"lin_constraint_86_a1", 311},
+	{"lin_constraint_86_a2", 312},
+	{"lin_constraint_86_b", 313},
+	{"lin_constraint_87_a1", 314},
+	{"lin_constraint_87_a2", 315},
+	{"lin_constraint_87_b", 316},
+	{"lin_constraint_88_a1", 317},
+	{"lin_constraint_88_a2", 318},
+	{"lin_constraint_88_b", 319},
+	{"lin_constraint_89_a1", 320},
+	{"lin_constraint_89_a2", 321},
+	{"lin_constraint_89_b", 322},
+	{"lin_constraint_8_a1", 77},
+	{"lin_constraint_8_a2", 78},
+	{"lin_constraint_8_b", 79},
+	{"lin_constraint_90_a1", 323},
+	{"lin_constraint_90_a2", 324},
+	{"lin_constraint_90_b", 325},
+	{"lin_constraint_91_a1", 326},
+	{"lin_constraint_91_a2", 327},
+	{"lin_constraint_91_b", 328},
+	{"lin_constraint_92_a1", 329},
+	{"lin_constraint_92_a2", 330},
+	{"lin_constraint_92_b", 331},
+	{"lin_constraint_93_a1", 332},
+	{"lin_constraint_93_a2", 333},
+	{"lin_constraint_93_b", 334},
+	{"lin_constraint_94_a1", 335},
+	{"lin_constraint_94_a2", 336},
+	{"lin_constraint_94_b", 337},
+	{"lin_constraint_95_a1", 338},
+	{"lin_constraint_95_a2", 339},
+	{"lin_constraint_95_b", 340},
+	{"lin_constraint_96_a1", 341},
+	{"lin_constraint_96_a2", 342},
+	{"lin_constraint_96_b", 343},
+	{"lin_constraint_97_a1", 344},
+	{"lin_constraint_97_a2", 345},
+	{"lin_constraint_97_b", 346},
+	{"lin_constraint_98_a1", 347},
+	{"lin_constraint_98_a2", 348},
+	{"lin_constraint_98_b", 349},
+	{"lin_constraint_99_a1", 350},
+	{"lin_constraint_99_a2", 351},
+	{"lin_constraint_99_b", 352},
+	{"lin_constraint_9_a1", 80},
+	{"lin_constraint_9_a2", 81},
+	{"lin_constraint_9_b", 82},
+	{"reference_velocity", 3},
+	{"spline0_start", 16},
+	{"spline1_start", 25},
+	{"spline2_start", 34},
+	{"spline3_start", 43},
+	{"spline4_start", 52},
+	{"spline_x0_a", 8},
+	{"spline_x0_b", 9},
+	{"spline_x0_c", 10},
+	{"spline_x0_d", 11},
+	{"spline_x1_a", 17},
+	{"spline_x1_b", 18},
+	{"spline_x1_c", 19},
+	{"spline_x1_d", 20},
+	{"spline_x2_a", 26},
+	{"spline_x2_b", 27},
+	{"spline_x2_c", 28},
+	{"spline_x2_d", 29},
+	{"spline_x3_a", 35},
+	{"spline_x3_b", 36},
+	{"spline_x3_c", 37},
+	{"spline_x3_d", 38},
+	{"spline_x4_a", 44},
+	{"spline_x4_b", 45},
+	{"spline_x4_c", 46},
+	{"spline_x4_d", 47},
+	{"spline_y0_a", 12},
+	{"spline_y0_b", 13},
+	{"spline_y0_c", 14},
+	{"spline_y0_d", 15},
+	{"spline_y1_a", 21},
+	{"spline_y1_b", 22},
+	{"spline_y1_c", 23},
+	{"spline_y1_d", 24},
+	{"spline_y2_a", 30},
+	{"spline_y2_b", 31},
+	{"spline_y2_c", 32},
+	{"spline_y2_d", 33},
+	{"spline_y3_a", 39},
+	{"spline_y3_b", 40},
+	{"spline_y3_c", 41},
+	{"spline_y3_d", 42},
+	{"spline_y4_a", 48},
+	{"spline_y4_b", 49},
+	{"spline_y4_c", 50},
+	{"spline_y4_d", 51},
+	{"terminal_angle", 6},
+	{"terminal_contouring", 7},
+	{"velocity", 2},
+};
+
+/** @brief Index of a model variable in z = [u, x], -1 if the model has no such variable */
+constexpr int modelVariableIndex(std::string_view name){
+	for(const auto& variable : MODEL_VARIABLES)
+		if(variable.name == name)
+			return variable.index;
+	return -1;
+}
+
+/** @brief Per-stage index of a parameter, -1 if the solver has no such parameter */
+constexpr int solverParameterIndex(std::string_view name){
+	int low = 0;
+	int high = 1055 - 1;
+	while(low <= high){
+		int mid = low + (high - low) / 2;
+		int cmp = SOLVER_PARAMETER_NAMES[mid].name.compare(name);
+		if(cmp == 0)
+			return SOLVER_PARAMETER_NAMES[mid].index;
+		if(cmp < 0)
+			low = mid + 1;
+		else
+			high = mid - 1;
+	}
+	return -1;
+}
+
 void setSolverParameterAcceleration(int k, AcadosParameters& params, const double value, int index=0);
 void setSolverParameterAngularVelocity(int k, AcadosParameters& params, const double value, int index=0);
 void setSolverParameterVelocity(int k, AcadosParameters& params, const double value, int index=0);
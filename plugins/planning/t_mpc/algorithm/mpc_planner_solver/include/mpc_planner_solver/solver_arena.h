@@ -0,0 +1,120 @@
+#ifndef SOLVER_ARENA_H
+#define SOLVER_ARENA_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace MPCPlanner
+{
+    /**
+     * @brief The parallel solvers of T-MPC in one contiguous allocation
+     *
+     * Every solver (with its parameters, warmstart and output) gets a page aligned slot of a single arena, instead of
+     * a separate heap allocation. Solver i is constructed by iteration i of the executor, i.e., on the worker that
+     * will also run its solves (GuidancePlanner::ParallelFor keeps this mapping). With first-touch page placement its
+     * slot, and the workspace that acados allocates for it, are then local to that worker's NUMA node.
+     *
+     * The arena owns the solvers; get(i) returns a handle that keeps the arena alive.
+     */
+    template <class SolverType>
+    class SolverArena : public std::enable_shared_from_this<SolverArena<SolverType>>
+    {
+    public:
+        /** @brief Runs body(0), ..., body(n - 1) and returns when all have finished */
+        using Executor = std::function<void(int n, const std::function<void(int)> &body)>;
+
+        static constexpr size_t PAGE_SIZE = 4096;
+
+        /**
+         * @brief Construct n solvers with ids first_id, ..., first_id + n - 1
+         * @param executor Parallel loop used to construct the solvers (serial if empty)
+         */
+        static std::shared_ptr<SolverArena> create(int first_id, int n, const Executor &executor = Executor())
+        {
+            return std::shared_ptr<SolverArena>(new SolverArena(first_id, n, executor));
+        }
+
+        ~SolverArena() { release(); }
+
+        SolverArena(const SolverArena &) = delete;
+        SolverArena &operator=(const SolverArena &) = delete;
+
+        int size() const { return (int)_solvers.size(); }
+
+        std::shared_ptr<SolverType> get(int i) { return std::shared_ptr<SolverType>(this->shared_from_this(), _solvers[i]); }
+
+        /** @brief Size of the slot of each solver (bytes) */
+        size_t slotSize() const { return _slot_size; }
+
+        /** @brief Start of the arena, the slot of solver i starts at data() + i * slotSize() */
+        const void *data() const { return _memory; }
+
+    private:
+        SolverArena(int first_id, int n, const Executor &executor)
+        {
+            _slot_size = ((sizeof(SolverType) + PAGE_SIZE - 1) / PAGE_SIZE) * PAGE_SIZE;
+            _solvers.assign(n, nullptr);
+            if (n == 0)
+                return;
+
+            // Not touched here: each page is first written by the thread that constructs its solver
+            _memory = static_cast<char *>(std::aligned_alloc(PAGE_SIZE, _slot_size * n));
+            if (_memory == nullptr)
+                throw std::bad_alloc();
+
+            std::mutex error_mutex;
+            std::exception_ptr error;
+            auto construct = [&](int i)
+            {
+                try
+                {
+                    _solvers[i] = new (_memory + i * _slot_size) SolverType(first_id + i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+            };
+
+            if (executor)
+                executor(n, construct);
+            else
+            {
+                for (int i = 0; i < n; i++)
+                    construct(i);
+            }
+
+            if (error)
+            {
+                release();
+                std::rethrow_exception(error);
+            }
+        }
+
+        void release()
+        {
+            for (auto *solver : _solvers)
+            {
+                if (solver != nullptr)
+                    solver->~SolverType();
+            }
+            _solvers.clear();
+            std::free(_memory);
+            _memory = nullptr;
+        }
+
+        char *_memory{nullptr};
+        size_t _slot_size{0};
+        std::vector<SolverType *> _solvers;
+    };
+}
+
+#endif // SOLVER_ARENA_H
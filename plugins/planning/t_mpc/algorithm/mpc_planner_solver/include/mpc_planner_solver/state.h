@@ -2,6 +2,7 @@
 #define STATE_H
 
 #include <mpc_planner_util/load_yaml.hpp>
+#include <mpc_planner_solver/mpc_planner_parameters.h>
 
 #include <Eigen/Dense>
 
@@ -17,14 +18,15 @@ namespace MPCPlanner
         void initialize();
 
         double get(std::string &&var_name) const;
+        double get(int var_index) const { return _state[var_index - _nu]; } // var_index: ModelIndex::*, states only
         Eigen::Vector2d getPos() const;
 
         void set(std::string &&var_name, double value);
+        void set(int var_index, double value) { _state[var_index - _nu] = value; }
         void print() const;
 
     private:
         std::vector<double> _state;
-        YAML::Node _config, _model_map;
 
         int _nu;
     };
@@ -4,8 +4,29 @@
 
 #include <ros_tools/profiling.h>
 
+#include <stdexcept>
+
 namespace MPCPlanner
 {
+    namespace
+    {
+        int parameterIndex(const std::string &parameter)
+        {
+            int index = solverParameterIndex(parameter);
+            if (index < 0)
+                throw std::runtime_error("Unknown solver parameter: " + parameter);
+            return index;
+        }
+
+        int modelIndex(const std::string &var_name)
+        {
+            int index = modelVariableIndex(var_name);
+            if (index < 0)
+                throw std::runtime_error("Unknown model variable: " + var_name);
+            return index;
+        }
+    }
+
     Solver::Solver(int solver_id)
     {
         _solver_id = solver_id;
@@ -22,10 +43,29 @@ namespace MPCPlanner
         nx = _config["nx"].as<unsigned int>();
         nvar = _config["nvar"].as<unsigned int>();
         npar = _config["npar"].as<unsigned int>();
-        dt = CONFIG["integrator_step"].as<double>();
+        dt = SETTINGS.integrator_step;
+
+        // The generated index tables replace the YAML maps at runtime, so they must describe the same solver
+        bool tables_match = ((int)npar == SOLVER_NUM_PARAMETERS && (int)nu == MODEL_NU && (int)nx == MODEL_NX);
+        for (YAML::const_iterator it = _parameter_map.begin(); tables_match && it != _parameter_map.end(); ++it)
+        {
+            if (it->first.as<std::string>() != "num parameters")
+                tables_match = solverParameterIndex(it->first.as<std::string>()) == it->second.as<int>();
+        }
+        tables_match = tables_match && (int)_model_map.size() == MODEL_NVAR;
+        for (const auto &variable : MODEL_VARIABLES)
+        {
+            const YAML::Node entry = _model_map[std::string(variable.name)];
+            tables_match = tables_match && entry.IsDefined() && entry[1].as<int>() == variable.index;
+        }
+        if (!tables_match)
+        {
+            LOG_ERROR("mpc_planner_parameters.h does not match the solver configuration, regenerate the solver");
+            exit(1);
+        }
 
-        _num_iterations = CONFIG["solver_settings"]["acados"]["iterations"].as<int>();
-        if (CONFIG["solver_settings"]["acados"]["solver_type"].as<std::string>() == "SQP")
+        _num_iterations = SETTINGS.solver_settings.acados_iterations;
+        if (SETTINGS.solver_settings.acados_solver_type == "SQP")
             _num_iterations = 1;
 
         // allocate the array and fill it accordingly
@@ -168,10 +208,17 @@ namespace MPCPlanner
         ocp_nlp_get(_nlp_config, _nlp_solver, "cost_value", &_info.pobj);
 
         // Get output
+#ifdef MPC_PLANNER_HAVE_OCP_NLP_GET_ALL
+        // All stages at once, laid out as [x0 | x1 | ... | xN] and [u0 | ... | uN-1] like the output arrays
+        ocp_nlp_get_all(_nlp_solver, _nlp_in, _nlp_out, "x", _output.xtraj);
+        ocp_nlp_get_all(_nlp_solver, _nlp_in, _nlp_out, "u", _output.utraj);
+#else
+        // acados without ocp_nlp_get_all: per stage
         for (int k = 0; k <= _nlp_dims->N; k++)
             ocp_nlp_out_get(_nlp_config, _nlp_dims, _nlp_out, k, "x", &_output.xtraj[k * nx]);
         for (int k = 0; k < _nlp_dims->N; k++)
             ocp_nlp_out_get(_nlp_config, _nlp_dims, _nlp_out, k, "u", &_output.utraj[k * nu]);
+#endif
 
         double res_stat, res_eq, res_ineq, res_comp;
         ocp_nlp_get(_nlp_config, _nlp_solver, "res_eq", &res_eq);
@@ -206,42 +253,37 @@ namespace MPCPlanner
     // PARAMETERS //
     bool Solver::hasParameter(std::string &&parameter)
     {
-        return _parameter_map[parameter].IsDefined();
+        return solverParameterIndex(parameter) >= 0;
     }
 
     void Solver::setParameter(int k, std::string &&parameter, double value)
     {
-        _params.all_parameters[k * npar + _parameter_map[parameter].as<int>()] = value;
+        setParameter(k, parameterIndex(parameter), value);
     }
 
     void Solver::setParameter(int k, std::string &parameter, double value)
     {
-        _params.all_parameters[k * npar + _parameter_map[parameter].as<int>()] = value;
+        setParameter(k, parameterIndex(parameter), value);
     }
 
     double Solver::getParameter(int k, std::string &&parameter)
     {
-        return _params.all_parameters[k * npar + _parameter_map[parameter].as<int>()];
+        return getParameter(k, parameterIndex(parameter));
     }
 
     // XINIT //
 
     void Solver::setXinit(std::string &&state_name, double value)
     {
-        _params.xinit[_model_map[state_name][1].as<int>() - nu] = value;
+        setXinit(modelIndex(state_name), value);
     }
 
     void Solver::setXinit(const State &state)
     {
-        for (YAML::const_iterator it = _model_map.begin(); it != _model_map.end(); ++it)
+        for (const auto &variable : MODEL_VARIABLES)
         {
-            if (it->second[0].as<std::string>() == "x")
-            {
-                // it->first.as<std::string>() is the variable name
-                setXinit(
-                    it->first.as<std::string>(),
-                    state.get(it->first.as<std::string>()));
-            }
+            if (variable.is_state)
+                setXinit(variable.index, state.get(variable.index));
         }
     }
 
@@ -249,26 +291,23 @@ namespace MPCPlanner
 
     void Solver::setEgoPrediction(unsigned int k, std::string &&var_name, double value)
     {
-        int index = _model_map[var_name][1].as<int>();
-        _params.x0[k * nvar + index] = value;
+        setEgoPrediction(k, modelIndex(var_name), value);
     }
 
     double Solver::getEgoPrediction(unsigned int k, std::string &&var_name)
     {
-
-        int index = _model_map[var_name][1].as<int>();
-        return _params.x0[k * nvar + index];
+        return getEgoPrediction(k, modelIndex(var_name));
     }
 
     void Solver::setEgoPredictionPosition(unsigned int k, const Eigen::Vector2d &value)
     {
-        setEgoPrediction(k, "x", value(0));
-        setEgoPrediction(k, "y", value(1));
+        setEgoPrediction(k, ModelIndex::X, value(0));
+        setEgoPrediction(k, ModelIndex::Y, value(1));
     }
 
     Eigen::Vector2d Solver::getEgoPredictionPosition(unsigned int k)
     {
-        return Eigen::Vector2d(getEgoPrediction(k, "x"), getEgoPrediction(k, "y"));
+        return Eigen::Vector2d(getEgoPrediction(k, ModelIndex::X), getEgoPrediction(k, ModelIndex::Y));
     }
 
     void Solver::loadWarmstart()
@@ -288,14 +327,12 @@ namespace MPCPlanner
         for (int k = 0; k <= N; k++) // For all timesteps
         {
             // LOG_HEADER(k);
-            for (YAML::const_iterator it = _model_map.begin(); it != _model_map.end(); ++it) // For all inputs and states
+            for (const auto &variable : MODEL_VARIABLES) // For all inputs and states
             {
-                if (_model_map[it->first.as<std::string>()][0].as<std::string>() == "x") // Set states to initial state
-                    setEgoPrediction(k, it->first.as<std::string>(), initial_state.get(it->first.as<std::string>()));
+                if (variable.is_state) // Set states to initial state
+                    setEgoPrediction(k, variable.index, initial_state.get(variable.index));
                 else
-                    setEgoPrediction(k, it->first.as<std::string>(), 0.);
-
-                // LOG_VALUE(it->first.as<std::string>(), getEgoPrediction(k, it->first.as<std::string>()));
+                    setEgoPrediction(k, variable.index, 0.);
             }
         }
     }
@@ -306,22 +343,22 @@ namespace MPCPlanner
         initializeWithState(initial_state); // Initialize all variables
 
         double x, y, psi, v, a, spline;
-        double deceleration = std::abs(CONFIG["deceleration_at_infeasible"].as<double>());
+        double deceleration = std::abs(SETTINGS.deceleration_at_infeasible);
 
-        x = initial_state.get("x");
-        y = initial_state.get("y");
-        psi = initial_state.get("psi");
-        v = initial_state.get("v");
-        spline = initial_state.get("spline");
+        x = initial_state.get(ModelIndex::X);
+        y = initial_state.get(ModelIndex::Y);
+        psi = initial_state.get(ModelIndex::PSI);
+        v = initial_state.get(ModelIndex::V);
+        spline = initial_state.get(ModelIndex::SPLINE);
         a = -deceleration;
 
-        setEgoPrediction(0, "x", x);
-        setEgoPrediction(0, "y", y);
-        setEgoPrediction(0, "psi", psi);
-        setEgoPrediction(0, "v", v);
-        setEgoPrediction(0, "spline", spline);
-        setEgoPrediction(0, "a", a);
-        setEgoPrediction(0, "w", 0);
+        setEgoPrediction(0, ModelIndex::X, x);
+        setEgoPrediction(0, ModelIndex::Y, y);
+        setEgoPrediction(0, ModelIndex::PSI, psi);
+        setEgoPrediction(0, ModelIndex::V, v);
+        setEgoPrediction(0, ModelIndex::SPLINE, spline);
+        setEgoPrediction(0, ModelIndex::A, a);
+        setEgoPrediction(0, ModelIndex::W, 0.);
 
         for (int k = 1; k <= N; k++) // For all timesteps
         {
@@ -331,13 +368,13 @@ namespace MPCPlanner
             v += a * dt;
             v = std::max(v, 0.);
 
-            setEgoPrediction(k, "x", x);
-            setEgoPrediction(k, "y", y);
-            setEgoPrediction(k, "psi", psi);
-            setEgoPrediction(k, "v", v);
-            setEgoPrediction(k, "spline", spline);
-            setEgoPrediction(k, "a", a);
-            setEgoPrediction(k, "w", 0);
+            setEgoPrediction(k, ModelIndex::X, x);
+            setEgoPrediction(k, ModelIndex::Y, y);
+            setEgoPrediction(k, ModelIndex::PSI, psi);
+            setEgoPrediction(k, ModelIndex::V, v);
+            setEgoPrediction(k, ModelIndex::SPLINE, spline);
+            setEgoPrediction(k, ModelIndex::A, a);
+            setEgoPrediction(k, ModelIndex::W, 0.);
         }
     }
 
@@ -349,16 +386,17 @@ namespace MPCPlanner
             // [initial_state, x_2, x_3, ..., x_N-1, x_N-1]
             for (int k = 0; k <= N; k++) // For all timesteps
             {
-                for (YAML::const_iterator it = _model_map.begin(); it != _model_map.end(); ++it) // For all inputs and states
+                for (const auto &variable : MODEL_VARIABLES) // For all inputs and states
                 {
-                    if (k == 0) // Load the current state at k = 0
-                        setEgoPrediction(0, it->first.as<std::string>(), initial_state.get(it->first.as<std::string>()));
+                    const int index = variable.index;
+                    if (k == 0) // Load the current state at k = 0 (State has no inputs, shift those like the other stages)
+                        setEgoPrediction(0, index, variable.is_state ? initial_state.get(index) : getOutput(1, index));
                     else if (k == N - 1) // extrapolate with the terminal state at k = N-1
-                        setEgoPrediction(N - 1, it->first.as<std::string>(), getOutput(N - 1, it->first.as<std::string>()));
+                        setEgoPrediction(N - 1, index, getOutput(N - 1, index));
                     else if (k == N)
-                        setEgoPrediction(N, it->first.as<std::string>(), getOutput(N - 1, it->first.as<std::string>()));
+                        setEgoPrediction(N, index, getOutput(N - 1, index));
                     else // use x_{k+1} to initialize x_{k} (note that both have the initial state)
-                        setEgoPrediction(k, it->first.as<std::string>(), getOutput(k + 1, it->first.as<std::string>()));
+                        setEgoPrediction(k, index, getOutput(k + 1, index));
                 }
             }
         }
@@ -369,8 +407,8 @@ namespace MPCPlanner
             // [initial_state, x_1, x_2, ..., x_N-1, x_N]
             for (int k = 0; k < N; k++) // For all timesteps
             {
-                for (YAML::const_iterator it = _model_map.begin(); it != _model_map.end(); ++it)                 // For all inputs and states
-                    setEgoPrediction(k, it->first.as<std::string>(), getOutput(k, it->first.as<std::string>())); // Initialize with the previous output
+                for (const auto &variable : MODEL_VARIABLES)                                  // For all inputs and states
+                    setEgoPrediction(k, variable.index, getOutput(k, variable.index)); // Initialize with the previous output
             }
         }
     }
@@ -378,14 +416,7 @@ namespace MPCPlanner
     // OUTPUT //
     double Solver::getOutput(int k, std::string &&state_name) const
     {
-        if (_model_map[state_name][0].as<std::string>() == "x")
-        {
-            return _output.xtraj[k * nx + _model_map[state_name][1].as<int>() - nu];
-        }
-        else
-        {
-            return _output.utraj[k * nu + _model_map[state_name][1].as<int>()];
-        }
+        return getOutput(k, modelIndex(state_name));
     }
 
     std::string Solver::explainExitFlag(int exitflag) const
@@ -428,18 +459,18 @@ namespace MPCPlanner
         // For all outputs, check whether they are close (within 1e-2) to their bounds on either side
         for (int k = 0; k < N; k++)
         {
-            for (YAML::const_iterator it = _model_map.begin(); it != _model_map.end(); ++it)
+            for (const auto &variable : MODEL_VARIABLES)
             {
-                if (k == 0 && it->second[0].as<std::string>() == "x")
+                if (k == 0 && variable.is_state)
                     continue;
 
-                if (std::abs(getOutput(k, it->first.as<std::string>()) - it->second[2].as<double>()) < 1e-2)
+                if (std::abs(getOutput(k, variable.index) - variable.lower_bound) < 1e-2)
                 {
-                    LOG_WARN_THROTTLE(500, it->first.as<std::string>() + " limited by lower bound");
+                    LOG_WARN_THROTTLE(500, std::string(variable.name) + " limited by lower bound");
                 }
-                if (std::abs(getOutput(k, it->first.as<std::string>()) - it->second[3].as<double>()) < 1e-2)
+                if (std::abs(getOutput(k, variable.index) - variable.upper_bound) < 1e-2)
                 {
-                    LOG_WARN_THROTTLE(500, it->first.as<std::string>() + " limited by upper bound");
+                    LOG_WARN_THROTTLE(500, std::string(variable.name) + " limited by upper bound");
                 }
             }
         }
@@ -6,6 +6,8 @@
 
 #include "mpc_planner_generated.h"
 
+#include <stdexcept>
+
 extern "C"
 {
 	Solver_extfunc extfunc_eval_ = &Solver_adtool2forces;
@@ -13,6 +15,25 @@ extern "C"
 
 namespace MPCPlanner
 {
+	namespace
+	{
+		int parameterIndex(const std::string &parameter)
+		{
+			int index = solverParameterIndex(parameter);
+			if (index < 0)
+				throw std::runtime_error("Unknown solver parameter: " + parameter);
+			return index;
+		}
+
+		int modelIndex(const std::string &var_name)
+		{
+			int index = modelVariableIndex(var_name);
+			if (index < 0)
+				throw std::runtime_error("Unknown model variable: " + var_name);
+			return index;
+		}
+	}
+
 	Solver::Solver(int solver_id)
 	{
 		_solver_id = solver_id;
@@ -26,7 +47,7 @@ namespace MPCPlanner
 		nx = _config["nx"].as<unsigned int>();
 		nvar = _config["nvar"].as<unsigned int>();
 		npar = _config["npar"].as<unsigned int>();
-		dt = CONFIG["integrator_step"].as<double>();
+		dt = SETTINGS.integrator_step;
 		reset();
 	}
 
@@ -63,27 +84,42 @@ namespace MPCPlanner
 
 	bool Solver::hasParameter(std::string &&parameter)
 	{
-		return _parameter_map[parameter].IsDefined();
+		return solverParameterIndex(parameter) >= 0;
 	}
 
 	void Solver::setParameter(int k, std::string &&parameter, double value)
 	{
-		_params.all_parameters[k * npar + _parameter_map[parameter].as<int>()] = value;
+		setParameter(k, parameterIndex(parameter), value);
 	}
 
 	void Solver::setParameter(int k, std::string &parameter, double value)
 	{
-		_params.all_parameters[k * npar + _parameter_map[parameter].as<int>()] = value;
+		setParameter(k, parameterIndex(parameter), value);
+	}
+
+	void Solver::setParameter(int k, int parameter_index, double value)
+	{
+		_params.all_parameters[k * npar + parameter_index] = value;
 	}
 
 	double Solver::getParameter(int k, std::string &&parameter)
 	{
-		return _params.all_parameters[k * npar + _parameter_map[parameter].as<int>()];
+		return getParameter(k, parameterIndex(parameter));
+	}
+
+	double Solver::getParameter(int k, int parameter_index) const
+	{
+		return _params.all_parameters[k * npar + parameter_index];
 	}
 
 	void Solver::setXinit(std::string &&state_name, double value)
 	{
-		_params.xinit[_model_map[state_name][1].as<int>() - nu] = value;
+		setXinit(modelIndex(state_name), value);
+	}
+
+	void Solver::setXinit(int var_index, double value)
+	{
+		_params.xinit[var_index - nu] = value;
 	}
 
 	void Solver::setXinit(const State &state)
@@ -118,7 +154,7 @@ namespace MPCPlanner
 		initializeWithState(initial_state); // Initialize all variables
 
 		double x, y, psi, v, a;
-		double deceleration = CONFIG["deceleration_at_infeasible"].as<double>();
+		double deceleration = SETTINGS.deceleration_at_infeasible;
 
 		x = initial_state.get("x");
 		y = initial_state.get("y");
@@ -188,15 +224,22 @@ namespace MPCPlanner
 
 	void Solver::setEgoPrediction(unsigned int k, std::string &&var_name, double value)
 	{
-		int index = _model_map[var_name][1].as<int>();
-		_params.x0[k * nvar + index] = value;
+		setEgoPrediction(k, modelIndex(var_name), value);
 	}
 
 	double Solver::getEgoPrediction(unsigned int k, std::string &&var_name)
 	{
+		return getEgoPrediction(k, modelIndex(var_name));
+	}
 
-		int index = _model_map[var_name][1].as<int>();
-		return _params.x0[k * nvar + index];
+	void Solver::setEgoPrediction(unsigned int k, int var_index, double value)
+	{
+		_params.x0[k * nvar + var_index] = value;
+	}
+
+	double Solver::getEgoPrediction(unsigned int k, int var_index) const
+	{
+		return _params.x0[k * nvar + var_index];
 	}
 
 	void Solver::setEgoPredictionPosition(unsigned int k, const Eigen::Vector2d &value)
@@ -240,7 +283,12 @@ namespace MPCPlanner
 
 	double Solver::getOutput(int k, std::string &&state_name) const
 	{
-		return getForcesOutput(_output, k, _model_map[state_name][1].as<int>());
+		return getOutput(k, modelIndex(state_name));
+	}
+
+	double Solver::getOutput(int k, int var_index) const
+	{
+		return getForcesOutput(_output, k, var_index);
 	}
 
 	std::string Solver::explainExitFlag(int exitflag)
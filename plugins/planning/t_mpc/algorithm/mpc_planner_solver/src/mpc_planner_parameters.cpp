@@ -36,718 +36,76 @@ void setSolverParameterTerminalContouring(int k, AcadosParameters& params, const
 	params.all_parameters[k * 1055 + 7] = value;
 }
 void setSolverParameterSplineXA(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 8] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 17] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 26] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 35] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 44] = value;
+	static constexpr int indices[5] = {8, 17, 26, 35, 44};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineXB(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 9] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 18] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 27] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 36] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 45] = value;
+	static constexpr int indices[5] = {9, 18, 27, 36, 45};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineXC(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 10] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 19] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 28] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 37] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 46] = value;
+	static constexpr int indices[5] = {10, 19, 28, 37, 46};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineXD(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 11] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 20] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 29] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 38] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 47] = value;
+	static constexpr int indices[5] = {11, 20, 29, 38, 47};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineYA(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 12] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 21] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 30] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 39] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 48] = value;
+	static constexpr int indices[5] = {12, 21, 30, 39, 48};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineYB(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 13] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 22] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 31] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 40] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 49] = value;
+	static constexpr int indices[5] = {13, 22, 31, 40, 49};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineYC(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 14] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 23] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 32] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 41] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 50] = value;
+	static constexpr int indices[5] = {14, 23, 32, 41, 50};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineYD(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 15] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 24] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 33] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 42] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 51] = value;
+	static constexpr int indices[5] = {15, 24, 33, 42, 51};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterSplineStart(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 16] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 25] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 34] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 43] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 52] = value;
+	static constexpr int indices[5] = {16, 25, 34, 43, 52};
+	if(index < 0 || index >= 5)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterLinConstraintA1(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 53] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 56] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 59] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 62] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 65] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 68] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 71] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 74] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 77] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 80] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 83] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 86] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 89] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 92] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 95] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 98] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 101] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 104] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 107] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 110] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 113] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 116] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 119] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 122] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 125] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 128] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 131] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 134] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 137] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 140] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 143] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 146] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 149] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 152] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 155] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 158] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 161] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 164] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 167] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 170] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 173] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 176] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 179] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 182] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 185] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 188] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 191] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 194] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 197] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 200] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 203] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 206] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 209] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 212] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 215] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 218] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 221] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 224] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 227] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 230] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 233] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 236] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 239] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 242] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 245] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 248] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 251] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 254] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 257] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 260] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 263] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 266] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 269] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 272] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 275] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 278] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 281] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 284] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 287] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 290] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 293] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 296] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 299] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 302] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 305] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 308] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 311] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 314] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 317] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 320] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 323] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 326] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 329] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 332] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 335] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 338] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 341] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 344] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 347] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 350] = value;
+	static constexpr int indices[100] = {53, 56, 59, 62, 65, 68, 71, 74, 77, 80, 83, 86, 89, 92, 95, 98, 101, 104, 107, 110, 113, 116, 119, 122, 125, 128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 161, 164, 167, 170, 173, 176, 179, 182, 185, 188, 191, 194, 197, 200, 203, 206, 209, 212, 215, 218, 221, 224, 227, 230, 233, 236, 239, 242, 245, 248, 251, 254, 257, 260, 263, 266, 269, 272, 275, 278, 281, 284, 287, 290, 293, 296, 299, 302, 305, 308, 311, 314, 317, 320, 323, 326, 329, 332, 335, 338, 341, 344, 347, 350};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterLinConstraintA2(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 54] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 57] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 60] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 63] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 66] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 69] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 72] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 75] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 78] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 81] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 84] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 87] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 90] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 93] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 96] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 99] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 102] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 105] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 108] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 111] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 114] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 117] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 120] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 123] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 126] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 129] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 132] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 135] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 138] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 141] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 144] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 147] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 150] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 153] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 156] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 159] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 162] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 165] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 168] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 171] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 174] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 177] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 180] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 183] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 186] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 189] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 192] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 195] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 198] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 201] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 204] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 207] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 210] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 213] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 216] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 219] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 222] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 225] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 228] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 231] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 234] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 237] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 240] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 243] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 246] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 249] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 252] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 255] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 258] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 261] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 264] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 267] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 270] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 273] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 276] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 279] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 282] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 285] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 288] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 291] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 294] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 297] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 300] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 303] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 306] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 309] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 312] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 315] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 318] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 321] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 324] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 327] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 330] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 333] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 336] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 339] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 342] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 345] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 348] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 351] = value;
+	static constexpr int indices[100] = {54, 57, 60, 63, 66, 69, 72, 75, 78, 81, 84, 87, 90, 93, 96, 99, 102, 105, 108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177, 180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249, 252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285, 288, 291, 294, 297, 300, 303, 306, 309, 312, 315, 318, 321, 324, 327, 330, 333, 336, 339, 342, 345, 348, 351};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterLinConstraintB(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 55] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 58] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 61] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 64] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 67] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 70] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 73] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 76] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 79] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 82] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 85] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 88] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 91] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 94] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 97] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 100] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 103] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 106] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 109] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 112] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 115] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 118] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 121] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 124] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 127] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 130] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 133] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 136] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 139] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 142] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 145] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 148] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 151] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 154] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 157] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 160] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 163] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 166] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 169] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 172] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 175] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 178] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 181] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 184] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 187] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 190] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 193] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 196] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 199] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 202] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 205] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 208] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 211] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 214] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 217] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 220] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 223] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 226] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 229] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 232] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 235] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 238] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 241] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 244] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 247] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 250] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 253] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 256] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 259] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 262] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 265] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 268] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 271] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 274] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 277] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 280] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 283] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 286] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 289] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 292] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 295] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 298] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 301] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 304] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 307] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 310] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 313] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 316] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 319] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 322] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 325] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 328] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 331] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 334] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 337] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 340] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 343] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 346] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 349] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 352] = value;
+	static constexpr int indices[100] = {55, 58, 61, 64, 67, 70, 73, 76, 79, 82, 85, 88, 91, 94, 97, 100, 103, 106, 109, 112, 115, 118, 121, 124, 127, 130, 133, 136, 139, 142, 145, 148, 151, 154, 157, 160, 163, 166, 169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205, 208, 211, 214, 217, 220, 223, 226, 229, 232, 235, 238, 241, 244, 247, 250, 253, 256, 259, 262, 265, 268, 271, 274, 277, 280, 283, 286, 289, 292, 295, 298, 301, 304, 307, 310, 313, 316, 319, 322, 325, 328, 331, 334, 337, 340, 343, 346, 349, 352};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterEgoDiscRadius(int k, AcadosParameters& params, const double value, int index){
 	(void)index;
@@ -758,1417 +116,45 @@ void setSolverParameterEgoDiscOffset(int k, AcadosParameters& params, const doub
 	params.all_parameters[k * 1055 + 354] = value;
 }
 void setSolverParameterEllipsoidObstX(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 355] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 362] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 369] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 376] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 383] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 390] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 397] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 404] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 411] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 418] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 425] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 432] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 439] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 446] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 453] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 460] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 467] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 474] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 481] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 488] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 495] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 502] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 509] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 516] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 523] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 530] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 537] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 544] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 551] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 558] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 565] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 572] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 579] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 586] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 593] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 600] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 607] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 614] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 621] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 628] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 635] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 642] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 649] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 656] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 663] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 670] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 677] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 684] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 691] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 698] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 705] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 712] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 719] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 726] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 733] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 740] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 747] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 754] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 761] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 768] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 775] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 782] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 789] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 796] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 803] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 810] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 817] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 824] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 831] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 838] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 845] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 852] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 859] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 866] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 873] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 880] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 887] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 894] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 901] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 908] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 915] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 922] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 929] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 936] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 943] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 950] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 957] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 964] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 971] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 978] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 985] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 992] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 999] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 1006] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 1013] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 1020] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 1027] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 1034] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 1041] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 1048] = value;
+	static constexpr int indices[100] = {355, 362, 369, 376, 383, 390, 397, 404, 411, 418, 425, 432, 439, 446, 453, 460, 467, 474, 481, 488, 495, 502, 509, 516, 523, 530, 537, 544, 551, 558, 565, 572, 579, 586, 593, 600, 607, 614, 621, 628, 635, 642, 649, 656, 663, 670, 677, 684, 691, 698, 705, 712, 719, 726, 733, 740, 747, 754, 761, 768, 775, 782, 789, 796, 803, 810, 817, 824, 831, 838, 845, 852, 859, 866, 873, 880, 887, 894, 901, 908, 915, 922, 929, 936, 943, 950, 957, 964, 971, 978, 985, 992, 999, 1006, 1013, 1020, 1027, 1034, 1041, 1048};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterEllipsoidObstY(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 356] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 363] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 370] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 377] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 384] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 391] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 398] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 405] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 412] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 419] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 426] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 433] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 440] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 447] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 454] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 461] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 468] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 475] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 482] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 489] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 496] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 503] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 510] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 517] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 524] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 531] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 538] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 545] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 552] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 559] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 566] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 573] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 580] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 587] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 594] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 601] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 608] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 615] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 622] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 629] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 636] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 643] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 650] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 657] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 664] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 671] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 678] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 685] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 692] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 699] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 706] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 713] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 720] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 727] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 734] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 741] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 748] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 755] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 762] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 769] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 776] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 783] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 790] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 797] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 804] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 811] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 818] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 825] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 832] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 839] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 846] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 853] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 860] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 867] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 874] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 881] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 888] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 895] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 902] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 909] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 916] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 923] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 930] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 937] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 944] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 951] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 958] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 965] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 972] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 979] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 986] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 993] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 1000] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 1007] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 1014] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 1021] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 1028] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 1035] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 1042] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 1049] = value;
+	static constexpr int indices[100] = {356, 363, 370, 377, 384, 391, 398, 405, 412, 419, 426, 433, 440, 447, 454, 461, 468, 475, 482, 489, 496, 503, 510, 517, 524, 531, 538, 545, 552, 559, 566, 573, 580, 587, 594, 601, 608, 615, 622, 629, 636, 643, 650, 657, 664, 671, 678, 685, 692, 699, 706, 713, 720, 727, 734, 741, 748, 755, 762, 769, 776, 783, 790, 797, 804, 811, 818, 825, 832, 839, 846, 853, 860, 867, 874, 881, 888, 895, 902, 909, 916, 923, 930, 937, 944, 951, 958, 965, 972, 979, 986, 993, 1000, 1007, 1014, 1021, 1028, 1035, 1042, 1049};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterEllipsoidObstPsi(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 357] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 364] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 371] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 378] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 385] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 392] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 399] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 406] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 413] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 420] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 427] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 434] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 441] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 448] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 455] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 462] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 469] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 476] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 483] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 490] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 497] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 504] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 511] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 518] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 525] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 532] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 539] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 546] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 553] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 560] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 567] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 574] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 581] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 588] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 595] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 602] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 609] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 616] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 623] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 630] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 637] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 644] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 651] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 658] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 665] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 672] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 679] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 686] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 693] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 700] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 707] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 714] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 721] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 728] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 735] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 742] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 749] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 756] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 763] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 770] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 777] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 784] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 791] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 798] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 805] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 812] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 819] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 826] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 833] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 840] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 847] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 854] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 861] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 868] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 875] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 882] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 889] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 896] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 903] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 910] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 917] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 924] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 931] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 938] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 945] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 952] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 959] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 966] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 973] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 980] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 987] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 994] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 1001] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 1008] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 1015] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 1022] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 1029] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 1036] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 1043] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 1050] = value;
+	static constexpr int indices[100] = {357, 364, 371, 378, 385, 392, 399, 406, 413, 420, 427, 434, 441, 448, 455, 462, 469, 476, 483, 490, 497, 504, 511, 518, 525, 532, 539, 546, 553, 560, 567, 574, 581, 588, 595, 602, 609, 616, 623, 630, 637, 644, 651, 658, 665, 672, 679, 686, 693, 700, 707, 714, 721, 728, 735, 742, 749, 756, 763, 770, 777, 784, 791, 798, 805, 812, 819, 826, 833, 840, 847, 854, 861, 868, 875, 882, 889, 896, 903, 910, 917, 924, 931, 938, 945, 952, 959, 966, 973, 980, 987, 994, 1001, 1008, 1015, 1022, 1029, 1036, 1043, 1050};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterEllipsoidObstMajor(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 358] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 365] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 372] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 379] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 386] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 393] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 400] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 407] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 414] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 421] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 428] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 435] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 442] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 449] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 456] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 463] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 470] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 477] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 484] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 491] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 498] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 505] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 512] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 519] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 526] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 533] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 540] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 547] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 554] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 561] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 568] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 575] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 582] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 589] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 596] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 603] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 610] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 617] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 624] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 631] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 638] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 645] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 652] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 659] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 666] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 673] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 680] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 687] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 694] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 701] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 708] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 715] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 722] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 729] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 736] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 743] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 750] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 757] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 764] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 771] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 778] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 785] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 792] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 799] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 806] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 813] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 820] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 827] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 834] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 841] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 848] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 855] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 862] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 869] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 876] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 883] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 890] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 897] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 904] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 911] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 918] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 925] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 932] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 939] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 946] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 953] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 960] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 967] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 974] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 981] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 988] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 995] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 1002] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 1009] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 1016] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 1023] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 1030] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 1037] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 1044] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 1051] = value;
+	static constexpr int indices[100] = {358, 365, 372, 379, 386, 393, 400, 407, 414, 421, 428, 435, 442, 449, 456, 463, 470, 477, 484, 491, 498, 505, 512, 519, 526, 533, 540, 547, 554, 561, 568, 575, 582, 589, 596, 603, 610, 617, 624, 631, 638, 645, 652, 659, 666, 673, 680, 687, 694, 701, 708, 715, 722, 729, 736, 743, 750, 757, 764, 771, 778, 785, 792, 799, 806, 813, 820, 827, 834, 841, 848, 855, 862, 869, 876, 883, 890, 897, 904, 911, 918, 925, 932, 939, 946, 953, 960, 967, 974, 981, 988, 995, 1002, 1009, 1016, 1023, 1030, 1037, 1044, 1051};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterEllipsoidObstMinor(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 359] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 366] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 373] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 380] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 387] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 394] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 401] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 408] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 415] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 422] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 429] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 436] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 443] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 450] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 457] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 464] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 471] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 478] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 485] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 492] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 499] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 506] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 513] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 520] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 527] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 534] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 541] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 548] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 555] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 562] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 569] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 576] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 583] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 590] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 597] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 604] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 611] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 618] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 625] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 632] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 639] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 646] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 653] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 660] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 667] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 674] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 681] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 688] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 695] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 702] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 709] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 716] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 723] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 730] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 737] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 744] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 751] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 758] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 765] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 772] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 779] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 786] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 793] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 800] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 807] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 814] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 821] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 828] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 835] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 842] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 849] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 856] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 863] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 870] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 877] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 884] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 891] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 898] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 905] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 912] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 919] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 926] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 933] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 940] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 947] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 954] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 961] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 968] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 975] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 982] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 989] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 996] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 1003] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 1010] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 1017] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 1024] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 1031] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 1038] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 1045] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 1052] = value;
+	static constexpr int indices[100] = {359, 366, 373, 380, 387, 394, 401, 408, 415, 422, 429, 436, 443, 450, 457, 464, 471, 478, 485, 492, 499, 506, 513, 520, 527, 534, 541, 548, 555, 562, 569, 576, 583, 590, 597, 604, 611, 618, 625, 632, 639, 646, 653, 660, 667, 674, 681, 688, 695, 702, 709, 716, 723, 730, 737, 744, 751, 758, 765, 772, 779, 786, 793, 800, 807, 814, 821, 828, 835, 842, 849, 856, 863, 870, 877, 884, 891, 898, 905, 912, 919, 926, 933, 940, 947, 954, 961, 968, 975, 982, 989, 996, 1003, 1010, 1017, 1024, 1031, 1038, 1045, 1052};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterEllipsoidObstChi(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 360] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 367] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 374] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 381] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 388] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 395] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 402] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 409] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 416] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 423] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 430] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 437] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 444] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 451] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 458] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 465] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 472] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 479] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 486] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 493] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 500] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 507] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 514] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 521] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 528] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 535] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 542] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 549] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 556] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 563] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 570] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 577] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 584] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 591] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 598] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 605] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 612] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 619] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 626] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 633] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 640] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 647] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 654] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 661] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 668] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 675] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 682] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 689] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 696] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 703] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 710] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 717] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 724] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 731] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 738] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 745] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 752] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 759] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 766] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 773] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 780] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 787] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 794] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 801] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 808] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 815] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 822] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 829] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 836] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 843] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 850] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 857] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 864] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 871] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 878] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 885] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 892] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 899] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 906] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 913] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 920] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 927] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 934] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 941] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 948] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 955] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 962] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 969] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 976] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 983] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 990] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 997] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 1004] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 1011] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 1018] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 1025] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 1032] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 1039] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 1046] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 1053] = value;
+	static constexpr int indices[100] = {360, 367, 374, 381, 388, 395, 402, 409, 416, 423, 430, 437, 444, 451, 458, 465, 472, 479, 486, 493, 500, 507, 514, 521, 528, 535, 542, 549, 556, 563, 570, 577, 584, 591, 598, 605, 612, 619, 626, 633, 640, 647, 654, 661, 668, 675, 682, 689, 696, 703, 710, 717, 724, 731, 738, 745, 752, 759, 766, 773, 780, 787, 794, 801, 808, 815, 822, 829, 836, 843, 850, 857, 864, 871, 878, 885, 892, 899, 906, 913, 920, 927, 934, 941, 948, 955, 962, 969, 976, 983, 990, 997, 1004, 1011, 1018, 1025, 1032, 1039, 1046, 1053};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 void setSolverParameterEllipsoidObstR(int k, AcadosParameters& params, const double value, int index){
-	if(index == 0)
-		params.all_parameters[k * 1055 + 361] = value;
-	else if(index == 1)
-		params.all_parameters[k * 1055 + 368] = value;
-	else if(index == 2)
-		params.all_parameters[k * 1055 + 375] = value;
-	else if(index == 3)
-		params.all_parameters[k * 1055 + 382] = value;
-	else if(index == 4)
-		params.all_parameters[k * 1055 + 389] = value;
-	else if(index == 5)
-		params.all_parameters[k * 1055 + 396] = value;
-	else if(index == 6)
-		params.all_parameters[k * 1055 + 403] = value;
-	else if(index == 7)
-		params.all_parameters[k * 1055 + 410] = value;
-	else if(index == 8)
-		params.all_parameters[k * 1055 + 417] = value;
-	else if(index == 9)
-		params.all_parameters[k * 1055 + 424] = value;
-	else if(index == 10)
-		params.all_parameters[k * 1055 + 431] = value;
-	else if(index == 11)
-		params.all_parameters[k * 1055 + 438] = value;
-	else if(index == 12)
-		params.all_parameters[k * 1055 + 445] = value;
-	else if(index == 13)
-		params.all_parameters[k * 1055 + 452] = value;
-	else if(index == 14)
-		params.all_parameters[k * 1055 + 459] = value;
-	else if(index == 15)
-		params.all_parameters[k * 1055 + 466] = value;
-	else if(index == 16)
-		params.all_parameters[k * 1055 + 473] = value;
-	else if(index == 17)
-		params.all_parameters[k * 1055 + 480] = value;
-	else if(index == 18)
-		params.all_parameters[k * 1055 + 487] = value;
-	else if(index == 19)
-		params.all_parameters[k * 1055 + 494] = value;
-	else if(index == 20)
-		params.all_parameters[k * 1055 + 501] = value;
-	else if(index == 21)
-		params.all_parameters[k * 1055 + 508] = value;
-	else if(index == 22)
-		params.all_parameters[k * 1055 + 515] = value;
-	else if(index == 23)
-		params.all_parameters[k * 1055 + 522] = value;
-	else if(index == 24)
-		params.all_parameters[k * 1055 + 529] = value;
-	else if(index == 25)
-		params.all_parameters[k * 1055 + 536] = value;
-	else if(index == 26)
-		params.all_parameters[k * 1055 + 543] = value;
-	else if(index == 27)
-		params.all_parameters[k * 1055 + 550] = value;
-	else if(index == 28)
-		params.all_parameters[k * 1055 + 557] = value;
-	else if(index == 29)
-		params.all_parameters[k * 1055 + 564] = value;
-	else if(index == 30)
-		params.all_parameters[k * 1055 + 571] = value;
-	else if(index == 31)
-		params.all_parameters[k * 1055 + 578] = value;
-	else if(index == 32)
-		params.all_parameters[k * 1055 + 585] = value;
-	else if(index == 33)
-		params.all_parameters[k * 1055 + 592] = value;
-	else if(index == 34)
-		params.all_parameters[k * 1055 + 599] = value;
-	else if(index == 35)
-		params.all_parameters[k * 1055 + 606] = value;
-	else if(index == 36)
-		params.all_parameters[k * 1055 + 613] = value;
-	else if(index == 37)
-		params.all_parameters[k * 1055 + 620] = value;
-	else if(index == 38)
-		params.all_parameters[k * 1055 + 627] = value;
-	else if(index == 39)
-		params.all_parameters[k * 1055 + 634] = value;
-	else if(index == 40)
-		params.all_parameters[k * 1055 + 641] = value;
-	else if(index == 41)
-		params.all_parameters[k * 1055 + 648] = value;
-	else if(index == 42)
-		params.all_parameters[k * 1055 + 655] = value;
-	else if(index == 43)
-		params.all_parameters[k * 1055 + 662] = value;
-	else if(index == 44)
-		params.all_parameters[k * 1055 + 669] = value;
-	else if(index == 45)
-		params.all_parameters[k * 1055 + 676] = value;
-	else if(index == 46)
-		params.all_parameters[k * 1055 + 683] = value;
-	else if(index == 47)
-		params.all_parameters[k * 1055 + 690] = value;
-	else if(index == 48)
-		params.all_parameters[k * 1055 + 697] = value;
-	else if(index == 49)
-		params.all_parameters[k * 1055 + 704] = value;
-	else if(index == 50)
-		params.all_parameters[k * 1055 + 711] = value;
-	else if(index == 51)
-		params.all_parameters[k * 1055 + 718] = value;
-	else if(index == 52)
-		params.all_parameters[k * 1055 + 725] = value;
-	else if(index == 53)
-		params.all_parameters[k * 1055 + 732] = value;
-	else if(index == 54)
-		params.all_parameters[k * 1055 + 739] = value;
-	else if(index == 55)
-		params.all_parameters[k * 1055 + 746] = value;
-	else if(index == 56)
-		params.all_parameters[k * 1055 + 753] = value;
-	else if(index == 57)
-		params.all_parameters[k * 1055 + 760] = value;
-	else if(index == 58)
-		params.all_parameters[k * 1055 + 767] = value;
-	else if(index == 59)
-		params.all_parameters[k * 1055 + 774] = value;
-	else if(index == 60)
-		params.all_parameters[k * 1055 + 781] = value;
-	else if(index == 61)
-		params.all_parameters[k * 1055 + 788] = value;
-	else if(index == 62)
-		params.all_parameters[k * 1055 + 795] = value;
-	else if(index == 63)
-		params.all_parameters[k * 1055 + 802] = value;
-	else if(index == 64)
-		params.all_parameters[k * 1055 + 809] = value;
-	else if(index == 65)
-		params.all_parameters[k * 1055 + 816] = value;
-	else if(index == 66)
-		params.all_parameters[k * 1055 + 823] = value;
-	else if(index == 67)
-		params.all_parameters[k * 1055 + 830] = value;
-	else if(index == 68)
-		params.all_parameters[k * 1055 + 837] = value;
-	else if(index == 69)
-		params.all_parameters[k * 1055 + 844] = value;
-	else if(index == 70)
-		params.all_parameters[k * 1055 + 851] = value;
-	else if(index == 71)
-		params.all_parameters[k * 1055 + 858] = value;
-	else if(index == 72)
-		params.all_parameters[k * 1055 + 865] = value;
-	else if(index == 73)
-		params.all_parameters[k * 1055 + 872] = value;
-	else if(index == 74)
-		params.all_parameters[k * 1055 + 879] = value;
-	else if(index == 75)
-		params.all_parameters[k * 1055 + 886] = value;
-	else if(index == 76)
-		params.all_parameters[k * 1055 + 893] = value;
-	else if(index == 77)
-		params.all_parameters[k * 1055 + 900] = value;
-	else if(index == 78)
-		params.all_parameters[k * 1055 + 907] = value;
-	else if(index == 79)
-		params.all_parameters[k * 1055 + 914] = value;
-	else if(index == 80)
-		params.all_parameters[k * 1055 + 921] = value;
-	else if(index == 81)
-		params.all_parameters[k * 1055 + 928] = value;
-	else if(index == 82)
-		params.all_parameters[k * 1055 + 935] = value;
-	else if(index == 83)
-		params.all_parameters[k * 1055 + 942] = value;
-	else if(index == 84)
-		params.all_parameters[k * 1055 + 949] = value;
-	else if(index == 85)
-		params.all_parameters[k * 1055 + 956] = value;
-	else if(index == 86)
-		params.all_parameters[k * 1055 + 963] = value;
-	else if(index == 87)
-		params.all_parameters[k * 1055 + 970] = value;
-	else if(index == 88)
-		params.all_parameters[k * 1055 + 977] = value;
-	else if(index == 89)
-		params.all_parameters[k * 1055 + 984] = value;
-	else if(index == 90)
-		params.all_parameters[k * 1055 + 991] = value;
-	else if(index == 91)
-		params.all_parameters[k * 1055 + 998] = value;
-	else if(index == 92)
-		params.all_parameters[k * 1055 + 1005] = value;
-	else if(index == 93)
-		params.all_parameters[k * 1055 + 1012] = value;
-	else if(index == 94)
-		params.all_parameters[k * 1055 + 1019] = value;
-	else if(index == 95)
-		params.all_parameters[k * 1055 + 1026] = value;
-	else if(index == 96)
-		params.all_parameters[k * 1055 + 1033] = value;
-	else if(index == 97)
-		params.all_parameters[k * 1055 + 1040] = value;
-	else if(index == 98)
-		params.all_parameters[k * 1055 + 1047] = value;
-	else if(index == 99)
-		params.all_parameters[k * 1055 + 1054] = value;
+	static constexpr int indices[100] = {361, 368, 375, 382, 389, 396, 403, 410, 417, 424, 431, 438, 445, 452, 459, 466, 473, 480, 487, 494, 501, 508, 515, 522, 529, 536, 543, 550, 557, 564, 571, 578, 585, 592, 599, 606, 613, 620, 627, 634, 641, 648, 655, 662, 669, 676, 683, 690, 697, 704, 711, 718, 725, 732, 739, 746, 753, 760, 767, 774, 781, 788, 795, 802, 809, 816, 823, 830, 837, 844, 851, 858, 865, 872, 879, 886, 893, 900, 907, 914, 921, 928, 935, 942, 949, 956, 963, 970, 977, 984, 991, 998, 1005, 1012, 1019, 1026, 1033, 1040, 1047, 1054};
+	if(index < 0 || index >= 100)
+		return;
+	params.all_parameters[k * 1055 + indices[index]] = value;
 }
 }
@@ -2,43 +2,52 @@
 
 #include <ros_tools/logging.h>
 
+#include <stdexcept>
+
 using namespace MPCPlanner;
 
 State::State()
 {
-    loadConfigYaml(SYSTEM_CONFIG_PATH(__FILE__, "solver_settings"), _config);
-    loadConfigYaml(SYSTEM_CONFIG_PATH(__FILE__, "model_map"), _model_map);
     initialize();
 }
 
 void State::initialize()
 {
-    _state = std::vector<double>(_config["nx"].as<int>(), 0.0);
-    _nu = _config["nu"].as<int>();
+    // Dimensions come from the generated tables (checked against solver_settings.yaml by the Solver)
+    _state = std::vector<double>(MODEL_NX, 0.0);
+    _nu = MODEL_NU;
+}
+
+static int stateIndex(const std::string &var_name)
+{
+    int index = modelVariableIndex(var_name);
+    if (index < 0)
+        throw std::runtime_error("Unknown model variable: " + var_name);
+    return index;
 }
 
 double State::get(std::string &&var_name) const
 {
-    return _state[_model_map[var_name][1].as<int>() - _nu]; // States come after the inputs
+    return get(stateIndex(var_name)); // States come after the inputs
 }
 
 Eigen::Vector2d State::getPos() const
 {
-    return Eigen::Vector2d(get("x"), get("y"));
+    return Eigen::Vector2d(get(ModelIndex::X), get(ModelIndex::Y));
 }
 
 void State::set(std::string &&var_name, double value)
 {
-    _state[_model_map[var_name][1].as<int>() - _nu] = value;
+    set(stateIndex(var_name), value);
 }
 
 void State::print() const
 {
-    for (YAML::const_iterator it = _model_map.begin(); it != _model_map.end(); ++it)
+    for (const auto &variable : MODEL_VARIABLES)
     {
-        if (it->second[0].as<std::string>() == "x")
+        if (variable.is_state)
         {
-            LOG_VALUE(it->first.as<std::string>(), get(it->first.as<std::string>()));
+            LOG_VALUE(std::string(variable.name), get(variable.index));
         }
     }
 }
\ No newline at end of file
@@ -64,6 +64,22 @@ TEST_F(StateTest, TestName)
     ASSERT_TRUE(state.getPos()(1) == 3.5);
 }
 
+TEST_F(StateTest, GeneratedTables)
+{
+    // The generated tables must agree with the YAML maps written by the generator
+    ASSERT_TRUE(solverParameterIndex("reference_velocity") == 3);
+    ASSERT_TRUE(solverParameterIndex("ellipsoid_obst_0_x") == 355);
+    ASSERT_TRUE(solverParameterIndex("not_a_parameter") == -1);
+
+    ASSERT_TRUE(modelVariableIndex("x") == ModelIndex::X);
+    ASSERT_TRUE(modelVariableIndex("spline") == ModelIndex::SPLINE);
+    ASSERT_TRUE(modelVariableIndex("not_a_variable") == -1);
+
+    State state;
+    state.set(ModelIndex::PSI, 0.3);
+    ASSERT_TRUE(state.get("psi") == 0.3);
+}
+
 TEST_F(SolverTest, TestName)
 {
     Solver solver;
@@ -30,6 +30,8 @@ namespace MPCPlanner
 
         int current_path_segment{-1};
 
+        double road_width{-1.}; // [m] Measured from the road boundaries by Contouring, < 0 if not set (use SETTINGS.road.width)
+
         void reset();
     };
 }
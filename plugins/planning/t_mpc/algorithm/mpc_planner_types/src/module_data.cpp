@@ -9,5 +9,6 @@ namespace MPCPlanner
                 path_width_right.reset();
                 path_velocity.reset();
                 current_path_segment = -1;
+                road_width = -1.;
         }
 }
\ No newline at end of file
@@ -2,14 +2,21 @@
 #define PARAMETERS_H
 
 #include <mpc_planner_util/load_yaml.hpp>
+#include <mpc_planner_util/planner_config.h>
 #include <ros_tools/logging.h>
 
-#define LOG_MARK(x)                        \
-    if (CONFIG["debug_output"].as<bool>()) \
+#include <atomic>
+
+#define LOG_MARK(x)              \
+    if (SETTINGS.debug_output) \
     LOG_HOOK_MSG(x)
 
+/** @note Raw YAML access, use SETTINGS outside of initialization */
 #define CONFIG Configuration::getInstance().getYAMLNode()
 
+/** @brief Typed settings parsed once in Configuration::initialize() */
+#define SETTINGS Configuration::getInstance().settings()
+
 namespace YAML
 {
     class SafeNode
@@ -32,15 +39,30 @@ public:
     void initialize(const std::string &config_file)
     {
         loadConfigYaml(config_file, _config); // Load parameters from the YAML file
+        _settings = PlannerConfig::fromYAML(_config);
     }
 
     YAML::Node &getYAMLNode()
     {
+        _yaml_accesses.fetch_add(1, std::memory_order_relaxed);
         return _config;
     }
 
+    const PlannerConfig &settings() const
+    {
+        return _settings;
+    }
+
+    /** @brief Number of CONFIG[...] accesses so far (the planning loop should not add any) */
+    size_t yamlAccessCount() const
+    {
+        return _yaml_accesses.load(std::memory_order_relaxed);
+    }
+
 private:
     YAML::Node _config;
+    PlannerConfig _settings;
+    std::atomic<size_t> _yaml_accesses{0};
 
     Configuration()
     {
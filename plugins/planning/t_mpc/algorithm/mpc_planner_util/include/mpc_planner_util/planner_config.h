@@ -0,0 +1,128 @@
+#ifndef PLANNER_CONFIG_H
+#define PLANNER_CONFIG_H
+
+#include <yaml-cpp/yaml.h>
+
+#include <limits>
+#include <map>
+#include <string>
+
+/**
+ * @brief Typed view of settings.yaml, parsed once by Configuration::initialize()
+ *
+ * The modules read these plain fields in their per-iteration paths instead of going through CONFIG[...] (a
+ * yaml-cpp tree lookup and string conversion on every access). Missing required keys throw at initialization.
+ */
+struct PlannerConfig
+{
+    std::string name;
+    int N{0};                     // [#] Time horizon
+    double integrator_step{0.};   // [s]
+    int n_discs{1};
+    bool enable_output{true};
+    double control_frequency{0.}; // [Hz]
+
+    bool debug_output{false};
+    bool debug_limits{false};
+    bool debug_visuals{false};
+
+    struct SolverSettings
+    {
+        int acados_iterations{0};
+        std::string acados_solver_type;
+    } solver_settings;
+
+    struct Recording
+    {
+        bool enable{false};
+        std::string folder;
+        std::string file;
+        bool timestamp{false};
+        int num_experiments{0};
+    } recording;
+
+    double deceleration_at_infeasible{0.}; // [m/s^2]
+    int max_obstacles{0};
+    double max_obstacle_distance{std::numeric_limits<double>::infinity()}; // [m] Optional
+    double robot_radius{0.};                                                // [m]
+    double obstacle_radius{0.};                                             // [m]
+
+    struct Robot
+    {
+        double length{0.}; // [m]
+        double width{0.};  // [m]
+    } robot;
+
+    struct LinearizedConstraints
+    {
+        int add_halfspaces{0};
+    } linearized_constraints;
+
+    struct ScenarioConstraints
+    {
+        int parallel_solvers{1};
+    } scenario_constraints;
+
+    struct Decomp
+    {
+        double range{0.};
+        int max_constraints{0};
+        double reuse_tolerance{0.1}; // Segments moving less keep their polyhedron (m), 0 disables reuse
+        bool parallel{true};         // Dilate the segments in parallel on GuidancePlanner::ParallelFor
+    } decomp;
+
+    struct Road
+    {
+        bool two_way{false};
+        double width{0.}; // [m] Default, the width measured from received road boundaries is in ModuleData::road_width
+    } road;
+
+    bool shift_previous_solution_forward{false};
+
+    struct Contouring
+    {
+        bool dynamic_velocity_reference{false};
+        int num_segments{0};
+        bool add_road_constraints{false};
+    } contouring;
+
+    struct TMPC
+    {
+        bool use_tmpcpp{false};
+        bool enable_constraints{false};
+        bool highlight_selected{false};
+        bool warmstart_with_mpc_solution{false};
+    } tmpc;
+
+    struct Probabilistic
+    {
+        bool enable{false};
+        double risk{0.};
+    } probabilistic;
+
+    struct Weights
+    {
+        double goal{0.};
+        double velocity{0.};
+        double reference_velocity{0.};
+        double contour{0.};
+        double lag{0.};
+        double terminal_angle{0.};
+        double terminal_contouring{0.};
+
+        std::map<std::string, double> by_name; // All weights, for modules that set them by solver parameter name
+
+        /** @brief Weight by name, throws std::runtime_error if it is not configured */
+        double get(const std::string &weight_name) const;
+    } weights;
+
+    struct Visualization
+    {
+        int draw_every{1};
+    } visualization;
+
+    /** @brief Parse settings.yaml, throws if a required key is missing or has the wrong type */
+    static PlannerConfig fromYAML(const YAML::Node &config);
+};
+
+#endif // PLANNER_CONFIG_H
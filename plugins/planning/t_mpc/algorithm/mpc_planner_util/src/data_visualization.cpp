@@ -21,7 +21,7 @@ namespace MPCPlanner
         RosTools::ROSMarkerPublisher &publisher = VISUALS.getPublisher(topic_name);
 
         auto &cylinder = publisher.getNewPointMarker("CYLINDER");
-        cylinder.setScale(2. * CONFIG["robot_radius"].as<double>(), 2. * CONFIG["robot_radius"].as<double>(), 0.01);
+        cylinder.setScale(2. * SETTINGS.robot_radius, 2. * SETTINGS.robot_radius, 0.01);
 
         auto &line = publisher.getNewLine();
         line.setScale(0.15, 0.15);
@@ -234,7 +234,7 @@ namespace MPCPlanner
         RosTools::ROSMarkerPublisher &publisher = VISUALS.getPublisher(topic_name);
 
         auto &cylinder = publisher.getNewPointMarker("CYLINDER");
-        cylinder.setScale(2. * CONFIG["robot_radius"].as<double>(), 2. * CONFIG["robot_radius"].as<double>(), 0.01);
+        cylinder.setScale(2. * SETTINGS.robot_radius, 2. * SETTINGS.robot_radius, 0.01);
         cylinder.setColorInt(0, 10, alpha);
 
         for (size_t k = 0; k < trajectory.positions.size(); k++)
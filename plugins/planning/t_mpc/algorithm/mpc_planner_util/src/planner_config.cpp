@@ -0,0 +1,122 @@
+#include <mpc_planner_util/planner_config.h>
+
+#include <stdexcept>
+
+namespace
+{
+    const YAML::Node section(const YAML::Node &node, const std::string &key)
+    {
+        const YAML::Node value = node[key];
+        if (!value || !value.IsMap())
+            throw std::runtime_error("settings: missing section \"" + key + "\"");
+        return value;
+    }
+
+    template <typename T>
+    T required(const YAML::Node &node, const std::string &key)
+    {
+        const YAML::Node value = node[key];
+        if (!value)
+            throw std::runtime_error("settings: missing key \"" + key + "\"");
+        return value.as<T>();
+    }
+
+    template <typename T>
+    T optional(const YAML::Node &node, const std::string &key, T fallback)
+    {
+        const YAML::Node value = node[key];
+        return value ? value.as<T>() : fallback;
+    }
+}
+
+double PlannerConfig::Weights::get(const std::string &weight_name) const
+{
+    auto it = by_name.find(weight_name);
+    if (it == by_name.end())
+        throw std::runtime_error("settings: weight \"" + weight_name + "\" is not configured");
+    return it->second;
+}
+
+PlannerConfig PlannerConfig::fromYAML(const YAML::Node &config)
+{
+    PlannerConfig c;
+
+    c.name = optional<std::string>(config, "name", "");
+    c.N = required<int>(config, "N");
+    c.integrator_step = required<double>(config, "integrator_step");
+    c.n_discs = required<int>(config, "n_discs");
+    c.enable_output = required<bool>(config, "enable_output");
+    c.control_frequency = required<double>(config, "control_frequency");
+
+    c.debug_output = required<bool>(config, "debug_output");
+    c.debug_limits = required<bool>(config, "debug_limits");
+    c.debug_visuals = required<bool>(config, "debug_visuals");
+
+    const YAML::Node acados = section(section(config, "solver_settings"), "acados");
+    c.solver_settings.acados_iterations = required<int>(acados, "iterations");
+    c.solver_settings.acados_solver_type = required<std::string>(acados, "solver_type");
+
+    const YAML::Node recording = section(config, "recording");
+    c.recording.enable = required<bool>(recording, "enable");
+    c.recording.folder = required<std::string>(recording, "folder");
+    c.recording.file = required<std::string>(recording, "file");
+    c.recording.timestamp = required<bool>(recording, "timestamp");
+    c.recording.num_experiments = required<int>(recording, "num_experiments");
+
+    c.deceleration_at_infeasible = required<double>(config, "deceleration_at_infeasible");
+    c.max_obstacles = required<int>(config, "max_obstacles");
+    c.max_obstacle_distance = optional<double>(config, "max_obstacle_distance", c.max_obstacle_distance);
+    c.robot_radius = required<double>(config, "robot_radius");
+    c.obstacle_radius = required<double>(config, "obstacle_radius");
+
+    const YAML::Node robot = section(config, "robot");
+    c.robot.length = required<double>(robot, "length");
+    c.robot.width = required<double>(robot, "width");
+
+    c.linearized_constraints.add_halfspaces = required<int>(section(config, "linearized_constraints"), "add_halfspaces");
+    c.scenario_constraints.parallel_solvers = required<int>(section(config, "scenario_constraints"), "parallel_solvers");
+
+    const YAML::Node decomp = section(config, "decomp");
+    c.decomp.range = required<double>(decomp, "range");
+    c.decomp.max_constraints = required<int>(decomp, "max_constraints");
+    c.decomp.reuse_tolerance = optional<double>(decomp, "reuse_tolerance", c.decomp.reuse_tolerance);
+    c.decomp.parallel = optional<bool>(decomp, "parallel", c.decomp.parallel);
+
+    const YAML::Node road = section(config, "road");
+    c.road.two_way = required<bool>(road, "two_way");
+    c.road.width = required<double>(road, "width");
+
+    c.shift_previous_solution_forward = required<bool>(config, "shift_previous_solution_forward");
+
+    const YAML::Node contouring = section(config, "contouring");
+    c.contouring.dynamic_velocity_reference = required<bool>(contouring, "dynamic_velocity_reference");
+    c.contouring.num_segments = required<int>(contouring, "num_segments");
+    c.contouring.add_road_constraints = required<bool>(contouring, "add_road_constraints");
+
+    const YAML::Node tmpc = section(config, "t-mpc");
+    c.tmpc.use_tmpcpp = required<bool>(tmpc, "use_t-mpc++");
+    c.tmpc.enable_constraints = required<bool>(tmpc, "enable_constraints");
+    c.tmpc.highlight_selected = required<bool>(tmpc, "highlight_selected");
+    c.tmpc.warmstart_with_mpc_solution = required<bool>(tmpc, "warmstart_with_mpc_solution");
+
+    const YAML::Node probabilistic = section(config, "probabilistic");
+    c.probabilistic.enable = required<bool>(probabilistic, "enable");
+    c.probabilistic.risk = required<double>(probabilistic, "risk");
+
+    const YAML::Node weights = section(config, "weights");
+    for (YAML::const_iterator it = weights.begin(); it != weights.end(); ++it)
+        c.weights.by_name[it->first.as<std::string>()] = it->second.as<double>();
+    c.weights.goal = c.weights.get("goal");
+    c.weights.velocity = c.weights.get("velocity");
+    c.weights.reference_velocity = c.weights.get("reference_velocity");
+    c.weights.contour = c.weights.get("contour");
+    c.weights.lag = c.weights.get("lag");
+    c.weights.terminal_angle = c.weights.get("terminal_angle");
+    c.weights.terminal_contouring = c.weights.get("terminal_contouring");
+
+    c.visualization.draw_every = required<int>(section(config, "visualization"), "draw_every");
+    if (c.visualization.draw_every < 1)
+        throw std::runtime_error("settings: visualization.draw_every must be >= 1");
+
+    return c;
+}
@@ -6,6 +6,10 @@
 #include <algorithm>
 #include <thread>
 
+#ifdef ROS_TOOLS_NAVSIM_TRACE
+#include "core/trace.hpp"
+#endif
+
 namespace RosTools
 {
     Benchmarker::Benchmarker(const std::string &name)
@@ -116,6 +120,9 @@ namespace RosTools
     {
         std::lock_guard<std::mutex> lock(m_lock);
 
+        if (m_CurrentSession == nullptr)
+            return;
+
         if (m_ProfileCount++ > 0)
             m_OutputStream << ",";
 
@@ -159,6 +166,15 @@ namespace RosTools
     {
         auto endTimepoint = std::chrono::system_clock::now();
 
+#ifdef ROS_TOOLS_NAVSIM_TRACE
+        if (navsim::trace::Tracer::enabled())
+        {
+            const int64_t end_ns = navsim::trace::Tracer::now();
+            const int64_t duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(endTimepoint - m_StartTimepoint).count();
+            navsim::trace::Tracer::instance().record("tmpc", m_Name, end_ns - duration_ns, end_ns);
+        }
+#endif
+
         long long start = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch().count();
         long long end = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch().count();
 
@@ -216,6 +216,7 @@ def generate_parameter_cpp_code(settings, model):
     # IMPORTS
     header_file.write("#ifndef __MPC_PLANNER_PARAMETERS_H__\n")
     header_file.write("#define __MPC_PLANNER_PARAMETERS_H__\n\n")
+    header_file.write("#include <string_view>\n\n")
 
     if settings["solver_settings"]["solver"] == "acados":  # Forward declare
         header_file.write("namespace MPCPlanner{\n\n")
@@ -232,6 +233,9 @@ def generate_parameter_cpp_code(settings, model):
 
     cpp_file.write("namespace MPCPlanner{\n\n")
 
+    generate_index_tables(header_file, settings, model)
+
+    npar = settings["params"].length()
     for key, indices in settings["params"].parameter_bundles.items():
         function_name = key.replace("_", " ").title().replace(" ", "")
 
@@ -239,17 +243,15 @@ def generate_parameter_cpp_code(settings, model):
             header_file.write(f"void setSolverParameter{function_name}(int k, {param_name}& params, const double value, int index=0);\n")
             cpp_file.write(f"void setSolverParameter{function_name}(int k, {param_name}& params, const double value, int index){{\n")
             cpp_file.write("\t(void)index;\n")
-            cpp_file.write(f"\tparams.all_parameters[k * {settings['params'].length()} + {indices[0]}] = value;\n")
+            cpp_file.write(f"\tparams.all_parameters[k * {npar} + {indices[0]}] = value;\n")
         else:
+            # Index table instead of an if-chain: constant time for every bundle member
             header_file.write(f"void setSolverParameter{function_name}(int k, {param_name}& params, const double value, int index);\n")
             cpp_file.write(f"void setSolverParameter{function_name}(int k, {param_name}& params, const double value, int index){{\n")
-            for i, index in enumerate(indices):
-                if i == 0:
-                    cpp_file.write(f"\tif(index == {i})\n")
-                else:
-                    cpp_file.write(f"\telse if(index == {i})\n")
-
-                cpp_file.write(f"\t\tparams.all_parameters[k * {settings['params'].length()} + {index}] = value;\n")
+            cpp_file.write(f"\tstatic constexpr int indices[{len(indices)}] = {{{', '.join(str(i) for i in indices)}}};\n")
+            cpp_file.write(f"\tif(index < 0 || index >= {len(indices)})\n")
+            cpp_file.write("\t\treturn;\n")
+            cpp_file.write(f"\tparams.all_parameters[k * {npar} + indices[index]] = value;\n")
 
         cpp_file.write("}\n")
 
@@ -260,6 +262,79 @@ def generate_parameter_cpp_code(settings, model):
     return
 
 
+def generate_index_tables(header_file, settings, model):
+    """Compile-time copies of parameter_map.yaml and model_map.yaml, so that the solver interface
+    resolves names without YAML lookups and hot loops can index directly"""
+    params = settings["params"]
+    parameter_names = sorted((name, index) for name, index in params._params.items() if name != "num parameters")
+
+    header_file.write("\n// Solver layout at generation time (mirrors parameter_map.yaml and model_map.yaml)\n")
+    header_file.write(f"constexpr int SOLVER_NUM_PARAMETERS = {params.length()}; // Parameters per stage\n")
+    header_file.write(f"constexpr int MODEL_NU = {model.nu}; // Inputs come first in z = [u, x]\n")
+    header_file.write(f"constexpr int MODEL_NX = {model.nx};\n")
+    header_file.write(f"constexpr int MODEL_NVAR = {model.get_nvar()};\n\n")
+
+    variables = [(name, idx, False) for idx, name in enumerate(model.inputs)]
+    variables += [(name, idx + model.nu, True) for idx, name in enumerate(model.states)]
+
+    header_file.write("/** @brief Index of each model variable in z = [u, x] */\n")
+    header_file.write("namespace ModelIndex{\n")
+    for name, index, _ in variables:
+        header_file.write(f"\tconstexpr int {name.upper()} = {index};\n")
+    header_file.write("}\n\n")
+
+    header_file.write("struct ModelVariable{\n")
+    header_file.write("\tstd::string_view name;\n")
+    header_file.write("\tint index;\n")
+    header_file.write("\tbool is_state;\n")
+    header_file.write("\tdouble lower_bound;\n")
+    header_file.write("\tdouble upper_bound;\n")
+    header_file.write("};\n\n")
+
+    header_file.write("/** @brief Model variables ordered by index */\n")
+    header_file.write(f"constexpr ModelVariable MODEL_VARIABLES[{len(variables)}] = {{\n")
+    for name, index, is_state in variables:
+        lower, upper = model.get_bounds(name)[0], model.get_bounds(name)[1]
+        header_file.write(f'\t{{"{name}", {index}, {"true" if is_state else "false"}, {float(lower)!r}, {float(upper)!r}}},\n')
+    header_file.write("};\n\n")
+
+    header_file.write("struct SolverParameterName{\n")
+    header_file.write("\tstd::string_view name;\n")
+    header_file.write("\tint index;\n")
+    header_file.write("};\n\n")
+
+    header_file.write("/** @brief Per-stage parameter indices, sorted by name */\n")
+    header_file.write(f"constexpr SolverParameterName SOLVER_PARAMETER_NAMES[{len(parameter_names)}] = {{\n")
+    for name, index in parameter_names:
+        header_file.write(f'\t{{"{name}", {index}}},\n')
+    header_file.write("};\n\n")
+
+    header_file.write("/** @brief Index of a model variable in z = [u, x], -1 if the model has no such variable */\n")
+    header_file.write("constexpr int modelVariableIndex(std::string_view name){\n")
+    header_file.write("\tfor(const auto& variable : MODEL_VARIABLES)\n")
+    header_file.write("\t\tif(variable.name == name)\n")
+    header_file.write("\t\t\treturn variable.index;\n")
+    header_file.write("\treturn -1;\n")
+    header_file.write("}\n\n")
+
+    header_file.write("/** @brief Per-stage index of a parameter, -1 if the solver has no such parameter */\n")
+    header_file.write("constexpr int solverParameterIndex(std::string_view name){\n")
+    header_file.write("\tint low = 0;\n")
+    header_file.write(f"\tint high = {len(parameter_names)} - 1;\n")
+    header_file.write("\twhile(low <= high){\n")
+    header_file.write("\t\tint mid = low + (high - low) / 2;\n")
+    header_file.write("\t\tint cmp = SOLVER_PARAMETER_NAMES[mid].name.compare(name);\n")
+    header_file.write("\t\tif(cmp == 0)\n")
+    header_file.write("\t\t\treturn SOLVER_PARAMETER_NAMES[mid].index;\n")
+    header_file.write("\t\tif(cmp < 0)\n")
+    header_file.write("\t\t\tlow = mid + 1;\n")
+    header_file.write("\t\telse\n")
+    header_file.write("\t\t\thigh = mid - 1;\n")
+    header_file.write("\t}\n")
+    header_file.write("\treturn -1;\n")
+    header_file.write("}\n\n")
+
+
 def generate_rqtreconfigure(settings):
     current_package = get_current_package()
     system_name = "".join(current_package.split("_")[2:])
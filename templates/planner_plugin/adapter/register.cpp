@@ -1,23 +1,24 @@
 #include "{{PLUGIN_NAME_SNAKE}}_plugin.hpp"
 #include "plugin/framework/plugin_registry.hpp"
 #include <memory>
+#include <mutex>
 
 namespace {{NAMESPACE}} {
 namespace adapter {
 
 // 插件自注册函数
 void register{{PLUGIN_NAME}}Plugin() {
-  static bool registered = false;
-  if (!registered) {
+  // call_once：静态初始化器、动态加载器和 loadAllBuiltinPlugins 可能从不同线程重复调用
+  static std::once_flag registered;
+  std::call_once(registered, []() {
     std::cout << "[DEBUG] Registering {{PLUGIN_NAME}} plugin..." << std::endl;
     navsim::plugin::PlannerPluginRegistry::getInstance().registerPlugin(
         "{{PLUGIN_NAME}}",
         []() -> std::shared_ptr<navsim::plugin::PlannerPluginInterface> {
           return std::make_shared<{{PLUGIN_NAME}}Plugin>();
         });
-    registered = true;
     std::cout << "[DEBUG] {{PLUGIN_NAME}} plugin registered successfully" << std::endl;
-  }
+  });
 }
 
 } // namespace adapter
@@ -0,0 +1,145 @@
+/**
+ * @file test_algorithm_manager_concurrency.cpp
+ * @brief 多个 AlgorithmManager 在同一进程内并发运行的压力测试
+ *
+ * 每个线程持有独立的 AlgorithmManager / LocalSimulator / 插件实例，
+ * 并发运行的结果必须与单线程运行完全一致。
+ */
+
+#include "core/algorithm_manager.hpp"
+#include "sim/local_simulator.hpp"
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace navsim;
+
+namespace {
+
+constexpr int kThreadCount = 4;
+constexpr int kSteps = 120;
+constexpr double kStepDt = 1.0 / 30.0;
+
+struct RunResult {
+  bool initialized = false;
+  bool loaded = false;
+  int processed = 0;
+  planning::Pose2d final_pose;
+};
+
+std::string writeConfig() {
+  // 栅格/ESDF 感知插件都持有逐帧状态；截止时间放宽，避免负载差异导致结果分叉
+  nlohmann::json config = {
+    {"perception", {
+      {"plugins", {
+        {{"name", "GridMapBuilder"}, {"enabled", true}, {"priority", 100},
+         {"params", {{"resolution", 0.1}, {"map_width", 20.0}, {"map_height", 20.0},
+                     {"obstacle_cost", 100}, {"inflation_radius", 0.3}}}},
+        {{"name", "EsdfBuilder"}, {"enabled", true}, {"priority", 90},
+         {"params", {{"resolution", 0.1}, {"map_width", 19.0}, {"map_height", 19.0},
+                     {"max_distance", 5.0}, {"include_dynamic", true}}}}
+      }}
+    }},
+    {"planning", {
+      {"primary_planner", "AstarPlanner"},
+      {"fallback_planner", "StraightLine"},
+      {"enable_fallback", true}
+    }}
+  };
+
+  std::string filename = "/tmp/test_concurrency_config.json";
+  std::ofstream file(filename);
+  file << config.dump(2);
+  return filename;
+}
+
+std::string writeScenario() {
+  nlohmann::json scenario = {
+    {"name", "concurrency"},
+    {"startPose", {{"x", 0.0}, {"y", 0.0}, {"yaw", 0.0}}},
+    {"goalPose", {{"x", 8.0}, {"y", 0.5}, {"yaw", 0.0}, {"tol", {{"pos", 0.2}, {"yaw", 0.1}}}}},
+    {"obstacles", {
+      {"circles", {{{"x", 4.0}, {"y", 0.0}, {"radius", 0.5}}}},
+      {"polygons", nlohmann::json::array()},
+      {"dynamic", nlohmann::json::array()}
+    }}
+  };
+
+  std::string filename = "/tmp/test_concurrency_scenario.json";
+  std::ofstream file(filename);
+  file << scenario.dump(2);
+  return filename;
+}
+
+RunResult runScenario(const std::string& config_file, const std::string& scenario_file) {
+  RunResult result;
+
+  AlgorithmManager::Config config;
+  config.config_file = config_file;
+  config.enable_visualization = false;
+  config.max_computation_time_ms = 10000.0;
+
+  AlgorithmManager manager;
+  result.initialized = manager.initialize_with_simulator(config);
+  if (!result.initialized) {
+    return result;
+  }
+
+  sim::SimulatorConfig sim_config;
+  sim_config.time_step = 0.01;
+  sim_config.enable_adaptive_stepping = false;
+
+  auto simulator = std::make_shared<sim::LocalSimulator>();
+  result.loaded = simulator->initialize(sim_config) && simulator->load_scenario(scenario_file);
+  if (!result.loaded) {
+    return result;
+  }
+
+  manager.set_local_simulator(simulator);
+  manager.set_current_scenario(scenario_file);
+  manager.reset();
+  manager.startSimulation();
+
+  for (int i = 0; i < kSteps; ++i) {
+    manager.process_simulation_step(kStepDt);
+  }
+
+  result.processed = manager.getStatistics().successful_processed;
+  result.final_pose = simulator->get_world_state().ego_pose;
+  return result;
+}
+
+}  // namespace
+
+TEST(AlgorithmManagerConcurrencyTest, ParallelManagersMatchSequentialRun) {
+  const std::string config_file = writeConfig();
+  const std::string scenario_file = writeScenario();
+
+  RunResult reference = runScenario(config_file, scenario_file);
+  ASSERT_TRUE(reference.initialized);
+  ASSERT_TRUE(reference.loaded);
+  ASSERT_GT(reference.processed, 0);
+  ASSERT_GT(reference.final_pose.x, 0.0);  // 自车确实在规划轨迹上前进
+
+  // 初始化（插件注册、动态加载）与仿真步进都不加外部锁
+  std::vector<RunResult> results(kThreadCount);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([&, i]() { results[i] = runScenario(config_file, scenario_file); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < kThreadCount; ++i) {
+    SCOPED_TRACE("thread " + std::to_string(i));
+    ASSERT_TRUE(results[i].initialized);
+    ASSERT_TRUE(results[i].loaded);
+    EXPECT_EQ(results[i].processed, reference.processed);
+    EXPECT_DOUBLE_EQ(results[i].final_pose.x, reference.final_pose.x);
+    EXPECT_DOUBLE_EQ(results[i].final_pose.y, reference.final_pose.y);
+    EXPECT_DOUBLE_EQ(results[i].final_pose.yaw, reference.final_pose.yaw);
+  }
+}
@@ -0,0 +1,199 @@
+/**
+ * @file test_collision_world.cpp
+ * @brief CollisionWorld 粗相网格与窄相测试
+ */
+
+#include "sim/collision_world.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace navsim::sim;
+using navsim::planning::Point2d;
+
+namespace {
+
+OrientedBox makeBox(double cx, double cy, double yaw, double half_length, double half_width) {
+  OrientedBox box;
+  box.cx = cx;
+  box.cy = cy;
+  box.yaw = yaw;
+  box.half_length = half_length;
+  box.half_width = half_width;
+  return box;
+}
+
+StaticObstacle makePolygon(const std::vector<Point2d>& points) {
+  StaticObstacle obs;
+  obs.type = StaticObstacle::Type::POLYGON;
+  obs.polygon.points = points;
+  return obs;
+}
+
+// 暴力遍历所有障碍物作为参照
+std::vector<std::pair<int, uint32_t>> bruteForce(const OrientedBox& box,
+                                                 const std::vector<StaticObstacle>& statics,
+                                                 const DynamicObstacleStore& store) {
+  std::vector<std::pair<int, uint32_t>> hits;
+  for (uint32_t i = 0; i < statics.size(); ++i) {
+    const auto& obs = statics[i];
+    bool hit = obs.type == StaticObstacle::Type::CIRCLE
+        ? boxIntersectsCircle(box, obs.circle.center.x, obs.circle.center.y, obs.circle.radius)
+        : boxIntersectsPolygon(box, obs.polygon.points);
+    if (hit) hits.push_back({-1, i});
+  }
+  for (size_t m = 0; m < kMotionModelCount; ++m) {
+    const auto& block = store.block(static_cast<MotionModel>(m));
+    for (uint32_t row = 0; row < block.size(); ++row) {
+      bool hit = block.shape[row] == DynamicObstacle::Shape::CIRCLE
+          ? boxIntersectsCircle(box, block.x[row], block.y[row], block.radius[row])
+          : boxIntersectsBox(box, makeBox(block.x[row], block.y[row], block.yaw[row],
+                                          0.5 * block.height[row], 0.5 * block.width[row]));
+      if (hit) hits.push_back({static_cast<int>(m), row});
+    }
+  }
+  std::sort(hits.begin(), hits.end());
+  return hits;
+}
+
+std::vector<std::pair<int, uint32_t>> toPairs(const std::vector<CollisionWorld::Hit>& hits) {
+  std::vector<std::pair<int, uint32_t>> pairs;
+  for (const auto& hit : hits) {
+    int kind = hit.kind == CollisionWorld::Hit::Kind::STATIC ? -1 : static_cast<int>(hit.model);
+    pairs.push_back({kind, hit.index});
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+}  // namespace
+
+// ========== 窄相 ==========
+
+TEST(CollisionNarrowPhaseTest, BoxCircle) {
+  auto box = makeBox(0.0, 0.0, M_PI / 4.0, 1.0, 0.5);
+  EXPECT_TRUE(boxIntersectsCircle(box, 0.0, 0.0, 0.1));
+  // 沿长轴方向 1.0 + 0.2 处，半径 0.25 相交，0.15 不相交
+  const double d = 1.2;
+  EXPECT_TRUE(boxIntersectsCircle(box, d * std::cos(M_PI / 4), d * std::sin(M_PI / 4), 0.25));
+  EXPECT_FALSE(boxIntersectsCircle(box, d * std::cos(M_PI / 4), d * std::sin(M_PI / 4), 0.15));
+}
+
+TEST(CollisionNarrowPhaseTest, BoxBox) {
+  auto a = makeBox(0.0, 0.0, 0.0, 1.0, 1.0);
+  EXPECT_TRUE(boxIntersectsBox(a, makeBox(1.9, 0.0, 0.0, 1.0, 1.0)));
+  EXPECT_FALSE(boxIntersectsBox(a, makeBox(2.1, 0.0, 0.0, 1.0, 1.0)));
+  // 旋转 45° 后角点伸出 sqrt(2)，外接圆相交但 SAT 分离
+  EXPECT_TRUE(boxIntersectsBox(a, makeBox(2.3, 0.0, M_PI / 4.0, 1.0, 1.0)));
+  EXPECT_FALSE(boxIntersectsBox(a, makeBox(2.3, 2.3, 0.0, 1.0, 1.0)));
+}
+
+TEST(CollisionNarrowPhaseTest, BoxConcavePolygon) {
+  // U 形多边形，开口向上
+  std::vector<Point2d> u_shape = {{0, 0}, {6, 0}, {6, 6}, {4, 6}, {4, 2}, {2, 2}, {2, 6}, {0, 6}};
+  EXPECT_FALSE(boxIntersectsPolygon(makeBox(3.0, 4.0, 0.0, 0.5, 0.5), u_shape));  // 开口内
+  EXPECT_TRUE(boxIntersectsPolygon(makeBox(3.0, 2.2, 0.0, 0.5, 0.5), u_shape));   // 压到底边
+  EXPECT_TRUE(boxIntersectsPolygon(makeBox(1.0, 1.0, 0.0, 0.2, 0.2), u_shape));   // 完全在内部
+  EXPECT_FALSE(boxIntersectsPolygon(makeBox(8.0, 3.0, 0.0, 1.0, 1.0), u_shape));
+}
+
+// ========== 粗相与暴力遍历一致 ==========
+
+TEST(CollisionWorldTest, MatchesBruteForce) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> pos(-100.0, 100.0);
+  std::uniform_real_distribution<double> size(0.2, 3.0);
+  std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+
+  std::vector<StaticObstacle> statics;
+  for (int i = 0; i < 1500; ++i) {
+    double x = pos(rng), y = pos(rng), s = size(rng);
+    if (i % 3 == 0) {
+      statics.push_back(makePolygon({{x, y}, {x + s, y}, {x + s, y + 2 * s}, {x, y + s}}));
+    } else {
+      statics.emplace_back(Point2d{x, y}, s);
+    }
+  }
+  // 跨越大量格子的长条障碍物
+  statics.push_back(makePolygon({{-90, -1}, {90, -1}, {90, 1}, {-90, 1}}));
+
+  DynamicObstacleStore store;
+  for (int i = 0; i < 1500; ++i) {
+    DynamicObstacle obs(std::to_string(i));
+    obs.pose = {pos(rng), pos(rng), angle(rng)};
+    obs.twist = {size(rng), -size(rng), 0.3};
+    obs.model = static_cast<MotionModel>(i % 3);
+    if (i % 2 == 0) {
+      obs.shape = DynamicObstacle::Shape::RECTANGLE;
+      obs.width = size(rng);
+      obs.height = size(rng);
+    } else {
+      obs.radius = 0.5 * size(rng);
+    }
+    store.add(obs);
+  }
+
+  CollisionWorld world;
+  world.buildStatic(statics);
+  world.rebuildDynamic(store);
+  EXPECT_EQ(world.staticCount(), statics.size());
+  EXPECT_EQ(world.dynamicCount(), store.size());
+
+  auto check_queries = [&]() {
+    size_t total_hits = 0;
+    for (int q = 0; q < 300; ++q) {
+      auto box = makeBox(pos(rng), pos(rng), angle(rng), size(rng), size(rng));
+      std::vector<CollisionWorld::Hit> hits;
+      world.collect(box, store, hits);
+      auto expected = bruteForce(box, statics, store);
+      ASSERT_EQ(toPairs(hits), expected) << "query " << q;
+      EXPECT_EQ(world.collides(box, store), !expected.empty());
+      total_hits += expected.size();
+    }
+    EXPECT_GT(total_hits, 0u);
+  };
+
+  check_queries();
+
+  // 积分若干步后增量更新，结果仍与暴力遍历一致
+  for (int step = 0; step < 20; ++step) {
+    store.integrate(0.5);
+    world.updateDynamic(store);
+  }
+  check_queries();
+}
+
+// ========== LocalSimulator 集成 ==========
+
+TEST(LocalSimulatorCollisionTest, DetectsPolygonsAndReportsIds) {
+  LocalSimulator simulator;
+  SimulatorConfig config;
+  ASSERT_TRUE(simulator.initialize(config));
+
+  std::vector<std::string> hit_ids;
+  simulator.set_collision_callback([&](const std::string& id) { hit_ids.push_back(id); });
+
+  simulator.set_ego_pose({0.0, 0.0, 0.0});
+  simulator.add_static_obstacle(makePolygon({{1.0, -1.0}, {2.0, -1.0}, {2.0, 1.0}, {1.0, 1.0}}));
+  EXPECT_FALSE(simulator.check_collision());
+  EXPECT_TRUE(simulator.check_collision_at({1.0, 0.0, 0.0}));
+
+  DynamicObstacle walker("walker");
+  walker.pose = {-3.0, 0.0, 0.0};
+  walker.twist = {3.0, 0.0, 0.0};
+  walker.radius = 0.3;
+  simulator.add_dynamic_obstacle(walker);
+
+  simulator.start();
+  for (int i = 0; i < 10 && hit_ids.empty(); ++i) {
+    simulator.step(0.1);
+  }
+  ASSERT_FALSE(hit_ids.empty());
+  EXPECT_EQ(hit_ids.front(), "walker");
+
+  hit_ids.clear();
+  simulator.set_ego_pose({1.5, 0.0, 0.0});
+  simulator.step(0.0);
+  EXPECT_NE(std::find(hit_ids.begin(), hit_ids.end(), "static_0"), hit_ids.end());
+}
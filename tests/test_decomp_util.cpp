@@ -0,0 +1,193 @@
+/**
+ * @file test_decomp_util.cpp
+ * @brief DecompUtil 障碍物栅格与多面体复用测试
+ *
+ * 障碍物点在 set_obs 时按栅格分桶，每条线段只查询其局部包围盒附近的点；
+ * 路径只有微小移动时，仍不含障碍物的多面体在两次 dilate 之间复用。
+ */
+
+#include <decomp_util/ellipsoid_decomp.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief [-range, range]^2 内的伪随机障碍物点
+ */
+vec_Vec2f makeObstacles(int count, double range, unsigned seed) {
+  auto random = [&seed](double low, double high) {
+    seed = seed * 1103515245u + 12345u;
+    return low + (high - low) * ((seed >> 8) & 0xffff) / 65535.0;
+  };
+
+  vec_Vec2f obs;
+  for (int i = 0; i < count; ++i) {
+    Vec2f point(random(-range, range), random(-range, range));
+    if (std::abs(point(1)) > 0.6) {  // 沿 x 轴留出通道
+      obs.push_back(point);
+    }
+  }
+  return obs;
+}
+
+/**
+ * @brief 沿 x 轴的路径，y 方向偏移 offset
+ */
+vec_Vec2f makePath(double offset) {
+  vec_Vec2f path;
+  for (double x = -20.0; x <= 20.0; x += 1.0) {
+    path.emplace_back(x, offset + 0.1 * std::sin(x));
+  }
+  return path;
+}
+
+void expectSamePolyhedra(const vec_E<Polyhedron2D>& a, const vec_E<Polyhedron2D>& b) {
+  ASSERT_EQ(a.size(), b.size());
+  for (size_t i = 0; i < a.size(); ++i) {
+    ASSERT_EQ(a[i].vs_.size(), b[i].vs_.size()) << "polyhedron " << i;
+    for (size_t j = 0; j < a[i].vs_.size(); ++j) {
+      EXPECT_TRUE(a[i].vs_[j].p_.isApprox(b[i].vs_[j].p_)) << "polyhedron " << i;
+      EXPECT_TRUE(a[i].vs_[j].n_.isApprox(b[i].vs_[j].n_)) << "polyhedron " << i;
+    }
+  }
+}
+
+/**
+ * @brief 每个迭代在自己的线程中执行的并行循环，记录调用次数
+ */
+EllipsoidDecomp2D::Executor makeThreadExecutor(std::atomic<int>& calls) {
+  return [&calls](int n, const std::function<void(int)>& body) {
+    calls++;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n; ++i) {
+      threads.emplace_back(body, i);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+}
+
+/**
+ * @brief 没有障碍物点严格位于多面体内部
+ */
+void expectObstacleFree(const vec_E<Polyhedron2D>& polyhedra, const vec_Vec2f& obs) {
+  for (size_t i = 0; i < polyhedra.size(); ++i) {
+    for (const auto& point : obs) {
+      bool interior = true;
+      for (const auto& plane : polyhedra[i].vs_) {
+        interior = interior && plane.signed_dist(point) < -1e-6;
+      }
+      EXPECT_FALSE(interior) << "polyhedron " << i << " contains (" << point.transpose() << ")";
+    }
+  }
+}
+
+}  // namespace
+
+TEST(DecompUtilTest, GridQueryMatchesBruteForce) {
+  vec_Vec2f obs = makeObstacles(2000, 25.0, 3);
+  ObstacleGrid2D grid(obs, 1.0);
+
+  Vec2f lower(-3.3, 0.2), upper(4.1, 7.7);
+  vec_Vec2f expected;
+  for (const auto& point : obs) {
+    if ((point.array() >= lower.array()).all() && (point.array() <= upper.array()).all()) {
+      expected.push_back(point);
+    }
+  }
+
+  vec_Vec2f result = grid.points_in_box(lower, upper);
+  ASSERT_EQ(result.size(), expected.size());
+  for (size_t i = 0; i < result.size(); ++i) {
+    EXPECT_EQ(result[i], expected[i]);
+  }
+  EXPECT_TRUE(grid.points_in_box(Vec2f(100, 100), Vec2f(200, 200)).empty());
+}
+
+TEST(DecompUtilTest, GridDecompositionMatchesPointList) {
+  vec_Vec2f obs = makeObstacles(3000, 25.0, 7);
+  vec_Vec2f path = makePath(0.0);
+
+  // 逐段使用原始点列表（不经过栅格）的结果
+  vec_E<Polyhedron2D> expected;
+  for (size_t i = 0; i + 1 < path.size(); ++i) {
+    LineSegment2D line(path[i], path[i + 1]);
+    line.set_local_bbox(Vec2f(2.0, 2.0));
+    line.set_obs(obs);
+    line.dilate(0);
+    expected.push_back(line.get_polyhedron());
+  }
+
+  EllipsoidDecomp2D decomp;
+  decomp.set_local_bbox(Vec2f(2.0, 2.0));
+  decomp.set_obs(obs);
+  decomp.dilate(path, 0);
+  expectSamePolyhedra(decomp.get_polyhedrons(), expected);
+
+  // 并行路径：各线段在不同线程中膨胀，结果相同
+  std::atomic<int> calls{0};
+  decomp.set_executor(makeThreadExecutor(calls));
+  decomp.dilate(path, 0);
+  EXPECT_EQ(calls.load(), 1);
+  expectSamePolyhedra(decomp.get_polyhedrons(), expected);
+}
+
+TEST(DecompUtilTest, ReusesPolyhedraOfSlightlyMovedPath) {
+  vec_Vec2f obs = makeObstacles(3000, 25.0, 11);
+
+  EllipsoidDecomp2D decomp;
+  decomp.set_local_bbox(Vec2f(2.0, 2.0));
+  decomp.set_reuse_tolerance(0.1);
+  decomp.set_obs(obs);
+  std::atomic<int> calls{0};
+  decomp.set_executor(makeThreadExecutor(calls));
+
+  decomp.dilate(makePath(0.0), 0);
+  EXPECT_EQ(decomp.reused(), 0);
+
+  vec_Vec2f moved = makePath(0.05);
+  decomp.dilate(moved, 0);
+  EXPECT_GT(decomp.reused(), 0);
+  expectObstacleFree(decomp.get_polyhedrons(), obs);
+
+  // 每个多面体仍包含其线段
+  auto polyhedra = decomp.get_polyhedrons();
+  for (size_t i = 0; i + 1 < moved.size(); ++i) {
+    EXPECT_TRUE(polyhedra[i].inside(moved[i]));
+    EXPECT_TRUE(polyhedra[i].inside(moved[i + 1]));
+  }
+
+  // 移动超过容差时重新计算
+  decomp.dilate(makePath(0.3), 0);
+  EXPECT_EQ(decomp.reused(), 0);
+  EXPECT_EQ(calls.load(), 3);
+}
+
+TEST(DecompUtilTest, RecomputesWhenObstacleAppearsInside) {
+  vec_Vec2f obs = makeObstacles(3000, 25.0, 13);
+  vec_Vec2f path = makePath(0.0);
+
+  EllipsoidDecomp2D decomp;
+  decomp.set_local_bbox(Vec2f(2.0, 2.0));
+  decomp.set_reuse_tolerance(0.1);
+  decomp.set_obs(obs);
+  decomp.dilate(path, 0);
+  decomp.dilate(path, 0);
+  const int reused = decomp.reused();
+  EXPECT_EQ(reused, static_cast<int>(path.size()) - 1);
+
+  // 通道中出现一个障碍物：只有包含它的多面体重新计算
+  obs.emplace_back(0.5, 0.3);
+  decomp.set_obs(obs);
+  decomp.dilate(path, 0);
+  EXPECT_LT(decomp.reused(), reused);
+  EXPECT_GT(decomp.reused(), 0);
+  expectObstacleFree(decomp.get_polyhedrons(), obs);
+}
@@ -0,0 +1,151 @@
+/**
+ * @file test_guidance_homology.cpp
+ * @brief H-signature 比较缓存测试
+ *
+ * 分段积分缓存、并行预计算与跨帧复用不能改变比较结果：与每帧新建的 Homology 逐位一致；
+ * 静止障碍物的积分应在下一帧复用。
+ */
+
+#include <guidance_planner/environment.h>
+#include <guidance_planner/homotopy_comparison/homology.h>
+#include <guidance_planner/types/paths.h>
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+#include <vector>
+
+using namespace GuidancePlanner;
+
+namespace {
+
+/**
+ * @brief 起点 -> 中间节点 -> 终点的路径集合（节点保存在 list 中，指针稳定）
+ */
+struct PathSet {
+  std::list<Node> nodes;
+  std::vector<GeometricPath> paths;
+
+  explicit PathSet(std::mt19937& rng) {
+    std::uniform_real_distribution<double> xy(-8.0, 8.0);
+    std::uniform_real_distribution<double> time(3.0, Config::N - 3.0);
+
+    nodes.emplace_back(-1, SpaceTimePoint(0.0, 0.0, 0.0), NodeType::GUARD);
+    Node* start = &nodes.back();
+
+    std::vector<Node*> goals;
+    for (int g = 0; g < 2; ++g) {
+      nodes.emplace_back(-2, SpaceTimePoint(10.0, -2.0 + 4.0 * g, Config::N), NodeType::GOAL);
+      goals.push_back(&nodes.back());
+    }
+
+    for (int m = 0; m < 12; ++m) {
+      nodes.emplace_back(m, SpaceTimePoint(xy(rng), xy(rng), time(rng)), NodeType::CONNECTOR);
+      paths.emplace_back(std::vector<Node*>({start, &nodes.back(), goals[m % 2]}));
+    }
+  }
+};
+
+/**
+ * @brief 偶数号障碍物静止，奇数号匀速运动
+ */
+std::vector<Obstacle> makeObstacles(int tick) {
+  std::vector<Obstacle> obstacles;
+  for (int id = 0; id < 6; ++id) {
+    Eigen::Vector2d velocity = id % 2 == 0 ? Eigen::Vector2d::Zero() : Eigen::Vector2d(0.1, -0.05 * id);
+    Eigen::Vector2d position(-5.0 + 2.0 * id, id % 3 - 1.0);
+    obstacles.emplace_back(id, position + velocity * tick, velocity, 1.0, Config::N, 0.5);
+  }
+  return obstacles;
+}
+
+}  // namespace
+
+TEST(GuidanceHomologyTest, CachedComparisonsMatchFreshComputation) {
+  Config::N = 20;
+  std::mt19937 rng(11);
+  PathSet set(rng);
+
+  Homology homology;
+  Environment environment;
+  int reused = 0;
+  for (int tick = 0; tick < 3; ++tick) {
+    environment.LoadObstacles(makeObstacles(tick), {});
+    homology.Clear();
+
+    Homology fresh;
+    for (size_t i = 0; i < set.paths.size(); ++i) {
+      for (size_t j = i + 1; j < set.paths.size(); ++j) {
+        ASSERT_EQ(homology.AreEquivalent(set.paths[i], set.paths[j], environment),
+                  fresh.AreEquivalent(set.paths[i], set.paths[j], environment))
+            << "tick " << tick << ", paths " << i << " and " << j;
+        ASSERT_EQ(homology.GetCost(set.paths[i], set.paths[j], environment),
+                  fresh.GetCost(set.paths[i], set.paths[j], environment));
+      }
+    }
+
+    if (tick > 0) {
+      EXPECT_GT(homology.Reused(), 0) << "tick " << tick;
+    }
+    reused += homology.Reused();
+  }
+  EXPECT_GT(reused, 0);
+}
+
+TEST(GuidanceHomologyTest, PrepareCoversOrderedComparisons) {
+  Config::N = 20;
+  std::mt19937 rng(4);
+  PathSet set(rng);
+
+  Homology homology;
+  Environment environment;
+  environment.LoadObstacles(makeObstacles(0), {});
+  homology.Clear();
+
+  std::vector<const GeometricPath*> paths;
+  for (auto& path : set.paths) {
+    paths.push_back(&path);
+  }
+  homology.Prepare(paths, environment);
+  int computed = homology.Computed();
+  ASSERT_GT(computed, 0);
+
+  for (size_t i = 0; i < set.paths.size(); ++i) {
+    for (size_t j = i + 1; j < set.paths.size(); ++j) {
+      homology.AreEquivalent(set.paths[i], set.paths[j], environment);
+    }
+  }
+  EXPECT_EQ(homology.Computed(), computed);
+}
+
+TEST(GuidanceHomologyTest, DistinguishesSidesOfAnObstacle) {
+  Config::N = 20;
+
+  std::list<Node> nodes;
+  nodes.emplace_back(-1, SpaceTimePoint(0.0, 0.0, 0.0), NodeType::GUARD);
+  Node* start = &nodes.back();
+  nodes.emplace_back(-2, SpaceTimePoint(10.0, 0.0, Config::N), NodeType::GOAL);
+  Node* goal = &nodes.back();
+
+  std::vector<Node*> via;
+  for (double y : {3.0, 4.0, -3.0}) {
+    nodes.emplace_back(static_cast<int>(via.size()), SpaceTimePoint(5.0, y, Config::N / 2.0), NodeType::CONNECTOR);
+    via.push_back(&nodes.back());
+  }
+  GeometricPath left_a({start, via[0], goal});
+  GeometricPath left_b({start, via[1], goal});
+  GeometricPath right({start, via[2], goal});
+
+  Environment environment;
+  environment.LoadObstacles({Obstacle(0, Eigen::Vector2d(5.0, 0.0), Eigen::Vector2d::Zero(), 1.0, Config::N, 0.5)}, {});
+
+  Homology homology;
+  EXPECT_TRUE(homology.AreEquivalent(left_a, left_b, environment));
+  EXPECT_FALSE(homology.AreEquivalent(left_a, right, environment));
+
+  std::vector<double> signature_left = homology.HSignature(left_a, environment);
+  std::vector<double> signature_right = homology.HSignature(right, environment);
+  ASSERT_EQ(signature_left.size(), 1u);
+  EXPECT_GT(std::abs(signature_left[0] - signature_right[0]), 0.5);
+}
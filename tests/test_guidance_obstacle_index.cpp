@@ -0,0 +1,79 @@
+/**
+ * @file test_guidance_obstacle_index.cpp
+ * @brief 引导规划器障碍物时空索引测试
+ *
+ * 使用索引的碰撞 / 可见性查询必须与逐个障碍物检查的结果完全一致。
+ */
+
+#include <guidance_planner/environment.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace GuidancePlanner;
+
+namespace {
+
+/**
+ * @brief 随机障碍物：匀速、静止与大半径混合
+ */
+std::vector<Obstacle> makeObstacles(int count, std::mt19937& rng) {
+  std::uniform_real_distribution<double> xy(-20.0, 20.0);
+  std::uniform_real_distribution<double> velocity(-0.5, 0.5);
+  std::vector<Obstacle> obstacles;
+  for (int i = 0; i < count; ++i) {
+    Eigen::Vector2d pos(xy(rng), xy(rng));
+    Eigen::Vector2d vel = i % 5 == 0 ? Eigen::Vector2d::Zero() : Eigen::Vector2d(velocity(rng), velocity(rng));
+    double radius = i % 7 == 0 ? 2.0 : 0.5;
+    obstacles.emplace_back(i, pos, vel, 1.0, Config::N, radius);
+  }
+  return obstacles;
+}
+
+}  // namespace
+
+TEST(GuidanceObstacleIndexTest, QueriesMatchFullScan) {
+  Config::N = 20;
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<double> xy(-22.0, 22.0);
+  std::uniform_real_distribution<double> time(0.0, Config::N);
+
+  for (int count : {0, 1, 10, 80}) {
+    Environment indexed, full;
+    auto obstacles = makeObstacles(count, rng);
+    indexed.LoadObstacles(obstacles, {});
+    full.LoadObstacles(obstacles, {});
+    full.SetUseObstacleIndex(false);
+
+    for (int q = 0; q < 2000; ++q) {
+      SpaceTimePoint a(xy(rng), xy(rng), time(rng));
+      SpaceTimePoint b(xy(rng), xy(rng), time(rng));
+      if (q % 10 == 0) {
+        b.SetTime(a.Time());  // 时间不变的线段
+      }
+      const double margin = q % 3 == 0 ? 0.3 : 0.0;
+
+      ASSERT_EQ(indexed.InCollision(a, margin), full.InCollision(a, margin)) << count << " obstacles, query " << q;
+      ASSERT_EQ(indexed.IsVisible(a, b), full.IsVisible(a, b)) << count << " obstacles, query " << q;
+
+      double clearance = indexed.Clearance(a, b);
+      double expected = full.Clearance(a, b);
+      ASSERT_EQ(clearance < 0.0, expected < 0.0) << count << " obstacles, query " << q;
+      if (expected >= 0.0) {
+        EXPECT_DOUBLE_EQ(clearance, expected);
+      }
+    }
+  }
+}
+
+TEST(GuidanceObstacleIndexTest, ShortPredictionsFallBackToFullScan) {
+  Config::N = 20;
+  std::vector<Eigen::Vector2d> positions = {{0.0, 0.0}, {0.0, 0.0}};  // 少于 N + 1 个预测点
+  Environment environment;
+  environment.LoadObstacles({Obstacle(0, positions, 1.0)}, {});
+
+  EXPECT_FALSE(environment.IsVisible(SpaceTimePoint(-3.0, 0.0, 0.0), SpaceTimePoint(3.0, 0.0, 1.0)));
+  EXPECT_TRUE(environment.InCollision(SpaceTimePoint(0.5, 0.0, 1.0)));
+}
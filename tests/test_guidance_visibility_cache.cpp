@@ -0,0 +1,108 @@
+/**
+ * @file test_guidance_visibility_cache.cpp
+ * @brief PRM 可见性跨帧复用测试
+ *
+ * 节点随控制周期在时间轴上下移后，VisibilityCache 的结果必须与 Environment::IsVisible 完全一致；
+ * 障碍物预测前后一致时应复用上一帧的检查。
+ */
+
+#include <guidance_planner/environment.h>
+#include <guidance_planner/visibility_cache.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace GuidancePlanner;
+
+namespace {
+
+constexpr double kTimeShift = 1.5;  // 控制周期 / 离散步长，非整数
+
+/**
+ * @brief 第 tick 帧的障碍物预测：0 号匀速（预测前后一致），1 号每帧有随机偏移
+ */
+std::vector<Obstacle> makeObstacles(int tick, std::mt19937& rng) {
+  std::normal_distribution<double> noise(0.0, 0.05);
+  std::vector<Obstacle> obstacles;
+  for (int id = 0; id < 2; ++id) {
+    std::vector<Eigen::Vector2d> positions;
+    Eigen::Vector2d offset = id == 0 ? Eigen::Vector2d::Zero() : Eigen::Vector2d(noise(rng), noise(rng));
+    for (int k = 0; k <= Config::N; ++k) {
+      double t = tick * kTimeShift + k;
+      positions.emplace_back(id == 0 ? Eigen::Vector2d(-4.0 + 0.2 * t, 1.0) : Eigen::Vector2d(3.0, 5.0 - 0.3 * t) + offset);
+    }
+    obstacles.emplace_back(id, positions, 0.8);
+  }
+  return obstacles;
+}
+
+}  // namespace
+
+TEST(GuidanceVisibilityCacheTest, MatchesRayCastAcrossIterations) {
+  Config::N = 20;
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> xy(-6.0, 6.0);
+  std::uniform_real_distribution<double> time(2.0, Config::N);
+
+  Environment environment;
+  VisibilityCache cache;
+
+  std::vector<Node> nodes;
+  int reused = 0;
+  for (int tick = 0; tick < 6; ++tick) {
+    // 上一帧的节点下移一个控制周期，时间低于 1 的丢弃；再补充新采样
+    std::vector<Node> propagated;
+    for (auto& node : nodes) {
+      node.point_.Time() -= kTimeShift;
+      if (node.point_.Time() >= 1.0) {
+        propagated.push_back(node);
+      }
+    }
+    nodes = propagated;
+    while (nodes.size() < 30) {
+      Node node(0, SpaceTimePoint(xy(rng), xy(rng), time(rng)), NodeType::GUARD);
+      node.roadmap_key_ = cache.NewKey();
+      nodes.push_back(node);
+    }
+
+    std::vector<Obstacle> obstacles = makeObstacles(tick, rng);
+    environment.LoadObstacles(obstacles, {});
+    cache.Update(environment.GetDynamicObstacles(), kTimeShift, true);
+
+    for (size_t a = 0; a < nodes.size(); ++a) {
+      for (size_t b = a + 1; b < nodes.size(); ++b) {
+        ASSERT_EQ(cache.IsVisible(environment, nodes[a], nodes[b]), environment.IsVisible(nodes[a], nodes[b]))
+            << "tick " << tick << ", nodes " << a << " and " << b;
+      }
+    }
+    reused += cache.Reused();
+  }
+
+  EXPECT_GT(reused, 0);
+}
+
+TEST(GuidanceVisibilityCacheTest, DropsLinesWhenNodesWereNotPropagated) {
+  Config::N = 20;
+  std::mt19937 rng(3);
+
+  Environment environment;
+  VisibilityCache cache;
+
+  Node a(0, SpaceTimePoint(-5.0, -5.0, 2.0), NodeType::GUARD);
+  Node b(1, SpaceTimePoint(5.0, -5.0, 10.0), NodeType::GUARD);
+  a.roadmap_key_ = cache.NewKey();
+  b.roadmap_key_ = cache.NewKey();
+
+  environment.LoadObstacles(makeObstacles(0, rng), {});
+  cache.Update(environment.GetDynamicObstacles(), kTimeShift, true);
+  ASSERT_TRUE(cache.IsVisible(environment, a, b));
+
+  // 节点没有随时间下移：上一帧的结果不能再用
+  environment.LoadObstacles(makeObstacles(1, rng), {});
+  cache.Update(environment.GetDynamicObstacles(), kTimeShift, false);
+  EXPECT_EQ(cache.IsVisible(environment, a, b), environment.IsVisible(a, b));
+  EXPECT_EQ(cache.Reused(), 0);
+  EXPECT_EQ(cache.Checked(), 1);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file test_latency_metrics.cpp
+ * @brief 延迟直方图分位数精度、并发记录与导出格式测试
+ */
+
+#include "core/latency_metrics.hpp"
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace navsim::metrics;
+
+TEST(LatencyMetricsTest, BucketsCoverRangeContiguously) {
+  EXPECT_EQ(LatencyHistogram::bucketIndex(0), 0u);
+  EXPECT_EQ(LatencyHistogram::bucketIndex(15), 15u);
+  EXPECT_EQ(LatencyHistogram::bucketIndex(16), 16u);
+
+  // 每个桶的下界恰好是上一个桶的上界
+  uint64_t lower = 0;
+  for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+    uint64_t upper = LatencyHistogram::bucketUpperBound(i);
+    ASSERT_GT(upper, lower);
+    EXPECT_EQ(LatencyHistogram::bucketIndex(lower), i);
+    EXPECT_EQ(LatencyHistogram::bucketIndex(upper - 1), i);
+    lower = upper;
+  }
+  EXPECT_EQ(LatencyHistogram::bucketIndex(~0ull), LatencyHistogram::kBucketCount - 1);
+}
+
+TEST(LatencyMetricsTest, PercentilesWithinRelativeError) {
+  LatencyHistogram histogram;
+  for (int value = 1; value <= 10000; ++value) {
+    histogram.record(value);
+  }
+
+  auto snapshot = histogram.snapshot();
+  EXPECT_EQ(snapshot.count, 10000u);
+  EXPECT_EQ(snapshot.max_us, 10000u);
+  EXPECT_NEAR(snapshot.mean(), 5000.5, 1e-9);
+
+  const double tolerance = 1.0 / LatencyHistogram::kSubBuckets;
+  for (double quantile : {0.5, 0.9, 0.99}) {
+    double expected = quantile * 10000.0;
+    EXPECT_NEAR(snapshot.percentile(quantile), expected, expected * tolerance) << quantile;
+  }
+  EXPECT_EQ(snapshot.percentile(1.0), 10000.0);
+
+  histogram.reset();
+  EXPECT_EQ(histogram.snapshot().count, 0u);
+  EXPECT_EQ(histogram.snapshot().percentile(0.5), 0.0);
+}
+
+TEST(LatencyMetricsTest, ConcurrentRecording) {
+  LatencyMetrics metrics;
+  auto& stage = metrics.stage("planning");
+
+  constexpr int kThreads = 4;
+  constexpr int kSamples = 20000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&stage]() {
+      for (int i = 0; i < kSamples; ++i) {
+        // 每 100 个样本有 1 个超过 20ms 截止时间
+        stage.record(i % 100 == 0 ? 30.0 : 5.0, 20.0);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(&metrics.stage("planning"), &stage);
+  auto snapshot = stage.histogram.snapshot();
+  EXPECT_EQ(snapshot.count, static_cast<uint64_t>(kThreads * kSamples));
+  EXPECT_EQ(snapshot.max_us, 30000u);
+  EXPECT_EQ(stage.deadline_misses.load(), static_cast<uint64_t>(kThreads * kSamples / 100));
+}
+
+TEST(LatencyMetricsTest, JsonAndPrometheusExport) {
+  LatencyMetrics metrics;
+  auto& total = metrics.stage("total");
+  auto& plugin = metrics.stage("perception/GridMapBuilder");
+  for (int i = 0; i < 100; ++i) {
+    total.record(10.0, 25.0);
+    plugin.record(2.0);
+  }
+  total.record(40.0, 25.0);
+
+  auto json = metrics.toJson();
+  ASSERT_TRUE(json["stages"].contains("total"));
+  EXPECT_EQ(json["stages"]["total"]["count"].get<uint64_t>(), 101u);
+  EXPECT_EQ(json["stages"]["total"]["deadline_misses"].get<uint64_t>(), 1u);
+  EXPECT_NEAR(json["stages"]["total"]["p50_ms"].get<double>(), 10.0, 10.0 / LatencyHistogram::kSubBuckets);
+  EXPECT_DOUBLE_EQ(json["stages"]["total"]["max_ms"].get<double>(), 40.0);
+  EXPECT_EQ(json["stages"]["perception/GridMapBuilder"]["deadline_misses"].get<uint64_t>(), 0u);
+
+  std::string text = metrics.toPrometheus();
+  EXPECT_NE(text.find("# TYPE navsim_stage_latency_seconds summary"), std::string::npos);
+  EXPECT_NE(text.find("navsim_stage_latency_seconds_count{stage=\"total\"} 101"), std::string::npos);
+  EXPECT_NE(text.find("navsim_stage_deadline_misses_total{stage=\"total\"} 1"), std::string::npos);
+  EXPECT_NE(text.find("{stage=\"perception/GridMapBuilder\",quantile=\"0.99\"}"), std::string::npos);
+
+  const std::string prom_path = "/tmp/navsim_latency_metrics_test.prom";
+  ASSERT_TRUE(metrics.dump(prom_path));
+  std::ifstream prom_file(prom_path);
+  std::stringstream prom_content;
+  prom_content << prom_file.rdbuf();
+  EXPECT_EQ(prom_content.str(), text);
+
+  const std::string json_path = "/tmp/navsim_latency_metrics_test.json";
+  ASSERT_TRUE(metrics.dump(json_path));
+  std::ifstream json_file(json_path);
+  EXPECT_EQ(nlohmann::json::parse(json_file), json);
+}
@@ -4,9 +4,12 @@
  */
 
 #include "sim/local_simulator.hpp"
+#include "sim/ego_integrator.hpp"
 #include <gtest/gtest.h>
+#include <cmath>
 #include <fstream>
 #include <nlohmann/json.hpp>
+#include <thread>
 
 using namespace navsim::sim;
 using namespace navsim::planning;
@@ -152,7 +155,7 @@ TEST_F(LocalSimulatorTest, SimulationSteppingTest) {
   obs.id = "test_obs";
   obs.pose = {0.0, 0.0, 0.0};
   obs.twist = {1.0, 0.0, 0.0};  // 1 m/s 向前
-  obs.model = "cv";
+  obs.model = MotionModel::CV;
   simulator_->add_dynamic_obstacle(obs);
 
   simulator_->start();
@@ -186,7 +189,7 @@ TEST_F(LocalSimulatorTest, PausedSimulationTest) {
   obs.id = "test_obs";
   obs.pose = {0.0, 0.0, 0.0};
   obs.twist = {1.0, 0.0, 0.0};
-  obs.model = "cv";
+  obs.model = MotionModel::CV;
   simulator_->add_dynamic_obstacle(obs);
 
   // 保持暂停状态
@@ -332,6 +335,334 @@ TEST_F(LocalSimulatorTest, CallbackTest) {
   EXPECT_TRUE(frame_callback_called);
 }
 
+// ========== 动态障碍物存储测试 ==========
+
+TEST(DynamicObstacleStoreTest, ConstantVelocityAndAccelerationKernels) {
+  const double dt = 0.5;
+  DynamicObstacleStore store;
+
+  navsim::sim::DynamicObstacle cv("cv");
+  cv.twist = {1.0, 2.0, 0.0};
+  store.add(cv);
+
+  navsim::sim::DynamicObstacle ca("ca");
+  ca.model = MotionModel::CA;
+  ca.twist = {1.0, 0.0, 0.0};
+  ca.accel_x = 2.0;
+  ca.accel_y = -1.0;
+  store.add(ca);
+
+  navsim::sim::DynamicObstacle custom("custom");
+  custom.model = MotionModel::CUSTOM;
+  custom.pose = {3.0, 3.0, 0.0};
+  custom.twist = {1.0, 1.0, 1.0};
+  store.add(custom);
+
+  store.integrate(dt);
+
+  const auto& cv_block = store.block(MotionModel::CV);
+  EXPECT_DOUBLE_EQ(cv_block.x[0], 0.5);
+  EXPECT_DOUBLE_EQ(cv_block.y[0], 1.0);
+
+  const auto& ca_block = store.block(MotionModel::CA);
+  EXPECT_DOUBLE_EQ(ca_block.x[0], 1.0 * dt + 0.5 * 2.0 * dt * dt);
+  EXPECT_DOUBLE_EQ(ca_block.y[0], 0.5 * -1.0 * dt * dt);
+  EXPECT_DOUBLE_EQ(ca_block.vx[0], 2.0);
+  EXPECT_DOUBLE_EQ(ca_block.vy[0], -0.5);
+
+  // CUSTOM 由外部控制，不积分
+  const auto& custom_block = store.block(MotionModel::CUSTOM);
+  EXPECT_DOUBLE_EQ(custom_block.x[0], 3.0);
+  EXPECT_DOUBLE_EQ(custom_block.yaw[0], 0.0);
+}
+
+TEST(DynamicObstacleStoreTest, CtrvKernelFollowsArc) {
+  DynamicObstacleStore store;
+
+  // 半径 r = v / omega = 2m，转过 π/2 后到达 (r, r)
+  navsim::sim::DynamicObstacle ctrv("ctrv");
+  ctrv.model = MotionModel::CTRV;
+  ctrv.twist = {1.0, 0.0, 0.5};
+  store.add(ctrv);
+
+  // CTRV 为闭式解，分两步积分与一步积分结果一致
+  store.integrate(M_PI / 2.0);
+  store.integrate(M_PI / 2.0);
+
+  const auto& block = store.block(MotionModel::CTRV);
+  EXPECT_NEAR(block.x[0], 2.0, 1e-9);
+  EXPECT_NEAR(block.y[0], 2.0, 1e-9);
+  EXPECT_NEAR(block.yaw[0], M_PI / 2.0, 1e-9);
+  EXPECT_NEAR(block.vx[0], 0.0, 1e-9);
+  EXPECT_NEAR(block.vy[0], 1.0, 1e-9);
+}
+
+TEST(DynamicObstacleStoreTest, GroupsByModelAndInternsIds) {
+  DynamicObstacleStore store;
+
+  navsim::sim::DynamicObstacle a("7");
+  navsim::sim::DynamicObstacle b("ped_b");
+  b.model = MotionModel::CTRV;
+  navsim::sim::DynamicObstacle c("ped_c");
+  store.add(a);
+  store.add(b);
+  store.add(c);
+
+  // 按模型分块遍历：CV 块 (7, ped_c) 在 CTRV 块 (ped_b) 之前
+  ASSERT_EQ(store.size(), 3u);
+  EXPECT_EQ(store[0].id, "7");
+  EXPECT_EQ(store[1].id, "ped_c");
+  EXPECT_EQ(store[2].id, "ped_b");
+  EXPECT_EQ(store[2].model, MotionModel::CTRV);
+
+  // 纯数字 ID 保留数值，其它 ID 映射为负数
+  std::vector<navsim::planning::DynamicObstacle> planning_obstacles;
+  store.appendTo(planning_obstacles);
+  ASSERT_EQ(planning_obstacles.size(), 3u);
+  EXPECT_EQ(planning_obstacles[0].id, 7);
+  EXPECT_LT(planning_obstacles[1].id, 0);
+  EXPECT_NE(planning_obstacles[1].id, planning_obstacles[2].id);
+
+  EXPECT_TRUE(store.remove("7"));
+  EXPECT_FALSE(store.remove("missing"));
+  ASSERT_EQ(store.size(), 2u);
+  EXPECT_EQ(store[0].id, "ped_c");
+
+  MotionModel model;
+  EXPECT_TRUE(parseMotionModel("ctrv", model));
+  EXPECT_EQ(model, MotionModel::CTRV);
+  EXPECT_FALSE(parseMotionModel("unknown", model));
+}
+
+TEST_F(LocalSimulatorTest, DynamicObstacleBulkConversion) {
+  EXPECT_TRUE(simulator_->initialize(config_));
+
+  for (int i = 0; i < 1000; ++i) {
+    navsim::sim::DynamicObstacle obs("agent_" + std::to_string(i));
+    obs.pose = {static_cast<double>(i), 0.0, 0.0};
+    obs.twist = {1.0, 0.0, 0.0};
+    obs.model = (i % 2 == 0) ? MotionModel::CV : MotionModel::CA;
+    if (i % 3 == 0) {
+      obs.shape = navsim::sim::DynamicObstacle::Shape::RECTANGLE;
+      obs.width = 0.6;
+      obs.height = 1.2;
+    }
+    simulator_->add_dynamic_obstacle(obs);
+  }
+
+  simulator_->start();
+  EXPECT_TRUE(simulator_->step(0.1));
+
+  auto world_tick = simulator_->to_world_tick();
+  ASSERT_EQ(world_tick.dynamic_obstacles_size(), 1000);
+  EXPECT_EQ(world_tick.dynamic_obstacles(0).id(), "agent_0");
+  EXPECT_EQ(world_tick.dynamic_obstacles(0).model(), "cv");
+  EXPECT_NEAR(world_tick.dynamic_obstacles(0).pose().x(), 0.1, 1e-12);
+  EXPECT_TRUE(world_tick.dynamic_obstacles(0).shape().has_rectangle());
+  EXPECT_DOUBLE_EQ(world_tick.dynamic_obstacles(0).shape().rectangle().w(), 1.2);
+  EXPECT_EQ(world_tick.dynamic_obstacles(500).id(), "agent_1");
+  EXPECT_EQ(world_tick.dynamic_obstacles(500).model(), "ca");
+
+  // 非数字 ID 也能转换为 PlanningContext
+  auto context = simulator_->to_planning_context();
+  EXPECT_EQ(context.dynamic_obstacles.size(), 1000u);
+}
+
+// ========== 固定步长积分 ==========
+
+TEST(EgoIntegratorTest, HigherOrderMethodsFollowArc) {
+  // 恒定 v / omega 的精确解为圆弧
+  const double v = 2.0, omega = 1.0, dt = 0.1;
+  const Twist2d twist(v, 0.0, omega);
+  const EgoKinematics kinematics;
+
+  auto error_of = [&](IntegrationMethod method) {
+    Pose2d pose(0.0, 0.0, 0.0);
+    for (int i = 0; i < 20; ++i) {
+      pose = integrateEgoPose(pose, twist, kinematics, method, dt);
+    }
+    const double t = 20 * dt;
+    const double x = v / omega * std::sin(omega * t);
+    const double y = v / omega * (1.0 - std::cos(omega * t));
+    return std::hypot(pose.x - x, pose.y - y);
+  };
+
+  const double euler = error_of(IntegrationMethod::EULER);
+  const double midpoint = error_of(IntegrationMethod::MIDPOINT);
+  const double rk4 = error_of(IntegrationMethod::RK4);
+  EXPECT_GT(euler, 1e-2);
+  EXPECT_LT(midpoint, euler);
+  EXPECT_LT(rk4, midpoint);
+  EXPECT_LT(rk4, 1e-5);
+
+  IntegrationMethod method;
+  EXPECT_TRUE(parseIntegrationMethod("midpoint", method));
+  EXPECT_EQ(method, IntegrationMethod::MIDPOINT);
+  EXPECT_FALSE(parseIntegrationMethod("verlet", method));
+}
+
+TEST(EgoIntegratorTest, AckermannLimitsSteering) {
+  EgoKinematics kinematics;
+  kinematics.type = EgoKinematics::Type::ACKERMANN;
+  kinematics.wheelbase = 1.0;
+  kinematics.max_steer = 0.5;
+
+  // 请求的 omega 超过转角限制，实际横摆角速度为 v * tan(max_steer) / L
+  Pose2d pose = integrateEgoPose(Pose2d(0.0, 0.0, 0.0), Twist2d(1.0, 0.3, 5.0),
+                                 kinematics, IntegrationMethod::RK4, 0.1);
+  EXPECT_NEAR(pose.yaw, 0.1 * std::tan(0.5), 1e-9);
+  EXPECT_GT(pose.y, 0.0);  // 左转，vy 被忽略
+
+  // 静止时不能原地转向
+  pose = integrateEgoPose(Pose2d(0.0, 0.0, 0.0), Twist2d(0.0, 0.0, 1.0),
+                          kinematics, IntegrationMethod::RK4, 0.1);
+  EXPECT_DOUBLE_EQ(pose.yaw, 0.0);
+}
+
+TEST_F(LocalSimulatorTest, FixedStepIsIndependentOfFrameRate) {
+  auto run = [this](const std::vector<double>& frames) {
+    LocalSimulator simulator;
+    EXPECT_TRUE(simulator.initialize(config_));
+    simulator.set_ego_pose(Pose2d(0.0, 0.0, 0.0));
+    simulator.set_ego_twist(Twist2d(1.5, 0.0, 0.8));
+    simulator.start();
+    for (double dt : frames) {
+      simulator.step(dt);
+    }
+    return simulator.get_world_state();
+  };
+
+  // 总时长均为 1.0s：均匀 10ms 帧与抖动帧
+  std::vector<double> uniform(100, 0.01);
+  std::vector<double> jittered;
+  const double pattern[] = {0.013, 0.007, 0.031, 0.009, 0.040};
+  for (int i = 0; i < 10; ++i) {
+    jittered.insert(jittered.end(), std::begin(pattern), std::end(pattern));
+  }
+
+  auto a = run(uniform);
+  auto b = run(jittered);
+  EXPECT_EQ(a.ego_pose.x, b.ego_pose.x);
+  EXPECT_EQ(a.ego_pose.y, b.ego_pose.y);
+  EXPECT_EQ(a.ego_pose.yaw, b.ego_pose.yaw);
+  EXPECT_EQ(a.timestamp, b.timestamp);
+  EXPECT_NEAR(a.timestamp, 1.0, 1e-9);
+}
+
+TEST_F(LocalSimulatorTest, InterpolatedEgoPose) {
+  EXPECT_TRUE(simulator_->initialize(config_));
+  simulator_->set_ego_pose(Pose2d(0.0, 0.0, 0.0));
+  simulator_->set_ego_twist(Twist2d(1.0, 0.0, 0.0));
+  simulator_->start();
+
+  // 0.025s = 2 个子步 + 半个子步余量
+  simulator_->step(0.025);
+  EXPECT_NEAR(simulator_->get_simulation_time(), 0.02, 1e-12);
+  EXPECT_NEAR(simulator_->get_interpolation_alpha(), 0.5, 1e-9);
+
+  Pose2d pose = simulator_->get_interpolated_ego_pose();
+  EXPECT_NEAR(pose.x, 0.015, 1e-9);
+  EXPECT_NEAR(simulator_->get_world_state().ego_pose.x, 0.02, 1e-9);
+}
+
+// ========== 快照与分叉 ==========
+
+TEST_F(LocalSimulatorTest, SnapshotRestore) {
+  EXPECT_TRUE(simulator_->initialize(config_));
+  simulator_->set_ego_twist(Twist2d(1.0, 0.0, 0.5));
+  navsim::sim::DynamicObstacle walker("walker");
+  walker.twist = {0.5, 0.0, 0.0};
+  walker.pose = {5.0, 5.0, 0.0};
+  simulator_->add_dynamic_obstacle(walker);
+  simulator_->start();
+  simulator_->step(0.095);
+
+  auto snapshot = simulator_->snapshot();
+  ASSERT_TRUE(snapshot.valid());
+  const WorldState expected = simulator_->get_world_state();
+
+  for (int i = 0; i < 50; ++i) {
+    simulator_->step(0.02);
+  }
+  EXPECT_NE(simulator_->get_world_state().ego_pose.x, expected.ego_pose.x);
+
+  const uint64_t revision = simulator_->get_scene_revision();
+  ASSERT_TRUE(simulator_->restore(snapshot));
+  EXPECT_GT(simulator_->get_scene_revision(), revision);
+  EXPECT_TRUE(simulator_->is_running());
+  EXPECT_EQ(simulator_->get_world_state().ego_pose.x, expected.ego_pose.x);
+  EXPECT_EQ(simulator_->get_world_state().timestamp, expected.timestamp);
+  EXPECT_EQ(simulator_->get_world_state().dynamic_obstacles[0].pose.x,
+            expected.dynamic_obstacles[0].pose.x);
+  EXPECT_NEAR(simulator_->get_interpolation_alpha(), 0.5, 1e-6);
+
+  // 快照本身不随仿真器变化
+  simulator_->step(0.1);
+  EXPECT_EQ(snapshot.world_state().timestamp, expected.timestamp);
+
+  EXPECT_FALSE(simulator_->restore(SimulationSnapshot()));
+  EXPECT_EQ(LocalSimulator::from_snapshot(SimulationSnapshot()), nullptr);
+}
+
+TEST_F(LocalSimulatorTest, ParallelForkRollouts) {
+  EXPECT_TRUE(simulator_->initialize(config_));
+  StaticObstacle wall;
+  wall.type = StaticObstacle::Type::POLYGON;
+  wall.polygon.points = {{3.0, -5.0}, {3.5, -5.0}, {3.5, 5.0}, {3.0, 5.0}};
+  simulator_->add_static_obstacle(wall);
+  simulator_->set_ego_pose(Pose2d(0.0, 0.0, 0.0));
+  simulator_->start();
+
+  const auto snapshot = simulator_->snapshot();
+
+  // K 条候选控制：不同角速度，2 秒后只有直行的候选撞墙
+  const std::vector<double> omegas = {0.0, 0.4, 0.8, -0.8};
+  auto rollout = [&](double omega, Pose2d& final_pose, bool& collided) {
+    auto fork = LocalSimulator::from_snapshot(snapshot);
+    fork->set_collision_callback([&](const std::string&) { collided = true; });
+    fork->set_ego_twist(Twist2d(2.0, 0.0, omega));
+    for (int i = 0; i < 100; ++i) {
+      fork->step(0.02);
+    }
+    final_pose = fork->get_world_state().ego_pose;
+  };
+
+  std::vector<Pose2d> serial_pose(omegas.size());
+  std::vector<char> serial_hit(omegas.size(), 0);
+  for (size_t k = 0; k < omegas.size(); ++k) {
+    bool hit = false;
+    rollout(omegas[k], serial_pose[k], hit);
+    serial_hit[k] = hit;
+  }
+
+  std::vector<Pose2d> parallel_pose(omegas.size());
+  std::vector<char> parallel_hit(omegas.size(), 0);
+  std::vector<std::thread> threads;
+  for (size_t k = 0; k < omegas.size(); ++k) {
+    threads.emplace_back([&, k]() {
+      bool hit = false;
+      rollout(omegas[k], parallel_pose[k], hit);
+      parallel_hit[k] = hit;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t k = 0; k < omegas.size(); ++k) {
+    EXPECT_EQ(parallel_pose[k].x, serial_pose[k].x);
+    EXPECT_EQ(parallel_pose[k].y, serial_pose[k].y);
+    EXPECT_EQ(parallel_hit[k], serial_hit[k]);
+  }
+  EXPECT_TRUE(serial_hit[0]);
+  EXPECT_FALSE(serial_hit[2]);
+
+  // 源仿真器未被推进
+  EXPECT_EQ(simulator_->get_simulation_time(), 0.0);
+  EXPECT_EQ(simulator_->get_world_state().ego_pose.x, 0.0);
+  EXPECT_TRUE(simulator_->fork()->is_running());
+}
+
 // ========== 主函数 ==========
 
 int main(int argc, char** argv) {
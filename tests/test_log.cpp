@@ -0,0 +1,125 @@
+/**
+ * @file test_log.cpp
+ * @brief 异步日志的级别过滤、限频与多线程写出测试
+ */
+
+#include "core/log.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace navsim::log;
+
+namespace {
+
+size_t countLines(const std::string& text, const std::string& needle) {
+  size_t count = 0;
+  std::istringstream stream(text);
+  std::string line;
+  while (std::getline(stream, line)) {
+    if (line.find(needle) != std::string::npos) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+/**
+ * @brief 将日志写出重定向到字符串流，析构时恢复
+ */
+class CapturedLog {
+public:
+  CapturedLog() {
+    Logger::instance().setOutput(out_, err_);
+  }
+
+  ~CapturedLog() {
+    Logger::instance().setOutput(std::cout, std::cerr);
+    Logger::setLevel(Level::INFO);
+  }
+
+  std::string out() {
+    Logger::instance().flush();
+    return out_.str();
+  }
+
+  std::string err() {
+    Logger::instance().flush();
+    return err_.str();
+  }
+
+private:
+  std::ostringstream out_;
+  std::ostringstream err_;
+};
+
+int evaluated(int value, int& counter) {
+  ++counter;
+  return value;
+}
+
+}  // namespace
+
+TEST(LogTest, ParseLevel) {
+  Level level = Level::INFO;
+  EXPECT_TRUE(parseLevel("debug", level));
+  EXPECT_EQ(level, Level::DEBUG);
+  EXPECT_TRUE(parseLevel("off", level));
+  EXPECT_EQ(level, Level::OFF);
+  EXPECT_FALSE(parseLevel("verbose", level));
+}
+
+TEST(LogTest, LevelFilteringSkipsFormatting) {
+  CapturedLog capture;
+  Logger::setLevel(Level::INFO);
+
+  int evaluations = 0;
+  NAVSIM_LOG(DEBUG, "Test") << "hidden " << evaluated(1, evaluations);
+  NAVSIM_LOG(INFO, "Test") << "shown " << evaluated(2, evaluations);
+  NAVSIM_LOG(WARN, "Test") << "warning " << evaluated(3, evaluations);
+
+  EXPECT_EQ(evaluations, 2);
+  std::string out = capture.out();
+  EXPECT_EQ(out, "[Test] shown 2\n");
+  EXPECT_EQ(capture.err(), "[Test] warning 3\n");
+}
+
+TEST(LogTest, RateLimitedSites) {
+  CapturedLog capture;
+
+  for (int i = 0; i < 100; ++i) {
+    NAVSIM_LOG_EVERY_N(INFO, "EveryN", 10) << i;
+    NAVSIM_LOG_THROTTLE(INFO, "Throttle", 3600.0) << i;
+  }
+
+  std::string out = capture.out();
+  EXPECT_EQ(countLines(out, "[EveryN]"), 10u);
+  EXPECT_NE(out.find("[EveryN] 0\n"), std::string::npos);
+  EXPECT_NE(out.find("[EveryN] 90\n"), std::string::npos);
+  EXPECT_EQ(countLines(out, "[Throttle]"), 1u);
+}
+
+TEST(LogTest, ConcurrentProducers) {
+  CapturedLog capture;
+
+  constexpr int kThreads = 4;
+  constexpr int kMessages = 500;   // 总数小于队列容量，写出线程来不及时也不会丢弃
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < kMessages; ++i) {
+        NAVSIM_LOG(INFO, "Worker") << t << ":" << i;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::string out = capture.out();
+  EXPECT_EQ(countLines(out, "[Worker]"), static_cast<size_t>(kThreads * kMessages));
+  EXPECT_NE(out.find("[Worker] 3:499\n"), std::string::npos);
+  EXPECT_EQ(Logger::instance().droppedMessages(), 0u);
+}
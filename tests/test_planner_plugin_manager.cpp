@@ -0,0 +1,321 @@
+/**
+ * @file test_planner_plugin_manager.cpp
+ * @brief PlannerPluginManager 执行模式测试
+ */
+
+#include "plugin/framework/planner_plugin_manager.hpp"
+#include "plugin/framework/plugin_registry.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+using namespace navsim::plugin;
+using namespace navsim::planning;
+
+namespace {
+
+/**
+ * @brief 可配置耗时与结果的测试规划器
+ *
+ * 配置项：
+ * - delay_ms: 规划耗时，期间每 1ms 轮询一次取消
+ * - ignore_cancel: 不轮询取消（如 T-MPC），总是执行完 delay_ms
+ * - succeed: 是否返回成功
+ * - cost / constraints_satisfied: 写入结果，用于组合模式评分
+ */
+class MockPlanner : public PlannerPluginInterface {
+public:
+  PlannerPluginMetadata getMetadata() const override {
+    PlannerPluginMetadata metadata;
+    metadata.name = "MockPlanner";
+    return metadata;
+  }
+
+  bool initialize(const nlohmann::json& config) override {
+    delay_ms_ = config.value("delay_ms", 0);
+    ignore_cancel_ = config.value("ignore_cancel", false);
+    succeed_ = config.value("succeed", true);
+    cost_ = config.value("cost", 0.0);
+    constraints_satisfied_ = config.value("constraints_satisfied", true);
+    return true;
+  }
+
+  bool plan(const PlanningContext& context,
+            std::chrono::milliseconds deadline,
+            PlanningResult& result) override {
+    (void)context;
+    (void)deadline;
+    for (int i = 0; i < delay_ms_; ++i) {
+      if (!ignore_cancel_ && isCancelled()) {
+        result.success = false;
+        result.failure_reason = "Cancelled";
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    result.success = succeed_;
+    result.planner_name = name_;
+    result.total_cost = cost_;
+    result.constraints_satisfied = constraints_satisfied_;
+    result.failure_reason = succeed_ ? "" : "Mock failure";
+    return succeed_;
+  }
+
+  std::pair<bool, std::string> isAvailable(const PlanningContext& context) const override {
+    (void)context;
+    return {true, ""};
+  }
+
+  std::string name_ = "MockPlanner";
+
+private:
+  int delay_ms_ = 0;
+  bool ignore_cancel_ = false;
+  bool succeed_ = true;
+  double cost_ = 0.0;
+  bool constraints_satisfied_ = true;
+};
+
+class MockPrimary : public MockPlanner {
+public:
+  MockPrimary() { name_ = "MockPrimary"; }
+};
+
+std::atomic<int> g_fallback_calls{0};
+
+class MockFallback : public MockPlanner {
+public:
+  MockFallback() { name_ = "MockFallback"; }
+
+  bool plan(const PlanningContext& context,
+            std::chrono::milliseconds deadline,
+            PlanningResult& result) override {
+    g_fallback_calls++;
+    return MockPlanner::plan(context, deadline, result);
+  }
+};
+
+class MockAlternative : public MockPlanner {
+public:
+  MockAlternative() { name_ = "MockAlternative"; }
+};
+
+REGISTER_PLANNER_PLUGIN(MockPrimary)
+REGISTER_PLANNER_PLUGIN(MockFallback)
+REGISTER_PLANNER_PLUGIN(MockAlternative)
+
+}  // namespace
+
+class PlannerPluginManagerTest : public ::testing::Test {
+protected:
+  void load(int primary_delay_ms, bool primary_succeed,
+            int fallback_delay_ms, bool fallback_succeed,
+            PlannerPluginManager::ExecutionMode mode,
+            bool primary_ignores_cancel = false) {
+    nlohmann::json configs = {
+      {"MockPrimary", {{"delay_ms", primary_delay_ms}, {"succeed", primary_succeed},
+                       {"ignore_cancel", primary_ignores_cancel}}},
+      {"MockFallback", {{"delay_ms", fallback_delay_ms}, {"succeed", fallback_succeed}}}
+    };
+    ASSERT_TRUE(manager_.loadPlanners("MockPrimary", "MockFallback", true, configs));
+    ASSERT_TRUE(manager_.initialize());
+    manager_.setExecutionMode(mode);
+  }
+
+  PlannerPluginManager manager_;
+  PlanningContext context_;
+  PlanningResult result_;
+};
+
+TEST_F(PlannerPluginManagerTest, ParseExecutionMode) {
+  PlannerPluginManager::ExecutionMode mode;
+  EXPECT_TRUE(PlannerPluginManager::parseExecutionMode("race", mode));
+  EXPECT_EQ(mode, PlannerPluginManager::ExecutionMode::RACE);
+  EXPECT_TRUE(PlannerPluginManager::parseExecutionMode("sequential", mode));
+  EXPECT_EQ(mode, PlannerPluginManager::ExecutionMode::SEQUENTIAL);
+  EXPECT_TRUE(PlannerPluginManager::parseExecutionMode("portfolio", mode));
+  EXPECT_EQ(mode, PlannerPluginManager::ExecutionMode::PORTFOLIO);
+  EXPECT_FALSE(PlannerPluginManager::parseExecutionMode("unknown", mode));
+}
+
+TEST_F(PlannerPluginManagerTest, SequentialUsesFallbackAfterPrimaryFails) {
+  load(0, false, 0, true, PlannerPluginManager::ExecutionMode::SEQUENTIAL);
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(50), result_));
+  EXPECT_EQ(result_.planner_name, "MockFallback");
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["primary_failure"], 1);
+  EXPECT_EQ(stats["fallback_success"], 1);
+  EXPECT_FALSE(stats.contains("race"));
+}
+
+TEST_F(PlannerPluginManagerTest, RacePrimaryWinsAndCancelsFallback) {
+  load(0, true, 1000, true, PlannerPluginManager::ExecutionMode::RACE);
+
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(200), result_));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(result_.planner_name, "MockPrimary");
+  EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["race"]["primary_wins"], 1);
+  EXPECT_EQ(stats["race"]["fallback_wins"], 0);
+}
+
+TEST_F(PlannerPluginManagerTest, RaceFallbackWinsWhenPrimaryMissesDeadline) {
+  load(1000, true, 0, true, PlannerPluginManager::ExecutionMode::RACE);
+
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(20), result_));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(result_.planner_name, "MockFallback");
+  EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["race"]["fallback_wins"], 1);
+  EXPECT_EQ(stats["fallback_success"], 1);
+}
+
+TEST_F(PlannerPluginManagerTest, RaceDoesNotWaitForNonCooperativePrimary) {
+  load(300, true, 0, true, PlannerPluginManager::ExecutionMode::RACE, true);
+
+  // 主规划器不响应取消，plan() 仍在截止时间返回降级规划器结果
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(20), result_));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(result_.planner_name, "MockFallback");
+  EXPECT_LT(elapsed, std::chrono::milliseconds(150));
+
+  // 主规划器仍在后台执行：下一帧只运行降级规划器
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(20), result_));
+  EXPECT_EQ(result_.planner_name, "MockFallback");
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["race"]["primary_busy"], 1);
+  EXPECT_EQ(stats["primary_failure"], 0);
+
+  // 超时但成功的主规划器计为 primary_late，不计为失败
+  std::this_thread::sleep_for(std::chrono::milliseconds(400));
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(20), result_));
+  stats = manager_.getStatistics();
+  EXPECT_EQ(stats["race"]["primary_late"], 1);
+  EXPECT_EQ(stats["primary_failure"], 0);
+  EXPECT_EQ(stats["race"]["fallback_wins"], 3);
+}
+
+TEST_F(PlannerPluginManagerTest, RaceRecordsLatencySavedWhenPrimaryFails) {
+  load(10, false, 10, true, PlannerPluginManager::ExecutionMode::RACE);
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(200), result_));
+  EXPECT_EQ(result_.planner_name, "MockFallback");
+
+  auto stats = manager_.getStatistics();
+  EXPECT_GT(stats["race"]["latency_saved_ms"].get<double>(), 0.0);
+}
+
+TEST_F(PlannerPluginManagerTest, RaceReportsNoWinnerWhenBothFail) {
+  load(0, false, 0, false, PlannerPluginManager::ExecutionMode::RACE);
+
+  EXPECT_FALSE(manager_.plan(context_, std::chrono::milliseconds(50), result_));
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["race"]["no_winner"], 1);
+  EXPECT_EQ(stats["primary_failure"], 1);
+  EXPECT_EQ(stats["fallback_failure"], 1);
+}
+
+class PlannerPortfolioTest : public ::testing::Test {
+protected:
+  void load(const nlohmann::json& configs, bool fallback_succeed = true,
+            const std::vector<std::string>& portfolio = {"MockPrimary", "MockAlternative"}) {
+    nlohmann::json all_configs = configs;
+    all_configs["MockFallback"] = {{"succeed", fallback_succeed}};
+    ASSERT_TRUE(manager_.loadPlanners("MockPrimary", "MockFallback", true, all_configs));
+    ASSERT_TRUE(manager_.loadPortfolio(portfolio));
+    ASSERT_TRUE(manager_.initialize());
+    manager_.setExecutionMode(PlannerPluginManager::ExecutionMode::PORTFOLIO);
+  }
+
+  PlannerPluginManager manager_;
+  PlanningContext context_;
+  PlanningResult result_;
+};
+
+TEST_F(PlannerPortfolioTest, PicksLowestCost) {
+  load({{"MockPrimary", {{"cost", 5.0}}}, {"MockAlternative", {{"cost", 2.0}}}});
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(100), result_));
+  EXPECT_EQ(result_.planner_name, "MockAlternative");
+  EXPECT_DOUBLE_EQ(result_.metadata["portfolio_score"], 2.0);
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["portfolio"]["wins"]["MockAlternative"], 1);
+}
+
+TEST_F(PlannerPortfolioTest, PenalizesConstraintViolation) {
+  load({{"MockPrimary", {{"cost", 5.0}}},
+        {"MockAlternative", {{"cost", 2.0}, {"constraints_satisfied", false}}}});
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(100), result_));
+  EXPECT_EQ(result_.planner_name, "MockPrimary");
+}
+
+TEST_F(PlannerPortfolioTest, UsesCustomScoringFunction) {
+  load({{"MockPrimary", {{"cost", 5.0}}}, {"MockAlternative", {{"cost", 2.0}}}});
+  manager_.setScoringFunction([](const PlanningResult& result) { return -result.total_cost; });
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(100), result_));
+  EXPECT_EQ(result_.planner_name, "MockPrimary");
+}
+
+TEST_F(PlannerPortfolioTest, UsesClearanceFromEsdf) {
+  load({{"MockPrimary", {{"cost", 1.0}}}, {"MockAlternative", {{"cost", 1.0}}}});
+
+  context_.esdf_map = std::make_unique<ESDFMap>();
+  context_.esdf_map->config.origin = {0.0, 0.0};
+  context_.esdf_map->config.resolution = 1.0;
+  context_.esdf_map->config.width = 2;
+  context_.esdf_map->config.height = 1;
+  context_.esdf_map->config.max_distance = 5.0;
+  context_.esdf_map->data = {0.5, 5.0};
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(100), result_));
+  // 空轨迹不经过任何栅格，净空取 max_distance 并按 clearance_cap 截断
+  EXPECT_DOUBLE_EQ(result_.metadata["min_clearance"], 5.0);
+  EXPECT_DOUBLE_EQ(result_.metadata["portfolio_score"], 1.0 - 2.0);
+}
+
+TEST_F(PlannerPortfolioTest, FallsBackWhenPortfolioFails) {
+  load({{"MockPrimary", {{"succeed", false}}}, {"MockAlternative", {{"succeed", false}}}});
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(100), result_));
+  EXPECT_EQ(result_.planner_name, "MockFallback");
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["portfolio"]["no_winner"], 1);
+  EXPECT_EQ(stats["fallback_success"], 1);
+}
+
+TEST_F(PlannerPortfolioTest, DoesNotRerunFallbackMember) {
+  load({{"MockPrimary", {{"succeed", false}}}}, false, {"MockPrimary", "MockFallback"});
+  g_fallback_calls = 0;
+
+  // 降级规划器作为组合成员已经失败，不再重复执行
+  EXPECT_FALSE(manager_.plan(context_, std::chrono::milliseconds(100), result_));
+  EXPECT_EQ(g_fallback_calls.load(), 1);
+
+  auto stats = manager_.getStatistics();
+  EXPECT_EQ(stats["portfolio"]["no_winner"], 1);
+  EXPECT_EQ(stats["fallback_failure"], 0);
+}
+
+TEST_F(PlannerPortfolioTest, ExcludesLateResults) {
+  load({{"MockPrimary", {{"cost", 5.0}}}, {"MockAlternative", {{"cost", 1.0}, {"delay_ms", 1000}}}});
+
+  EXPECT_TRUE(manager_.plan(context_, std::chrono::milliseconds(30), result_));
+  EXPECT_EQ(result_.planner_name, "MockPrimary");
+}
@@ -0,0 +1,238 @@
+/**
+ * @file test_tick_allocations.cpp
+ * @brief 每帧数据通路的稳态堆分配测试
+ *
+ * 替换全局 operator new 统计分配次数：预热若干帧后，
+ * 前置处理 → PlanningContext::resetForTick → GridMapBuilder → ESDFBuilder
+ * 这条每帧通路不应再产生任何堆分配。
+ */
+
+#include "core/log.hpp"
+#include "core/planning_context.hpp"
+#include "esdf_builder_plugin.hpp"
+#include "grid_map_builder_plugin.hpp"
+#include "plugin/preprocessing/preprocessing.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<bool> g_counting{false};
+std::atomic<size_t> g_allocations{0};
+
+void* countedAlloc(size_t size) {
+  if (g_counting.load(std::memory_order_relaxed)) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+/**
+ * @brief 统计作用域内（当前进程所有线程）的堆分配次数
+ */
+class AllocationCounter {
+public:
+  AllocationCounter() {
+    g_allocations.store(0);
+    g_counting.store(true);
+  }
+  ~AllocationCounter() { g_counting.store(false); }
+
+  size_t count() const { return g_allocations.load(); }
+};
+
+}  // namespace
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+
+using namespace navsim;
+
+namespace {
+
+/**
+ * @brief 构造含静态地图、动态障碍物和底盘信息的 WorldTick
+ */
+void fillWorldTick(proto::WorldTick& tick) {
+  tick.set_tick_id(1);
+  tick.mutable_goal()->mutable_pose()->set_x(10.0);
+  tick.mutable_goal()->mutable_pose()->set_y(10.0);
+  tick.mutable_goal()->mutable_tol()->set_pos(0.5);
+  tick.mutable_goal()->mutable_tol()->set_yaw(0.2);
+
+  auto* chassis = tick.mutable_chassis();
+  chassis->set_model("differential");
+  chassis->mutable_limits()->set_v_max(1.5);
+  chassis->mutable_geometry()->set_body_length(0.6);
+  chassis->mutable_geometry()->set_body_width(0.5);
+
+  auto* static_map = tick.mutable_static_map();
+  static_map->set_resolution(0.1);
+  for (int i = 0; i < 12; ++i) {
+    auto* circle = static_map->add_circles();
+    circle->set_x(-10.0 + 2.0 * i);
+    circle->set_y(5.0);
+    circle->set_r(0.5);
+  }
+  for (int i = 0; i < 4; ++i) {
+    auto* polygon = static_map->add_polygons();
+    const double x = -8.0 + 5.0 * i;
+    for (const auto& corner : {std::make_pair(0.0, 0.0), std::make_pair(1.0, 0.0),
+                               std::make_pair(1.0, 1.0), std::make_pair(0.0, 1.0)}) {
+      auto* point = polygon->add_points();
+      point->set_x(x + corner.first);
+      point->set_y(-6.0 + corner.second);
+    }
+  }
+
+  for (int i = 0; i < 4; ++i) {
+    auto* obstacle = tick.add_dynamic_obstacles();
+    obstacle->set_id("dyn_" + std::to_string(i));
+    obstacle->set_model("cv");
+    obstacle->mutable_shape()->mutable_circle()->set_r(0.4);
+    obstacle->mutable_twist()->set_vx(0.5);
+  }
+}
+
+/**
+ * @brief 推进一帧：自车与动态障碍物移动，静态地图保持不变
+ */
+void advanceWorldTick(proto::WorldTick& tick, int frame) {
+  tick.set_tick_id(frame);
+  tick.set_stamp(0.05 * frame);
+  tick.mutable_ego()->mutable_pose()->set_x(0.05 * frame);
+  tick.mutable_ego()->mutable_pose()->set_yaw(0.01 * frame);
+  for (int i = 0; i < tick.dynamic_obstacles_size(); ++i) {
+    auto* pose = tick.mutable_dynamic_obstacles(i)->mutable_pose();
+    pose->set_x(-5.0 + 3.0 * i + 0.025 * frame);
+    pose->set_y(-2.0 + std::sin(0.1 * frame + i));
+  }
+}
+
+class TickAllocationTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    log::Logger::setLevel(log::Level::WARN);
+    fillWorldTick(world_tick_);
+  }
+
+  void TearDown() override {
+    log::Logger::setLevel(log::Level::INFO);
+  }
+
+  proto::WorldTick world_tick_;
+};
+
+}  // namespace
+
+TEST_F(TickAllocationTest, SteadyStateTickDoesNotAllocate) {
+  perception::PreprocessingPipeline pipeline;
+  plugin::PerceptionInput input;
+  planning::PlanningContext context;
+
+  plugins::perception::GridMapBuilderPlugin::Config grid_config;
+  grid_config.map_width = 30.0;
+  grid_config.map_height = 30.0;
+  plugins::perception::GridMapBuilderPlugin grid_builder(grid_config);
+
+  plugins::perception::ESDFBuilderPlugin esdf_builder;
+  ASSERT_TRUE(esdf_builder.initialize({{"resolution", 0.1},
+                                       {"map_width", 30.0},
+                                       {"map_height", 30.0},
+                                       {"max_distance", 5.0},
+                                       {"include_dynamic", true}}));
+
+  auto run_tick = [&](int frame) {
+    advanceWorldTick(world_tick_, frame);
+    pipeline.process(world_tick_, input);
+    input.raw_world_tick = &world_tick_;
+    context.resetForTick(input.ego, input.task, input.bev_obstacles, input.dynamic_obstacles);
+    bool ok = grid_builder.process(input, context);
+    ok = esdf_builder.process(input, context) && ok;
+    return ok;
+  };
+
+  // 预热：各容器增长到稳态容量
+  for (int frame = 1; frame <= 5; ++frame) {
+    ASSERT_TRUE(run_tick(frame));
+  }
+  ASSERT_EQ(input.bev_obstacles.circles.size(), 12u);
+  ASSERT_EQ(input.bev_obstacles.polygons.size(), 4u);
+  ASSERT_EQ(input.dynamic_obstacles.size(), 4u);
+  ASSERT_TRUE(context.occupancy_grid);
+  ASSERT_TRUE(context.esdf_map);
+
+  size_t allocations = 0;
+  bool ok = true;
+  {
+    AllocationCounter counter;
+    for (int frame = 6; frame <= 25; ++frame) {
+      ok = run_tick(frame) && ok;
+    }
+    allocations = counter.count();
+  }
+  EXPECT_TRUE(ok);
+  EXPECT_EQ(allocations, 0u);
+
+  // 复用存储不改变结果：与新建对象的单帧处理一致
+  plugin::PerceptionInput fresh_input = perception::PreprocessingPipeline().process(world_tick_);
+  EXPECT_EQ(fresh_input.bev_obstacles.circles.size(), input.bev_obstacles.circles.size());
+  ASSERT_EQ(fresh_input.dynamic_obstacles.size(), input.dynamic_obstacles.size());
+  for (size_t i = 0; i < input.dynamic_obstacles.size(); ++i) {
+    EXPECT_DOUBLE_EQ(fresh_input.dynamic_obstacles[i].current_pose.x, input.dynamic_obstacles[i].current_pose.x);
+    ASSERT_EQ(fresh_input.dynamic_obstacles[i].predicted_trajectories.size(),
+              input.dynamic_obstacles[i].predicted_trajectories.size());
+  }
+  EXPECT_EQ(context.dynamic_obstacles.size(), input.dynamic_obstacles.size());
+  ASSERT_TRUE(context.bev_obstacles);
+  EXPECT_EQ(context.bev_obstacles->polygons.size(), 4u);
+}
+
+TEST_F(TickAllocationTest, ResetForTickDropsStaleCustomData) {
+  planning::PlanningContext context;
+  context.setCustomData<int>("stale", std::make_shared<int>(1));
+  ASSERT_TRUE(context.hasCustomData("stale"));
+
+  planning::BEVObstacles empty_bev;
+  context.bev_obstacles = std::make_unique<planning::BEVObstacles>();
+  context.resetForTick(context.ego, context.task, empty_bev, {});
+
+  EXPECT_FALSE(context.hasCustomData("stale"));
+  EXPECT_EQ(context.getCustomData<int>("stale"), nullptr);
+  EXPECT_FALSE(context.bev_obstacles);
+}
+
+TEST_F(TickAllocationTest, ResetForTickDropsStaleMaps) {
+  planning::PlanningContext context;
+  planning::BEVObstacles empty_bev;
+
+  planning::OccupancyGrid* grid = &context.acquireOccupancyGrid();
+  planning::ESDFMap* esdf = &context.acquireESDFMap();
+  context.acquireLaneLines();
+  ASSERT_TRUE(context.occupancy_grid && context.esdf_map && context.lane_lines);
+
+  // 新的一帧：没有感知插件产出之前，规划器看不到上一帧的地图
+  context.resetForTick(context.ego, context.task, empty_bev, {});
+  EXPECT_FALSE(context.occupancy_grid);
+  EXPECT_FALSE(context.esdf_map);
+  EXPECT_FALSE(context.lane_lines);
+
+  // 感知插件取回的是上一帧的对象（复用存储）
+  EXPECT_EQ(&context.acquireOccupancyGrid(), grid);
+  EXPECT_EQ(&context.acquireESDFMap(), esdf);
+  EXPECT_EQ(context.occupancy_grid.get(), grid);
+  EXPECT_EQ(&context.acquireOccupancyGrid(), grid);
+}
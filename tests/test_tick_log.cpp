@@ -0,0 +1,147 @@
+/**
+ * @file test_tick_log.cpp
+ * @brief WorldTick 记录日志的写入、mmap 读取与尾部截断容错测试
+ */
+
+#include "core/tick_log.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+using namespace navsim;
+
+namespace {
+
+proto::TickRecord makeRecord(uint64_t sequence) {
+  proto::TickRecord record;
+  record.set_sequence(sequence);
+  record.set_recv_time(0.05 * sequence);
+  record.set_deadline_ms(25.0);
+  record.set_success(sequence % 2 == 0);
+
+  auto* tick = record.mutable_world_tick();
+  tick->set_tick_id(100 + sequence);
+  tick->set_stamp(1.5 + sequence);
+
+  auto* plan = record.mutable_plan_update();
+  plan->set_tick_id(100 + sequence);
+  for (uint64_t i = 0; i < sequence; ++i) {
+    auto* point = plan->add_trajectory();
+    point->set_x(static_cast<double>(i));
+    point->set_t(0.1 * i);
+  }
+
+  auto* timing = record.add_timings();
+  timing->set_stage("planning");
+  timing->set_latency_ms(3.0 + sequence);
+  return record;
+}
+
+}  // namespace
+
+TEST(TickLogTest, RoundTrip) {
+  const std::string path = "/tmp/navsim_tick_log_test.ticklog";
+  {
+    record::TickLogWriter writer;
+    ASSERT_TRUE(writer.open(path));
+    for (uint64_t i = 0; i < 20; ++i) {
+      ASSERT_TRUE(writer.append(makeRecord(i)));
+    }
+    EXPECT_EQ(writer.recordCount(), 20u);
+  }  // 析构时落盘
+
+  record::TickLogReader reader;
+  ASSERT_TRUE(reader.open(path));
+  ASSERT_EQ(reader.size(), 20u);
+  EXPECT_FALSE(reader.truncated());
+
+  // 随机访问
+  for (size_t i : {size_t{19}, size_t{0}, size_t{7}}) {
+    proto::TickRecord record;
+    ASSERT_TRUE(reader.read(i, record));
+    EXPECT_EQ(record.sequence(), i);
+    EXPECT_EQ(record.world_tick().tick_id(), 100 + i);
+    EXPECT_EQ(record.plan_update().trajectory_size(), static_cast<int>(i));
+    EXPECT_EQ(record.success(), i % 2 == 0);
+    ASSERT_EQ(record.timings_size(), 1);
+    EXPECT_DOUBLE_EQ(record.timings(0).latency_ms(), 3.0 + i);
+  }
+
+  proto::TickRecord record;
+  EXPECT_FALSE(reader.read(20, record));
+  std::remove(path.c_str());
+}
+
+TEST(TickLogTest, TruncatedTailIsIgnored) {
+  const std::string path = "/tmp/navsim_tick_log_truncated.ticklog";
+  {
+    record::TickLogWriter writer;
+    ASSERT_TRUE(writer.open(path));
+    for (uint64_t i = 0; i < 5; ++i) {
+      ASSERT_TRUE(writer.append(makeRecord(i + 3)));
+    }
+  }
+
+  // 模拟写入中途崩溃：截掉最后一条记录的一部分
+  auto size = std::filesystem::file_size(path);
+  std::filesystem::resize_file(path, size - 5);
+
+  record::TickLogReader reader;
+  ASSERT_TRUE(reader.open(path));
+  EXPECT_EQ(reader.size(), 4u);
+  EXPECT_TRUE(reader.truncated());
+
+  proto::TickRecord record;
+  ASSERT_TRUE(reader.read(3, record));
+  EXPECT_EQ(record.sequence(), 6u);
+  std::remove(path.c_str());
+}
+
+TEST(TickLogTest, FlushIntervalBoundsUnflushedRecords) {
+  const std::string path = "/tmp/navsim_tick_log_flush.ticklog";
+  record::TickLogWriter writer;
+  ASSERT_TRUE(writer.open(path));
+  EXPECT_EQ(writer.flushInterval(), 1u);
+
+  // 默认每条刷新：写入器未关闭时文件中已有完整记录
+  ASSERT_TRUE(writer.append(makeRecord(0)));
+  {
+    record::TickLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.size(), 1u);
+    EXPECT_FALSE(reader.truncated());
+  }
+
+  // 每 3 条刷新：记录总数到 3 时落盘
+  writer.setFlushInterval(3);
+  ASSERT_TRUE(writer.append(makeRecord(1)));
+  {
+    record::TickLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.size(), 1u);
+  }
+  ASSERT_TRUE(writer.append(makeRecord(2)));
+  {
+    record::TickLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.size(), 3u);
+  }
+
+  writer.close();
+  std::remove(path.c_str());
+}
+
+TEST(TickLogTest, RejectsForeignFiles) {
+  const std::string path = "/tmp/navsim_tick_log_foreign.json";
+  {
+    std::ofstream file(path);
+    file << "{\"not\": \"a tick log\"}";
+  }
+
+  record::TickLogReader reader;
+  EXPECT_FALSE(reader.open(path));
+  EXPECT_EQ(reader.size(), 0u);
+  EXPECT_FALSE(reader.open("/tmp/navsim_tick_log_missing.ticklog"));
+  std::remove(path.c_str());
+}
@@ -0,0 +1,131 @@
+/**
+ * @file test_tick_scheduler.cpp
+ * @brief TickScheduler 调度与统计测试
+ */
+
+#include "core/tick_scheduler.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace navsim;
+
+namespace {
+
+TickScheduler::Config makeConfig(double rate_hz, TickScheduler::CatchUpPolicy policy,
+                                 int max_burst_ticks = 3) {
+  TickScheduler::Config config;
+  config.rate_hz = rate_hz;
+  config.catch_up = policy;
+  config.max_burst_ticks = max_burst_ticks;
+  return config;
+}
+
+}  // namespace
+
+TEST(TickSchedulerTest, ParseCatchUpPolicy) {
+  TickScheduler::CatchUpPolicy policy;
+  EXPECT_TRUE(TickScheduler::parseCatchUpPolicy("skip", policy));
+  EXPECT_EQ(policy, TickScheduler::CatchUpPolicy::SKIP);
+  EXPECT_TRUE(TickScheduler::parseCatchUpPolicy("burst", policy));
+  EXPECT_EQ(policy, TickScheduler::CatchUpPolicy::BURST);
+  EXPECT_FALSE(TickScheduler::parseCatchUpPolicy("unknown", policy));
+}
+
+TEST(TickSchedulerTest, OnTimeTicksUseAbsoluteDeadlines) {
+  TickScheduler scheduler(makeConfig(100.0, TickScheduler::CatchUpPolicy::SKIP));
+  scheduler.start();
+
+  auto first = scheduler.waitForNextTick();
+  auto second = scheduler.waitForNextTick();
+
+  EXPECT_FALSE(second.overrun);
+  EXPECT_NEAR(second.dt, 0.01, 1e-9);
+  EXPECT_EQ(second.deadline - first.deadline, scheduler.period());
+  EXPECT_GE(TickScheduler::Clock::now(), second.deadline);
+
+  const auto& stats = scheduler.getStatistics();
+  EXPECT_EQ(stats.ticks, 2u);
+  EXPECT_EQ(stats.jitter_us.count, 2u);
+}
+
+TEST(TickSchedulerTest, SkipPolicyDropsMissedTicks) {
+  TickScheduler scheduler(makeConfig(100.0, TickScheduler::CatchUpPolicy::SKIP));
+  scheduler.start();
+  scheduler.waitForNextTick();
+
+  // 模拟一帧工作耗时约 3.5 个周期
+  std::this_thread::sleep_for(std::chrono::milliseconds(35));
+  auto tick = scheduler.waitForNextTick();
+
+  EXPECT_TRUE(tick.overrun);
+  EXPECT_GE(tick.skipped_ticks, 2u);
+  EXPECT_NEAR(tick.dt, 0.01 * (tick.skipped_ticks + 1), 1e-9);
+
+  const auto& stats = scheduler.getStatistics();
+  EXPECT_EQ(stats.overruns, 1u);
+  EXPECT_EQ(stats.skipped_ticks, tick.skipped_ticks);
+  EXPECT_EQ(stats.overrun_us.count, 1u);
+}
+
+TEST(TickSchedulerTest, BurstPolicyReplaysMissedTicksWithFixedDt) {
+  TickScheduler scheduler(makeConfig(100.0, TickScheduler::CatchUpPolicy::BURST, 10));
+  scheduler.start();
+  scheduler.waitForNextTick();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(35));
+  auto tick = scheduler.waitForNextTick();
+  EXPECT_TRUE(tick.overrun);
+  EXPECT_EQ(tick.skipped_ticks, 0u);
+  EXPECT_NEAR(tick.dt, 0.01, 1e-9);
+
+  // 补执行的节拍立即返回，每次 dt 均为一个周期；一直执行到追上进度
+  uint64_t replayed = 0;
+  for (int i = 0; i < 10; ++i) {
+    auto next = scheduler.waitForNextTick();
+    if (!next.overrun) {
+      break;
+    }
+    EXPECT_NEAR(next.dt, 0.01, 1e-9);
+    replayed++;
+  }
+
+  // 落后约 2.5 个周期：补执行 2 个节拍，每个只计数一次
+  EXPECT_EQ(replayed, 2u);
+  EXPECT_EQ(scheduler.getStatistics().skipped_ticks, 0u);
+  EXPECT_EQ(scheduler.getStatistics().burst_ticks, replayed);
+}
+
+TEST(TickSchedulerTest, BurstPolicyDropsBeyondLimit) {
+  TickScheduler scheduler(makeConfig(100.0, TickScheduler::CatchUpPolicy::BURST, 1));
+  scheduler.start();
+  scheduler.waitForNextTick();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(55));
+  auto tick = scheduler.waitForNextTick();
+
+  EXPECT_TRUE(tick.overrun);
+  EXPECT_GE(tick.skipped_ticks, 3u);
+  EXPECT_EQ(scheduler.getStatistics().burst_ticks, 1u);
+}
+
+TEST(TickSchedulerTest, OverrunHistogramRecordsLateness) {
+  TickScheduler scheduler(makeConfig(100.0, TickScheduler::CatchUpPolicy::SKIP));
+  scheduler.start();
+  scheduler.waitForNextTick();
+
+  // 超出下一个截止时间约 25ms
+  std::this_thread::sleep_for(std::chrono::milliseconds(35));
+  scheduler.waitForNextTick();
+
+  auto stats = scheduler.getStatistics();
+  ASSERT_EQ(stats.overrun_us.count, 1u);
+  EXPECT_GE(stats.overrun_us.max_us, 24000u);
+  EXPECT_DOUBLE_EQ(stats.overrun_us.percentile(1.0), static_cast<double>(stats.overrun_us.max_us));
+  EXPECT_EQ(stats.jitter_us.count, 1u);
+
+  scheduler.resetStatistics();
+  stats = scheduler.getStatistics();
+  EXPECT_EQ(stats.ticks, 0u);
+  EXPECT_EQ(stats.overrun_us.count, 0u);
+  EXPECT_EQ(stats.jitter_us.count, 0u);
+}
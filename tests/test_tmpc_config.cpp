@@ -0,0 +1,78 @@
+/**
+ * @file test_tmpc_config.cpp
+ * @brief T-MPC 类型化配置测试
+ *
+ * settings.yaml 只在 TMPCPlannerPlugin::initialize 时解析一次；
+ * 之后 plan() 中各模块只读取 PlannerConfig 字段，不应再访问 YAML 节点。
+ */
+
+#include "tmpc_planner_plugin.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace navsim;
+
+namespace {
+
+const std::string kConfigDir =
+    std::string(NAVSIM_SOURCE_DIR) + "/plugins/planning/t_mpc/algorithm/mpc_planner_jackalsimulator/config";
+
+/**
+ * @brief 自车朝目标行驶，前方有两个动态障碍物
+ */
+planning::PlanningContext makeContext(int frame) {
+  planning::PlanningContext context;
+  context.ego.pose = {0.1 * frame, 0.0, 0.0};
+  context.ego.twist.vx = 0.5;
+  context.task.goal_pose = {10.0, 0.0, 0.0};
+
+  for (int i = 0; i < 2; ++i) {
+    planning::DynamicObstacle obstacle;
+    obstacle.id = i;
+    obstacle.shape_type = "circle";
+    obstacle.length = 0.8;
+    obstacle.width = 0.8;
+    obstacle.current_pose = {4.0 + 2.0 * i, std::sin(0.1 * frame + i), 0.0};
+    obstacle.current_twist.vx = -0.3;
+    context.dynamic_obstacles.push_back(obstacle);
+  }
+  return context;
+}
+
+}  // namespace
+
+TEST(TMPCConfigTest, ParsesSettingsOnce) {
+  YAML::Node node = YAML::LoadFile(kConfigDir + "/settings.yaml");
+  PlannerConfig settings = PlannerConfig::fromYAML(node);
+
+  EXPECT_EQ(settings.N, node["N"].as<int>());
+  EXPECT_EQ(settings.max_obstacles, node["max_obstacles"].as<int>());
+  EXPECT_DOUBLE_EQ(settings.road.width, node["road"]["width"].as<double>());
+  EXPECT_EQ(settings.tmpc.use_tmpcpp, node["t-mpc"]["use_t-mpc++"].as<bool>());
+  EXPECT_DOUBLE_EQ(settings.weights.get("acceleration"), node["weights"]["acceleration"].as<double>());
+  EXPECT_THROW(settings.weights.get("not_a_weight"), std::runtime_error);
+
+  node.remove("max_obstacles");
+  EXPECT_THROW(PlannerConfig::fromYAML(node), std::runtime_error);
+}
+
+TEST(TMPCConfigTest, PlanDoesNotAccessYaml) {
+  tmpc_planner::adapter::TMPCPlannerPlugin planner;
+  ASSERT_TRUE(planner.initialize({{"config_dir", kConfigDir}, {"verbose", false}}));
+
+  // 第一帧可能触发延迟初始化，从第二帧开始统计
+  plugin::PlanningResult result;
+  auto context = makeContext(0);
+  planner.plan(context, std::chrono::milliseconds(100), result);
+
+  const size_t accesses = Configuration::getInstance().yamlAccessCount();
+  for (int frame = 1; frame <= 5; ++frame) {
+    context = makeContext(frame);
+    result = plugin::PlanningResult();
+    planner.plan(context, std::chrono::milliseconds(100), result);
+  }
+  EXPECT_EQ(Configuration::getInstance().yamlAccessCount(), accesses);
+}
@@ -0,0 +1,197 @@
+/**
+ * @file test_tmpc_reference_route.cpp
+ * @brief T-MPC 参考路线缓存测试
+ *
+ * 参考路线在 ESDF / 占据栅格上用 A* 规划，并在各帧之间复用；
+ * 只有目标移动、前方路线被地图阻塞或自车偏离路线时才重新规划。
+ */
+
+#include "reference_route.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace navsim;
+using tmpc_planner::adapter::ReferenceRoute;
+
+namespace {
+
+constexpr double kResolution = 0.2;
+constexpr int kSize = 150;  // 30 m x 30 m
+
+/**
+ * @brief 以自车为中心的 ESDF，x = wall_x 处有一堵墙（y < wall_top）
+ */
+planning::ESDFMap makeEsdf(const planning::Pose2d& ego, double wall_x, double wall_top) {
+  planning::ESDFMap esdf;
+  esdf.config.origin = {ego.x - kSize * kResolution / 2.0, ego.y - kSize * kResolution / 2.0};
+  esdf.config.resolution = kResolution;
+  esdf.config.width = kSize;
+  esdf.config.height = kSize;
+  esdf.config.max_distance = 5.0;
+  esdf.data.resize(kSize * kSize);
+
+  for (int y = 0; y < kSize; ++y) {
+    for (int x = 0; x < kSize; ++x) {
+      planning::Point2d p = esdf.cellToWorld(x, y);
+      double dy = std::max(0.0, p.y - wall_top);
+      double distance = std::hypot(p.x - wall_x, dy) - 0.3;
+      esdf.data[y * kSize + x] = std::min(distance, esdf.config.max_distance);
+    }
+  }
+  return esdf;
+}
+
+/**
+ * @brief 与 makeEsdf 相同的墙，以占据栅格表示
+ */
+planning::OccupancyGrid makeGrid(const planning::Pose2d& ego, double wall_x, double wall_top) {
+  planning::OccupancyGrid grid;
+  grid.config.origin = {ego.x - kSize * kResolution / 2.0, ego.y - kSize * kResolution / 2.0};
+  grid.config.resolution = kResolution;
+  grid.config.width = kSize;
+  grid.config.height = kSize;
+  grid.data.assign(kSize * kSize, 0);
+
+  for (int y = 0; y < kSize; ++y) {
+    for (int x = 0; x < kSize; ++x) {
+      planning::Point2d p = grid.cellToWorld(x, y);
+      if (std::abs(p.x + 0.5 * kResolution - wall_x) < 0.3 && p.y < wall_top) {
+        grid.data[y * kSize + x] = 100;
+      }
+    }
+  }
+  return grid;
+}
+
+/**
+ * @brief 路线点到墙的最小距离
+ */
+double minWallDistance(const ReferenceRoute& route, double wall_x, double wall_top) {
+  double nearest = 1e9;
+  for (const auto& point : route.points()) {
+    nearest = std::min(nearest, std::hypot(point.x - wall_x, std::max(0.0, point.y - wall_top)) - 0.3);
+  }
+  return nearest;
+}
+
+}  // namespace
+
+TEST(TMPCReferenceRouteTest, RouteAvoidsWallInEsdf) {
+  planning::Pose2d ego{0.0, 0.0, 0.0};
+  planning::Pose2d goal{10.0, 0.0, 0.0};
+  planning::ESDFMap esdf = makeEsdf(ego, 5.0, 3.0);
+
+  ReferenceRoute route;
+  ASSERT_TRUE(route.update(ego, goal, &esdf, nullptr));
+  ASSERT_TRUE(route.valid());
+  EXPECT_EQ(route.source(), ReferenceRoute::Source::ESDF);
+
+  // 直线会穿墙，路线必须从墙的上端绕过
+  EXPECT_GT(minWallDistance(route, 5.0, 3.0), route.config().clearance - kResolution);
+  EXPECT_NEAR(route.points().front().x, ego.x, 1e-6);
+  EXPECT_NEAR(route.points().back().x, goal.x, 1e-6);
+  EXPECT_NEAR(route.points().back().y, goal.y, 1e-6);
+
+  // 样条按弧长参数化
+  EXPECT_NEAR(route.spline()->parameterLength(), route.arcLengths().back(), 1e-9);
+}
+
+TEST(TMPCReferenceRouteTest, RouteAvoidsWallInOccupancyGrid) {
+  planning::Pose2d ego{0.0, 0.0, 0.0};
+  planning::Pose2d goal{10.0, 0.0, 0.0};
+  planning::OccupancyGrid grid = makeGrid(ego, 5.0, 3.0);
+
+  ReferenceRoute route;
+  ASSERT_TRUE(route.update(ego, goal, nullptr, &grid));
+  EXPECT_EQ(route.source(), ReferenceRoute::Source::OCCUPANCY);
+  EXPECT_GT(minWallDistance(route, 5.0, 3.0), route.config().clearance - 2.0 * kResolution);
+}
+
+TEST(TMPCReferenceRouteTest, ReusesRouteWhileFollowingIt) {
+  planning::Pose2d goal{10.0, 0.0, 0.0};
+  ReferenceRoute route;
+
+  planning::Pose2d ego{0.0, 0.0, 0.0};
+  planning::ESDFMap esdf = makeEsdf(ego, 5.0, 3.0);
+  ASSERT_TRUE(route.update(ego, goal, &esdf, nullptr));
+  auto spline = route.spline();
+
+  // 自车沿路线前进，地图随自车滚动
+  for (size_t i = 1; i < route.points().size() / 2; ++i) {
+    ego = route.points()[i];
+    esdf = makeEsdf(ego, 5.0, 3.0);
+    EXPECT_FALSE(route.update(ego, goal, &esdf, nullptr)) << "point " << i;
+  }
+  EXPECT_EQ(route.replans(), 1);
+  EXPECT_EQ(route.spline(), spline);
+}
+
+TEST(TMPCReferenceRouteTest, ReplansWhenGoalMoves) {
+  planning::Pose2d ego{0.0, 0.0, 0.0};
+  planning::ESDFMap esdf = makeEsdf(ego, 5.0, 3.0);
+
+  ReferenceRoute route;
+  ASSERT_TRUE(route.update(ego, {10.0, 0.0, 0.0}, &esdf, nullptr));
+  EXPECT_FALSE(route.update(ego, {10.2, 0.0, 0.0}, &esdf, nullptr));
+  EXPECT_TRUE(route.update(ego, {10.0, -4.0, 0.0}, &esdf, nullptr));
+  EXPECT_NEAR(route.points().back().y, -4.0, 1e-6);
+  EXPECT_EQ(route.replans(), 2);
+}
+
+TEST(TMPCReferenceRouteTest, ReplansWhenRouteIsBlocked) {
+  planning::Pose2d ego{0.0, 0.0, 0.0};
+  planning::Pose2d goal{10.0, 0.0, 0.0};
+
+  ReferenceRoute route;
+  planning::ESDFMap free_space = makeEsdf(ego, 50.0, 0.0);
+  ASSERT_TRUE(route.update(ego, goal, &free_space, nullptr));
+  EXPECT_FALSE(route.update(ego, goal, &free_space, nullptr));
+
+  // 前方出现墙：路线被阻塞，重新规划后绕开
+  planning::ESDFMap blocked = makeEsdf(ego, 5.0, 3.0);
+  EXPECT_TRUE(route.update(ego, goal, &blocked, nullptr));
+  EXPECT_GT(minWallDistance(route, 5.0, 3.0), route.config().clearance - kResolution);
+  EXPECT_FALSE(route.update(ego, goal, &blocked, nullptr));
+}
+
+TEST(TMPCReferenceRouteTest, ReplansWhenEgoLeavesRoute) {
+  planning::Pose2d goal{10.0, 0.0, 0.0};
+  ReferenceRoute route;
+  ASSERT_TRUE(route.update({0.0, 0.0, 0.0}, goal, nullptr, nullptr));
+  EXPECT_FALSE(route.update({1.0, 1.0, 0.0}, goal, nullptr, nullptr));
+  EXPECT_TRUE(route.update({1.0, 3.0, 0.0}, goal, nullptr, nullptr));
+  EXPECT_NEAR(route.points().front().y, 3.0, 1e-6);
+}
+
+TEST(TMPCReferenceRouteTest, StraightLineWithoutMap) {
+  planning::Pose2d ego{0.0, 0.0, 0.0};
+  planning::Pose2d goal{6.0, 8.0, 0.0};
+
+  ReferenceRoute route;
+  ASSERT_TRUE(route.update(ego, goal, nullptr, nullptr));
+  EXPECT_EQ(route.source(), ReferenceRoute::Source::STRAIGHT);
+  EXPECT_NEAR(route.arcLengths().back(), 10.0, 1e-6);
+  for (const auto& point : route.points()) {
+    EXPECT_NEAR(point.yaw, std::atan2(8.0, 6.0), 1e-6);
+  }
+
+  // 地图到达后改为在地图上规划
+  planning::ESDFMap esdf = makeEsdf(ego, 50.0, 0.0);
+  EXPECT_TRUE(route.update(ego, goal, &esdf, nullptr));
+  EXPECT_EQ(route.source(), ReferenceRoute::Source::ESDF);
+}
+
+TEST(TMPCReferenceRouteTest, LeavesMapTowardsDistantGoal) {
+  planning::Pose2d ego{0.0, 0.0, 0.0};
+  planning::Pose2d goal{60.0, 0.0, 0.0};
+  planning::ESDFMap esdf = makeEsdf(ego, 5.0, 3.0);
+
+  ReferenceRoute route;
+  ASSERT_TRUE(route.update(ego, goal, &esdf, nullptr));
+  EXPECT_EQ(route.source(), ReferenceRoute::Source::ESDF);
+  EXPECT_GT(minWallDistance(route, 5.0, 3.0), route.config().clearance - kResolution);
+  EXPECT_NEAR(route.points().back().x, goal.x, 1e-6);
+}
@@ -0,0 +1,104 @@
+/**
+ * @file test_tmpc_solver_arena.cpp
+ * @brief T-MPC 并行求解器内存池测试
+ *
+ * 各并行求解器放在同一块按页对齐的连续内存中，每个求解器由之后运行它的工作线程构造（首次写入），
+ * 返回的句柄保持内存池存活。
+ */
+
+#include <mpc_planner_solver/solver_arena.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using MPCPlanner::SolverArena;
+
+namespace {
+
+std::atomic<int> g_alive{0};
+
+/**
+ * @brief 模拟求解器：较大的参数数组，记录构造线程
+ */
+struct FakeSolver {
+  explicit FakeSolver(int solver_id) : id(solver_id), thread(std::this_thread::get_id()) {
+    if (solver_id < 0) {
+      throw std::runtime_error("invalid solver id");
+    }
+    for (double& value : parameters) {
+      value = solver_id;
+    }
+    g_alive++;
+  }
+
+  ~FakeSolver() { g_alive--; }
+
+  int id;
+  std::thread::id thread;
+  double parameters[1500];
+};
+
+}  // namespace
+
+TEST(TMPCSolverArenaTest, SolversShareOnePageAlignedArena) {
+  auto arena = SolverArena<FakeSolver>::create(1, 4);
+  ASSERT_EQ(arena->size(), 4);
+  EXPECT_EQ(g_alive.load(), 4);
+
+  EXPECT_EQ(arena->slotSize() % SolverArena<FakeSolver>::PAGE_SIZE, 0u);
+  EXPECT_GE(arena->slotSize(), sizeof(FakeSolver));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(arena->data()) % SolverArena<FakeSolver>::PAGE_SIZE, 0u);
+
+  for (int i = 0; i < arena->size(); ++i) {
+    auto solver = arena->get(i);
+    EXPECT_EQ(solver->id, i + 1);
+    EXPECT_EQ(solver->parameters[1499], i + 1);
+    EXPECT_EQ(reinterpret_cast<const char*>(solver.get()),
+              static_cast<const char*>(arena->data()) + i * arena->slotSize());
+  }
+}
+
+TEST(TMPCSolverArenaTest, HandlesKeepArenaAlive) {
+  std::shared_ptr<FakeSolver> solver;
+  {
+    auto arena = SolverArena<FakeSolver>::create(1, 3);
+    solver = arena->get(2);
+  }
+  EXPECT_EQ(g_alive.load(), 3);
+  EXPECT_EQ(solver->id, 3);
+
+  solver.reset();
+  EXPECT_EQ(g_alive.load(), 0);
+}
+
+TEST(TMPCSolverArenaTest, ExecutorConstructsEachSolver) {
+  // 每个迭代在自己的线程中执行，与工作线程池的固定映射相同
+  SolverArena<FakeSolver>::Executor executor = [](int n, const std::function<void(int)>& body) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n; ++i) {
+      threads.emplace_back(body, i);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  auto arena = SolverArena<FakeSolver>::create(1, 4, executor);
+  for (int i = 0; i < arena->size(); ++i) {
+    EXPECT_NE(arena->get(i)->thread, std::this_thread::get_id());
+    for (int j = 0; j < i; ++j) {
+      EXPECT_NE(arena->get(i)->thread, arena->get(j)->thread);
+    }
+  }
+}
+
+TEST(TMPCSolverArenaTest, FailedConstructionReleasesSolvers) {
+  // id 为 -1 的求解器构造失败，已构造的求解器被析构
+  EXPECT_THROW(SolverArena<FakeSolver>::create(-2, 4), std::runtime_error);
+  EXPECT_EQ(g_alive.load(), 0);
+}
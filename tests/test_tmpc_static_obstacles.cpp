@@ -0,0 +1,203 @@
+/**
+ * @file test_tmpc_static_obstacles.cpp
+ * @brief T-MPC 静态障碍物筛选测试
+ *
+ * 静态 BEV 障碍物的圆拟合按地图版本缓存；每帧只选取走廊（参考路线与自车预测位置）附近的障碍物，
+ * 按相关性排序填充障碍物槽位，相邻的圆合并为包含它们的圆；剩余槽位由离自车最近的其他圆填充。
+ */
+
+#include "static_obstacle_selector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace navsim;
+using tmpc_planner::adapter::StaticObstacleSelector;
+
+namespace {
+
+/**
+ * @brief 沿 x 轴、长 length 的直线走廊
+ */
+std::vector<StaticObstacleSelector::CorridorPoint> makeCorridor(double length) {
+  std::vector<StaticObstacleSelector::CorridorPoint> corridor;
+  for (double s = 0.0; s <= length; s += 0.5) {
+    corridor.push_back({Eigen::Vector2d(s, 0.0), s});
+  }
+  return corridor;
+}
+
+/**
+ * @brief circle 是否完全被 selected 中的某个圆覆盖
+ */
+bool isCovered(const StaticObstacleSelector::Circle& circle,
+               const std::vector<StaticObstacleSelector::Circle>& selected) {
+  for (const auto& other : selected) {
+    if ((circle.center - other.center).norm() + circle.radius <= other.radius + 1e-9) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+TEST(TMPCStaticObstaclesTest, KeepsObstaclesAlongCorridor) {
+  planning::BEVObstacles bev;
+  // 列表前部是远处的障碍物，原实现按列表顺序填满槽位后会丢弃走廊上的障碍物
+  for (int i = 0; i < 50; ++i) {
+    bev.circles.push_back({{-40.0 + 2.0 * i, 30.0}, 0.5});
+  }
+  bev.circles.push_back({{8.0, 1.0}, 0.5});
+  bev.circles.push_back({{4.0, -1.0}, 0.5});
+
+  StaticObstacleSelector selector;
+  ASSERT_TRUE(selector.update(bev));
+
+  std::vector<StaticObstacleSelector::Circle> selected;
+  selector.select(Eigen::Vector2d::Zero(), makeCorridor(15.0), 5, selected);
+
+  ASSERT_EQ(selected.size(), 5u);
+  EXPECT_EQ(selector.candidates(), 2);
+  // 离走廊同样近时，沿走廊更近的排在前面
+  EXPECT_NEAR(selected[0].center.x(), 4.0, 1e-9);
+  EXPECT_NEAR(selected[1].center.x(), 8.0, 1e-9);
+
+  // 剩余槽位：离自车最近的远处障碍物（距离相同时按列表顺序）
+  EXPECT_EQ(selector.filled(), 3);
+  EXPECT_NEAR(selected[2].center.x(), 0.0, 1e-9);
+  EXPECT_NEAR(selected[3].center.x(), -2.0, 1e-9);
+  EXPECT_NEAR(selected[4].center.x(), 2.0, 1e-9);
+  for (size_t i = 2; i < selected.size(); ++i) {
+    EXPECT_NEAR(selected[i].center.y(), 30.0, 1e-9);
+  }
+}
+
+TEST(TMPCStaticObstaclesTest, RanksByRelevanceWhenSlotsRunOut) {
+  planning::BEVObstacles bev;
+  for (int i = 0; i < 10; ++i) {
+    bev.circles.push_back({{14.0 - 1.5 * i, 2.0}, 0.3});
+  }
+  bev.circles.push_back({{3.0, 0.5}, 0.3});  // 紧贴走廊
+
+  StaticObstacleSelector selector;
+  selector.update(bev);
+
+  std::vector<StaticObstacleSelector::Circle> selected;
+  selector.select(Eigen::Vector2d::Zero(), makeCorridor(15.0), 3, selected);
+
+  ASSERT_EQ(selected.size(), 3u);
+  EXPECT_NEAR(selected[0].center.x(), 3.0, 1e-9);
+  EXPECT_EQ(selector.dropped(), 8);
+  EXPECT_EQ(selector.filled(), 0);
+  // 其余按沿走廊的距离排序
+  EXPECT_NEAR(selected[1].center.x(), 0.5, 1e-9);
+  EXPECT_NEAR(selected[2].center.x(), 2.0, 1e-9);
+}
+
+TEST(TMPCStaticObstaclesTest, MergesClusteredObstaclesConservatively) {
+  planning::BEVObstacles bev;
+  bev.circles.push_back({{5.0, 1.0}, 0.2});
+  bev.circles.push_back({{5.5, 1.0}, 0.2});  // 间隙 0.1 m
+  bev.circles.push_back({{5.0, -2.0}, 0.2});  // 另一侧，单独保留
+
+  StaticObstacleSelector selector;
+  selector.update(bev);
+
+  std::vector<StaticObstacleSelector::Circle> selected;
+  selector.select(Eigen::Vector2d::Zero(), makeCorridor(10.0), 10, selected);
+
+  ASSERT_EQ(selected.size(), 2u);
+  EXPECT_EQ(selector.merged(), 1);
+  for (const auto& circle : selector.circles()) {
+    EXPECT_TRUE(isCovered(circle, selected));
+  }
+  for (const auto& circle : selected) {
+    EXPECT_LE(circle.radius, selector.config().max_merge_radius + 1e-9);
+  }
+}
+
+TEST(TMPCStaticObstaclesTest, RectangleCentrelineIsCoveredByCircles) {
+  planning::BEVObstacles bev;
+  bev.rectangles.push_back({{6.0, 1.5, M_PI / 2.0}, 4.0, 1.0});  // 长边沿 y 轴
+
+  StaticObstacleSelector::Config config;
+  config.merge_gap = -1.0;  // 不合并
+  StaticObstacleSelector selector;
+  selector.setConfig(config);
+  selector.update(bev);
+
+  // 圆沿长轴排布、半径为短边的一半：覆盖中心线，不覆盖矩形的四个角
+  ASSERT_EQ(selector.circles().size(), 4u);
+  for (double t : {-2.0, -1.0, 0.0, 1.0, 2.0}) {
+    Eigen::Vector2d point(6.0, 1.5 + t * 0.99);
+    bool covered = false;
+    for (const auto& circle : selector.circles()) {
+      covered = covered || (point - circle.center).norm() <= circle.radius + 1e-9;
+    }
+    EXPECT_TRUE(covered) << "t = " << t;
+  }
+}
+
+TEST(TMPCStaticObstaclesTest, FitsAreCachedPerMapVersion) {
+  planning::BEVObstacles bev;
+  bev.circles.push_back({{5.0, 1.0}, 0.5});
+  planning::BEVObstacles::Polygon polygon;
+  polygon.vertices = {{3.0, -1.0}, {4.0, -1.0}, {3.5, -2.0}};
+  bev.polygons.push_back(polygon);
+
+  StaticObstacleSelector selector;
+  EXPECT_TRUE(selector.update(bev));
+  EXPECT_FALSE(selector.update(bev));
+  EXPECT_FALSE(selector.update(planning::BEVObstacles(bev)));
+  EXPECT_EQ(selector.fits(), 1);
+
+  bev.polygons[0].vertices[2].y = -2.5;
+  EXPECT_TRUE(selector.update(bev));
+  EXPECT_EQ(selector.fits(), 2);
+
+  selector.reset();
+  EXPECT_TRUE(selector.update(bev));
+}
+
+TEST(TMPCStaticObstaclesTest, IndexMatchesBruteForce) {
+  planning::BEVObstacles bev;
+  unsigned seed = 5;
+  auto random = [&seed](double low, double high) {
+    seed = seed * 1103515245u + 12345u;
+    return low + (high - low) * ((seed >> 8) & 0xffff) / 65535.0;
+  };
+  for (int i = 0; i < 400; ++i) {
+    bev.circles.push_back({{random(-200.0, 200.0), random(-50.0, 50.0)}, random(0.1, 1.5)});
+  }
+
+  StaticObstacleSelector::Config config;
+  config.merge_gap = -1e9;  // 不合并，逐个比较
+  StaticObstacleSelector selector;
+  selector.setConfig(config);
+  selector.update(bev);
+
+  std::vector<StaticObstacleSelector::CorridorPoint> corridor;
+  for (double s = 0.0; s <= 60.0; s += 0.5) {
+    corridor.push_back({Eigen::Vector2d(-30.0 + s, 0.2 * s - 5.0), s});
+  }
+
+  std::vector<StaticObstacleSelector::Circle> selected;
+  selector.select(Eigen::Vector2d::Zero(), corridor, 1000, selected);
+
+  int expected = 0;
+  for (const auto& circle : selector.circles()) {
+    bool near = false;
+    for (const auto& point : corridor) {
+      near = near || (circle.center - point.position).norm() - circle.radius <= config.corridor_width;
+    }
+    expected += near ? 1 : 0;
+  }
+  EXPECT_GT(expected, 0);
+  EXPECT_EQ(selector.candidates(), expected);
+  // 槽位足够：其余的圆全部按离自车的距离补入
+  EXPECT_EQ(selected.size(), selector.circles().size());
+  EXPECT_EQ(selector.filled(), static_cast<int>(selector.circles().size()) - expected);
+}
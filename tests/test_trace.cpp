@@ -0,0 +1,111 @@
+/**
+ * @file test_trace.cpp
+ * @brief Tracer 多线程记录与 Chrome trace 导出测试
+ */
+
+#include "core/trace.hpp"
+#include <gtest/gtest.h>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <thread>
+
+using namespace navsim::trace;
+
+namespace {
+
+nlohmann::json readTrace(const std::string& path) {
+  std::ifstream file(path);
+  return nlohmann::json::parse(file);
+}
+
+}  // namespace
+
+TEST(TraceTest, DisabledRecordsNothing) {
+  ASSERT_FALSE(Tracer::enabled());
+  {
+    NAVSIM_TRACE_SCOPE("test", "ignored");
+  }
+
+  const std::string path = "/tmp/navsim_trace_disabled.json";
+  ASSERT_TRUE(Tracer::instance().start(path));
+  Tracer::instance().stop();
+  EXPECT_EQ(Tracer::instance().writtenEvents(), 0u);
+
+  auto trace = readTrace(path);
+  for (const auto& event : trace["traceEvents"]) {
+    EXPECT_NE(event["ph"], "X");
+  }
+}
+
+TEST(TraceTest, MultiThreadExport) {
+  const std::string path = "/tmp/navsim_trace_threads.json";
+  ASSERT_TRUE(Tracer::instance().start(path, std::chrono::milliseconds(5)));
+  Tracer::instance().setThreadName("main");
+
+  constexpr int kThreads = 4;
+  constexpr int kEventsPerThread = 2000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([t]() {
+      Tracer::instance().setThreadName("worker_" + std::to_string(t));
+      const std::string name = "stage_" + std::to_string(t);
+      for (int i = 0; i < kEventsPerThread; ++i) {
+        NAVSIM_TRACE_SCOPE("test", name);
+      }
+    });
+  }
+  {
+    TraceScope outer("test", "outer \"quoted\"");
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  Tracer::instance().stop();
+
+  const uint64_t dropped = Tracer::instance().droppedEvents();
+  EXPECT_EQ(Tracer::instance().writtenEvents() + dropped, kThreads * kEventsPerThread + 1u);
+
+  auto trace = readTrace(path);
+  EXPECT_EQ(trace["otherData"]["dropped_events"].get<uint64_t>(), dropped);
+
+  std::map<std::string, int> counts;
+  std::map<int, std::string> thread_names;
+  for (const auto& event : trace["traceEvents"]) {
+    if (event["ph"] == "X") {
+      EXPECT_GE(event["ts"].get<double>(), 0.0);
+      EXPECT_GE(event["dur"].get<double>(), 0.0);
+      counts[event["name"].get<std::string>()]++;
+    } else if (event["name"] == "thread_name") {
+      thread_names[event["tid"].get<int>()] = event["args"]["name"].get<std::string>();
+    }
+  }
+
+  int total = 0;
+  for (int t = 0; t < kThreads; ++t) {
+    total += counts["stage_" + std::to_string(t)];
+  }
+  EXPECT_EQ(total + dropped, static_cast<uint64_t>(kThreads * kEventsPerThread));
+  EXPECT_EQ(counts["outer \"quoted\""], 1);
+  EXPECT_EQ(thread_names.size(), kThreads + 1u);
+}
+
+TEST(TraceTest, ScopeEndedEarlyRecordsOnce) {
+  const std::string path = "/tmp/navsim_trace_end.json";
+  ASSERT_TRUE(Tracer::instance().start(path));
+  {
+    TraceScope scope("test", "early");
+    scope.end();
+    scope.end();
+  }
+  Tracer::instance().stop();
+  EXPECT_EQ(Tracer::instance().writtenEvents(), 1u);
+
+  // 停止后记录的事件不会出现在下一次会话中
+  {
+    NAVSIM_TRACE_SCOPE("test", "after_stop");
+  }
+  ASSERT_TRUE(Tracer::instance().start(path));
+  Tracer::instance().stop();
+  EXPECT_EQ(Tracer::instance().writtenEvents(), 0u);
+}
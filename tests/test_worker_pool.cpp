@@ -0,0 +1,73 @@
+/**
+ * @file test_worker_pool.cpp
+ * @brief 共享工作线程池：任务覆盖、固定线程分配、嵌套调用与异常传递测试
+ */
+
+#include "core/worker_pool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace navsim::worker;
+
+TEST(WorkerPoolTest, RunsEveryIndexOnce) {
+  WorkerPool pool({4, {}});
+  std::vector<std::atomic<int>> hits(100);
+  pool.parallelFor(hits.size(), [&](size_t i) { hits[i]++; });
+
+  for (auto& hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+}
+
+TEST(WorkerPoolTest, IndexStaysOnSameThread) {
+  WorkerPool pool({3, {}});
+  const size_t n = 6;
+  std::vector<std::thread::id> first(n), second(n);
+
+  pool.parallelFor(n, [&](size_t i) { first[i] = std::this_thread::get_id(); });
+  pool.parallelFor(n, [&](size_t i) { second[i] = std::this_thread::get_id(); });
+
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(first[i], second[i]);
+    EXPECT_EQ(first[i], first[i % pool.size()]);
+    EXPECT_NE(first[i], std::this_thread::get_id());
+  }
+}
+
+TEST(WorkerPoolTest, NestedCallRunsInline) {
+  WorkerPool pool({2, {}});
+  std::atomic<int> inline_runs{0};
+
+  pool.parallelFor(2, [&](size_t) {
+    EXPECT_TRUE(pool.isWorkerThread());
+    const auto outer = std::this_thread::get_id();
+    pool.parallelFor(4, [&](size_t) {
+      if (std::this_thread::get_id() == outer) {
+        inline_runs++;
+      }
+    });
+  });
+
+  EXPECT_EQ(inline_runs.load(), 8);
+  EXPECT_FALSE(pool.isWorkerThread());
+}
+
+TEST(WorkerPoolTest, RethrowsExceptionAfterAllFinish) {
+  WorkerPool pool({4, {}});
+  std::atomic<int> finished{0};
+
+  EXPECT_THROW(pool.parallelFor(8, [&](size_t i) {
+    if (i == 3) {
+      throw std::runtime_error("solver failed");
+    }
+    finished++;
+  }), std::runtime_error);
+  EXPECT_EQ(finished.load(), 7);
+
+  // 异常之后线程池仍可用
+  pool.parallelFor(8, [&](size_t) { finished++; });
+  EXPECT_EQ(finished.load(), 15);
+}
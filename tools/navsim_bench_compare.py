@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""
+NavSim Bench Compare Tool
+
+对比两次 navsim_bench 的 JSON 结果，找出性能回退。
+
+用法:
+    # 在两个提交上分别运行（建议 Release 构建、固定 CPU 频率）
+    ./build/navsim_bench --benchmark_repetitions=5 \\
+        --benchmark_out=base.json --benchmark_out_format=json
+    ./build/navsim_bench --benchmark_repetitions=5 \\
+        --benchmark_out=head.json --benchmark_out_format=json
+
+    # 对比，耗时增加超过 10% 的基准视为回退（退出码 1）
+    python3 tools/navsim_bench_compare.py base.json head.json --threshold 0.10
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+from typing import Dict
+
+# Google Benchmark 的 time_unit 换算到纳秒
+UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path: Path, metric: str) -> Dict[str, float]:
+    """读取每个基准的耗时（纳秒）；有重复运行时取 median 聚合结果"""
+    with open(path) as f:
+        data = json.load(f)
+
+    times = {}
+    medians = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("error_occurred"):
+            continue
+        name = bench.get("run_name", bench["name"])
+        value = bench[metric] * UNIT_TO_NS[bench.get("time_unit", "ns")]
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[name] = value
+        else:
+            # 无聚合结果时使用最后一次运行
+            times[name] = value
+
+    times.update(medians)
+    return times
+
+
+def format_ns(value: float) -> str:
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if value >= scale:
+            return f"{value / scale:.3f} {unit}"
+    return f"{value:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="NavSim Bench Compare Tool",
+        formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+
+    parser.add_argument("baseline", type=Path, help="Baseline navsim_bench JSON output")
+    parser.add_argument("contender", type=Path, help="Contender navsim_bench JSON output")
+
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.10,
+        help="Relative slowdown treated as a regression (default: 0.10)"
+    )
+
+    parser.add_argument(
+        "--metric",
+        choices=["real_time", "cpu_time"],
+        default="cpu_time",
+        help="Time metric to compare (default: cpu_time)"
+    )
+
+    parser.add_argument(
+        "--filter",
+        default="",
+        help="Only compare benchmarks whose name contains this string"
+    )
+
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    contender = load_times(args.contender, args.metric)
+
+    names = [n for n in baseline if n in contender and args.filter in n]
+    if not names:
+        print("No common benchmarks to compare")
+        return 1
+
+    width = max(len(n) for n in names)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Contender':>12}  {'Change':>8}")
+    print("-" * (width + 40))
+
+    regressions = []
+    for name in names:
+        base = baseline[name]
+        head = contender[name]
+        change = (head - base) / base if base > 0 else 0.0
+        marker = ""
+        if change > args.threshold:
+            marker = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            marker = "  improved"
+        print(f"{name:<{width}}  {format_ns(base):>12}  {format_ns(head):>12}  {change:>+7.1%}{marker}")
+
+    missing = sorted(n for n in set(baseline) - set(contender) if args.filter in n)
+    if missing:
+        print(f"\nMissing in contender ({len(missing)}):")
+        for name in missing:
+            print(f"  {name}")
+
+    print(f"\n{len(regressions)} regression(s) over {args.threshold:.0%} out of {len(names)} benchmarks")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())